@@ -0,0 +1,560 @@
+/*
+ * bench_cases.c - neg_bench Case Registry
+ *
+ * One entry per kernel. Cells per run() call:
+ *
+ *   hyd.thomas_solve     nx*ny columns of nz layers        (micro)
+ *   hyd.barrier_field    nx*ny*nz values                   (micro)
+ *   se3.pose_compose     nx*ny poses                       (micro)
+ *   hash.sha256          nx*ny*nz float values             (micro)
+ *   hash.state           nx*ny*nz scalar field values      (micro)
+ *   hyd.richards_step    nx*ny*nz cells, dry surface       (macro)
+ *   hyd.richards_ponded  nx*ny*nz cells, surface flow on   (macro)
+ *   atm.biotic_pump      ny transects of nx cells          (macro)
+ *   reg.regv2_cascade    nx*ny surface cells, REGv2 SOM    (macro)
+ *   io.snapshot          nx*ny*nz values, save + restore   (macro)
+ *
+ * The SE(3) pose update stands in for the integrators: the RKMK /
+ * Clebsch modules under src/core/integrators are not part of the core
+ * library build yet. Surface flow is static inside the Richards-Lite
+ * step, so it is measured as a whole step with a ponded, connected
+ * surface rather than in isolation.
+ *
+ * Initial conditions follow tests/physics_integration_benchmark.c
+ * (LoessPlateau.json, degraded state).
+ *
+ * Author: ClaudeCode (benchmark harness)
+ * Version: 1.0
+ */
+
+#include "neg_bench.h"
+
+#include "../src/core/state.h"
+#include "../embedded/se3_batch.h"
+#include "../embedded/sha256.h"
+#include "../include/barrier_field.h"
+#include "../src/solvers/hydrology_richards_lite.h"
+#include "../src/solvers/hydrology_richards_lite_internal.h"
+#include "../src/solvers/atmosphere_biotic.h"
+#include "../src/solvers/regeneration_cascade.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef NEG_BENCH_CONFIG_DIR
+#define NEG_BENCH_CONFIG_DIR "config/parameters"
+#endif
+
+/* Richards-Lite stack scratch limits (hydrology_richards_lite.c) */
+#define RICHARDS_MAX_ROW     1024
+#define RICHARDS_MAX_LAYERS  256
+
+/* ========================================================================
+ * HELPERS
+ * ======================================================================== */
+
+/* Deterministic LCG so every run sees the same fields */
+static uint32_t lcg_next(uint32_t* state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+static float lcg_unit(uint32_t* state) {
+    return (float)(lcg_next(state) >> 8) / 16777216.0f;
+}
+
+static void free_data(BenchContext* ctx) {
+    free(ctx->data);
+    ctx->data = NULL;
+}
+
+/** Degraded Loess Plateau cell (tests/physics_integration_benchmark.c) */
+static void init_cell(Cell* cell) {
+    memset(cell, 0, sizeof(*cell));
+    cell->theta = 0.12f;
+    cell->psi = -10.0f;
+    cell->K_s = 5.0e-6f;
+    cell->alpha_vG = 1.5f;
+    cell->n_vG = 1.4f;
+    cell->theta_s = 0.45f;
+    cell->theta_r = 0.05f;
+    cell->M_K_zz = 1.0f;
+    cell->M_K_xx = 1.0f;
+    cell->kappa_evap = 1.0f;
+    cell->zeta_c = 0.005f;
+    cell->a_c = 0.5f;
+    cell->vegetation_cover = 0.15f;
+    cell->SOM_percent = 0.5f;
+    cell->vegetation_cover_fxp = (int32_t)(0.15f * 65536.0f);
+    cell->SOM_percent_fxp = (int32_t)(0.5f * 65536.0f);
+    cell->porosity_eff = 0.45f;
+    cell->K_tensor[0] = 5.0e-6f;
+    cell->K_tensor[4] = 5.0e-6f;
+    cell->K_tensor[8] = 5.0e-6f;
+    cell->dz = 0.2f;
+    cell->dx = 10.0f;
+    cell->soil_temp_C = 15.0f;
+    cell->Phi_agg = 0.5f;
+    cell->FB_ratio = 0.5f;
+    cell->O2 = 1.0f;
+    cell->theta_deep = 0.05f;
+}
+
+static void init_hyd_params(RichardsLiteParams* p) {
+    p->K_r = 1.0e-4f;
+    p->phi_r = 0.5f;
+    p->l_r = 0.005f;
+    p->b_T = 1.5f;
+    p->E_bare_ref = 5.0e-7f;
+    p->dt_max = 3600.0f;
+    p->CFL_factor = 0.5f;
+    p->picard_tol = 1.0e-4f;
+    p->picard_max_iter = 20;
+    p->use_free_drainage = 1;
+}
+
+/* ========================================================================
+ * hyd.thomas_solve
+ * ======================================================================== */
+
+typedef struct {
+    int columns;
+    float* a;
+    float* b;
+    float* c;
+    float* d;
+    float* x;
+} ThomasData;
+
+static int thomas_setup(BenchContext* ctx) {
+    if (ctx->nz < 2 || ctx->nz > RICHARDS_MAX_LAYERS) return -1;
+
+    size_t n = (size_t)ctx->nx * ctx->ny * ctx->nz;
+    ThomasData* t = (ThomasData*)calloc(1, sizeof(ThomasData) + 5 * n * sizeof(float));
+    if (!t) return -1;
+
+    t->columns = ctx->nx * ctx->ny;
+    t->a = (float*)(t + 1);
+    t->b = t->a + n;
+    t->c = t->b + n;
+    t->d = t->c + n;
+    t->x = t->d + n;
+
+    /* Implicit diffusion: diagonally dominant, like solve_vertical_implicit */
+    uint32_t rng = 12345u;
+    for (size_t i = 0; i < n; i++) {
+        float coeff = 0.1f + lcg_unit(&rng);
+        t->a[i] = -coeff;
+        t->c[i] = -coeff;
+        t->b[i] = 1.0f + 2.0f * coeff;
+        t->d[i] = 0.05f + 0.4f * lcg_unit(&rng);
+    }
+
+    ctx->data = t;
+    ctx->cells = n;
+    ctx->bytes = 5 * n * sizeof(float);
+    return 0;
+}
+
+static void thomas_run(BenchContext* ctx) {
+    ThomasData* t = (ThomasData*)ctx->data;
+    int nz = ctx->nz;
+    for (int col = 0; col < t->columns; col++) {
+        size_t base = (size_t)col * nz;
+        thomas_algorithm(t->a + base, t->b + base, t->c + base, t->d + base, t->x + base, nz);
+    }
+}
+
+/* ========================================================================
+ * hyd.barrier_field
+ * ======================================================================== */
+
+typedef struct {
+    float* x;
+    float* lo;
+    float* hi;
+    float* value;
+    float* grad;
+} BarrierData;
+
+static const BarrierFieldParamsF k_bench_barrier = { 8.0f, 1e-6f, 1e6f };
+
+static int barrier_setup(BenchContext* ctx) {
+    size_t n = (size_t)ctx->nx * ctx->ny * ctx->nz;
+    BarrierData* b = (BarrierData*)calloc(1, sizeof(BarrierData) + 5 * n * sizeof(float));
+    if (!b) return -1;
+
+    b->x = (float*)(b + 1);
+    b->lo = b->x + n;
+    b->hi = b->lo + n;
+    b->value = b->hi + n;
+    b->grad = b->value + n;
+
+    uint32_t rng = 777u;
+    for (size_t i = 0; i < n; i++) {
+        b->lo[i] = 0.02f + 0.08f * lcg_unit(&rng);
+        b->hi[i] = 0.35f + 0.15f * lcg_unit(&rng);
+        b->x[i] = b->lo[i] + (b->hi[i] - b->lo[i]) * lcg_unit(&rng);
+    }
+
+    ctx->data = b;
+    ctx->cells = n;
+    ctx->bytes = 5 * n * sizeof(float);
+    return 0;
+}
+
+static void barrier_run(BenchContext* ctx) {
+    BarrierData* b = (BarrierData*)ctx->data;
+    barrier_field_bounded_f(b->x, b->lo, b->hi, (int)ctx->cells, &k_bench_barrier,
+                            b->value, b->grad);
+}
+
+/* ========================================================================
+ * se3.pose_compose
+ * ======================================================================== */
+
+typedef struct {
+    mat3_soa_t R;
+    mat3_soa_t dR;
+    vec3_soa_t v;
+    vec3_soa_t dt;
+    fixed_t* buf;
+} PoseData;
+
+static int pose_setup(BenchContext* ctx) {
+    int n = ctx->nx * ctx->ny;
+    PoseData* p = (PoseData*)calloc(1, sizeof(PoseData));
+    if (!p) return -1;
+    p->buf = (fixed_t*)calloc((size_t)24 * n, sizeof(fixed_t));
+    if (!p->buf) {
+        free(p);
+        return -1;
+    }
+
+    se3_init_tables();
+    mat3_soa_bind(&p->R, p->buf, n);
+    mat3_soa_bind(&p->dR, p->buf + 9 * n, n);
+    vec3_soa_bind(&p->v, p->buf + 18 * n, n);
+    vec3_soa_bind(&p->dt, p->buf + 21 * n, n);
+
+    uint32_t rng = 4242u;
+    for (int i = 0; i < n; i++) {
+        fixed_t R[9], dR[9];
+        rotation_from_yaw(lcg_next(&rng), R);
+        rotation_from_yaw(lcg_next(&rng) >> 12, dR);  /* Small per-step rotation */
+        for (int k = 0; k < 9; k++) {
+            p->R.m[k][i] = R[k];
+            p->dR.m[k][i] = dR[k];
+        }
+        for (int k = 0; k < 3; k++) {
+            p->v.v[k][i] = (fixed_t)(lcg_next(&rng) >> 12) - (1 << 19);
+        }
+    }
+
+    ctx->data = p;
+    ctx->cells = (size_t)n;
+    ctx->bytes = (size_t)24 * n * sizeof(fixed_t);
+    return 0;
+}
+
+/* One pose update: R <- R·ΔR, Δt <- R·v (body velocity to world frame) */
+static void pose_run(BenchContext* ctx) {
+    PoseData* p = (PoseData*)ctx->data;
+    int n = (int)ctx->cells;
+    rotation_mul_n(&p->R, &p->dR, &p->R, n);
+    mat3_mul_vec3_n(&p->R, &p->v, &p->dt, n);
+}
+
+static void pose_teardown(BenchContext* ctx) {
+    PoseData* p = (PoseData*)ctx->data;
+    if (p) free(p->buf);
+    free_data(ctx);
+}
+
+/* ========================================================================
+ * hash.sha256
+ * ======================================================================== */
+
+static int sha_setup(BenchContext* ctx) {
+    size_t n = (size_t)ctx->nx * ctx->ny * ctx->nz;
+    float* field = (float*)malloc(n * sizeof(float));
+    if (!field) return -1;
+
+    uint32_t rng = 99u;
+    for (size_t i = 0; i < n; i++) {
+        field[i] = lcg_unit(&rng);
+    }
+
+    ctx->data = field;
+    ctx->cells = n;
+    ctx->bytes = n * sizeof(float);
+    return 0;
+}
+
+static void sha_run(BenchContext* ctx) {
+    uint8_t digest[SHA256_DIGEST_BYTES];
+    sha256(ctx->data, ctx->cells * sizeof(float), digest);
+}
+
+/* ========================================================================
+ * hash.state / io.snapshot
+ * ======================================================================== */
+
+typedef struct {
+    void* sim;
+    uint8_t* buffer;
+    size_t size;
+} StateData;
+
+static int state_bench_setup(BenchContext* ctx) {
+    SimulationConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.num_entities = (uint32_t)(ctx->nx * ctx->ny);
+    cfg.num_scalar_fields = (uint32_t)(ctx->nx * ctx->ny * ctx->nz);
+    cfg.grid_width = (uint32_t)ctx->nx;
+    cfg.grid_height = (uint32_t)ctx->ny;
+    cfg.grid_depth = (uint32_t)ctx->nz;
+    cfg.dt = 0.01f;
+
+    StateData* s = (StateData*)calloc(1, sizeof(StateData));
+    if (!s) return -1;
+    s->sim = state_create(&cfg);
+    s->size = state_get_binary_size(s->sim);
+    s->buffer = (uint8_t*)malloc(s->size);
+    ctx->data = s;
+    if (!s->sim || !s->buffer) return -1;
+
+    SimulationState view;
+    state_get_view(s->sim, &view);
+    uint32_t rng = 2024u;
+    for (uint32_t i = 0; i < view.num_scalar_values; i++) {
+        view.scalar_fields[i] = lcg_unit(&rng);
+    }
+
+    ctx->cells = cfg.num_scalar_fields;
+    ctx->bytes = 2 * s->size;  /* Live state + serialized image */
+    return 0;
+}
+
+static void state_hash_run(BenchContext* ctx) {
+    StateData* s = (StateData*)ctx->data;
+    volatile uint64_t h = state_hash(s->sim);
+    (void)h;
+}
+
+static void snapshot_run(BenchContext* ctx) {
+    StateData* s = (StateData*)ctx->data;
+    size_t written = state_to_binary(s->sim, s->buffer, s->size);
+    state_reset_from_binary(s->sim, s->buffer, written);
+}
+
+static void state_bench_teardown(BenchContext* ctx) {
+    StateData* s = (StateData*)ctx->data;
+    if (s) {
+        if (s->sim) state_destroy(s->sim);
+        free(s->buffer);
+    }
+    free_data(ctx);
+}
+
+/* ========================================================================
+ * hyd.richards_step / hyd.richards_ponded
+ * ======================================================================== */
+
+typedef struct {
+    RichardsLiteParams params;
+    float rainfall;
+    Cell* cells;
+} RichardsData;
+
+static int richards_setup_common(BenchContext* ctx, int ponded) {
+    if (ctx->nx > RICHARDS_MAX_ROW) return -1;
+    if (ctx->nz < 1 || ctx->nz > RICHARDS_MAX_LAYERS) return -1;
+
+    size_t n = (size_t)ctx->nx * ctx->ny * ctx->nz;
+    RichardsData* r = (RichardsData*)calloc(1, sizeof(RichardsData) + n * sizeof(Cell));
+    if (!r) return -1;
+
+    r->cells = (Cell*)(r + 1);
+    init_hyd_params(&r->params);
+    r->rainfall = 1.0e-7f;
+    richards_lite_init();
+
+    uint32_t rng = 31337u;
+    for (size_t i = 0; i < n; i++) {
+        init_cell(&r->cells[i]);
+        if (ponded) {
+            /* Ponded above the fill-and-spill threshold on rough terrain */
+            r->cells[i].h_surface = 0.02f;
+            r->cells[i].z = 0.05f * lcg_unit(&rng);
+        }
+    }
+
+    ctx->data = r;
+    ctx->cells = n;
+    /* Cells plus the solver's column scratch (tridiagonal bands, theta, h) */
+    ctx->bytes = n * sizeof(Cell) + (size_t)8 * ctx->nz * sizeof(float);
+    return 0;
+}
+
+static int richards_setup(BenchContext* ctx) {
+    return richards_setup_common(ctx, 0);
+}
+
+static int richards_ponded_setup(BenchContext* ctx) {
+    return richards_setup_common(ctx, 1);
+}
+
+static void richards_run(BenchContext* ctx) {
+    RichardsData* r = (RichardsData*)ctx->data;
+    richards_lite_step(r->cells, &r->params, (size_t)ctx->nx, (size_t)ctx->ny, (size_t)ctx->nz,
+                       3600.0f, r->rainfall, NULL);
+}
+
+/* ========================================================================
+ * atm.biotic_pump
+ * ======================================================================== */
+
+typedef struct {
+    BioticPumpParams params;
+    float* fields;      /* ET, LAI, H_c, phi_f, Temp, u, v, dp planes */
+} BioticData;
+
+static int biotic_setup(BenchContext* ctx) {
+    if (ctx->nx < 3) return -1;
+
+    size_t n = (size_t)ctx->nx * ctx->ny;
+    BioticData* b = (BioticData*)calloc(1, sizeof(BioticData) + 8 * n * sizeof(float));
+    if (!b) return -1;
+    b->fields = (float*)(b + 1);
+
+    /* tests/test_biotic_pump.c defaults, 10 km spacing */
+    b->params.h_gamma = 1500.0f;
+    b->params.h_c = 2000.0f;
+    b->params.c_d = 5.0e-4f;
+    b->params.f = 1.0e-5f;
+    b->params.rho = 1.2f;
+    b->params.r_T = 0.622f;
+    b->params.RH_0 = 0.2f;
+    b->params.k_E = 50000.0f;
+    b->params.dx = 1.0e4f;
+
+    biotic_pump_init();
+
+    uint32_t rng = 8675309u;
+    for (size_t i = 0; i < n; i++) {
+        b->fields[0 * n + i] = 2.0f + 3.0f * lcg_unit(&rng);     /* ET [mm/day] */
+        b->fields[1 * n + i] = 3.0f + 4.0f * lcg_unit(&rng);     /* LAI */
+        b->fields[2 * n + i] = 15.0f + 25.0f * lcg_unit(&rng);   /* H_c [m] */
+        b->fields[3 * n + i] = lcg_unit(&rng);                   /* phi_f */
+        b->fields[4 * n + i] = 288.0f + 15.0f * lcg_unit(&rng);  /* Temp [K] */
+    }
+
+    ctx->data = b;
+    ctx->cells = n;
+    ctx->bytes = 8 * n * sizeof(float);
+    return 0;
+}
+
+static void biotic_run(BenchContext* ctx) {
+    BioticData* b = (BioticData*)ctx->data;
+    size_t n = ctx->cells;
+    size_t nx = (size_t)ctx->nx;
+
+    for (int row = 0; row < ctx->ny; row++) {
+        size_t off = (size_t)row * nx;
+        VegetationState veg;
+        veg.ET = b->fields + 0 * n + off;
+        veg.LAI = b->fields + 1 * n + off;
+        veg.H_c = b->fields + 2 * n + off;
+        veg.phi_f = b->fields + 3 * n + off;
+        veg.Temp = b->fields + 4 * n + off;
+        biotic_pump_step(&veg, &b->params, nx, 600.0f,
+                         b->fields + 5 * n + off,
+                         b->fields + 6 * n + off,
+                         b->fields + 7 * n + off);
+    }
+}
+
+/* ========================================================================
+ * reg.regv2_cascade
+ * ======================================================================== */
+
+typedef struct {
+    RegenerationParams params;
+    Cell* cells;
+} RegData;
+
+static int regv2_setup(BenchContext* ctx) {
+    /* REGv2 is a process-wide switch; enable it once */
+    static int s_regv2_state = 0;  /* 0 = not tried, 1 = enabled, -1 = failed */
+    if (s_regv2_state == 0) {
+        s_regv2_state = regeneration_cascade_enable_regv2(
+            NEG_BENCH_CONFIG_DIR "/REGv2_Microbial.json") == 0 ? 1 : -1;
+    }
+    if (s_regv2_state < 0) return -1;
+
+    size_t n = (size_t)ctx->nx * ctx->ny;
+    RegData* r = (RegData*)calloc(1, sizeof(RegData) + n * sizeof(Cell));
+    if (!r) return -1;
+    r->cells = (Cell*)(r + 1);
+
+    /* LoessPlateau.json */
+    r->params.r_V = 0.12f;
+    r->params.K_V = 0.70f;
+    r->params.lambda1 = 0.50f;
+    r->params.lambda2 = 0.08f;
+    r->params.theta_star = 0.17f;
+    r->params.SOM_star = 1.2f;
+    r->params.a1 = 0.18f;
+    r->params.a2 = 0.035f;
+    r->params.eta1 = 5.0f;
+    r->params.K_vertical_multiplier = 1.15f;
+
+    uint32_t rng = 5150u;
+    for (size_t i = 0; i < n; i++) {
+        init_cell(&r->cells[i]);
+        r->cells[i].theta = 0.08f + 0.2f * lcg_unit(&rng);
+        r->cells[i].C_labile = lcg_unit(&rng);
+        r->cells[i].FB_ratio = 0.2f + 2.0f * lcg_unit(&rng);
+    }
+
+    ctx->data = r;
+    ctx->cells = n;
+    ctx->bytes = n * sizeof(Cell);
+    return 0;
+}
+
+static void regv2_run(BenchContext* ctx) {
+    RegData* r = (RegData*)ctx->data;
+    regeneration_cascade_step(r->cells, ctx->cells, &r->params, 1.0f);
+}
+
+/* ========================================================================
+ * REGISTRY
+ * ======================================================================== */
+
+const BenchCase g_bench_cases[] = {
+    { "hyd.thomas_solve", "micro", "Tridiagonal solve per column (nz layers)",
+      thomas_setup, thomas_run, free_data, 0 },
+    { "hyd.barrier_field", "micro", "Bounded barrier value + gradient over a float field",
+      barrier_setup, barrier_run, free_data, 0 },
+    { "se3.pose_compose", "micro", "SE(3) pose update R*dR, R*v over SoA streams",
+      pose_setup, pose_run, pose_teardown, 0 },
+    { "hash.sha256", "micro", "SHA-256 of a float field",
+      sha_setup, sha_run, free_data, 0 },
+    { "hash.state", "micro", "state_hash() (serialize + XXH3)",
+      state_bench_setup, state_hash_run, state_bench_teardown, 0 },
+    { "hyd.richards_step", "macro", "Richards-Lite step, dry surface",
+      richards_setup, richards_run, free_data, 0 },
+    { "hyd.richards_ponded", "macro", "Richards-Lite step, ponded surface (surface flow active)",
+      richards_ponded_setup, richards_run, free_data, 0 },
+    { "atm.biotic_pump", "macro", "Biotic pump step, one transect per row",
+      biotic_setup, biotic_run, free_data, 0 },
+    { "reg.regv2_cascade", "macro", "REGv1 cascade with REGv2 microbial SOM",
+      regv2_setup, regv2_run, free_data, 0 },
+    { "io.snapshot", "macro", "state_to_binary() + state_reset_from_binary()",
+      state_bench_setup, snapshot_run, state_bench_teardown, 0 },
+};
+
+const int g_bench_case_count = (int)(sizeof(g_bench_cases) / sizeof(g_bench_cases[0]));
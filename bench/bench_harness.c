@@ -0,0 +1,518 @@
+/*
+ * bench_harness.c - Timing, Statistics, JSON and Baselines for neg_bench
+ *
+ * Measurement per case:
+ *   1. setup() at the requested grid shape
+ *   2. warmup run() calls (touch buffers, fill caches and LUTs)
+ *   3. calibrate: double the iteration count until one sample lasts at
+ *      least min_sample_ms
+ *   4. take `samples` timed samples of that many iterations
+ *   5. median / p99 / min of ns per cell over the samples
+ *
+ * p99 is nearest-rank: with the default 21 samples it is the slowest
+ * sample, which is the number that matters for frame budgets.
+ *
+ * Multi-worker runs set up one instance per worker, calibrate on worker 0
+ * alone, then time all workers together (one thread each, the caller's
+ * thread included). Threads are created per sample; against the >= 2 ms
+ * sample floor that costs well under 1%.
+ *
+ * With opts->perf, a single-worker case runs one extra pass of the
+ * calibrated iteration count under the hardware counters (on the caller's
+ * thread, which owns them), kept apart from the timed samples so counter
+ * reads never inflate the timings.
+ *
+ * Author: ClaudeCode (benchmark harness)
+ * Version: 1.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "neg_bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32) || (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+#define NEG_BENCH_NO_THREADS 1
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* ========================================================================
+ * TIMING
+ * ======================================================================== */
+
+uint64_t bench_now_ns(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void bench_options_default(BenchOptions* opts) {
+    opts->samples = 21;
+    opts->min_sample_ms = 2.0;
+    opts->warmup = 2;
+    opts->perf = NULL;
+}
+
+/* ========================================================================
+ * MEASUREMENT
+ * ======================================================================== */
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/** Nearest-rank percentile of a sorted array */
+static double percentile_sorted(const double* v, int n, double pct) {
+    int rank = (int)(pct / 100.0 * n + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+    return v[rank - 1];
+}
+
+int bench_cpu_count(void) {
+#if defined(NEG_BENCH_NO_THREADS) || !defined(_SC_NPROCESSORS_ONLN)
+    return 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+typedef struct {
+    const BenchCase* bench;
+    BenchContext ctx;
+    long iters;
+} BenchWorker;
+
+static void run_iterations(BenchWorker* w) {
+    for (long i = 0; i < w->iters; i++) {
+        w->bench->run(&w->ctx);
+    }
+}
+
+#ifndef NEG_BENCH_NO_THREADS
+static void* worker_main(void* arg) {
+    run_iterations((BenchWorker*)arg);
+    return NULL;
+}
+#endif
+
+/**
+ * One timed sample: every worker runs its iterations concurrently.
+ *
+ * @return Wall time in ns, or 0 if a thread could not be created
+ */
+static uint64_t time_sample(BenchWorker* workers, int n_workers) {
+    uint64_t t0 = bench_now_ns();
+#ifndef NEG_BENCH_NO_THREADS
+    pthread_t threads[64];
+    int started = 0;
+    for (int w = 1; w < n_workers; w++) {
+        if (pthread_create(&threads[w], NULL, worker_main, &workers[w]) != 0) break;
+        started++;
+    }
+    run_iterations(&workers[0]);
+    for (int w = 1; w <= started; w++) {
+        pthread_join(threads[w], NULL);
+    }
+    if (started != n_workers - 1) return 0;
+#else
+    run_iterations(&workers[0]);
+#endif
+    uint64_t elapsed = bench_now_ns() - t0;
+    return elapsed > 0 ? elapsed : 1;
+}
+
+static void teardown_workers(BenchWorker* workers, int n_workers) {
+    for (int w = 0; w < n_workers; w++) {
+        if (workers[w].bench->teardown) workers[w].bench->teardown(&workers[w].ctx);
+    }
+    free(workers);
+}
+
+int bench_run_case(const BenchCase* bench, int nx, int ny, int nz, int workers,
+                   const BenchOptions* opts, BenchResult* out) {
+    memset(out, 0, sizeof(*out));
+    out->bench = bench;
+    out->nx = nx;
+    out->ny = ny;
+    out->nz = nz;
+    out->workers = workers;
+
+    int max_workers = 64;
+#ifdef NEG_BENCH_NO_THREADS
+    max_workers = 1;
+#endif
+    if (workers < 1 || workers > max_workers ||
+        (workers > 1 && (bench->flags & BENCH_SERIAL_ONLY))) {
+        out->skipped = 1;
+        return 0;
+    }
+
+    BenchWorker* w = (BenchWorker*)calloc((size_t)workers, sizeof(BenchWorker));
+    if (!w) return -1;
+
+    int declined = 0;
+    for (int i = 0; i < workers; i++) {
+        w[i].bench = bench;
+        w[i].ctx.nx = nx;
+        w[i].ctx.ny = ny;
+        w[i].ctx.nz = nz;
+        if (bench->setup(&w[i].ctx) != 0 || w[i].ctx.cells == 0) {
+            declined = 1;
+        }
+    }
+    if (declined) {
+        teardown_workers(w, workers);
+        out->skipped = 1;
+        return 0;
+    }
+    out->cells = w[0].ctx.cells;
+    out->bytes = w[0].ctx.bytes;
+
+    int n = opts->samples > 0 ? opts->samples : 1;
+    double* ns_per_cell = (double*)malloc((size_t)n * sizeof(double));
+    if (!ns_per_cell) {
+        teardown_workers(w, workers);
+        return -1;
+    }
+
+    for (int i = 0; i < workers; i++) {
+        for (int k = 0; k < opts->warmup; k++) {
+            bench->run(&w[i].ctx);
+        }
+    }
+
+    /* Calibrate iterations per sample on worker 0 alone */
+    uint64_t min_ns = (uint64_t)(opts->min_sample_ms * 1e6);
+    long iters = 1;
+    for (;;) {
+        w[0].iters = iters;
+        uint64_t elapsed = time_sample(w, 1);
+        if (elapsed >= min_ns || iters >= (1L << 24)) break;
+        iters *= 2;
+    }
+    for (int i = 0; i < workers; i++) {
+        w[i].iters = iters;
+    }
+
+    double total_cells = (double)iters * (double)out->cells * workers;
+    for (int s = 0; s < n; s++) {
+        uint64_t elapsed = time_sample(w, workers);
+        if (elapsed == 0) {
+            free(ns_per_cell);
+            teardown_workers(w, workers);
+            return -1;
+        }
+        ns_per_cell[s] = (double)elapsed / total_cells;
+    }
+
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        out->perf_per_cell[c] = -1.0;
+    }
+    out->ipc = -1.0;
+    if (opts->perf && opts->perf->opened > 0 && workers == 1) {
+        double counts[BENCH_PERF_COUNT];
+        double cells = (double)iters * (double)out->cells;
+        bench_perf_start(opts->perf);
+        for (long k = 0; k < iters; k++) {
+            bench->run(&w[0].ctx);
+        }
+        bench_perf_stop(opts->perf, counts);
+
+        for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+            if (counts[c] >= 0.0) {
+                out->perf_per_cell[c] = counts[c] / cells;
+                out->has_perf = 1;
+            }
+        }
+        if (counts[BENCH_PERF_CYCLES] > 0.0 && counts[BENCH_PERF_INSTRUCTIONS] >= 0.0) {
+            out->ipc = counts[BENCH_PERF_INSTRUCTIONS] / counts[BENCH_PERF_CYCLES];
+        }
+    }
+
+    teardown_workers(w, workers);
+
+    qsort(ns_per_cell, (size_t)n, sizeof(double), compare_double);
+    out->iterations = iters;
+    out->median_ns_per_cell = (n % 2) ? ns_per_cell[n / 2]
+                                      : 0.5 * (ns_per_cell[n / 2 - 1] + ns_per_cell[n / 2]);
+    out->p99_ns_per_cell = percentile_sorted(ns_per_cell, n, 99.0);
+    out->min_ns_per_cell = ns_per_cell[0];
+    out->cells_per_sec = out->median_ns_per_cell > 0.0 ? 1e9 / out->median_ns_per_cell : 0.0;
+    out->bytes_per_cell = (double)out->bytes / (double)out->cells;
+    out->parallel_efficiency = 1.0;
+
+    free(ns_per_cell);
+    return 0;
+}
+
+void bench_fill_efficiency(BenchResult* results, int n) {
+    for (int i = 0; i < n; i++) {
+        BenchResult* r = &results[i];
+        if (r->skipped || r->workers <= 1) continue;
+
+        r->parallel_efficiency = 0.0;
+        for (int k = 0; k < n; k++) {
+            const BenchResult* solo = &results[k];
+            if (!solo->skipped && solo->workers == 1 && solo->bench == r->bench &&
+                solo->nx == r->nx && solo->ny == r->ny && solo->nz == r->nz &&
+                solo->cells_per_sec > 0.0) {
+                r->parallel_efficiency = r->cells_per_sec / (r->workers * solo->cells_per_sec);
+                break;
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * REPORTING
+ * ======================================================================== */
+
+void bench_write_json(FILE* f, const BenchResult* results, int n, const BenchOptions* opts) {
+    fprintf(f, "{\n");
+    fprintf(f, "  \"schema\": \"neg_bench/1\",\n");
+    fprintf(f, "  \"samples\": %d,\n", opts->samples);
+    fprintf(f, "  \"min_sample_ms\": %.3f,\n", opts->min_sample_ms);
+    fprintf(f, "  \"benchmarks\": [\n");
+
+    for (int i = 0; i < n; i++) {
+        const BenchResult* r = &results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"kind\": \"%s\", \"nx\": %d, \"ny\": %d, \"nz\": %d"
+                   ", \"workers\": %d",
+                r->bench->name, r->bench->kind, r->nx, r->ny, r->nz, r->workers);
+        if (r->skipped) {
+            fprintf(f, ", \"skipped\": true");
+        } else {
+            fprintf(f, ", \"cells\": %zu, \"iterations\": %ld"
+                       ", \"median_ns_per_cell\": %.4f, \"p99_ns_per_cell\": %.4f"
+                       ", \"min_ns_per_cell\": %.4f, \"cells_per_sec\": %.6e"
+                       ", \"bytes_per_cell\": %.1f, \"parallel_efficiency\": %.3f",
+                    r->cells, r->iterations, r->median_ns_per_cell,
+                    r->p99_ns_per_cell, r->min_ns_per_cell, r->cells_per_sec,
+                    r->bytes_per_cell, r->parallel_efficiency);
+            if (r->ipc >= 0.0) {
+                fprintf(f, ", \"ipc\": %.3f", r->ipc);
+            }
+            for (int c = 0; r->has_perf && c < BENCH_PERF_COUNT; c++) {
+                if (r->perf_per_cell[c] >= 0.0) {
+                    fprintf(f, ", \"%s_per_cell\": %.4f",
+                            bench_perf_name((BenchPerfCounter)c), r->perf_per_cell[c]);
+                }
+            }
+        }
+        if (r->has_baseline) {
+            fprintf(f, ", \"baseline_ns_per_cell\": %.4f, \"threshold_pct\": %.1f, \"regression\": %s",
+                    r->baseline_ns_per_cell, r->threshold_pct, r->regression ? "true" : "false");
+        }
+        fprintf(f, "}%s\n", (i + 1 < n) ? "," : "");
+    }
+
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+}
+
+void bench_print_table(FILE* f, const BenchResult* results, int n) {
+    fprintf(f, "%-22s %-5s %-14s %3s %10s %10s %12s %8s %6s %9s\n",
+            "benchmark", "kind", "grid", "W", "median", "p99", "cells/s", "B/cell", "eff", "vs base");
+    fprintf(f, "%-22s %-5s %-14s %3s %10s %10s %12s %8s %6s %9s\n",
+            "", "", "", "", "ns/cell", "ns/cell", "", "", "", "");
+
+    for (int i = 0; i < n; i++) {
+        const BenchResult* r = &results[i];
+        char grid[32];
+        snprintf(grid, sizeof(grid), "%dx%dx%d", r->nx, r->ny, r->nz);
+
+        if (r->skipped) {
+            fprintf(f, "%-22s %-5s %-14s %3d %10s\n",
+                    r->bench->name, r->bench->kind, grid, r->workers, "skipped");
+            continue;
+        }
+
+        char delta[32] = "-";
+        if (r->has_baseline && r->baseline_ns_per_cell > 0.0) {
+            double pct = 100.0 * (r->median_ns_per_cell / r->baseline_ns_per_cell - 1.0);
+            snprintf(delta, sizeof(delta), "%+.1f%%%s", pct, r->regression ? "!" : "");
+        }
+        fprintf(f, "%-22s %-5s %-14s %3d %10.3f %10.3f %12.3e %8.1f %6.2f %9s\n",
+                r->bench->name, r->bench->kind, grid, r->workers,
+                r->median_ns_per_cell, r->p99_ns_per_cell, r->cells_per_sec,
+                r->bytes_per_cell, r->parallel_efficiency, delta);
+    }
+}
+
+/** "%.3f" into buf, or "-" for an unavailable (negative) value */
+static const char* format_counter(char* buf, size_t len, double v) {
+    if (v < 0.0) {
+        snprintf(buf, len, "-");
+    } else {
+        snprintf(buf, len, "%.3f", v);
+    }
+    return buf;
+}
+
+void bench_print_perf_table(FILE* f, const BenchResult* results, int n) {
+    int any = 0;
+    for (int i = 0; i < n; i++) {
+        any |= !results[i].skipped && results[i].has_perf;
+    }
+    if (!any) return;
+
+    fprintf(f, "\n%-22s %-14s %6s %10s %10s %10s %10s %10s\n",
+            "benchmark", "grid", "IPC", "cycles", "instr", "L1D miss", "LLC miss", "br miss");
+    fprintf(f, "%-22s %-14s %6s %10s %10s %10s %10s %10s\n",
+            "", "", "", "/cell", "/cell", "/cell", "/cell", "/cell");
+
+    for (int i = 0; i < n; i++) {
+        const BenchResult* r = &results[i];
+        if (r->skipped || !r->has_perf) continue;
+
+        char grid[32];
+        char col[BENCH_PERF_COUNT + 1][24];
+        snprintf(grid, sizeof(grid), "%dx%dx%d", r->nx, r->ny, r->nz);
+        format_counter(col[BENCH_PERF_COUNT], sizeof(col[0]), r->ipc);
+        for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+            format_counter(col[c], sizeof(col[0]), r->perf_per_cell[c]);
+        }
+        fprintf(f, "%-22s %-14s %6s %10s %10s %10s %10s %10s\n",
+                r->bench->name, grid, col[BENCH_PERF_COUNT],
+                col[BENCH_PERF_CYCLES], col[BENCH_PERF_INSTRUCTIONS],
+                col[BENCH_PERF_L1D_MISSES], col[BENCH_PERF_LLC_MISSES],
+                col[BENCH_PERF_BRANCH_MISSES]);
+    }
+}
+
+void bench_write_csv(FILE* f, const BenchResult* results, int n) {
+    fprintf(f, "name,kind,nx,ny,nz,workers,cells,median_ns_per_cell,p99_ns_per_cell,"
+               "cells_per_sec,bytes_per_cell,working_set_bytes,parallel_efficiency,ipc");
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        fprintf(f, ",%s_per_cell", bench_perf_name((BenchPerfCounter)c));
+    }
+    fprintf(f, "\n");
+    for (int i = 0; i < n; i++) {
+        const BenchResult* r = &results[i];
+        if (r->skipped) continue;
+        fprintf(f, "%s,%s,%d,%d,%d,%d,%zu,%.4f,%.4f,%.6e,%.1f,%zu,%.3f,",
+                r->bench->name, r->bench->kind, r->nx, r->ny, r->nz, r->workers,
+                r->cells, r->median_ns_per_cell, r->p99_ns_per_cell, r->cells_per_sec,
+                r->bytes_per_cell, r->bytes * (size_t)r->workers, r->parallel_efficiency);
+        if (r->ipc >= 0.0) fprintf(f, "%.3f", r->ipc);
+        for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+            fprintf(f, ",");
+            if (r->perf_per_cell[c] >= 0.0) fprintf(f, "%.4f", r->perf_per_cell[c]);
+        }
+        fprintf(f, "\n");
+    }
+}
+
+/* ========================================================================
+ * BASELINE COMPARISON
+ * ======================================================================== */
+
+/**
+ * Read `"key": <number>` from one baseline line.
+ *
+ * @return 0 on success, -1 if the key is absent
+ */
+static int json_number(const char* line, const char* key, double* out) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* p = strstr(line, pattern);
+    if (!p) return -1;
+    return sscanf(p + strlen(pattern), "%lf", out) == 1 ? 0 : -1;
+}
+
+/**
+ * Find the baseline median for one result: same name, grid shape and
+ * worker count (files written before "workers" existed count as 1).
+ *
+ * @return 0 and *median on success, -1 if absent
+ */
+static int find_baseline(const char* json, const BenchResult* r, double* median) {
+    char pattern[128];
+    char line[512];
+    snprintf(pattern, sizeof(pattern), "\"name\": \"%s\"", r->bench->name);
+
+    for (const char* p = strstr(json, pattern); p; p = strstr(p + 1, pattern)) {
+        const char* end = strchr(p, '\n');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len >= sizeof(line)) len = sizeof(line) - 1;
+        memcpy(line, p, len);
+        line[len] = '\0';
+
+        double nx, ny, nz, workers, base;
+        if (json_number(line, "nx", &nx) != 0 || json_number(line, "ny", &ny) != 0 ||
+            json_number(line, "nz", &nz) != 0 ||
+            json_number(line, "median_ns_per_cell", &base) != 0) {
+            continue;
+        }
+        if (json_number(line, "workers", &workers) != 0) {
+            workers = 1.0;
+        }
+        if ((int)nx == r->nx && (int)ny == r->ny && (int)nz == r->nz &&
+            (int)workers == r->workers && base > 0.0) {
+            *median = base;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int bench_compare_baseline(const char* path, BenchResult* results, int n,
+                           double default_pct,
+                           const BenchThreshold* overrides, int n_overrides) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size <= 0) {
+        fclose(f);
+        return -1;
+    }
+
+    char* json = (char*)malloc((size_t)size + 1);
+    if (!json) {
+        fclose(f);
+        return -1;
+    }
+    size_t got = fread(json, 1, (size_t)size, f);
+    json[got] = '\0';
+    fclose(f);
+
+    int regressions = 0;
+
+    for (int i = 0; i < n; i++) {
+        BenchResult* r = &results[i];
+        double base;
+        if (r->skipped || find_baseline(json, r, &base) != 0) continue;
+
+        double pct = default_pct;
+        for (int k = 0; k < n_overrides; k++) {
+            if (strcmp(overrides[k].name, r->bench->name) == 0) {
+                pct = overrides[k].pct;
+            }
+        }
+
+        r->has_baseline = 1;
+        r->baseline_ns_per_cell = base;
+        r->threshold_pct = pct;
+        r->regression = r->median_ns_per_cell > base * (1.0 + pct / 100.0);
+        regressions += r->regression;
+    }
+
+    free(json);
+    return regressions;
+}
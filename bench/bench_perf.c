@@ -0,0 +1,151 @@
+/*
+ * bench_perf.c - Hardware Performance Counters for neg_bench
+ *
+ * Linux perf_event_open counters for the calling thread, user space only.
+ * Each counter is opened on its own rather than as a group: a PMU with
+ * fewer programmable counters than requested then multiplexes instead of
+ * failing the whole group, and a counter the CPU or hypervisor does not
+ * expose (LLC misses in many VMs) drops out alone. Readings are scaled by
+ * time_enabled / time_running to undo multiplexing.
+ *
+ * Elsewhere, or when perf_event_paranoid / seccomp / the container denies
+ * the syscall, bench_perf_open() opens nothing and the harness reports
+ * timing only.
+ *
+ * Author: ClaudeCode (benchmark harness)
+ * Version: 1.0
+ */
+
+/* syscall() is hidden by strict -std=c11 */
+#define _DEFAULT_SOURCE
+
+#include "neg_bench.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static const char* const k_counter_names[BENCH_PERF_COUNT] = {
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "llc_misses",
+    "branch_misses",
+};
+
+const char* bench_perf_name(BenchPerfCounter counter) {
+    return ((int)counter >= 0 && (int)counter < BENCH_PERF_COUNT) ? k_counter_names[counter]
+                                                                  : "unknown";
+}
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int open_counter(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    /* pid 0, cpu -1: this thread, on whichever CPU it runs */
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0UL);
+}
+
+int bench_perf_open(BenchPerf* perf, char* why, size_t why_len) {
+    static const struct {
+        uint32_t type;
+        uint64_t config;
+    } k_events[BENCH_PERF_COUNT] = {
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                              (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    };
+
+    int first_errno = 0;
+    perf->opened = 0;
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        perf->fd[c] = open_counter(k_events[c].type, k_events[c].config);
+        if (perf->fd[c] >= 0) {
+            perf->opened++;
+        } else if (!first_errno) {
+            first_errno = errno;
+        }
+    }
+
+    if (perf->opened == 0 && why && why_len > 0) {
+        snprintf(why, why_len, "perf_event_open: %s%s", strerror(first_errno),
+                 (first_errno == EACCES || first_errno == EPERM)
+                     ? " (see /proc/sys/kernel/perf_event_paranoid)" : "");
+    }
+    return perf->opened;
+}
+
+void bench_perf_close(BenchPerf* perf) {
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        if (perf->fd[c] >= 0) close(perf->fd[c]);
+        perf->fd[c] = -1;
+    }
+    perf->opened = 0;
+}
+
+void bench_perf_start(BenchPerf* perf) {
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        if (perf->fd[c] < 0) continue;
+        ioctl(perf->fd[c], PERF_EVENT_IOC_RESET, 0);
+        ioctl(perf->fd[c], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void bench_perf_stop(BenchPerf* perf, double counts[BENCH_PERF_COUNT]) {
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        if (perf->fd[c] >= 0) ioctl(perf->fd[c], PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) {
+        uint64_t v[3];  /* value, time_enabled, time_running */
+        counts[c] = -1.0;
+        if (perf->fd[c] < 0 || read(perf->fd[c], v, sizeof(v)) != (ssize_t)sizeof(v)) {
+            continue;
+        }
+        if (v[2] == 0) continue;  /* Never scheduled onto the PMU */
+        counts[c] = (double)v[0];
+        if (v[2] < v[1]) counts[c] *= (double)v[1] / (double)v[2];
+    }
+}
+
+#else /* !__linux__ */
+
+int bench_perf_open(BenchPerf* perf, char* why, size_t why_len) {
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) perf->fd[c] = -1;
+    perf->opened = 0;
+    if (why && why_len > 0) snprintf(why, why_len, "perf counters need Linux");
+    return 0;
+}
+
+void bench_perf_close(BenchPerf* perf) {
+    perf->opened = 0;
+}
+
+void bench_perf_start(BenchPerf* perf) {
+    (void)perf;
+}
+
+void bench_perf_stop(BenchPerf* perf, double counts[BENCH_PERF_COUNT]) {
+    (void)perf;
+    for (int c = 0; c < BENCH_PERF_COUNT; c++) counts[c] = -1.0;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,287 @@
+/*
+ * neg_bench.c - Unified Benchmark Driver
+ *
+ * Runs the registered kernel benchmarks (bench_cases.c), prints median /
+ * p99 ns per cell and cells/s, writes JSON or CSV, and optionally fails on
+ * regressions against a stored baseline. Sweep mode repeats every case
+ * over grid sizes and worker counts to expose cache cliffs and scaling.
+ *
+ * Usage:
+ *   neg_bench [options]
+ *
+ *   --list                   List cases and exit
+ *   --filter SUBSTR          Only cases whose name contains SUBSTR
+ *   --grid NXxNYxNZ          Grid shape (default 64x64x16)
+ *   --samples N              Timed samples per case (default 21)
+ *   --min-time-ms T          Minimum duration of one sample (default 2)
+ *   --quick                  5 samples of 0.2 ms (smoke test / CI)
+ *   --json FILE              Write JSON results
+ *   --baseline FILE          Compare against a previous --json output
+ *   --threshold PCT          Allowed median slowdown (default 10%)
+ *   --threshold-for NAME=PCT Per-case override (repeatable)
+ *
+ * Scaling sweep (grid size × worker count):
+ *   --sweep                  Run every case over the sweep shapes and workers
+ *   --sweep-nx LIST          nx = ny values (default 32,64,128,256,512,1024)
+ *   --sweep-nz LIST          nz values (default 1,16)
+ *   --workers LIST           Worker counts (default 1,2,4,... up to the CPU count)
+ *   --csv FILE               Write results as CSV (one row per case/shape/workers)
+ *
+ * Hardware counters (Linux perf_event_open, single-worker runs):
+ *   --perf                   Report IPC and cycles / instructions / L1D, LLC and
+ *                            branch misses per cell; skipped with a note if the
+ *                            kernel denies the counters
+ *
+ * Exit status: 0 ok, 1 regression against the baseline, 2 usage or I/O error.
+ *
+ * Recording and checking a baseline:
+ *   neg_bench --json bench/baseline.json
+ *   neg_bench --baseline bench/baseline.json --threshold 15
+ *
+ * Cache-size cliffs and thread scaling:
+ *   neg_bench --sweep --filter hyd. --csv sweep.csv
+ *
+ * Where the misses are:
+ *   neg_bench --perf --filter hyd.
+ *
+ * Author: ClaudeCode (benchmark harness)
+ * Version: 1.0
+ */
+
+#include "neg_bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_THRESHOLDS 32
+#define MAX_SWEEP_VALUES 16
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+            "Usage: %s [--list] [--filter SUBSTR] [--grid NXxNYxNZ] [--samples N]\n"
+            "          [--min-time-ms T] [--quick] [--json FILE] [--baseline FILE]\n"
+            "          [--threshold PCT] [--threshold-for NAME=PCT]\n"
+            "          [--sweep] [--sweep-nx LIST] [--sweep-nz LIST] [--workers LIST]\n"
+            "          [--csv FILE] [--perf]\n", prog);
+}
+
+static int parse_grid(const char* s, int* nx, int* ny, int* nz) {
+    int n = sscanf(s, "%dx%dx%d", nx, ny, nz);
+    if (n == 2) *nz = 1;
+    return (n >= 2 && *nx > 0 && *ny > 0 && *nz > 0) ? 0 : -1;
+}
+
+/** Parse a comma-separated list of positive integers; returns the count or -1 */
+static int parse_list(const char* s, int* values, int cap) {
+    int n = 0;
+    while (*s) {
+        char* end;
+        long v = strtol(s, &end, 10);
+        if (end == s || v <= 0 || n >= cap) return -1;
+        values[n++] = (int)v;
+        if (*end == ',') end++;
+        else if (*end != '\0') return -1;
+        s = end;
+    }
+    return n > 0 ? n : -1;
+}
+
+static int write_report(const char* path, const BenchResult* results, int n,
+                        const BenchOptions* opts, int csv) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "neg_bench: cannot write '%s'\n", path);
+        return -1;
+    }
+    if (csv) {
+        bench_write_csv(f, results, n);
+    } else {
+        bench_write_json(f, results, n, opts);
+    }
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opts;
+    bench_options_default(&opts);
+
+    const char* filter = NULL;
+    const char* json_path = NULL;
+    const char* baseline_path = NULL;
+    const char* csv_path = NULL;
+    double threshold_pct = 10.0;
+    BenchThreshold overrides[MAX_THRESHOLDS];
+    int n_overrides = 0;
+    int nx = 64, ny = 64, nz = 16;
+    int list_only = 0;
+    int sweep = 0;
+    int sweep_nx[MAX_SWEEP_VALUES] = { 32, 64, 128, 256, 512, 1024 };
+    int sweep_nz[MAX_SWEEP_VALUES] = { 1, 16 };
+    int workers[MAX_SWEEP_VALUES] = { 1 };
+    int n_sweep_nx = 6, n_sweep_nz = 2, n_workers = 1;
+    int workers_given = 0;
+    int want_perf = 0;
+    BenchPerf perf;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--list") == 0) {
+            list_only = 1;
+        } else if (strcmp(arg, "--quick") == 0) {
+            opts.samples = 5;
+            opts.min_sample_ms = 0.2;
+            opts.warmup = 1;
+        } else if (strcmp(arg, "--sweep") == 0) {
+            sweep = 1;
+        } else if (strcmp(arg, "--perf") == 0) {
+            want_perf = 1;
+        } else if (val && (strcmp(arg, "--sweep-nx") == 0 || strcmp(arg, "--sweep-nz") == 0 ||
+                           strcmp(arg, "--workers") == 0)) {
+            int* list = workers;
+            int* count = &n_workers;
+            if (strcmp(arg, "--sweep-nx") == 0) {
+                list = sweep_nx;
+                count = &n_sweep_nx;
+            } else if (strcmp(arg, "--sweep-nz") == 0) {
+                list = sweep_nz;
+                count = &n_sweep_nz;
+            } else {
+                workers_given = 1;
+            }
+            *count = parse_list(val, list, MAX_SWEEP_VALUES);
+            if (*count < 0) {
+                fprintf(stderr, "neg_bench: bad %s '%s'\n", arg, val);
+                return 2;
+            }
+            i++;
+        } else if (val && strcmp(arg, "--csv") == 0) {
+            csv_path = val;
+            i++;
+        } else if (val && strcmp(arg, "--filter") == 0) {
+            filter = val;
+            i++;
+        } else if (val && strcmp(arg, "--grid") == 0) {
+            if (parse_grid(val, &nx, &ny, &nz) != 0) {
+                fprintf(stderr, "neg_bench: bad --grid '%s'\n", val);
+                return 2;
+            }
+            i++;
+        } else if (val && strcmp(arg, "--samples") == 0) {
+            opts.samples = atoi(val);
+            i++;
+        } else if (val && strcmp(arg, "--min-time-ms") == 0) {
+            opts.min_sample_ms = atof(val);
+            i++;
+        } else if (val && strcmp(arg, "--json") == 0) {
+            json_path = val;
+            i++;
+        } else if (val && strcmp(arg, "--baseline") == 0) {
+            baseline_path = val;
+            i++;
+        } else if (val && strcmp(arg, "--threshold") == 0) {
+            threshold_pct = atof(val);
+            i++;
+        } else if (val && strcmp(arg, "--threshold-for") == 0) {
+            char* eq = strchr(argv[i + 1], '=');
+            if (!eq || n_overrides >= MAX_THRESHOLDS) {
+                fprintf(stderr, "neg_bench: bad --threshold-for '%s'\n", val);
+                return 2;
+            }
+            *eq = '\0';
+            overrides[n_overrides].name = argv[i + 1];
+            overrides[n_overrides].pct = atof(eq + 1);
+            n_overrides++;
+            i++;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (list_only) {
+        for (int i = 0; i < g_bench_case_count; i++) {
+            printf("%-22s %-5s %s\n", g_bench_cases[i].name, g_bench_cases[i].kind,
+                   g_bench_cases[i].description);
+        }
+        return 0;
+    }
+
+    /* A plain run is one shape with one worker; a sweep is the cross product */
+    if (!sweep) {
+        sweep_nx[0] = nx;
+        sweep_nz[0] = nz;
+        n_sweep_nx = n_sweep_nz = 1;
+    } else if (!workers_given) {
+        int cpus = bench_cpu_count();
+        n_workers = 0;
+        for (int w = 1; w <= cpus && n_workers < MAX_SWEEP_VALUES; w *= 2) {
+            workers[n_workers++] = w;
+        }
+    }
+
+    if (want_perf) {
+        char why[160];
+        if (bench_perf_open(&perf, why, sizeof(why)) > 0) {
+            opts.perf = &perf;
+        } else {
+            fprintf(stderr, "neg_bench: hardware counters unavailable (%s); timing only\n", why);
+        }
+    }
+
+    size_t max_results = (size_t)g_bench_case_count * n_sweep_nx * n_sweep_nz * n_workers;
+    BenchResult* results = (BenchResult*)calloc(max_results, sizeof(BenchResult));
+    if (!results) return 2;
+
+    int n = 0;
+    for (int i = 0; i < g_bench_case_count; i++) {
+        const BenchCase* bench = &g_bench_cases[i];
+        if (filter && !strstr(bench->name, filter)) continue;
+        for (int a = 0; a < n_sweep_nx; a++) {
+            for (int b = 0; b < n_sweep_nz; b++) {
+                for (int w = 0; w < n_workers; w++) {
+                    int shape_ny = sweep ? sweep_nx[a] : ny;
+                    if (bench_run_case(bench, sweep_nx[a], shape_ny, sweep_nz[b], workers[w],
+                                       &opts, &results[n]) != 0) {
+                        fprintf(stderr, "neg_bench: %s: out of memory or threads\n",
+                                bench->name);
+                        free(results);
+                        return 2;
+                    }
+                    n++;
+                }
+            }
+        }
+    }
+    bench_fill_efficiency(results, n);
+
+    int regressions = 0;
+    if (baseline_path) {
+        regressions = bench_compare_baseline(baseline_path, results, n, threshold_pct,
+                                             overrides, n_overrides);
+        if (regressions < 0) {
+            fprintf(stderr, "neg_bench: cannot read baseline '%s'\n", baseline_path);
+            free(results);
+            return 2;
+        }
+    }
+
+    /* JSON goes to a file only: solver init banners share stdout */
+    bench_print_table(stdout, results, n);
+    bench_print_perf_table(stdout, results, n);
+    if (opts.perf) bench_perf_close(opts.perf);
+    if ((json_path && write_report(json_path, results, n, &opts, 0) != 0) ||
+        (csv_path && write_report(csv_path, results, n, &opts, 1) != 0)) {
+        free(results);
+        return 2;
+    }
+
+    if (regressions > 0) {
+        fprintf(stderr, "neg_bench: %d regression(s) beyond threshold\n", regressions);
+    }
+
+    free(results);
+    return regressions > 0 ? 1 : 0;
+}
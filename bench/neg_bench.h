@@ -0,0 +1,271 @@
+/*
+ * neg_bench.h - Unified Benchmark Harness
+ *
+ * One registry of kernel benchmarks, one timing loop, one report format.
+ * Every case advances a known number of cells per run() call, so results
+ * are comparable across kernels and grid shapes:
+ *
+ *   ns/cell   = sample time / (iterations × cells)
+ *   cells/s   = 1e9 / median ns/cell
+ *
+ * Kinds:
+ *   - micro: one inner kernel in isolation (Thomas solve, barrier field,
+ *            SE(3) batch compose, SHA-256, state hash)
+ *   - macro: a whole solver step or API round trip (Richards-Lite step,
+ *            biotic pump, REGv2 cascade, snapshot save/restore)
+ *
+ * Each sample repeats run() enough times to exceed a minimum sample
+ * duration (calibrated once per case); the median and p99 are taken over
+ * the samples. Results are emitted as JSON, one benchmark object per line,
+ * and can be compared against a stored baseline of the same format with
+ * per-case regression thresholds (bench/bench_harness.c).
+ *
+ * Scaling sweeps (--sweep) repeat every case over a list of grid shapes
+ * and worker counts. Workers are independent instances of the case run
+ * concurrently, one per thread, the way ensemble members are scheduled:
+ *
+ *   parallel efficiency = cells/s with W workers / (W × cells/s with 1)
+ *
+ * Cases whose kernels keep static scratch buffers are BENCH_SERIAL_ONLY
+ * and only run with one worker.
+ *
+ * With --perf on Linux, single-worker cases also run one pass under
+ * perf_event_open counters (bench/bench_perf.c) and report IPC and
+ * cycles / cache misses / branch misses per cell, so a layout change can
+ * be attributed to the misses it removed. Counters that cannot be opened
+ * (non-Linux, perf_event_paranoid, containers, VMs) are simply omitted.
+ *
+ * Author: ClaudeCode (benchmark harness)
+ * Version: 1.0
+ */
+
+#ifndef NEG_BENCH_H
+#define NEG_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* ========================================================================
+ * CASE REGISTRY
+ * ======================================================================== */
+
+/**
+ * Per-run state of one case.
+ *
+ * The harness fills in the grid shape; setup() sets cells and may hang
+ * its buffers off data.
+ */
+typedef struct {
+    int nx, ny, nz;     /* Grid shape requested by the harness */
+    size_t cells;       /* Cells advanced by one run() call (set by setup) */
+    size_t bytes;       /* Working set touched by one run() call (set by setup) */
+    void* data;         /* Case-owned state */
+} BenchContext;
+
+/* BenchCase flags */
+#define BENCH_SERIAL_ONLY (1u << 0)  /* Kernel uses static scratch: one worker only */
+
+/**
+ * A registered benchmark.
+ *
+ * setup() returns 0 on success, or non-zero if the case cannot run at
+ * this grid shape (the case is then reported as skipped).
+ */
+typedef struct {
+    const char* name;           /* "<module>.<kernel>", e.g. "hyd.thomas_solve" */
+    const char* kind;           /* "micro" or "macro" */
+    const char* description;
+    int  (*setup)(BenchContext* ctx);
+    void (*run)(BenchContext* ctx);
+    void (*teardown)(BenchContext* ctx);
+    unsigned flags;             /* BENCH_* */
+} BenchCase;
+
+/* Defined in bench_cases.c */
+extern const BenchCase g_bench_cases[];
+extern const int g_bench_case_count;
+
+/* ========================================================================
+ * HARDWARE COUNTERS
+ * ======================================================================== */
+
+typedef enum {
+    BENCH_PERF_CYCLES = 0,
+    BENCH_PERF_INSTRUCTIONS,
+    BENCH_PERF_L1D_MISSES,      /* L1D read misses */
+    BENCH_PERF_LLC_MISSES,      /* Last-level cache misses */
+    BENCH_PERF_BRANCH_MISSES,
+    BENCH_PERF_COUNT
+} BenchPerfCounter;
+
+/**
+ * Counters of the calling thread (one fd per counter, -1 if unavailable).
+ */
+typedef struct {
+    int fd[BENCH_PERF_COUNT];
+    int opened;                 /* Number of counters open */
+} BenchPerf;
+
+/**
+ * Open the counters for the calling thread (user space only).
+ *
+ * @param why Receives the first open error when nothing could be opened
+ * @return Number of counters opened (0 = unavailable, not an error)
+ */
+int bench_perf_open(BenchPerf* perf, char* why, size_t why_len);
+
+void bench_perf_close(BenchPerf* perf);
+
+/** Reset and enable all open counters */
+void bench_perf_start(BenchPerf* perf);
+
+/**
+ * Disable and read all counters, scaled for multiplexing.
+ *
+ * @param counts Receives one value per counter, -1 if unavailable
+ */
+void bench_perf_stop(BenchPerf* perf, double counts[BENCH_PERF_COUNT]);
+
+/** Short counter name ("cycles", "l1d_misses", ...) */
+const char* bench_perf_name(BenchPerfCounter counter);
+
+/* ========================================================================
+ * MEASUREMENT
+ * ======================================================================== */
+
+/**
+ * Sampling options.
+ */
+typedef struct {
+    int samples;                /* Timed samples per case (median / p99 over these) */
+    double min_sample_ms;       /* Minimum duration of one sample */
+    int warmup;                 /* Untimed run() calls before calibration */
+    BenchPerf* perf;            /* Counters for single-worker runs, or NULL */
+} BenchOptions;
+
+/**
+ * Result of one case.
+ */
+typedef struct {
+    const BenchCase* bench;
+    int skipped;                /* setup() declined this shape / worker count */
+    int nx, ny, nz;
+    int workers;                /* Concurrent instances */
+    size_t cells;               /* Per instance */
+    size_t bytes;               /* Working set per instance */
+    long iterations;            /* run() calls per sample, per instance */
+    double median_ns_per_cell;  /* Wall time / cells over all workers */
+    double p99_ns_per_cell;
+    double min_ns_per_cell;
+    double cells_per_sec;       /* From the median, all workers */
+    double bytes_per_cell;
+    double parallel_efficiency; /* Set by bench_fill_efficiency(); 1.0 for one worker */
+
+    /* Hardware counters (opts->perf, single worker) */
+    int has_perf;
+    double perf_per_cell[BENCH_PERF_COUNT];  /* -1 where unavailable */
+    double ipc;                              /* -1 unless cycles and instructions */
+
+    /* Filled by bench_compare_baseline() */
+    int has_baseline;
+    double baseline_ns_per_cell;
+    double threshold_pct;
+    int regression;
+} BenchResult;
+
+/**
+ * Default options: 21 samples of at least 2 ms, 2 warmup calls, no counters.
+ */
+void bench_options_default(BenchOptions* opts);
+
+/**
+ * Monotonic clock in nanoseconds.
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * Set up, calibrate, sample and tear down one case.
+ *
+ * With workers > 1, each worker sets up its own instance and all of them
+ * run the same iteration count concurrently; a sample is the wall time
+ * until the last worker finishes.
+ *
+ * @param bench Case to run
+ * @param nx, ny, nz Grid shape
+ * @param workers Concurrent instances (>= 1)
+ * @param opts Sampling options
+ * @param out Result (skipped = 1 if setup() declined, or workers > 1 for a
+ *            BENCH_SERIAL_ONLY case or a build without threads)
+ * @return 0 on success or skip, -1 on allocation or thread failure
+ */
+int bench_run_case(const BenchCase* bench, int nx, int ny, int nz, int workers,
+                   const BenchOptions* opts, BenchResult* out);
+
+/**
+ * Fill parallel_efficiency of every multi-worker result from the
+ * single-worker result of the same case and grid shape.
+ */
+void bench_fill_efficiency(BenchResult* results, int n);
+
+/**
+ * Number of online CPUs (1 if unknown).
+ */
+int bench_cpu_count(void);
+
+/* ========================================================================
+ * REPORTING AND BASELINES
+ * ======================================================================== */
+
+/**
+ * Write results as JSON (schema "neg_bench/1").
+ *
+ * One object per benchmark per line, so baselines can be diffed and
+ * read back without a JSON library.
+ */
+void bench_write_json(FILE* f, const BenchResult* results, int n, const BenchOptions* opts);
+
+/**
+ * Print a human-readable table.
+ */
+void bench_print_table(FILE* f, const BenchResult* results, int n);
+
+/**
+ * Print IPC and counters per cell for results that have them (nothing if
+ * none do).
+ */
+void bench_print_perf_table(FILE* f, const BenchResult* results, int n);
+
+/**
+ * Write sweep results as CSV, one row per case × shape × worker count:
+ * name,kind,nx,ny,nz,workers,cells,median_ns_per_cell,p99_ns_per_cell,
+ * cells_per_sec,bytes_per_cell,working_set_bytes,parallel_efficiency,
+ * ipc,cycles_per_cell,instructions_per_cell,l1d_misses_per_cell,
+ * llc_misses_per_cell,branch_misses_per_cell (counter columns empty when
+ * not measured)
+ */
+void bench_write_csv(FILE* f, const BenchResult* results, int n);
+
+/**
+ * Per-case regression threshold override ("name=percent").
+ */
+typedef struct {
+    const char* name;
+    double pct;
+} BenchThreshold;
+
+/**
+ * Compare results against a baseline file written by bench_write_json().
+ *
+ * A case regresses when its median ns/cell exceeds the baseline median by
+ * more than its threshold (per-case override, else default_pct). Cases
+ * absent from the baseline, or recorded at a different grid shape, are
+ * not compared.
+ *
+ * @return Number of regressions, or -1 if the baseline cannot be read
+ */
+int bench_compare_baseline(const char* path, BenchResult* results, int n,
+                           double default_pct,
+                           const BenchThreshold* overrides, int n_overrides);
+
+#endif /* NEG_BENCH_H */
@@ -31,11 +31,22 @@ OUTPUT_DIR="${BUILD_DIR}/output"
 # Source files
 SOURCES=(
     "${PROJECT_ROOT}/src/core/state.c"
+    "${PROJECT_ROOT}/src/core/phase_timers.c"
+    "${PROJECT_ROOT}/src/core/trace.c"
+    "${PROJECT_ROOT}/src/core/mem_stats.c"
+    "${PROJECT_ROOT}/src/core/openmetrics.c"
+    "${PROJECT_ROOT}/src/core/state_shm.c"
+    "${PROJECT_ROOT}/src/core/step_async.c"
+    "${PROJECT_ROOT}/src/core/thread_pool.c"
+    "${PROJECT_ROOT}/src/core/event_log.c"
+    "${PROJECT_ROOT}/src/core/replay.c"
+    "${PROJECT_ROOT}/src/core/rollback.c"
     "${PROJECT_ROOT}/src/api/negentropic.c"
     "${PROJECT_ROOT}/embedded/se3_math.c"
     "${PROJECT_ROOT}/embedded/trig_tables.c"
     "${PROJECT_ROOT}/embedded/handoff.c"
     "${PROJECT_ROOT}/embedded/t_bsp.c"
+    "${PROJECT_ROOT}/embedded/sha256.c"
 )
 
 # Output name
@@ -49,7 +60,7 @@ EMCC_FLAGS=(
     -s ALLOW_MEMORY_GROWTH=0      # Fixed memory (determinism)
     -s INITIAL_MEMORY=16MB        # 16MB initial heap
     -s STACK_SIZE=1MB             # 1MB stack
-    -s EXPORTED_FUNCTIONS='["_neg_create","_neg_step","_neg_get_state_json","_neg_get_state_binary","_neg_get_state_binary_size","_neg_get_state_hash","_neg_reset_from_binary","_neg_destroy","_neg_get_version","_neg_get_last_error","_neg_get_diagnostics"]'
+    -s EXPORTED_FUNCTIONS='["_neg_create","_neg_step","_neg_step_n","_neg_get_state_json","_neg_get_state_binary","_neg_get_state_binary_size","_neg_get_state_hash","_neg_reset_from_binary","_neg_destroy","_neg_get_version","_neg_get_last_error","_neg_get_diagnostics","_neg_get_memory_report","_neg_get_metrics_text","_neg_step_async","_neg_poll","_neg_wait","_neg_open_event_log","_neg_log_event","_neg_close_event_log","_neg_verify_event_log","_neg_open_replay","_neg_seek","_neg_close_replay","_neg_enable_rollback","_neg_rollback","_neg_get_rollback_depth"]'
     -s EXPORTED_RUNTIME_METHODS='["ccall","cwrap","UTF8ToString"]'
     -s MODULARIZE=1               # Export as module
     -s EXPORT_NAME="NegentropicCore"
@@ -23,6 +23,10 @@ SOURCES=(
     "${PROJECT_ROOT}/src/solvers/hydrology_richards_lite.c"
     "${PROJECT_ROOT}/src/solvers/regeneration_cascade.c"
     "${PROJECT_ROOT}/src/solvers/regeneration_microbial.c"
+    "${PROJECT_ROOT}/src/core/math/barrier_field.c"
+    "${PROJECT_ROOT}/src/core/math/fixed_math.c"
+    "${PROJECT_ROOT}/src/core/phase_timers.c"
+    "${PROJECT_ROOT}/src/core/mem_stats.c"
 )
 
 # Output name
@@ -0,0 +1,205 @@
+/*
+ * lambda_engine.c - Batched λ-Estimation and DLT Record Generation
+ *
+ * Hash all segments with the multi-buffer SHA-256 first (SIMD lanes
+ * stay busy across segments), then run the per-segment λ search.
+ * Compressed cells (T_BSP_COMPRESSED_POSES) are hashed and searched by
+ * streaming them through t_bsp_cell_reader() instead.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/p_tick.c (P_Ticker)
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#include "lambda_engine.h"
+#include "sha256.h"
+#ifdef T_BSP_COMPRESSED_POSES
+#include "pose_codec.h"
+#endif
+#include <string.h>
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/** Segments hashed per sha256_multi() call (bounds stack usage) */
+#define ENGINE_HASH_BATCH  16
+
+#ifdef T_BSP_COMPRESSED_POSES
+/** Compressed cell read through t_bsp_cell_reader() */
+typedef struct {
+    const t_bsp_cell_t* cell;
+    pose_reader_t reader;
+} cell_source_t;
+
+static void cell_source_rewind(void* user) {
+    cell_source_t* src = (cell_source_t*)user;
+    t_bsp_cell_reader(src->cell, &src->reader);
+}
+
+static bool cell_source_next(void* user, se3_pose_t* pose) {
+    return pose_reader_next(&((cell_source_t*)user)->reader, pose);
+}
+
+/**
+ * Fill one record from a compressed cell segment.
+ *
+ * One decode pass hashes the trajectory (same digest as hashing the raw
+ * poses) and picks up MMSI and timestamp; the λ search then re-reads the
+ * cell per evaluation. No pose buffer is expanded.
+ */
+static void process_cell_segment(const lambda_segment_t* seg, dlt_record_t* rec) {
+    cell_source_t cell = { seg->cell, { 0 } };
+    pose_source_t src = { cell_source_rewind, cell_source_next, &cell };
+    sha256_ctx_t hash;
+    se3_pose_t pose;
+    int n = 0;
+
+    sha256_init(&hash);
+    cell_source_rewind(&cell);
+    while (n < seg->n && cell_source_next(&cell, &pose)) {
+        if (n == 0) {
+            rec->mmsi = pose.mmsi;
+        }
+        sha256_update(&hash, &pose, sizeof(pose));
+        rec->timestamp = pose.timestamp;
+        n++;
+    }
+    sha256_final(&hash, rec->trajectory_hash);
+
+    fixed_t lambda = fast_lambda_estimate_source(&src, n, LAMBDA_EPSILON, LAMBDA_MAX_ITER);
+    fixed_t err = compute_return_error_source(&src, n, lambda);
+    fixed_t adjusted = adjust_lambda(lambda, err);
+    if (adjusted != lambda) {
+        err = compute_return_error_source(&src, n, adjusted);
+    }
+    rec->lambda_optimal = adjusted;
+    rec->return_error = err;
+}
+#endif
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+fixed_t lambda_estimate_with_error(const se3_pose_t* poses, int n,
+                                   fixed_t eps, int max_iter, fixed_t* error) {
+    fixed_t lambda = fast_lambda_estimate(poses, n, eps, max_iter);
+    fixed_t err = compute_return_error(poses, n, lambda);
+    fixed_t adjusted = adjust_lambda(lambda, err);
+
+    if (adjusted != lambda) {
+        err = compute_return_error(poses, n, adjusted);
+    }
+    if (error) {
+        *error = err;
+    }
+    return adjusted;
+}
+
+int lambda_engine_process(const lambda_segment_t* segs, int n_segs,
+                          const char* dataset, dlt_record_t* records) {
+    const uint8_t* msgs[ENGINE_HASH_BATCH];
+    size_t lens[ENGINE_HASH_BATCH];
+    uint8_t digests[ENGINE_HASH_BATCH][SHA256_DIGEST_BYTES];
+    int map[ENGINE_HASH_BATCH];
+    int lane[ENGINE_HASH_BATCH];   /* sha256_multi() lane, -1 for cell segments */
+    int written = 0;
+
+    if (segs == NULL || records == NULL || n_segs <= 0) {
+        return 0;
+    }
+    if (dataset == NULL) {
+        dataset = LAMBDA_ENGINE_DATASET;
+    }
+
+    for (int base = 0; base < n_segs; base += ENGINE_HASH_BATCH) {
+        int count = (n_segs - base < ENGINE_HASH_BATCH) ? (n_segs - base) : ENGINE_HASH_BATCH;
+        int queued = 0;
+        int lanes = 0;
+
+        /* Stage 1: multi-buffer trajectory hashes (pose arrays only) */
+        for (int i = 0; i < count; i++) {
+            const lambda_segment_t* seg = &segs[base + i];
+            if (seg->n <= 0) {
+                continue;
+            }
+            if (seg->poses == NULL) {
+#ifdef T_BSP_COMPRESSED_POSES
+                if (seg->cell != NULL) {
+                    map[queued] = base + i;
+                    lane[queued++] = -1;
+                }
+#endif
+                continue;
+            }
+            msgs[lanes] = (const uint8_t*)seg->poses;
+            lens[lanes] = (size_t)seg->n * sizeof(se3_pose_t);
+            map[queued] = base + i;
+            lane[queued++] = lanes++;
+        }
+        sha256_multi(msgs, lens, lanes, digests);
+
+        /* Stage 2: λ search and record assembly */
+        for (int q = 0; q < queued; q++) {
+            const lambda_segment_t* seg = &segs[map[q]];
+            dlt_record_t* rec = &records[written++];
+
+            memset(rec, 0, sizeof(*rec));
+            strncpy(rec->dataset, dataset, sizeof(rec->dataset) - 1);
+            rec->cell_id = seg->cell_id;
+#ifdef T_BSP_COMPRESSED_POSES
+            if (lane[q] < 0) {
+                process_cell_segment(seg, rec);
+                continue;
+            }
+#endif
+            rec->mmsi = seg->poses[0].mmsi;
+            rec->lambda_optimal = lambda_estimate_with_error(seg->poses, seg->n,
+                                                             LAMBDA_EPSILON, LAMBDA_MAX_ITER,
+                                                             &rec->return_error);
+            memcpy(rec->trajectory_hash, digests[lane[q]], SHA256_DIGEST_BYTES);
+            rec->timestamp = seg->poses[seg->n - 1].timestamp;
+        }
+    }
+
+    return written;
+}
+
+int lambda_engine_publish(const lambda_segment_t* segs, int n_segs, dlt_record_t* records) {
+    int produced = lambda_engine_process(segs, n_segs, NULL, records);
+    int published = 0;
+
+    for (int i = 0; i < produced; i++) {
+        if (publish_lambda_record(&records[i])) {
+            published++;
+        }
+    }
+    return published;
+}
+
+int lambda_engine_collect_cells(const t_bsp_t* bsp, float threshold,
+                                lambda_segment_t* segs, int max_segs) {
+    int count = 0;
+
+    if (bsp == NULL || segs == NULL) {
+        return 0;
+    }
+
+    for (int i = 0; i < MAX_CELLS && count < max_segs; i++) {
+        const t_bsp_cell_t* cell = &bsp->cells[i];
+        if (cell->pose_count > 0 && t_bsp_cell_near_full(cell, threshold)) {
+#ifdef T_BSP_COMPRESSED_POSES
+            segs[count].poses = NULL;
+            segs[count].cell = cell;
+#else
+            segs[count].poses = cell->poses;
+#endif
+            segs[count].n = cell->pose_count;
+            segs[count].cell_id = cell->cell_id;
+            segs[count]._padding = 0;
+            count++;
+        }
+    }
+    return count;
+}
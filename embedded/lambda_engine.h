@@ -0,0 +1,134 @@
+/*
+ * lambda_engine.h - Batched λ-Estimation and DLT Record Generation
+ *
+ * Turns full T-BSP cells (raw or compressed) or caller pose arrays into
+ * publishable dlt_record_t entries in one pass:
+ *
+ *   1. Trajectory hashes for all segments via sha256_multi()
+ *      (4-8 segments per SIMD pass)
+ *   2. Fixed-point λ per segment via fast_lambda_estimate()
+ *   3. Record assembly (dataset, MMSI, cell, λ, error, hash, timestamp)
+ *
+ * Throughput target: the full AIS feed on one core. A 128-pose cell
+ * costs ~80 µs on desktop x86-64 (dominated by the λ search), i.e.
+ * >10k cells/s vs ~250 cells/s produced by a global AIS stream.
+ *
+ * Doom analog: P_Ticker() — one batched pass over all thinkers per tic
+ * instead of per-object callbacks.
+ *
+ * Hardware Target: ESP32-S3 (no malloc) / desktop aggregator
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#ifndef LAMBDA_ENGINE_H
+#define LAMBDA_ENGINE_H
+
+#include "se3_edge.h"
+#include "t_bsp.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * CONFIGURATION CONSTANTS
+ * ======================================================================== */
+
+/** Default dataset tag for AIS-derived records */
+#define LAMBDA_ENGINE_DATASET  "MarineCadastre_AIS"
+
+/* ========================================================================
+ * DATA STRUCTURES
+ * ======================================================================== */
+
+/**
+ * Trajectory segment queued for λ-estimation.
+ *
+ * Points into caller-owned pose storage (a raw T-BSP cell or any pose
+ * array) or, in compressed builds, at a compressed cell that is decoded
+ * on the fly; the engine never copies poses.
+ */
+typedef struct {
+    const se3_pose_t* poses;   /**< First pose of segment (NULL: read cell) */
+#ifdef T_BSP_COMPRESSED_POSES
+    const t_bsp_cell_t* cell;  /**< Compressed source when poses is NULL */
+#endif
+    int n;                     /**< Number of poses */
+    uint16_t cell_id;          /**< Source cell (for record.cell_id) */
+    uint16_t _padding;         /**< Alignment */
+} lambda_segment_t;
+
+/* ========================================================================
+ * API FUNCTIONS
+ * ======================================================================== */
+
+/**
+ * Estimate λ and its return error for one segment.
+ *
+ * @param poses Trajectory
+ * @param n Number of poses
+ * @param eps Bracket tolerance (e.g. LAMBDA_EPSILON)
+ * @param max_iter Iteration budget (e.g. LAMBDA_MAX_ITER)
+ * @param error Output: return error at the published λ (may be NULL)
+ * @return Publishable λ (after adjust_lambda)
+ */
+fixed_t lambda_estimate_with_error(const se3_pose_t* poses, int n,
+                                   fixed_t eps, int max_iter, fixed_t* error);
+
+/**
+ * Build DLT records for a batch of segments.
+ *
+ * Record fields:
+ *   - mmsi:      MMSI of the segment's first pose
+ *   - timestamp: timestamp of the segment's last pose
+ *   - signature: zeroed (signing happens in the transport sink)
+ *
+ * Empty segments (n <= 0, or no poses and no cell) are skipped and
+ * produce no record.
+ *
+ * @param segs Segments to process
+ * @param n_segs Number of segments
+ * @param dataset Dataset tag (NULL = LAMBDA_ENGINE_DATASET, truncated to 31 chars)
+ * @param records Output: one record per non-empty segment (caller-allocated, n_segs entries)
+ * @return Number of records written
+ */
+int lambda_engine_process(const lambda_segment_t* segs, int n_segs,
+                          const char* dataset, dlt_record_t* records);
+
+/**
+ * Process and publish a batch (lambda_engine_process + publish_lambda_record).
+ *
+ * @param segs Segments to process
+ * @param n_segs Number of segments
+ * @param records Scratch/output records (n_segs entries)
+ * @return Number of records accepted by the publish sink
+ */
+int lambda_engine_publish(const lambda_segment_t* segs, int n_segs, dlt_record_t* records);
+
+/**
+ * Queue every active cell at or above a fill threshold.
+ *
+ * Segments reference cell storage directly: call t_bsp_reset_cell() only
+ * after the batch has been processed. In compressed builds a segment
+ * names the cell and lambda_engine_process() streams it through
+ * t_bsp_cell_reader() / pose_reader_next(), so no decode buffer is
+ * needed; records match those of the same poses stored raw.
+ *
+ * @param bsp T-BSP root
+ * @param threshold Fill fraction (1.0 = full cells only; bytes in
+ *                  compressed builds, see t_bsp_cell_near_full())
+ * @param segs Output segments
+ * @param max_segs Capacity of segs (MAX_CELLS is always sufficient)
+ * @return Number of segments queued
+ */
+int lambda_engine_collect_cells(const t_bsp_t* bsp, float threshold,
+                                lambda_segment_t* segs, int max_segs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LAMBDA_ENGINE_H */
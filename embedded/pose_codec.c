@@ -0,0 +1,382 @@
+/*
+ * pose_codec.c - Delta-Compressed SE(3) Trajectory Encoding Implementation
+ *
+ * Zigzag + LEB128 varint coding of yaw index, translation and timestamp
+ * residuals against a per-vessel constant-velocity predictor. Lossless,
+ * no malloc.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/g_game.c (demo tic encoding)
+ * Author: ClaudeCode (pose compression)
+ * Version: 1.0
+ */
+
+#include "pose_codec.h"
+#include <string.h>
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/** Shift from fine angle index to 32-bit BAM angle */
+#define FINE_TO_ANGLE_SHIFT  (32 - ANGLE_BITS)
+
+/**
+ * Zigzag-map signed value to unsigned (small magnitudes → small codes).
+ *
+ * Computed in uint32_t so that no signed shift or overflow occurs.
+ */
+static inline uint32_t zigzag_encode(int32_t v) {
+    uint32_t u = (uint32_t)v;
+    return (u << 1) ^ (0u - (u >> 31));
+}
+
+/**
+ * Inverse of zigzag_encode().
+ */
+static inline int32_t zigzag_decode(uint32_t z) {
+    return (int32_t)((z >> 1) ^ (0u - (z & 1u)));
+}
+
+/**
+ * Write LEB128 varint (7 bits per byte, MSB = continuation).
+ *
+ * Caller guarantees room (see POSE_RECORD_MAX_BYTES).
+ *
+ * @return Number of bytes written (1-5)
+ */
+static inline int varint_write(uint8_t* out, uint32_t v) {
+    int n = 0;
+    while (v >= 0x80u) {
+        out[n++] = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/**
+ * Read LEB128 varint with bounds checking.
+ *
+ * @param data Stream bytes
+ * @param end Number of valid bytes in data
+ * @param offset In/out: read position
+ * @param v Output: decoded value
+ * @return true on success, false on truncated or over-long varint
+ */
+static inline bool varint_read(const uint8_t* data, uint16_t end,
+                               uint16_t* offset, uint32_t* v) {
+    uint32_t result = 0;
+    uint16_t pos = *offset;
+
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (pos >= end) {
+            return false;
+        }
+        uint8_t byte = data[pos++];
+        result |= (uint32_t)(byte & 0x7Fu) << shift;
+        if ((byte & 0x80u) == 0) {
+            *offset = pos;
+            *v = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reset predictor to the keyframe origin.
+ */
+static inline void predictor_reset(pose_predictor_t* pred, uint32_t mmsi) {
+    memset(pred, 0, sizeof(*pred));
+    pred->mmsi = mmsi;
+}
+
+/**
+ * Find (or assign) the predictor slot of a vessel.
+ *
+ * Slots fill in order; once all are taken the least recently used one
+ * is handed to the new vessel.
+ *
+ * @param is_new Output: true if the slot was (re)assigned to mmsi
+ */
+static uint8_t vessel_slot(const pose_stream_t* stream, uint32_t mmsi, bool* is_new) {
+    for (uint8_t i = 0; i < stream->slots_used; i++) {
+        if (stream->pred[i].mmsi == mmsi) {
+            *is_new = false;
+            return i;
+        }
+    }
+
+    *is_new = true;
+    if (stream->slots_used < POSE_VESSEL_SLOTS) {
+        return stream->slots_used;
+    }
+
+    uint8_t victim = 0;
+    for (uint8_t i = 1; i < POSE_VESSEL_SLOTS; i++) {
+        if (stream->last_use[i] < stream->last_use[victim]) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+/**
+ * Binary search one quarter of the fine sine wave for a (sin, cos) pair.
+ *
+ * Within a quarter the table is monotonic (ascending for quarters 0 and 3,
+ * descending for 1 and 2). Near the extrema adjacent entries can be equal
+ * at Q16.16 resolution, so after locating the first entry equal to sin we
+ * scan the run of equal values and disambiguate with the cosine entry.
+ */
+static bool search_quarter(int quarter, fixed_t s, fixed_t c, uint32_t* idx) {
+    const int base = quarter * QUARTER_FINE_ANGLES;
+    const bool ascending = (quarter == 0 || quarter == 3);
+    int lo = 0;
+    int hi = QUARTER_FINE_ANGLES;
+
+    /* Lower bound: first position not "before" s in table order */
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        fixed_t v = finesine_at((uint32_t)(base + mid));
+        bool before = ascending ? (v < s) : (v > s);
+        if (before) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (int i = lo; i < QUARTER_FINE_ANGLES && finesine_at((uint32_t)(base + i)) == s; i++) {
+        uint32_t cand = (uint32_t)(base + i);
+        if (finesine_at(cand + QUARTER_FINE_ANGLES) == c) {
+            *idx = cand;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+/**
+ * Recover fine angle index from a yaw rotation matrix.
+ *
+ * rotation_from_yaw() writes R = [c -s 0; s c 0; 0 0 1] with
+ * s = finesine_at(idx), c = finesine_at(idx + 2048). Sign of (s, c) selects
+ * the candidate quarter(s); each is a short binary search.
+ *
+ * Performance: ~1 µs @ 240 MHz worst case (4 × 11 probes)
+ */
+bool pose_yaw_index(const fixed_t R[9], uint32_t* idx) {
+    const fixed_t s = R[3];
+    const fixed_t c = R[0];
+
+    /* Reject anything that is not a pure yaw about the Up axis */
+    if (R[1] != -s || R[4] != c ||
+        R[2] != 0 || R[5] != 0 ||
+        R[6] != 0 || R[7] != 0 || R[8] != FRACUNIT) {
+        return false;
+    }
+
+    for (int q = 0; q < 4; q++) {
+        if (search_quarter(q, s, c, idx)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Reset stream to empty.
+ */
+void pose_stream_reset(pose_stream_t* stream) {
+    stream->count = 0;
+    stream->used = 0;
+    stream->slot = 0;
+    stream->slots_used = 0;
+    memset(stream->last_use, 0, sizeof(stream->last_use));
+    for (int i = 0; i < POSE_VESSEL_SLOTS; i++) {
+        predictor_reset(&stream->pred[i], 0);
+    }
+}
+
+/**
+ * Check whether another worst-case record fits.
+ */
+bool pose_stream_has_room(const pose_stream_t* stream) {
+    return (size_t)stream->used + POSE_RECORD_MAX_BYTES <= POSE_STREAM_BYTES;
+}
+
+/**
+ * Append pose to stream.
+ *
+ * Residuals are formed in uint32_t (two's complement wraparound) so the
+ * codec is lossless for every int32 input, including extreme jumps.
+ */
+bool pose_stream_append(pose_stream_t* stream, const se3_pose_t* pose) {
+    if (!pose_stream_has_room(stream)) {
+        return false;
+    }
+
+    uint8_t* out = stream->data + stream->used;
+    int n = 0;
+
+    bool is_new;
+    uint8_t slot = vessel_slot(stream, pose->mmsi, &is_new);
+    pose_predictor_t* pred = &stream->pred[slot];
+
+    uint32_t flags = 0;
+    if (is_new || slot != stream->slot) {
+        flags |= POSE_REC_VESSEL;
+    }
+    if (is_new) {
+        predictor_reset(pred, pose->mmsi);
+        if (slot == stream->slots_used) {
+            stream->slots_used++;
+        }
+    }
+
+    uint32_t yaw_idx = pred->yaw_idx;
+    int32_t d_yaw = 0;
+    if (pose_yaw_index(pose->rotation, &yaw_idx)) {
+        /* Shortest signed turn in [-4096, 4095] fine angles */
+        d_yaw = (int32_t)((yaw_idx - pred->yaw_idx + NUM_FINE_ANGLES / 2) & ANGLE_MASK)
+                - NUM_FINE_ANGLES / 2;
+    } else {
+        flags |= POSE_REC_RAW_ROT;
+        yaw_idx = pred->yaw_idx;  /* Yaw predictor unchanged */
+    }
+
+    n += varint_write(out + n, (zigzag_encode(d_yaw) << 2) | flags);
+
+    if (flags & POSE_REC_VESSEL) {
+        n += varint_write(out + n, (uint32_t)slot << 1 | (uint32_t)is_new);
+    }
+    if (is_new) {
+        n += varint_write(out + n, pose->mmsi);
+    }
+
+    if (flags & POSE_REC_RAW_ROT) {
+        for (int i = 0; i < 9; i++) {
+            n += varint_write(out + n, zigzag_encode(pose->rotation[i]));
+        }
+    }
+
+    /* Translation: residual against constant-velocity prediction */
+    for (int i = 0; i < 3; i++) {
+        uint32_t step = (uint32_t)pose->translation[i] - (uint32_t)pred->pos[i];
+        uint32_t resid = step - (uint32_t)pred->vel[i];
+        n += varint_write(out + n, zigzag_encode((int32_t)resid));
+
+        pred->pos[i] = pose->translation[i];
+        pred->vel[i] = is_new ? 0 : (int32_t)step;
+    }
+
+    /* Timestamp: residual against previous report interval */
+    uint32_t dt = pose->timestamp - pred->timestamp;
+    n += varint_write(out + n, zigzag_encode((int32_t)(dt - pred->dt)));
+
+    pred->timestamp = pose->timestamp;
+    pred->dt = is_new ? 0 : dt;
+    pred->yaw_idx = yaw_idx;
+
+    stream->slot = slot;
+    stream->last_use[slot] = stream->count;
+    stream->used = (uint16_t)(stream->used + n);
+    stream->count++;
+    return true;
+}
+
+/**
+ * Initialize streaming decoder.
+ */
+void pose_reader_init(pose_reader_t* reader, const pose_stream_t* stream) {
+    reader->stream = stream;
+    reader->offset = 0;
+    reader->index = 0;
+    reader->slot = 0;
+    for (int i = 0; i < POSE_VESSEL_SLOTS; i++) {
+        predictor_reset(&reader->pred[i], 0);
+    }
+}
+
+/**
+ * Decode next pose.
+ *
+ * Mirrors pose_stream_append() step for step.
+ */
+bool pose_reader_next(pose_reader_t* reader, se3_pose_t* pose) {
+    const pose_stream_t* stream = reader->stream;
+    const uint8_t* data = stream->data;
+    const uint16_t end = stream->used;
+    uint16_t off = reader->offset;
+    uint32_t v;
+
+    if (reader->index >= stream->count) {
+        return false;
+    }
+
+    if (!varint_read(data, end, &off, &v)) {
+        return false;
+    }
+    uint32_t flags = v & 0x3u;
+    int32_t d_yaw = zigzag_decode(v >> 2);
+
+    bool is_new = false;
+    if (flags & POSE_REC_VESSEL) {
+        uint32_t select;
+        if (!varint_read(data, end, &off, &select) || (select >> 1) >= POSE_VESSEL_SLOTS) {
+            return false;
+        }
+        reader->slot = (uint8_t)(select >> 1);
+        is_new = (select & 1u) != 0;
+    }
+    pose_predictor_t* pred = &reader->pred[reader->slot];
+
+    if (is_new) {
+        uint32_t mmsi;
+        if (!varint_read(data, end, &off, &mmsi)) {
+            return false;
+        }
+        predictor_reset(pred, mmsi);
+    }
+
+    if (flags & POSE_REC_RAW_ROT) {
+        for (int i = 0; i < 9; i++) {
+            if (!varint_read(data, end, &off, &v)) {
+                return false;
+            }
+            pose->rotation[i] = zigzag_decode(v);
+        }
+    } else {
+        pred->yaw_idx = (pred->yaw_idx + (uint32_t)d_yaw) & ANGLE_MASK;
+        rotation_from_yaw(pred->yaw_idx << FINE_TO_ANGLE_SHIFT, pose->rotation);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        if (!varint_read(data, end, &off, &v)) {
+            return false;
+        }
+        uint32_t step = (uint32_t)pred->vel[i] + (uint32_t)zigzag_decode(v);
+        pred->pos[i] = (int32_t)((uint32_t)pred->pos[i] + step);
+        pred->vel[i] = is_new ? 0 : (int32_t)step;
+        pose->translation[i] = pred->pos[i];
+    }
+
+    if (!varint_read(data, end, &off, &v)) {
+        return false;
+    }
+    uint32_t dt = pred->dt + (uint32_t)zigzag_decode(v);
+    pred->timestamp += dt;
+    pred->dt = is_new ? 0 : dt;
+
+    pose->timestamp = pred->timestamp;
+    pose->mmsi = pred->mmsi;
+
+    reader->offset = off;
+    reader->index++;
+    return true;
+}
@@ -0,0 +1,85 @@
+/*
+ * record_lambda.c - DLT Record Hashing and Publication
+ *
+ * Trajectory hashing (SHA-256 over the packed pose sequence) and the
+ * publication hook for λ-estimation records. The network transport
+ * (IOTA Streams, MQTT, serial uplink) is platform-specific and is
+ * registered as a sink callback, keeping this file free of I/O.
+ *
+ * Hash input: n × 56-byte packed se3_pose_t, little-endian, in
+ * insertion order. All supported targets (x86-64, WASM, ESP32-S3
+ * Xtensa) are little-endian, so poses are hashed in place.
+ *
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#include "se3_edge.h"
+#include "sha256.h"
+#include <string.h>
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#error "record_lambda.c hashes packed poses in place and assumes a little-endian target"
+#endif
+
+_Static_assert(sizeof(se3_pose_t) == 56, "Trajectory hash format depends on 56-byte packed poses");
+
+/* ========================================================================
+ * MODULE STATE
+ * ======================================================================== */
+
+static dlt_publish_fn g_publish_sink = NULL;
+static void* g_publish_user = NULL;
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+/**
+ * Compute SHA-256 of a pose sequence.
+ *
+ * For many segments at once prefer lambda_engine_process(), which
+ * hashes 4-8 trajectories per SIMD pass.
+ *
+ * @param poses Pose sequence
+ * @param n Number of poses
+ * @param hash Output: 32-byte digest
+ */
+void compute_trajectory_hash(const se3_pose_t* poses, int n, uint8_t* hash) {
+    size_t len = (poses != NULL && n > 0) ? (size_t)n * sizeof(se3_pose_t) : 0;
+    sha256(poses, len, hash);
+}
+
+/**
+ * Register transport for published records.
+ *
+ * @param sink Callback invoked per record (NULL to disable publishing)
+ * @param user Opaque pointer passed to sink
+ */
+void dlt_set_publish_sink(dlt_publish_fn sink, void* user) {
+    g_publish_sink = sink;
+    g_publish_user = user;
+}
+
+/**
+ * Publish λ record through the registered sink.
+ *
+ * Records with an unterminated dataset name or λ outside the search
+ * bracket are rejected before reaching the transport.
+ *
+ * @param record Record to publish
+ * @return true if the sink accepted the record, false otherwise
+ *         (no sink, invalid record, or transport failure)
+ */
+bool publish_lambda_record(const dlt_record_t* record) {
+    if (record == NULL || g_publish_sink == NULL) {
+        return false;
+    }
+    if (memchr(record->dataset, '\0', sizeof(record->dataset)) == NULL) {
+        return false;
+    }
+    if (record->lambda_optimal < LAMBDA_MIN || record->lambda_optimal > LAMBDA_MAX) {
+        return false;
+    }
+    return g_publish_sink(record, g_publish_user);
+}
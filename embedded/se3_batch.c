@@ -0,0 +1,282 @@
+/*
+ * se3_batch.c - SIMD Batch Fixed-Point SE(3) Math (struct-of-arrays)
+ *
+ * All three kernels reduce to one primitive, DOT3: per lane,
+ *   (int32)(((int64)a0*b0 + (int64)a1*b1 + (int64)a2*b2) >> FRACBITS)
+ *
+ * SIMD multiplies produce 64-bit products for half the 32-bit lanes at a
+ * time (even lanes, then odd lanes shifted down). Only bits 16..47 of the
+ * 64-bit sum survive the final truncation, so a logical 64-bit shift is
+ * as good as the arithmetic shift of the scalar code, and 64-bit
+ * wraparound in the adds cannot change those bits.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/r_draw.c (R_DrawColumn)
+ * Author: ClaudeCode (batch SE(3) math)
+ * Version: 1.0
+ */
+
+#include "se3_batch.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/** Scalar reference (same expression as rotation_mul / mat3_mul_vec3) */
+static inline fixed_t dot3_scalar(fixed_t a0, fixed_t b0, fixed_t a1, fixed_t b1,
+                                  fixed_t a2, fixed_t b2) {
+    int64_t sum = (int64_t)a0 * (int64_t)b0;
+    sum += (int64_t)a1 * (int64_t)b1;
+    sum += (int64_t)a2 * (int64_t)b2;
+    return (fixed_t)(sum >> FRACBITS);
+}
+
+#if defined(__AVX2__)
+
+#define SB_LANES 8
+typedef __m256i sb_vec_t;
+#define SB_LOAD(p)      _mm256_loadu_si256((const __m256i*)(p))
+#define SB_STORE(p, v)  _mm256_storeu_si256((__m256i*)(p), v)
+#define SB_SUB(a, b)    _mm256_sub_epi32(a, b)
+
+static inline sb_vec_t sb_dot3(sb_vec_t a0, sb_vec_t b0, sb_vec_t a1, sb_vec_t b1,
+                               sb_vec_t a2, sb_vec_t b2) {
+    /* Even lanes: vpmuldq uses the low (signed) dword of each qword */
+    __m256i even = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(a0, b0),
+                                                     _mm256_mul_epi32(a1, b1)),
+                                    _mm256_mul_epi32(a2, b2));
+    /* Odd lanes: shift the high dwords down first */
+    __m256i odd = _mm256_add_epi64(
+        _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(a0, 32), _mm256_srli_epi64(b0, 32)),
+                         _mm256_mul_epi32(_mm256_srli_epi64(a1, 32), _mm256_srli_epi64(b1, 32))),
+        _mm256_mul_epi32(_mm256_srli_epi64(a2, 32), _mm256_srli_epi64(b2, 32)));
+
+    /* Bits 16..47 → low dword (even) / high dword (odd) */
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, FRACBITS),
+                              _mm256_slli_epi64(odd, 32 - FRACBITS), 0xAA);
+}
+
+#elif defined(__SSE2__)
+
+#define SB_LANES 4
+typedef __m128i sb_vec_t;
+#define SB_LOAD(p)      _mm_loadu_si128((const __m128i*)(p))
+#define SB_STORE(p, v)  _mm_storeu_si128((__m128i*)(p), v)
+#define SB_SUB(a, b)    _mm_sub_epi32(a, b)
+
+#if defined(__SSE4_1__)
+/** Signed 32×32→64 products of the even lanes (pmuldq) */
+static inline __m128i sb_mul_even(__m128i a, __m128i b) {
+    return _mm_mul_epi32(a, b);
+}
+#else
+/**
+ * Signed 32×32→64 products of the even lanes with SSE2 only.
+ *
+ * pmuludq gives the unsigned product; the signed one differs by
+ * (a<0 ? b : 0) + (b<0 ? a : 0) in the high dword.
+ */
+static inline __m128i sb_mul_even(__m128i a, __m128i b) {
+    __m128i corr = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                 _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(corr, 32));
+}
+#endif
+
+static inline sb_vec_t sb_dot3(sb_vec_t a0, sb_vec_t b0, sb_vec_t a1, sb_vec_t b1,
+                               sb_vec_t a2, sb_vec_t b2) {
+    __m128i even = _mm_add_epi64(_mm_add_epi64(sb_mul_even(a0, b0), sb_mul_even(a1, b1)),
+                                 sb_mul_even(a2, b2));
+    __m128i odd = _mm_add_epi64(
+        _mm_add_epi64(sb_mul_even(_mm_srli_epi64(a0, 32), _mm_srli_epi64(b0, 32)),
+                      sb_mul_even(_mm_srli_epi64(a1, 32), _mm_srli_epi64(b1, 32))),
+        sb_mul_even(_mm_srli_epi64(a2, 32), _mm_srli_epi64(b2, 32)));
+
+    even = _mm_srli_epi64(even, FRACBITS);
+    odd = _mm_slli_epi64(odd, 32 - FRACBITS);
+#if defined(__SSE4_1__)
+    return _mm_blend_epi16(even, odd, 0xCC);
+#else
+    {
+        const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+        return _mm_or_si128(_mm_and_si128(even, lo_mask), _mm_andnot_si128(lo_mask, odd));
+    }
+#endif
+}
+
+#elif defined(__wasm_simd128__)
+
+#define SB_LANES 4
+typedef v128_t sb_vec_t;
+#define SB_LOAD(p)      wasm_v128_load(p)
+#define SB_STORE(p, v)  wasm_v128_store(p, v)
+#define SB_SUB(a, b)    wasm_i32x4_sub(a, b)
+
+static inline sb_vec_t sb_dot3(sb_vec_t a0, sb_vec_t b0, sb_vec_t a1, sb_vec_t b1,
+                               sb_vec_t a2, sb_vec_t b2) {
+    /* Lanes 0,1 and 2,3 as exact i64 products */
+    v128_t lo = wasm_i64x2_add(wasm_i64x2_add(wasm_i64x2_extmul_low_i32x4(a0, b0),
+                                              wasm_i64x2_extmul_low_i32x4(a1, b1)),
+                               wasm_i64x2_extmul_low_i32x4(a2, b2));
+    v128_t hi = wasm_i64x2_add(wasm_i64x2_add(wasm_i64x2_extmul_high_i32x4(a0, b0),
+                                              wasm_i64x2_extmul_high_i32x4(a1, b1)),
+                               wasm_i64x2_extmul_high_i32x4(a2, b2));
+
+    lo = wasm_u64x2_shr(lo, FRACBITS);
+    hi = wasm_u64x2_shr(hi, FRACBITS);
+    return wasm_i32x4_shuffle(lo, hi, 0, 2, 4, 6);
+}
+
+#else
+#define SB_LANES 1
+#endif
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+int se3_batch_lanes(void) {
+    return SB_LANES;
+}
+
+void mat3_soa_bind(mat3_soa_t* mat, fixed_t* buf, int stride) {
+    for (int k = 0; k < 9; k++) {
+        mat->m[k] = buf + (size_t)k * (size_t)stride;
+    }
+}
+
+void vec3_soa_bind(vec3_soa_t* vec, fixed_t* buf, int stride) {
+    for (int k = 0; k < 3; k++) {
+        vec->v[k] = buf + (size_t)k * (size_t)stride;
+    }
+}
+
+void rotation_mul_n(const mat3_soa_t* A, const mat3_soa_t* B, const mat3_soa_t* C, int n) {
+    int i = 0;
+
+#if SB_LANES > 1
+    for (; i + SB_LANES <= n; i += SB_LANES) {
+        sb_vec_t a[9], b[9], c[9];
+
+        for (int k = 0; k < 9; k++) {
+            a[k] = SB_LOAD(A->m[k] + i);
+            b[k] = SB_LOAD(B->m[k] + i);
+        }
+        for (int r = 0; r < 3; r++) {
+            for (int col = 0; col < 3; col++) {
+                c[r*3 + col] = sb_dot3(a[r*3 + 0], b[0*3 + col],
+                                       a[r*3 + 1], b[1*3 + col],
+                                       a[r*3 + 2], b[2*3 + col]);
+            }
+        }
+        for (int k = 0; k < 9; k++) {
+            SB_STORE(C->m[k] + i, c[k]);
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        fixed_t a[9], b[9];
+
+        for (int k = 0; k < 9; k++) {
+            a[k] = A->m[k][i];
+            b[k] = B->m[k][i];
+        }
+        for (int r = 0; r < 3; r++) {
+            for (int col = 0; col < 3; col++) {
+                C->m[r*3 + col][i] = dot3_scalar(a[r*3 + 0], b[0*3 + col],
+                                                 a[r*3 + 1], b[1*3 + col],
+                                                 a[r*3 + 2], b[2*3 + col]);
+            }
+        }
+    }
+}
+
+void mat3_mul_vec3_n(const mat3_soa_t* R, const vec3_soa_t* v, const vec3_soa_t* out, int n) {
+    int i = 0;
+
+#if SB_LANES > 1
+    for (; i + SB_LANES <= n; i += SB_LANES) {
+        sb_vec_t x = SB_LOAD(v->v[0] + i);
+        sb_vec_t y = SB_LOAD(v->v[1] + i);
+        sb_vec_t z = SB_LOAD(v->v[2] + i);
+        sb_vec_t o[3];
+
+        for (int r = 0; r < 3; r++) {
+            o[r] = sb_dot3(SB_LOAD(R->m[r*3 + 0] + i), x,
+                           SB_LOAD(R->m[r*3 + 1] + i), y,
+                           SB_LOAD(R->m[r*3 + 2] + i), z);
+        }
+        for (int r = 0; r < 3; r++) {
+            SB_STORE(out->v[r] + i, o[r]);
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        fixed_t x = v->v[0][i], y = v->v[1][i], z = v->v[2][i];
+
+        for (int r = 0; r < 3; r++) {
+            out->v[r][i] = dot3_scalar(R->m[r*3 + 0][i], x,
+                                       R->m[r*3 + 1][i], y,
+                                       R->m[r*3 + 2][i], z);
+        }
+    }
+}
+
+void vec3_sub_n(const vec3_soa_t* a, const vec3_soa_t* b, const vec3_soa_t* out, int n) {
+    for (int k = 0; k < 3; k++) {
+        const fixed_t* pa = a->v[k];
+        const fixed_t* pb = b->v[k];
+        fixed_t* po = out->v[k];
+        int i = 0;
+
+#if SB_LANES > 1
+        for (; i + SB_LANES <= n; i += SB_LANES) {
+            SB_STORE(po + i, SB_SUB(SB_LOAD(pa + i), SB_LOAD(pb + i)));
+        }
+#endif
+        for (; i < n; i++) {
+            po[i] = (fixed_t)((uint32_t)pa[i] - (uint32_t)pb[i]);
+        }
+    }
+}
+
+void se3_poses_to_soa(const se3_pose_t* poses, int n, const mat3_soa_t* R, const vec3_soa_t* t) {
+    for (int i = 0; i < n; i++) {
+        if (R) {
+            for (int k = 0; k < 9; k++) {
+                R->m[k][i] = poses[i].rotation[k];
+            }
+        }
+        if (t) {
+            for (int k = 0; k < 3; k++) {
+                t->v[k][i] = poses[i].translation[k];
+            }
+        }
+    }
+}
+
+void se3_poses_from_soa(const mat3_soa_t* R, const vec3_soa_t* t, int n, se3_pose_t* poses) {
+    for (int i = 0; i < n; i++) {
+        if (R) {
+            for (int k = 0; k < 9; k++) {
+                poses[i].rotation[k] = R->m[k][i];
+            }
+        }
+        if (t) {
+            for (int k = 0; k < 3; k++) {
+                poses[i].translation[k] = t->v[k][i];
+            }
+        }
+    }
+}
@@ -95,20 +95,44 @@ static inline fixed_t FixedDiv(fixed_t a, fixed_t b) {
 #define NUM_FINE_ANGLES (1 << ANGLE_BITS)  /* 8192 entries */
 #define ANGLE_MASK (NUM_FINE_ANGLES - 1)
 
+/** Fine angles per quarter turn (2048) */
+#define QUARTER_FINE_ANGLES (NUM_FINE_ANGLES / 4)
+
 /**
- * Sine lookup table (from generated trig_tables.h)
+ * Quarter-wave sine table (from generated trig_tables.h)
+ *
+ * finesine_quarter[i] = sin(i × 90° / 2048) for i = 0..2048 (inclusive,
+ * so sin(90°) = FRACUNIT needs no special case). The other three
+ * quadrants follow by symmetry:
+ *   sin(180° - x) = sin(x),  sin(180° + x) = -sin(x)
  *
- * Resolution: ~0.044° per entry
- * Memory: 32 KB
+ * Resolution: ~0.044° per fine angle (same as Doom's finesine)
+ * Memory: 8 KB (2049 × 4 bytes, vs 32 KB for the full period)
  */
-extern const fixed_t finesine[NUM_FINE_ANGLES];
+extern const fixed_t finesine_quarter[QUARTER_FINE_ANGLES + 1];
 
 /**
- * Cosine via pointer offset (cos(x) = sin(x + 90°))
+ * Full-period fine sine by index, reconstructed from the quarter table.
  *
- * Doom optimization: no separate cosine table needed.
+ * Bit-identical to the former 8192-entry finesine[index] table
+ * (the generator rounds each entry independently and the rounded
+ * values are exactly symmetric).
+ *
+ * @param index Fine angle index (taken modulo NUM_FINE_ANGLES)
+ * @return sin(index × 360° / 8192) in 16.16 fixed-point
  */
-extern const fixed_t* const finecosine;
+static inline fixed_t finesine_at(uint32_t index) {
+    uint32_t quadrant = (index >> (ANGLE_BITS - 2)) & 3u;
+    uint32_t j = index & (QUARTER_FINE_ANGLES - 1);
+    fixed_t v;
+
+    /* Odd quadrants run the table backwards */
+    if (quadrant & 1u) {
+        j = QUARTER_FINE_ANGLES - j;
+    }
+    v = finesine_quarter[j];
+    return (quadrant & 2u) ? -v : v;
+}
 
 /**
  * Sine from LUT using 32-bit angle.
@@ -117,7 +141,7 @@ extern const fixed_t* const finecosine;
  * @return sin(angle) in 16.16 fixed-point [-1.0, 1.0]
  */
 static inline fixed_t Sin_from_LUT(uint32_t angle) {
-    return finesine[(angle >> (32 - ANGLE_BITS)) & ANGLE_MASK];
+    return finesine_at(angle >> (32 - ANGLE_BITS));
 }
 
 /**
@@ -131,7 +155,7 @@ static inline fixed_t Sin_from_LUT(uint32_t angle) {
 static inline fixed_t Cos_from_LUT(uint32_t angle) {
     /* Add 90° (0x40000000 = 1/4 of 2^32) and lookup in sine table */
     uint32_t angle_plus_90 = angle + 0x40000000;
-    return finesine[(angle_plus_90 >> (32 - ANGLE_BITS)) & ANGLE_MASK];
+    return finesine_at(angle_plus_90 >> (32 - ANGLE_BITS));
 }
 
 /* ========================================================================
@@ -248,6 +272,7 @@ fixed_t verify_pythagorean_identity(uint32_t angle);
 fixed_t get_max_pythagorean_error(void);
 fixed_t Sin_from_LUT_interp(uint32_t angle);
 fixed_t Cos_from_LUT_interp(uint32_t angle);
+void SinCos_from_LUT_interp(uint32_t angle, fixed_t* sin_out, fixed_t* cos_out);
 
 /* Spatial partitioning (t_bsp.c) - t_bsp_cell_t already defined above */
 /* See t_bsp.h for full T-BSP API */
@@ -269,8 +294,20 @@ fixed_t compute_return_error(const se3_pose_t* poses, int n, fixed_t lambda);
 fixed_t adjust_lambda(fixed_t lambda, fixed_t error);
 fixed_t fast_lambda_estimate(const se3_pose_t* poses, int n, fixed_t eps, int max_iter);
 
+/* Trajectory read pose by pose (e.g. a compressed T-BSP cell) */
+typedef struct {
+    void (*rewind)(void* user);                  /* Restart at the first pose */
+    bool (*next)(void* user, se3_pose_t* pose);  /* Next pose, false at end */
+    void* user;
+} pose_source_t;
+
+fixed_t compute_return_error_source(const pose_source_t* src, int n, fixed_t lambda);
+fixed_t fast_lambda_estimate_source(const pose_source_t* src, int n, fixed_t eps, int max_iter);
+
 /* DLT integration (record_lambda.c) */
+typedef bool (*dlt_publish_fn)(const dlt_record_t* record, void* user);
 void compute_trajectory_hash(const se3_pose_t* poses, int n, uint8_t* hash);
+void dlt_set_publish_sink(dlt_publish_fn sink, void* user);
 bool publish_lambda_record(const dlt_record_t* record);
 
 /* ========================================================================
@@ -281,6 +318,8 @@ bool publish_lambda_record(const dlt_record_t* record);
 #define LAMBDA_EPSILON       FLOAT_TO_FIXED(0.001f)  /* 0.1% target error */
 #define LAMBDA_VARIANCE_MAX  FLOAT_TO_FIXED(0.005f)  /* Statistical stability */
 #define LAMBDA_MAX_ITER      12                       /* Iteration budget */
+#define LAMBDA_MIN           FLOAT_TO_FIXED(0.1f)    /* Search bracket (matches */
+#define LAMBDA_MAX           FLOAT_TO_FIXED(2.0f)    /*   se3_double_scale.py)  */
 
 /* Geodetic constants (fixed-point degrees) */
 #define FIXED_180_DEG        FLOAT_TO_FIXED(180.0f)
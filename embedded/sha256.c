@@ -0,0 +1,368 @@
+/*
+ * sha256.c - In-Tree SHA-256 Implementation (scalar + multi-buffer SIMD)
+ *
+ * Scalar path follows FIPS 180-4 directly. The multi-buffer path keeps
+ * the eight working variables of 4-8 messages transposed in SIMD
+ * registers (one message per 32-bit lane), so each round instruction
+ * advances every message at once. No lane ever depends on another,
+ * hence digests are identical to the scalar path by construction.
+ *
+ * Reference: NIST FIPS 180-4, Secure Hash Standard (2015)
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#include "sha256.h"
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t H256_INIT[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static inline uint32_t load_be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+           ((uint32_t)p[2] << 8)  |  (uint32_t)p[3];
+}
+
+static inline void store_be32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t rotr32(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+/**
+ * Compress one 64-byte block into chaining state (scalar).
+ */
+static void sha256_compress(uint32_t h[8], const uint8_t* block) {
+    uint32_t w[64];
+    for (int t = 0; t < 16; t++) {
+        w[t] = load_be32(block + 4 * t);
+    }
+    for (int t = 16; t < 64; t++) {
+        uint32_t s0 = rotr32(w[t - 15], 7) ^ rotr32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        uint32_t s1 = rotr32(w[t - 2], 17) ^ rotr32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3];
+    uint32_t e = h[4], f = h[5], g = h[6], k = h[7];
+
+    for (int t = 0; t < 64; t++) {
+        uint32_t S1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = k + S1 + ch + K256[t] + w[t];
+        uint32_t S0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = S0 + maj;
+        k = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+    h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+}
+
+/* ========================================================================
+ * SIMD LANE ABSTRACTION
+ * ======================================================================== */
+
+#if defined(__AVX2__)
+#define MB_LANES 8
+typedef __m256i mbvec_t;
+#define MB_ADD(a, b)    _mm256_add_epi32(a, b)
+#define MB_XOR(a, b)    _mm256_xor_si256(a, b)
+#define MB_AND(a, b)    _mm256_and_si256(a, b)
+#define MB_ANDN(a, b)   _mm256_andnot_si256(a, b)       /* ~a & b */
+#define MB_OR(a, b)     _mm256_or_si256(a, b)
+#define MB_SHR(a, n)    _mm256_srli_epi32(a, n)
+#define MB_SHL(a, n)    _mm256_slli_epi32(a, n)
+#define MB_SET1(x)      _mm256_set1_epi32((int)(x))
+#define MB_LOAD(p)      _mm256_loadu_si256((const __m256i*)(p))
+#define MB_STORE(p, v)  _mm256_storeu_si256((__m256i*)(p), v)
+#elif defined(__SSE2__)
+#define MB_LANES 4
+typedef __m128i mbvec_t;
+#define MB_ADD(a, b)    _mm_add_epi32(a, b)
+#define MB_XOR(a, b)    _mm_xor_si128(a, b)
+#define MB_AND(a, b)    _mm_and_si128(a, b)
+#define MB_ANDN(a, b)   _mm_andnot_si128(a, b)          /* ~a & b */
+#define MB_OR(a, b)     _mm_or_si128(a, b)
+#define MB_SHR(a, n)    _mm_srli_epi32(a, n)
+#define MB_SHL(a, n)    _mm_slli_epi32(a, n)
+#define MB_SET1(x)      _mm_set1_epi32((int)(x))
+#define MB_LOAD(p)      _mm_loadu_si128((const __m128i*)(p))
+#define MB_STORE(p, v)  _mm_storeu_si128((__m128i*)(p), v)
+#elif defined(__wasm_simd128__)
+#define MB_LANES 4
+typedef v128_t mbvec_t;
+#define MB_ADD(a, b)    wasm_i32x4_add(a, b)
+#define MB_XOR(a, b)    wasm_v128_xor(a, b)
+#define MB_AND(a, b)    wasm_v128_and(a, b)
+#define MB_ANDN(a, b)   wasm_v128_andnot(b, a)          /* ~a & b (wasm: b & ~a) */
+#define MB_OR(a, b)     wasm_v128_or(a, b)
+#define MB_SHR(a, n)    wasm_u32x4_shr(a, n)
+#define MB_SHL(a, n)    wasm_i32x4_shl(a, n)
+#define MB_SET1(x)      wasm_i32x4_splat((int32_t)(x))
+#define MB_LOAD(p)      wasm_v128_load(p)
+#define MB_STORE(p, v)  wasm_v128_store(p, v)
+#else
+#define MB_LANES 1
+#endif
+
+#if MB_LANES > 1
+
+#define MB_ROTR(x, n)   MB_OR(MB_SHR(x, n), MB_SHL(x, 32 - (n)))
+
+/**
+ * Build FIPS 180-4 padding tail for a message.
+ *
+ * @param msg Message bytes
+ * @param len Message length
+ * @param tail Output: 1-2 padded blocks (128 bytes)
+ * @return Number of tail blocks (1 or 2)
+ */
+static int sha256_pad_tail(const uint8_t* msg, size_t len, uint8_t tail[2 * SHA256_BLOCK_BYTES]) {
+    size_t rem = len % SHA256_BLOCK_BYTES;
+    int blocks = (rem + 9 <= SHA256_BLOCK_BYTES) ? 1 : 2;
+    uint64_t bits = (uint64_t)len * 8;
+
+    memset(tail, 0, 2 * SHA256_BLOCK_BYTES);
+    if (rem > 0) {
+        memcpy(tail, msg + (len - rem), rem);
+    }
+    tail[rem] = 0x80;
+
+    uint8_t* lenp = tail + blocks * SHA256_BLOCK_BYTES - 8;
+    store_be32(lenp, (uint32_t)(bits >> 32));
+    store_be32(lenp + 4, (uint32_t)bits);
+    return blocks;
+}
+
+/**
+ * Compress one block per lane into transposed state.
+ *
+ * @param state state[i][lane] = h_i of message in lane
+ * @param blocks One 64-byte block pointer per lane
+ */
+static void sha256_compress_mb(uint32_t state[8][MB_LANES], const uint8_t* const blocks[MB_LANES]) {
+    uint32_t wt[16][MB_LANES];
+    mbvec_t w[64];
+
+    /* Gather big-endian message words, one lane per message */
+    for (int t = 0; t < 16; t++) {
+        for (int l = 0; l < MB_LANES; l++) {
+            wt[t][l] = load_be32(blocks[l] + 4 * t);
+        }
+        w[t] = MB_LOAD(wt[t]);
+    }
+    for (int t = 16; t < 64; t++) {
+        mbvec_t x = w[t - 15];
+        mbvec_t y = w[t - 2];
+        mbvec_t s0 = MB_XOR(MB_XOR(MB_ROTR(x, 7), MB_ROTR(x, 18)), MB_SHR(x, 3));
+        mbvec_t s1 = MB_XOR(MB_XOR(MB_ROTR(y, 17), MB_ROTR(y, 19)), MB_SHR(y, 10));
+        w[t] = MB_ADD(MB_ADD(w[t - 16], s0), MB_ADD(w[t - 7], s1));
+    }
+
+    mbvec_t a = MB_LOAD(state[0]), b = MB_LOAD(state[1]);
+    mbvec_t c = MB_LOAD(state[2]), d = MB_LOAD(state[3]);
+    mbvec_t e = MB_LOAD(state[4]), f = MB_LOAD(state[5]);
+    mbvec_t g = MB_LOAD(state[6]), k = MB_LOAD(state[7]);
+
+    for (int t = 0; t < 64; t++) {
+        mbvec_t S1 = MB_XOR(MB_XOR(MB_ROTR(e, 6), MB_ROTR(e, 11)), MB_ROTR(e, 25));
+        mbvec_t ch = MB_XOR(MB_AND(e, f), MB_ANDN(e, g));
+        mbvec_t t1 = MB_ADD(MB_ADD(k, S1), MB_ADD(ch, MB_ADD(MB_SET1(K256[t]), w[t])));
+        mbvec_t S0 = MB_XOR(MB_XOR(MB_ROTR(a, 2), MB_ROTR(a, 13)), MB_ROTR(a, 22));
+        mbvec_t maj = MB_XOR(MB_XOR(MB_AND(a, b), MB_AND(a, c)), MB_AND(b, c));
+        mbvec_t t2 = MB_ADD(S0, maj);
+        k = g; g = f; f = e; e = MB_ADD(d, t1);
+        d = c; c = b; b = a; a = MB_ADD(t1, t2);
+    }
+
+    MB_STORE(state[0], MB_ADD(MB_LOAD(state[0]), a));
+    MB_STORE(state[1], MB_ADD(MB_LOAD(state[1]), b));
+    MB_STORE(state[2], MB_ADD(MB_LOAD(state[2]), c));
+    MB_STORE(state[3], MB_ADD(MB_LOAD(state[3]), d));
+    MB_STORE(state[4], MB_ADD(MB_LOAD(state[4]), e));
+    MB_STORE(state[5], MB_ADD(MB_LOAD(state[5]), f));
+    MB_STORE(state[6], MB_ADD(MB_LOAD(state[6]), g));
+    MB_STORE(state[7], MB_ADD(MB_LOAD(state[7]), k));
+}
+
+/**
+ * Hash up to MB_LANES messages in one interleaved pass.
+ */
+static void sha256_multi_group(const uint8_t* const* msgs, const size_t* lens, int n,
+                               uint8_t (*digests)[SHA256_DIGEST_BYTES]) {
+    uint32_t state[8][MB_LANES];
+    uint32_t saved[8][MB_LANES];
+    uint8_t tails[MB_LANES][2 * SHA256_BLOCK_BYTES];
+    size_t full_blocks[MB_LANES];
+    size_t total_blocks[MB_LANES];
+    size_t max_blocks = 0;
+
+    for (int l = 0; l < MB_LANES; l++) {
+        /* Unused lanes replay lane 0 and are discarded */
+        int src = (l < n) ? l : 0;
+        full_blocks[l] = lens[src] / SHA256_BLOCK_BYTES;
+        total_blocks[l] = full_blocks[l] + (size_t)sha256_pad_tail(msgs[src], lens[src], tails[l]);
+        if (total_blocks[l] > max_blocks) {
+            max_blocks = total_blocks[l];
+        }
+        for (int i = 0; i < 8; i++) {
+            state[i][l] = H256_INIT[i];
+        }
+    }
+
+    for (size_t blk = 0; blk < max_blocks; blk++) {
+        const uint8_t* blocks[MB_LANES];
+
+        for (int l = 0; l < MB_LANES; l++) {
+            int src = (l < n) ? l : 0;
+            if (blk < full_blocks[l]) {
+                blocks[l] = msgs[src] + blk * SHA256_BLOCK_BYTES;
+            } else if (blk < total_blocks[l]) {
+                blocks[l] = tails[l] + (blk - full_blocks[l]) * SHA256_BLOCK_BYTES;
+            } else {
+                blocks[l] = tails[l];  /* Dummy input, result discarded */
+            }
+        }
+
+        memcpy(saved, state, sizeof(state));
+        sha256_compress_mb(state, blocks);
+
+        /* Finished lanes keep their final chaining value */
+        for (int l = 0; l < MB_LANES; l++) {
+            if (blk >= total_blocks[l]) {
+                for (int i = 0; i < 8; i++) {
+                    state[i][l] = saved[i][l];
+                }
+            }
+        }
+    }
+
+    for (int l = 0; l < n; l++) {
+        for (int i = 0; i < 8; i++) {
+            store_be32(digests[l] + 4 * i, state[i][l]);
+        }
+    }
+}
+
+#endif /* MB_LANES > 1 */
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+void sha256_init(sha256_ctx_t* ctx) {
+    memcpy(ctx->h, H256_INIT, sizeof(ctx->h));
+    ctx->total_len = 0;
+    ctx->buf_len = 0;
+}
+
+void sha256_update(sha256_ctx_t* ctx, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    ctx->total_len += len;
+
+    /* Top up a pending partial block first */
+    if (ctx->buf_len > 0) {
+        size_t take = SHA256_BLOCK_BYTES - ctx->buf_len;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(ctx->buf + ctx->buf_len, p, take);
+        ctx->buf_len += (uint32_t)take;
+        p += take;
+        len -= take;
+        if (ctx->buf_len < SHA256_BLOCK_BYTES) {
+            return;
+        }
+        sha256_compress(ctx->h, ctx->buf);
+        ctx->buf_len = 0;
+    }
+
+    /* Whole blocks straight from the caller's buffer */
+    while (len >= SHA256_BLOCK_BYTES) {
+        sha256_compress(ctx->h, p);
+        p += SHA256_BLOCK_BYTES;
+        len -= SHA256_BLOCK_BYTES;
+    }
+
+    if (len > 0) {
+        memcpy(ctx->buf, p, len);
+        ctx->buf_len = (uint32_t)len;
+    }
+}
+
+void sha256_final(sha256_ctx_t* ctx, uint8_t digest[SHA256_DIGEST_BYTES]) {
+    uint8_t tail[2 * SHA256_BLOCK_BYTES];
+    uint64_t bits = ctx->total_len * 8;
+    int blocks = (ctx->buf_len + 9 <= SHA256_BLOCK_BYTES) ? 1 : 2;
+
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, ctx->buf, ctx->buf_len);
+    tail[ctx->buf_len] = 0x80;
+    store_be32(tail + blocks * SHA256_BLOCK_BYTES - 8, (uint32_t)(bits >> 32));
+    store_be32(tail + blocks * SHA256_BLOCK_BYTES - 4, (uint32_t)bits);
+
+    for (int i = 0; i < blocks; i++) {
+        sha256_compress(ctx->h, tail + i * SHA256_BLOCK_BYTES);
+    }
+    for (int i = 0; i < 8; i++) {
+        store_be32(digest + 4 * i, ctx->h[i]);
+    }
+}
+
+void sha256(const void* data, size_t len, uint8_t digest[SHA256_DIGEST_BYTES]) {
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, len);
+    sha256_final(&ctx, digest);
+}
+
+int sha256_multi_lanes(void) {
+    return MB_LANES;
+}
+
+void sha256_multi(const uint8_t* const* msgs, const size_t* lens, int n,
+                  uint8_t (*digests)[SHA256_DIGEST_BYTES]) {
+#if MB_LANES > 1
+    for (int i = 0; i < n; i += MB_LANES) {
+        int group = (n - i < MB_LANES) ? (n - i) : MB_LANES;
+        sha256_multi_group(msgs + i, lens + i, group, digests + i);
+    }
+#else
+    for (int i = 0; i < n; i++) {
+        sha256(msgs[i], lens[i], digests[i]);
+    }
+#endif
+}
@@ -0,0 +1,120 @@
+/*
+ * sha256.h - In-Tree SHA-256 (scalar + multi-buffer SIMD)
+ *
+ * FIPS 180-4 SHA-256 for DLT trajectory hashes, with no external crypto
+ * dependency (ESP32 firmware, WASM and desktop share one implementation).
+ *
+ * Multi-buffer mode hashes several independent messages at once, one
+ * message per 32-bit SIMD lane:
+ *   - AVX2:          8 lanes (__AVX2__)
+ *   - SSE2:          4 lanes (__SSE2__, baseline on x86-64)
+ *   - WASM SIMD128:  4 lanes (__wasm_simd128__)
+ *   - Other targets: 1 lane  (scalar loop, e.g. ESP32 Xtensa)
+ *
+ * All paths produce identical digests; only throughput differs.
+ *
+ * Doom analog: none (Doom had no integrity checks beyond demo version bytes)
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * CONSTANTS
+ * ======================================================================== */
+
+#define SHA256_DIGEST_BYTES  32
+#define SHA256_BLOCK_BYTES   64
+
+/* ========================================================================
+ * DATA STRUCTURES
+ * ======================================================================== */
+
+/**
+ * Streaming hash context (scalar path).
+ *
+ * Memory: 112 bytes (stack-friendly)
+ */
+typedef struct {
+    uint32_t h[8];                        /**< Chaining state */
+    uint64_t total_len;                   /**< Bytes absorbed so far */
+    uint8_t  buf[SHA256_BLOCK_BYTES];     /**< Partial block */
+    uint32_t buf_len;                     /**< Bytes in buf */
+} sha256_ctx_t;
+
+/* ========================================================================
+ * API FUNCTIONS
+ * ======================================================================== */
+
+/**
+ * Initialize streaming context.
+ *
+ * @param ctx Context to initialize
+ */
+void sha256_init(sha256_ctx_t* ctx);
+
+/**
+ * Absorb message bytes.
+ *
+ * @param ctx Hash context
+ * @param data Input bytes
+ * @param len Number of bytes
+ */
+void sha256_update(sha256_ctx_t* ctx, const void* data, size_t len);
+
+/**
+ * Finish hash and write digest.
+ *
+ * @param ctx Hash context (must be re-initialized before reuse)
+ * @param digest Output: 32-byte digest
+ */
+void sha256_final(sha256_ctx_t* ctx, uint8_t digest[SHA256_DIGEST_BYTES]);
+
+/**
+ * One-shot hash.
+ *
+ * @param data Input bytes
+ * @param len Number of bytes
+ * @param digest Output: 32-byte digest
+ */
+void sha256(const void* data, size_t len, uint8_t digest[SHA256_DIGEST_BYTES]);
+
+/**
+ * Number of messages hashed per SIMD pass on this build.
+ *
+ * @return Lane count (8 for AVX2, 4 for SSE2/WASM SIMD128, 1 otherwise)
+ */
+int sha256_multi_lanes(void);
+
+/**
+ * Hash n independent messages, interleaved across SIMD lanes.
+ *
+ * Messages may have different lengths; lanes that finish early idle
+ * (their state is held) until the longest message in the group is done.
+ * Best throughput when messages in a group are similar in length, which
+ * is the case for full T-BSP cells.
+ *
+ * Performance: ~2x (SSE2) / ~5x (AVX2) single-core throughput vs sha256()
+ *
+ * @param msgs Array of n message pointers
+ * @param lens Array of n message lengths (bytes)
+ * @param n Number of messages (any count; processed in groups of lanes)
+ * @param digests Output: n × 32-byte digests
+ */
+void sha256_multi(const uint8_t* const* msgs, const size_t* lens, int n,
+                  uint8_t (*digests)[SHA256_DIGEST_BYTES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SHA256_H */
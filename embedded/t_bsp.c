@@ -168,6 +168,9 @@ bool t_bsp_insert_pose(t_bsp_t* bsp, uint16_t cell_id, const se3_pose_t* pose) {
                 target_cell->cell_id = cell_id;
                 target_cell->pose_count = 0;
                 target_cell->active = true;
+#ifdef T_BSP_COMPRESSED_POSES
+                pose_stream_reset(&target_cell->stream);
+#endif
                 bsp->active_count++;
                 break;
             }
@@ -179,6 +182,18 @@ bool t_bsp_insert_pose(t_bsp_t* bsp, uint16_t cell_id, const se3_pose_t* pose) {
         return false;
     }
 
+#ifdef T_BSP_COMPRESSED_POSES
+    /* Compressed capacity is bounded by stream bytes, not pose count */
+    if (!pose_stream_has_room(&target_cell->stream) ||
+        target_cell->pose_count == UINT16_MAX) {
+        /* Same contract as raw mode: caller runs λ-estimation first */
+        pose_stream_reset(&target_cell->stream);
+        target_cell->pose_count = 0;
+    }
+
+    pose_stream_append(&target_cell->stream, pose);
+    target_cell->pose_count++;
+#else
     /* Check for overflow (cell full) */
     if (target_cell->pose_count >= MAX_POSES_PER_CELL) {
         /* NOTE: Caller must handle λ-estimation before this point!
@@ -190,6 +205,7 @@ bool t_bsp_insert_pose(t_bsp_t* bsp, uint16_t cell_id, const se3_pose_t* pose) {
 
     /* Insert pose into cell */
     target_cell->poses[target_cell->pose_count++] = *pose;
+#endif
 
     return true;
 }
@@ -219,6 +235,9 @@ void t_bsp_reset_cell(t_bsp_t* bsp, uint16_t cell_id) {
         if (bsp->cells[i].active && bsp->cells[i].cell_id == cell_id) {
             bsp->cells[i].active = false;
             bsp->cells[i].pose_count = 0;
+#ifdef T_BSP_COMPRESSED_POSES
+            pose_stream_reset(&bsp->cells[i].stream);
+#endif
             bsp->active_count--;
             return;
         }
@@ -277,9 +296,25 @@ bool t_bsp_cell_near_full(const t_bsp_cell_t* cell, float threshold) {
         return false;
     }
 
+#ifdef T_BSP_COMPRESSED_POSES
+    /* Usable bytes exclude the worst-case record reserve */
+    uint32_t usable = POSE_STREAM_BYTES - POSE_RECORD_MAX_BYTES;
+    uint32_t threshold_bytes = (uint32_t)(threshold * usable);
+    return cell->stream.used >= threshold_bytes;
+#else
     uint16_t threshold_count = (uint16_t)(threshold * MAX_POSES_PER_CELL);
     return cell->pose_count >= threshold_count;
+#endif
+}
+
+#ifdef T_BSP_COMPRESSED_POSES
+/**
+ * Open streaming decoder over a compressed cell.
+ */
+void t_bsp_cell_reader(const t_bsp_cell_t* cell, pose_reader_t* reader) {
+    pose_reader_init(reader, &cell->stream);
 }
+#endif
 
 /* ========================================================================
  * DIAGNOSTIC FUNCTIONS (for debugging/testing)
@@ -18,6 +18,9 @@
 #define T_BSP_H
 
 #include "se3_edge.h"
+#ifdef T_BSP_COMPRESSED_POSES
+#include "pose_codec.h"
+#endif
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -104,7 +107,24 @@ typedef struct {
     uint16_t pose_count;         /**< Current number of poses (0 to MAX_POSES_PER_CELL) */
     bool active;                 /**< Cell in use (false = available for allocation) */
     uint8_t _padding[3];         /**< Alignment padding (total 24 bytes metadata) */
+#ifdef T_BSP_COMPRESSED_POSES
+    /**
+     * Compressed pose storage (design-time option, define
+     * T_BSP_COMPRESSED_POSES).
+     *
+     * Replaces poses[] with a delta-coded pose_stream_t (see pose_codec.h)
+     * in the same 7,168 bytes plus 176 bytes of stream header. Steady AIS
+     * tracks encode at 5-10 bytes per pose, so a cell holds ~700-1400
+     * poses before λ-estimation.
+     *
+     * Capacity is then bounded by bytes, not pose count: a cell is "full"
+     * when it can no longer guarantee room for a worst-case record.
+     * Read poses back with t_bsp_cell_reader() + pose_reader_next().
+     */
+    pose_stream_t stream;
+#else
     se3_pose_t poses[MAX_POSES_PER_CELL];  /**< Fixed-size trajectory buffer */
+#endif
 } t_bsp_cell_t;
 
 /**
@@ -217,6 +237,8 @@ void t_bsp_get_adjacent_cells(t_bsp_t* bsp, uint16_t cell_id,
  * Check if cell is near overflow (trigger preemptive λ-estimation).
  *
  * Useful for predictive computation before hard limit.
+ * In compressed mode the fraction applies to encoded bytes rather than
+ * pose count (see T_BSP_COMPRESSED_POSES).
  *
  * @param cell Cell to check
  * @param threshold Fraction of MAX_POSES_PER_CELL (e.g., 0.9 for 90%)
@@ -224,6 +246,19 @@ void t_bsp_get_adjacent_cells(t_bsp_t* bsp, uint16_t cell_id,
  */
 bool t_bsp_cell_near_full(const t_bsp_cell_t* cell, float threshold);
 
+#ifdef T_BSP_COMPRESSED_POSES
+/**
+ * Open streaming decoder over a compressed cell's trajectory.
+ *
+ * Poses are decoded one at a time in insertion order, so λ-estimation
+ * can consume a cell without a 56-byte-per-pose expansion buffer.
+ *
+ * @param cell Cell to read (must stay unmodified while reading)
+ * @param reader Output: decoder cursor positioned at the first pose
+ */
+void t_bsp_cell_reader(const t_bsp_cell_t* cell, pose_reader_t* reader);
+#endif
+
 /**
  * Get number of active cells (diagnostic function).
  *
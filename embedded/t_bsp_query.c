@@ -0,0 +1,380 @@
+/*
+ * t_bsp_query.c - Latest-Position Index and Spatial Vessel Queries
+ *
+ * Positions are converted once to local ENU (64-bit Q16.16 meters) and
+ * binned on the CELL_SIZE_KM grid. Queries sort the occupied cells by
+ * the minimum distance from the query point to their bounds and walk
+ * them nearest-first, so the scan ends at the first cell that cannot
+ * improve the result set.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/p_maputl.c (P_BlockThingsIterator)
+ * Author: ClaudeCode (spatial queries)
+ * Version: 1.0
+ */
+
+#include "t_bsp_query.h"
+#include <string.h>
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/** Meters per degree of latitude (matches FIXED_DEG_TO_KM) */
+#define QUERY_METERS_PER_DEG  111320
+
+/** Cell edge in Q16.16 meters (64-bit) */
+#define QUERY_CELL_M          ((int64_t)CELL_SIZE_KM * 1000 * FRACUNIT)
+
+/**
+ * Distances are compared as squared Q8.8 meters: exact ordering to
+ * 1/256 m, and the full ±128-cell grid squared stays below 2^63.
+ */
+#define QUERY_KEY_SHIFT       8
+
+/** Grid index range of the cell_id encoding */
+#define QUERY_IDX_MIN         (-128)
+#define QUERY_IDX_MAX         127
+
+/** Convert fixed-point degrees to a binary angle (BAM) */
+static inline uint32_t degrees_to_bam(fixed_t deg) {
+    return (uint32_t)(((int64_t)deg << 16) / 360);
+}
+
+/** Floor division for signed 64-bit values (b > 0) */
+static inline int64_t floor_div64(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if ((a % b) != 0 && a < 0) {
+        q--;
+    }
+    return q;
+}
+
+/** Integer square root (floor) of a 64-bit value */
+static uint64_t isqrt_u64(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/** Clamp 64-bit Q16.16 meters to fixed_t range */
+static inline fixed_t saturate_m(int64_t v) {
+    if (v > 0x7FFFFFFF) return 0x7FFFFFFF;
+    if (v < -0x7FFFFFFF) return -0x7FFFFFFF;
+    return (fixed_t)v;
+}
+
+/** Largest Q8.8 axis offset whose square fits int64 (~11,800 km) */
+#define QUERY_KEY_AXIS_MAX    3037000499LL
+
+/**
+ * Squared Q8.8 length of a Q16.16 offset, UINT64_MAX when an axis is
+ * beyond QUERY_KEY_AXIS_MAX (query points far from the reference).
+ */
+static inline uint64_t dist_key(int64_t de, int64_t dn) {
+    int64_t e = de >> QUERY_KEY_SHIFT;
+    int64_t n = dn >> QUERY_KEY_SHIFT;
+    if (e < 0) e = -e;
+    if (n < 0) n = -n;
+    if (e > QUERY_KEY_AXIS_MAX || n > QUERY_KEY_AXIS_MAX) {
+        return UINT64_MAX;
+    }
+    return (uint64_t)(e * e) + (uint64_t)(n * n);
+}
+
+/**
+ * Lat/lon → local ENU (Q16.16 meters, 64-bit).
+ */
+static void latlon_to_enu(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                          int64_t* east, int64_t* north) {
+    fixed_t dlat = lat - idx->ref_lat;
+    fixed_t dlon = normalize_lon(normalize_lon(lon) - idx->ref_lon);
+
+    *north = (int64_t)dlat * QUERY_METERS_PER_DEG;
+    *east = ((int64_t)dlon * QUERY_METERS_PER_DEG * idx->east_scale) >> FRACBITS;
+}
+
+/**
+ * Split an ENU position into grid indices and in-cell offsets.
+ *
+ * @return false if outside the cell_id grid
+ */
+static bool enu_to_cell(int64_t east, int64_t north,
+                        int* row, int* col, fixed_t* e_off, fixed_t* n_off) {
+    int64_t r = floor_div64(north, QUERY_CELL_M);
+    int64_t c = floor_div64(east, QUERY_CELL_M);
+
+    if (r < QUERY_IDX_MIN || r > QUERY_IDX_MAX || c < QUERY_IDX_MIN || c > QUERY_IDX_MAX) {
+        return false;
+    }
+    *row = (int)r;
+    *col = (int)c;
+    *n_off = (fixed_t)(north - r * QUERY_CELL_M);
+    *e_off = (fixed_t)(east - c * QUERY_CELL_M);
+    return true;
+}
+
+static inline uint16_t index_cell_id(int row, int col) {
+    return (uint16_t)(((row & 0xFF) << 8) | (col & 0xFF));
+}
+
+static inline void index_cell_origin(uint16_t cell_id, int64_t* east, int64_t* north) {
+    *north = (int64_t)(int8_t)((cell_id >> 8) & 0xFF) * QUERY_CELL_M;
+    *east = (int64_t)(int8_t)(cell_id & 0xFF) * QUERY_CELL_M;
+}
+
+/** Distance from a point to the nearest edge of a cell (0 if inside) */
+static inline int64_t axis_gap(int64_t q, int64_t lo) {
+    if (q < lo) return lo - q;
+    if (q > lo + QUERY_CELL_M) return q - (lo + QUERY_CELL_M);
+    return 0;
+}
+
+static t_bsp_index_cell_t* find_cell(t_bsp_index_t* idx, uint16_t cell_id) {
+    for (int i = 0; i < T_BSP_INDEX_CELLS; i++) {
+        if (idx->cells[i].count > 0 && idx->cells[i].cell_id == cell_id) {
+            return &idx->cells[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Shared k-NN / radius search.
+ *
+ * @param max_key Squared Q8.8 radius (UINT64_MAX = unbounded)
+ */
+static int query_nearest(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                         uint64_t max_key, int max_results, t_bsp_neighbor_t* results) {
+    uint64_t cell_key[T_BSP_INDEX_CELLS];
+    uint8_t order[T_BSP_INDEX_CELLS];
+    uint64_t best_key[T_BSP_QUERY_MAX];
+    int64_t qe, qn;
+    int n_cells = 0;
+    int found = 0;
+
+    if (idx == NULL || results == NULL || max_results <= 0) {
+        return 0;
+    }
+    if (max_results > T_BSP_QUERY_MAX) {
+        max_results = T_BSP_QUERY_MAX;
+    }
+
+    latlon_to_enu(idx, lat, lon, &qe, &qn);
+
+    /* Order occupied cells by their bounds (outward expansion) */
+    for (int i = 0; i < T_BSP_INDEX_CELLS; i++) {
+        const t_bsp_index_cell_t* cell = &idx->cells[i];
+        int64_t oe, on;
+        uint64_t key;
+        int j;
+
+        if (cell->count == 0) {
+            continue;
+        }
+        index_cell_origin(cell->cell_id, &oe, &on);
+        key = dist_key(axis_gap(qe, oe), axis_gap(qn, on));
+        if (key > max_key) {
+            continue;
+        }
+        for (j = n_cells; j > 0 && cell_key[j - 1] > key; j--) {
+            cell_key[j] = cell_key[j - 1];
+            order[j] = order[j - 1];
+        }
+        cell_key[j] = key;
+        order[j] = (uint8_t)i;
+        n_cells++;
+    }
+
+    for (int c = 0; c < n_cells; c++) {
+        const t_bsp_index_cell_t* cell = &idx->cells[order[c]];
+        int64_t oe, on;
+
+        /* Prune: no vessel in this or any later cell can place */
+        if (found == max_results && cell_key[c] > best_key[found - 1]) {
+            break;
+        }
+
+        index_cell_origin(cell->cell_id, &oe, &on);
+
+        for (int s = 0; s < cell->count; s++) {
+            const t_bsp_vessel_pos_t* v = &cell->vessels[s];
+            int64_t de = oe + v->east - qe;
+            int64_t dn = on + v->north - qn;
+            uint64_t key = dist_key(de, dn);
+            int j;
+
+            if (key > max_key) {
+                continue;
+            }
+            if (found == max_results) {
+                if (key >= best_key[found - 1]) {
+                    continue;
+                }
+                found--;   /* Drop current worst */
+            }
+
+            for (j = found; j > 0 && best_key[j - 1] > key; j--) {
+                best_key[j] = best_key[j - 1];
+                results[j] = results[j - 1];
+            }
+            best_key[j] = key;
+            results[j].mmsi = v->mmsi;
+            results[j].timestamp = v->timestamp;
+            results[j].east = saturate_m(de);
+            results[j].north = saturate_m(dn);
+            results[j].distance = saturate_m((int64_t)(isqrt_u64(key) << QUERY_KEY_SHIFT));
+            found++;
+        }
+    }
+
+    return found;
+}
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+void t_bsp_index_init(t_bsp_index_t* idx, const t_bsp_t* bsp) {
+    memset(idx, 0, sizeof(*idx));
+    idx->ref_lat = bsp->ref_lat;
+    idx->ref_lon = bsp->ref_lon;
+    idx->east_scale = Cos_from_LUT_interp(degrees_to_bam(bsp->ref_lat));
+}
+
+bool t_bsp_index_update(t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                        uint32_t mmsi, uint32_t timestamp) {
+    int64_t east, north;
+    int row, col;
+    fixed_t e_off, n_off;
+    uint16_t cell_id;
+    t_bsp_index_cell_t* cell;
+    t_bsp_vessel_pos_t* slot = NULL;
+
+    if (idx == NULL) {
+        return false;
+    }
+
+    latlon_to_enu(idx, lat, lon, &east, &north);
+    if (!enu_to_cell(east, north, &row, &col, &e_off, &n_off)) {
+        return false;
+    }
+    cell_id = index_cell_id(row, col);
+    cell = find_cell(idx, cell_id);
+
+    /* Fast path: vessel still in the same cell */
+    if (cell != NULL) {
+        for (int s = 0; s < cell->count; s++) {
+            if (cell->vessels[s].mmsi == mmsi) {
+                slot = &cell->vessels[s];
+                break;
+            }
+        }
+    }
+
+    if (slot == NULL) {
+        /* Cell change (or first report). Pick the target cell before
+         * dropping the stale entry, so a full index keeps the vessel's
+         * last known position. */
+        t_bsp_index_cell_t* fresh = NULL;
+        if (cell == NULL) {
+            for (int i = 0; i < T_BSP_INDEX_CELLS && fresh == NULL; i++) {
+                if (idx->cells[i].count == 0) {
+                    fresh = &idx->cells[i];
+                }
+            }
+            /* Full: reuse the cell the vessel alone is about to leave */
+            for (int i = 0; i < T_BSP_INDEX_CELLS && fresh == NULL; i++) {
+                if (idx->cells[i].count == 1 && idx->cells[i].vessels[0].mmsi == mmsi) {
+                    fresh = &idx->cells[i];
+                }
+            }
+            if (fresh == NULL) {
+                return false;
+            }
+        }
+
+        t_bsp_index_remove(idx, mmsi);
+
+        if (fresh != NULL) {
+            cell = fresh;
+            cell->cell_id = cell_id;
+            idx->cell_count++;
+        }
+
+        if (cell->count < T_BSP_INDEX_SLOTS) {
+            slot = &cell->vessels[cell->count++];
+        } else {
+            /* Evict the stalest report */
+            slot = &cell->vessels[0];
+            for (int s = 1; s < cell->count; s++) {
+                if (cell->vessels[s].timestamp < slot->timestamp) {
+                    slot = &cell->vessels[s];
+                }
+            }
+        }
+        slot->mmsi = mmsi;
+    }
+
+    slot->east = e_off;
+    slot->north = n_off;
+    slot->timestamp = timestamp;
+    return true;
+}
+
+bool t_bsp_index_remove(t_bsp_index_t* idx, uint32_t mmsi) {
+    if (idx == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < T_BSP_INDEX_CELLS; i++) {
+        t_bsp_index_cell_t* cell = &idx->cells[i];
+
+        for (int s = 0; s < cell->count; s++) {
+            if (cell->vessels[s].mmsi == mmsi) {
+                /* Swap-remove keeps the slot array dense */
+                cell->vessels[s] = cell->vessels[cell->count - 1];
+                cell->count--;
+                if (cell->count == 0) {
+                    idx->cell_count--;
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+int t_bsp_query_knn(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                    int k, t_bsp_neighbor_t* results) {
+    return query_nearest(idx, lat, lon, UINT64_MAX, k, results);
+}
+
+int t_bsp_query_radius(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                       fixed_t radius, t_bsp_neighbor_t* results, int max_results) {
+    if (radius < 0) {
+        return 0;
+    }
+    return query_nearest(idx, lat, lon, dist_key(radius, 0), max_results, results);
+}
+
+int t_bsp_index_vessel_count(const t_bsp_index_t* idx) {
+    int total = 0;
+
+    for (int i = 0; i < T_BSP_INDEX_CELLS; i++) {
+        total += idx->cells[i].count;
+    }
+    return total;
+}
@@ -0,0 +1,205 @@
+/*
+ * t_bsp_query.h - Latest-Position Index and Spatial Vessel Queries
+ *
+ * k-nearest-vessel and radius queries over the most recent position of
+ * every tracked vessel, for collision-risk and density analytics.
+ *
+ * The index mirrors the T-BSP grid (CELL_SIZE_KM squares around the
+ * voyage origin) but only keeps one compact 16-byte entry per vessel:
+ * its latest position as an offset inside its cell. Queries visit cells
+ * outward from the query point in order of their minimum possible
+ * distance and stop as soon as a cell's bounds cannot beat the current
+ * k-th result (or lie outside the radius), so a query touches only the
+ * cells that can contribute.
+ *
+ * Coordinates are local ENU meters around the T-BSP reference point:
+ *   north = Δlat × 111,320 m
+ *   east  = Δlon × 111,320 m × cos(ref_lat)
+ * Results are reported as fixed-point meters relative to the query point.
+ *
+ * Doom analog: P_BlockThingsIterator() — blockmap cells hold mobj lists,
+ * radius checks only walk the blocks overlapping the search box.
+ *
+ * Hardware Target: ESP32-S3 (no malloc, ~17 KB static index)
+ * Author: ClaudeCode (spatial queries)
+ * Version: 1.0
+ */
+
+#ifndef T_BSP_QUERY_H
+#define T_BSP_QUERY_H
+
+#include "se3_edge.h"
+#include "t_bsp.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * CONFIGURATION CONSTANTS
+ * ======================================================================== */
+
+/**
+ * Maximum vessels tracked per index cell.
+ *
+ * When a cell is full, the vessel with the oldest report is evicted
+ * (it has most likely left AIS range or stopped transmitting).
+ *
+ * Memory: 16 × 16 bytes = 256 bytes per cell
+ */
+#define T_BSP_INDEX_SLOTS    16
+
+/** Maximum index cells (same budget as the trajectory cells) */
+#define T_BSP_INDEX_CELLS    MAX_CELLS
+
+/** Upper bound on k / result count per query (bounds stack usage) */
+#define T_BSP_QUERY_MAX      64
+
+_Static_assert(T_BSP_INDEX_SLOTS <= 255, "slot count is stored in uint8_t");
+
+/* ========================================================================
+ * DATA STRUCTURES
+ * ======================================================================== */
+
+/**
+ * Latest known position of one vessel (16 bytes).
+ *
+ * Offsets are relative to the south-west corner of the owning cell,
+ * in [0, CELL_SIZE_KM × 1000) fixed-point meters.
+ */
+typedef struct {
+    uint32_t mmsi;          /**< Vessel identifier */
+    fixed_t east;           /**< East offset in cell (fixed meters) */
+    fixed_t north;          /**< North offset in cell (fixed meters) */
+    uint32_t timestamp;     /**< Report time (Unix seconds) */
+} t_bsp_vessel_pos_t;
+
+/**
+ * One grid cell of the latest-position index.
+ *
+ * Memory: 260 bytes per cell
+ */
+typedef struct {
+    uint16_t cell_id;       /**< Grid index (generate_cell_id encoding) */
+    uint8_t count;          /**< Vessels in this cell (0 = cell free) */
+    uint8_t _padding;       /**< Alignment */
+    t_bsp_vessel_pos_t vessels[T_BSP_INDEX_SLOTS];
+} t_bsp_index_cell_t;
+
+/**
+ * Latest-position index (one per T-BSP root).
+ *
+ * Kept separate from t_bsp_t so trajectory cells can be reset after
+ * λ-estimation without losing vessel positions, and so single-vessel
+ * nodes that never query do not pay for it.
+ *
+ * Memory: 64 × 260 + 16 = ~16.7 KB
+ */
+typedef struct {
+    t_bsp_index_cell_t cells[T_BSP_INDEX_CELLS];
+    fixed_t ref_lat, ref_lon;   /**< Copied from the T-BSP root */
+    fixed_t east_scale;         /**< cos(ref_lat) for longitude → meters */
+    uint16_t cell_count;        /**< Cells holding at least one vessel */
+    uint16_t _padding;          /**< Alignment */
+} t_bsp_index_t;
+
+/**
+ * Query result: one vessel relative to the query point.
+ *
+ * east/north/distance saturate at ±32,767 m (Q16.16 range); ordering
+ * is always exact, so k-NN results beyond that range are still
+ * returned nearest-first.
+ */
+typedef struct {
+    uint32_t mmsi;          /**< Vessel identifier */
+    uint32_t timestamp;     /**< Report time of the position */
+    fixed_t east;           /**< East offset from query point (fixed meters) */
+    fixed_t north;          /**< North offset from query point (fixed meters) */
+    fixed_t distance;       /**< Horizontal distance (fixed meters) */
+} t_bsp_neighbor_t;
+
+/* ========================================================================
+ * API FUNCTIONS
+ * ======================================================================== */
+
+/**
+ * Initialize an empty index on the grid of a T-BSP root.
+ *
+ * @param idx Index to initialize (caller-allocated)
+ * @param bsp T-BSP root providing the reference point
+ */
+void t_bsp_index_init(t_bsp_index_t* idx, const t_bsp_t* bsp);
+
+/**
+ * Record a vessel's latest position.
+ *
+ * Updates the vessel's entry in place when it stays in its cell; on a
+ * cell change the old entry is removed so each vessel appears once.
+ *
+ * Performance: ~0.5 µs @ 240 MHz (same cell), ~5 µs on cell change
+ *
+ * @param idx Index
+ * @param lat Latitude (fixed-point degrees)
+ * @param lon Longitude (fixed-point degrees, auto-normalized)
+ * @param mmsi Vessel identifier
+ * @param timestamp Report time (Unix seconds)
+ * @return false if the position is outside the ±127-cell grid or no
+ *         index cell is free
+ */
+bool t_bsp_index_update(t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                        uint32_t mmsi, uint32_t timestamp);
+
+/**
+ * Remove a vessel from the index.
+ *
+ * @param idx Index
+ * @param mmsi Vessel identifier
+ * @return true if the vessel was present
+ */
+bool t_bsp_index_remove(t_bsp_index_t* idx, uint32_t mmsi);
+
+/**
+ * Find the k vessels nearest to a point.
+ *
+ * @param idx Index
+ * @param lat Query latitude (fixed-point degrees)
+ * @param lon Query longitude (fixed-point degrees)
+ * @param k Number of neighbors wanted (clamped to T_BSP_QUERY_MAX)
+ * @param results Output: up to k neighbors, nearest first
+ * @return Number of results written
+ */
+int t_bsp_query_knn(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                    int k, t_bsp_neighbor_t* results);
+
+/**
+ * Find all vessels within a radius of a point.
+ *
+ * If more than max_results vessels match, the nearest max_results are
+ * returned.
+ *
+ * @param idx Index
+ * @param lat Query latitude (fixed-point degrees)
+ * @param lon Query longitude (fixed-point degrees)
+ * @param radius Search radius (fixed meters, inclusive)
+ * @param results Output: matching vessels, nearest first
+ * @param max_results Capacity of results (clamped to T_BSP_QUERY_MAX)
+ * @return Number of results written
+ */
+int t_bsp_query_radius(const t_bsp_index_t* idx, fixed_t lat, fixed_t lon,
+                       fixed_t radius, t_bsp_neighbor_t* results, int max_results);
+
+/**
+ * Number of vessels currently indexed (diagnostic function).
+ *
+ * @param idx Index
+ * @return Total vessel count across all cells
+ */
+int t_bsp_index_vessel_count(const t_bsp_index_t* idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* T_BSP_QUERY_H */
@@ -3,8 +3,8 @@
 #ifndef TRIG_TABLES_DATA_H
 #define TRIG_TABLES_DATA_H
 
-/* Sine lookup table: 8192 entries, ~0.044° resolution */
-const fixed_t finesine[NUM_FINE_ANGLES] = {
+/* Quarter-wave sine table: 2048 + 1 entries (0° - 90° inclusive), ~0.044° resolution */
+const fixed_t finesine_quarter[QUARTER_FINE_ANGLES + 1] = {
           0,     50,    101,    151,    201,    251,    302,    352,  /*    0-   7: 0.00° - 0.31° */
         402,    452,    503,    553,    603,    653,    704,    754,  /*    8-  15: 0.35° - 0.66° */
         804,    854,    905,    955,   1005,   1056,   1106,   1156,  /*   16-  23: 0.70° - 1.01° */
@@ -261,777 +261,7 @@ const fixed_t finesine[NUM_FINE_ANGLES] = {
       65525,  65526,  65527,  65527,  65528,  65529,  65530,  65530,  /* 2024-2031: 88.95° - 89.25° */
       65531,  65532,  65532,  65533,  65533,  65534,  65534,  65534,  /* 2032-2039: 89.30° - 89.60° */
       65535,  65535,  65535,  65536,  65536,  65536,  65536,  65536,  /* 2040-2047: 89.65° - 89.96° */
-      65536,  65536,  65536,  65536,  65536,  65536,  65535,  65535,  /* 2048-2055: 90.00° - 90.31° */
-      65535,  65534,  65534,  65534,  65533,  65533,  65532,  65532,  /* 2056-2063: 90.35° - 90.66° */
-      65531,  65530,  65530,  65529,  65528,  65527,  65527,  65526,  /* 2064-2071: 90.70° - 91.01° */
-      65525,  65524,  65523,  65522,  65521,  65520,  65519,  65517,  /* 2072-2079: 91.05° - 91.36° */
-      65516,  65515,  65514,  65512,  65511,  65510,  65508,  65507,  /* 2080-2087: 91.41° - 91.71° */
-      65505,  65504,  65502,  65500,  65499,  65497,  65495,  65493,  /* 2088-2095: 91.76° - 92.07° */
-      65492,  65490,  65488,  65486,  65484,  65482,  65480,  65478,  /* 2096-2103: 92.11° - 92.42° */
-      65476,  65473,  65471,  65469,  65467,  65464,  65462,  65460,  /* 2104-2111: 92.46° - 92.77° */
-      65457,  65455,  65452,  65449,  65447,  65444,  65442,  65439,  /* 2112-2119: 92.81° - 93.12° */
-      65436,  65433,  65430,  65428,  65425,  65422,  65419,  65416,  /* 2120-2127: 93.16° - 93.47° */
-      65413,  65410,  65406,  65403,  65400,  65397,  65393,  65390,  /* 2128-2135: 93.52° - 93.82° */
-      65387,  65383,  65380,  65376,  65373,  65369,  65366,  65362,  /* 2136-2143: 93.87° - 94.17° */
-      65358,  65355,  65351,  65347,  65343,  65339,  65336,  65332,  /* 2144-2151: 94.22° - 94.53° */
-      65328,  65324,  65320,  65315,  65311,  65307,  65303,  65299,  /* 2152-2159: 94.57° - 94.88° */
-      65294,  65290,  65286,  65281,  65277,  65272,  65268,  65263,  /* 2160-2167: 94.92° - 95.23° */
-      65259,  65254,  65249,  65245,  65240,  65235,  65230,  65225,  /* 2168-2175: 95.27° - 95.58° */
-      65220,  65215,  65210,  65205,  65200,  65195,  65190,  65185,  /* 2176-2183: 95.62° - 95.93° */
-      65180,  65175,  65169,  65164,  65159,  65153,  65148,  65142,  /* 2184-2191: 95.98° - 96.28° */
-      65137,  65131,  65126,  65120,  65114,  65109,  65103,  65097,  /* 2192-2199: 96.33° - 96.64° */
-      65091,  65085,  65079,  65073,  65067,  65061,  65055,  65049,  /* 2200-2207: 96.68° - 96.99° */
-      65043,  65037,  65031,  65025,  65018,  65012,  65006,  64999,  /* 2208-2215: 97.03° - 97.34° */
-      64993,  64986,  64980,  64973,  64967,  64960,  64953,  64947,  /* 2216-2223: 97.38° - 97.69° */
-      64940,  64933,  64926,  64919,  64912,  64905,  64899,  64892,  /* 2224-2231: 97.73° - 98.04° */
-      64884,  64877,  64870,  64863,  64856,  64849,  64841,  64834,  /* 2232-2239: 98.09° - 98.39° */
-      64827,  64819,  64812,  64804,  64797,  64789,  64782,  64774,  /* 2240-2247: 98.44° - 98.75° */
-      64766,  64759,  64751,  64743,  64735,  64728,  64720,  64712,  /* 2248-2255: 98.79° - 99.10° */
-      64704,  64696,  64688,  64680,  64672,  64663,  64655,  64647,  /* 2256-2263: 99.14° - 99.45° */
-      64639,  64630,  64622,  64614,  64605,  64597,  64588,  64580,  /* 2264-2271: 99.49° - 99.80° */
-      64571,  64563,  64554,  64545,  64536,  64528,  64519,  64510,  /* 2272-2279: 99.84° - 100.15° */
-      64501,  64492,  64483,  64474,  64465,  64456,  64447,  64438,  /* 2280-2287: 100.20° - 100.50° */
-      64429,  64420,  64410,  64401,  64392,  64382,  64373,  64363,  /* 2288-2295: 100.55° - 100.85° */
-      64354,  64344,  64335,  64325,  64316,  64306,  64296,  64287,  /* 2296-2303: 100.90° - 101.21° */
-      64277,  64267,  64257,  64247,  64237,  64227,  64217,  64207,  /* 2304-2311: 101.25° - 101.56° */
-      64197,  64187,  64177,  64167,  64156,  64146,  64136,  64125,  /* 2312-2319: 101.60° - 101.91° */
-      64115,  64105,  64094,  64084,  64073,  64062,  64052,  64041,  /* 2320-2327: 101.95° - 102.26° */
-      64031,  64020,  64009,  63998,  63987,  63976,  63966,  63955,  /* 2328-2335: 102.30° - 102.61° */
-      63944,  63933,  63922,  63910,  63899,  63888,  63877,  63866,  /* 2336-2343: 102.66° - 102.96° */
-      63854,  63843,  63832,  63820,  63809,  63797,  63786,  63774,  /* 2344-2351: 103.01° - 103.32° */
-      63763,  63751,  63739,  63728,  63716,  63704,  63692,  63680,  /* 2352-2359: 103.36° - 103.67° */
-      63668,  63657,  63645,  63633,  63621,  63608,  63596,  63584,  /* 2360-2367: 103.71° - 104.02° */
-      63572,  63560,  63547,  63535,  63523,  63510,  63498,  63486,  /* 2368-2375: 104.06° - 104.37° */
-      63473,  63461,  63448,  63435,  63423,  63410,  63397,  63385,  /* 2376-2383: 104.41° - 104.72° */
-      63372,  63359,  63346,  63333,  63320,  63307,  63294,  63281,  /* 2384-2391: 104.77° - 105.07° */
-      63268,  63255,  63242,  63229,  63215,  63202,  63189,  63175,  /* 2392-2399: 105.12° - 105.42° */
-      63162,  63149,  63135,  63122,  63108,  63095,  63081,  63067,  /* 2400-2407: 105.47° - 105.78° */
-      63054,  63040,  63026,  63012,  62998,  62985,  62971,  62957,  /* 2408-2415: 105.82° - 106.13° */
-      62943,  62929,  62915,  62901,  62886,  62872,  62858,  62844,  /* 2416-2423: 106.17° - 106.48° */
-      62830,  62815,  62801,  62787,  62772,  62758,  62743,  62729,  /* 2424-2431: 106.52° - 106.83° */
-      62714,  62699,  62685,  62670,  62655,  62641,  62626,  62611,  /* 2432-2439: 106.88° - 107.18° */
-      62596,  62581,  62566,  62551,  62536,  62521,  62506,  62491,  /* 2440-2447: 107.23° - 107.53° */
-      62476,  62461,  62445,  62430,  62415,  62400,  62384,  62369,  /* 2448-2455: 107.58° - 107.89° */
-      62353,  62338,  62322,  62307,  62291,  62275,  62260,  62244,  /* 2456-2463: 107.93° - 108.24° */
-      62228,  62212,  62197,  62181,  62165,  62149,  62133,  62117,  /* 2464-2471: 108.28° - 108.59° */
-      62101,  62085,  62069,  62053,  62036,  62020,  62004,  61988,  /* 2472-2479: 108.63° - 108.94° */
-      61971,  61955,  61939,  61922,  61906,  61889,  61873,  61856,  /* 2480-2487: 108.98° - 109.29° */
-      61839,  61823,  61806,  61789,  61772,  61756,  61739,  61722,  /* 2488-2495: 109.34° - 109.64° */
-      61705,  61688,  61671,  61654,  61637,  61620,  61603,  61586,  /* 2496-2503: 109.69° - 110.00° */
-      61568,  61551,  61534,  61517,  61499,  61482,  61464,  61447,  /* 2504-2511: 110.04° - 110.35° */
-      61429,  61412,  61394,  61377,  61359,  61341,  61324,  61306,  /* 2512-2519: 110.39° - 110.70° */
-      61288,  61270,  61253,  61235,  61217,  61199,  61181,  61163,  /* 2520-2527: 110.74° - 111.05° */
-      61145,  61127,  61108,  61090,  61072,  61054,  61035,  61017,  /* 2528-2535: 111.09° - 111.40° */
-      60999,  60980,  60962,  60943,  60925,  60906,  60888,  60869,  /* 2536-2543: 111.45° - 111.75° */
-      60851,  60832,  60813,  60794,  60776,  60757,  60738,  60719,  /* 2544-2551: 111.80° - 112.10° */
-      60700,  60681,  60662,  60643,  60624,  60605,  60586,  60567,  /* 2552-2559: 112.15° - 112.46° */
-      60547,  60528,  60509,  60490,  60470,  60451,  60431,  60412,  /* 2560-2567: 112.50° - 112.81° */
-      60392,  60373,  60353,  60334,  60314,  60294,  60275,  60255,  /* 2568-2575: 112.85° - 113.16° */
-      60235,  60215,  60195,  60175,  60156,  60136,  60116,  60096,  /* 2576-2583: 113.20° - 113.51° */
-      60075,  60055,  60035,  60015,  59995,  59975,  59954,  59934,  /* 2584-2591: 113.55° - 113.86° */
-      59914,  59893,  59873,  59852,  59832,  59811,  59791,  59770,  /* 2592-2599: 113.91° - 114.21° */
-      59750,  59729,  59708,  59687,  59667,  59646,  59625,  59604,  /* 2600-2607: 114.26° - 114.57° */
-      59583,  59562,  59541,  59520,  59499,  59478,  59457,  59436,  /* 2608-2615: 114.61° - 114.92° */
-      59415,  59393,  59372,  59351,  59330,  59308,  59287,  59265,  /* 2616-2623: 114.96° - 115.27° */
-      59244,  59222,  59201,  59179,  59158,  59136,  59114,  59093,  /* 2624-2631: 115.31° - 115.62° */
-      59071,  59049,  59027,  59005,  58983,  58962,  58940,  58918,  /* 2632-2639: 115.66° - 115.97° */
-      58896,  58873,  58851,  58829,  58807,  58785,  58763,  58740,  /* 2640-2647: 116.02° - 116.32° */
-      58718,  58696,  58673,  58651,  58628,  58606,  58583,  58561,  /* 2648-2655: 116.37° - 116.67° */
-      58538,  58516,  58493,  58470,  58448,  58425,  58402,  58379,  /* 2656-2663: 116.72° - 117.03° */
-      58356,  58334,  58311,  58288,  58265,  58242,  58219,  58195,  /* 2664-2671: 117.07° - 117.38° */
-      58172,  58149,  58126,  58103,  58079,  58056,  58033,  58009,  /* 2672-2679: 117.42° - 117.73° */
-      57986,  57963,  57939,  57916,  57892,  57869,  57845,  57821,  /* 2680-2687: 117.77° - 118.08° */
-      57798,  57774,  57750,  57726,  57703,  57679,  57655,  57631,  /* 2688-2695: 118.12° - 118.43° */
-      57607,  57583,  57559,  57535,  57511,  57487,  57463,  57438,  /* 2696-2703: 118.48° - 118.78° */
-      57414,  57390,  57366,  57341,  57317,  57293,  57268,  57244,  /* 2704-2711: 118.83° - 119.14° */
-      57219,  57195,  57170,  57145,  57121,  57096,  57072,  57047,  /* 2712-2719: 119.18° - 119.49° */
-      57022,  56997,  56972,  56948,  56923,  56898,  56873,  56848,  /* 2720-2727: 119.53° - 119.84° */
-      56823,  56798,  56773,  56747,  56722,  56697,  56672,  56647,  /* 2728-2735: 119.88° - 120.19° */
-      56621,  56596,  56571,  56545,  56520,  56494,  56469,  56443,  /* 2736-2743: 120.23° - 120.54° */
-      56418,  56392,  56367,  56341,  56315,  56289,  56264,  56238,  /* 2744-2751: 120.59° - 120.89° */
-      56212,  56186,  56160,  56134,  56108,  56082,  56056,  56030,  /* 2752-2759: 120.94° - 121.25° */
-      56004,  55978,  55952,  55926,  55900,  55873,  55847,  55821,  /* 2760-2767: 121.29° - 121.60° */
-      55794,  55768,  55742,  55715,  55689,  55662,  55636,  55609,  /* 2768-2775: 121.64° - 121.95° */
-      55582,  55556,  55529,  55502,  55476,  55449,  55422,  55395,  /* 2776-2783: 121.99° - 122.30° */
-      55368,  55341,  55314,  55288,  55260,  55233,  55206,  55179,  /* 2784-2791: 122.34° - 122.65° */
-      55152,  55125,  55098,  55071,  55043,  55016,  54989,  54961,  /* 2792-2799: 122.70° - 123.00° */
-      54934,  54906,  54879,  54852,  54824,  54796,  54769,  54741,  /* 2800-2807: 123.05° - 123.35° */
-      54714,  54686,  54658,  54630,  54603,  54575,  54547,  54519,  /* 2808-2815: 123.40° - 123.71° */
-      54491,  54463,  54435,  54407,  54379,  54351,  54323,  54295,  /* 2816-2823: 123.75° - 124.06° */
-      54267,  54239,  54210,  54182,  54154,  54125,  54097,  54069,  /* 2824-2831: 124.10° - 124.41° */
-      54040,  54012,  53983,  53955,  53926,  53898,  53869,  53840,  /* 2832-2839: 124.45° - 124.76° */
-      53812,  53783,  53754,  53726,  53697,  53668,  53639,  53610,  /* 2840-2847: 124.80° - 125.11° */
-      53581,  53552,  53523,  53494,  53465,  53436,  53407,  53378,  /* 2848-2855: 125.16° - 125.46° */
-      53349,  53319,  53290,  53261,  53232,  53202,  53173,  53144,  /* 2856-2863: 125.51° - 125.82° */
-      53114,  53085,  53055,  53026,  52996,  52967,  52937,  52907,  /* 2864-2871: 125.86° - 126.17° */
-      52878,  52848,  52818,  52788,  52759,  52729,  52699,  52669,  /* 2872-2879: 126.21° - 126.52° */
-      52639,  52609,  52579,  52549,  52519,  52489,  52459,  52429,  /* 2880-2887: 126.56° - 126.87° */
-      52398,  52368,  52338,  52308,  52277,  52247,  52217,  52186,  /* 2888-2895: 126.91° - 127.22° */
-      52156,  52126,  52095,  52065,  52034,  52003,  51973,  51942,  /* 2896-2903: 127.27° - 127.57° */
-      51911,  51881,  51850,  51819,  51789,  51758,  51727,  51696,  /* 2904-2911: 127.62° - 127.92° */
-      51665,  51634,  51603,  51572,  51541,  51510,  51479,  51448,  /* 2912-2919: 127.97° - 128.28° */
-      51417,  51386,  51354,  51323,  51292,  51260,  51229,  51198,  /* 2920-2927: 128.32° - 128.63° */
-      51166,  51135,  51104,  51072,  51041,  51009,  50977,  50946,  /* 2928-2935: 128.67° - 128.98° */
-      50914,  50882,  50851,  50819,  50787,  50756,  50724,  50692,  /* 2936-2943: 129.02° - 129.33° */
-      50660,  50628,  50596,  50564,  50532,  50500,  50468,  50436,  /* 2944-2951: 129.38° - 129.68° */
-      50404,  50372,  50340,  50307,  50275,  50243,  50211,  50178,  /* 2952-2959: 129.73° - 130.03° */
-      50146,  50114,  50081,  50049,  50016,  49984,  49951,  49919,  /* 2960-2967: 130.08° - 130.39° */
-      49886,  49854,  49821,  49788,  49756,  49723,  49690,  49657,  /* 2968-2975: 130.43° - 130.74° */
-      49624,  49592,  49559,  49526,  49493,  49460,  49427,  49394,  /* 2976-2983: 130.78° - 131.09° */
-      49361,  49328,  49295,  49262,  49228,  49195,  49162,  49129,  /* 2984-2991: 131.13° - 131.44° */
-      49095,  49062,  49029,  48995,  48962,  48929,  48895,  48862,  /* 2992-2999: 131.48° - 131.79° */
-      48828,  48795,  48761,  48727,  48694,  48660,  48626,  48593,  /* 3000-3007: 131.84° - 132.14° */
-      48559,  48525,  48491,  48458,  48424,  48390,  48356,  48322,  /* 3008-3015: 132.19° - 132.50° */
-      48288,  48254,  48220,  48186,  48152,  48118,  48084,  48049,  /* 3016-3023: 132.54° - 132.85° */
-      48015,  47981,  47947,  47912,  47878,  47844,  47809,  47775,  /* 3024-3031: 132.89° - 133.20° */
-      47741,  47706,  47672,  47637,  47603,  47568,  47534,  47499,  /* 3032-3039: 133.24° - 133.55° */
-      47464,  47430,  47395,  47360,  47325,  47291,  47256,  47221,  /* 3040-3047: 133.59° - 133.90° */
-      47186,  47151,  47116,  47081,  47046,  47011,  46976,  46941,  /* 3048-3055: 133.95° - 134.25° */
-      46906,  46871,  46836,  46801,  46765,  46730,  46695,  46660,  /* 3056-3063: 134.30° - 134.60° */
-      46624,  46589,  46554,  46518,  46483,  46447,  46412,  46376,  /* 3064-3071: 134.65° - 134.96° */
-      46341,  46305,  46270,  46234,  46199,  46163,  46127,  46091,  /* 3072-3079: 135.00° - 135.31° */
-      46056,  46020,  45984,  45948,  45912,  45877,  45841,  45805,  /* 3080-3087: 135.35° - 135.66° */
-      45769,  45733,  45697,  45661,  45625,  45589,  45552,  45516,  /* 3088-3095: 135.70° - 136.01° */
-      45480,  45444,  45408,  45371,  45335,  45299,  45262,  45226,  /* 3096-3103: 136.05° - 136.36° */
-      45190,  45153,  45117,  45080,  45044,  45007,  44971,  44934,  /* 3104-3111: 136.41° - 136.71° */
-      44898,  44861,  44824,  44788,  44751,  44714,  44677,  44641,  /* 3112-3119: 136.76° - 137.07° */
-      44604,  44567,  44530,  44493,  44456,  44419,  44382,  44345,  /* 3120-3127: 137.11° - 137.42° */
-      44308,  44271,  44234,  44197,  44160,  44123,  44086,  44049,  /* 3128-3135: 137.46° - 137.77° */
-      44011,  43974,  43937,  43899,  43862,  43825,  43787,  43750,  /* 3136-3143: 137.81° - 138.12° */
-      43713,  43675,  43638,  43600,  43562,  43525,  43487,  43450,  /* 3144-3151: 138.16° - 138.47° */
-      43412,  43374,  43337,  43299,  43261,  43223,  43186,  43148,  /* 3152-3159: 138.52° - 138.82° */
-      43110,  43072,  43034,  42996,  42958,  42920,  42882,  42844,  /* 3160-3167: 138.87° - 139.17° */
-      42806,  42768,  42730,  42692,  42654,  42616,  42578,  42539,  /* 3168-3175: 139.22° - 139.53° */
-      42501,  42463,  42424,  42386,  42348,  42309,  42271,  42233,  /* 3176-3183: 139.57° - 139.88° */
-      42194,  42156,  42117,  42079,  42040,  42002,  41963,  41924,  /* 3184-3191: 139.92° - 140.23° */
-      41886,  41847,  41808,  41770,  41731,  41692,  41653,  41614,  /* 3192-3199: 140.27° - 140.58° */
-      41576,  41537,  41498,  41459,  41420,  41381,  41342,  41303,  /* 3200-3207: 140.62° - 140.93° */
-      41264,  41225,  41186,  41147,  41108,  41068,  41029,  40990,  /* 3208-3215: 140.98° - 141.28° */
-      40951,  40912,  40872,  40833,  40794,  40754,  40715,  40675,  /* 3216-3223: 141.33° - 141.64° */
-      40636,  40597,  40557,  40518,  40478,  40439,  40399,  40359,  /* 3224-3231: 141.68° - 141.99° */
-      40320,  40280,  40241,  40201,  40161,  40121,  40082,  40042,  /* 3232-3239: 142.03° - 142.34° */
-      40002,  39962,  39922,  39882,  39843,  39803,  39763,  39723,  /* 3240-3247: 142.38° - 142.69° */
-      39683,  39643,  39603,  39563,  39523,  39482,  39442,  39402,  /* 3248-3255: 142.73° - 143.04° */
-      39362,  39322,  39282,  39241,  39201,  39161,  39120,  39080,  /* 3256-3263: 143.09° - 143.39° */
-      39040,  38999,  38959,  38919,  38878,  38838,  38797,  38757,  /* 3264-3271: 143.44° - 143.75° */
-      38716,  38675,  38635,  38594,  38554,  38513,  38472,  38432,  /* 3272-3279: 143.79° - 144.10° */
-      38391,  38350,  38309,  38269,  38228,  38187,  38146,  38105,  /* 3280-3287: 144.14° - 144.45° */
-      38064,  38023,  37982,  37941,  37900,  37859,  37818,  37777,  /* 3288-3295: 144.49° - 144.80° */
-      37736,  37695,  37654,  37613,  37572,  37530,  37489,  37448,  /* 3296-3303: 144.84° - 145.15° */
-      37407,  37365,  37324,  37283,  37241,  37200,  37159,  37117,  /* 3304-3311: 145.20° - 145.50° */
-      37076,  37034,  36993,  36951,  36910,  36868,  36827,  36785,  /* 3312-3319: 145.55° - 145.85° */
-      36744,  36702,  36660,  36619,  36577,  36535,  36493,  36452,  /* 3320-3327: 145.90° - 146.21° */
-      36410,  36368,  36326,  36284,  36243,  36201,  36159,  36117,  /* 3328-3335: 146.25° - 146.56° */
-      36075,  36033,  35991,  35949,  35907,  35865,  35823,  35781,  /* 3336-3343: 146.60° - 146.91° */
-      35738,  35696,  35654,  35612,  35570,  35527,  35485,  35443,  /* 3344-3351: 146.95° - 147.26° */
-      35401,  35358,  35316,  35274,  35231,  35189,  35146,  35104,  /* 3352-3359: 147.30° - 147.61° */
-      35062,  35019,  34977,  34934,  34892,  34849,  34806,  34764,  /* 3360-3367: 147.66° - 147.96° */
-      34721,  34679,  34636,  34593,  34551,  34508,  34465,  34422,  /* 3368-3375: 148.01° - 148.32° */
-      34380,  34337,  34294,  34251,  34208,  34165,  34122,  34079,  /* 3376-3383: 148.36° - 148.67° */
-      34037,  33994,  33951,  33908,  33865,  33821,  33778,  33735,  /* 3384-3391: 148.71° - 149.02° */
-      33692,  33649,  33606,  33563,  33520,  33476,  33433,  33390,  /* 3392-3399: 149.06° - 149.37° */
-      33347,  33303,  33260,  33217,  33173,  33130,  33087,  33043,  /* 3400-3407: 149.41° - 149.72° */
-      33000,  32956,  32913,  32870,  32826,  32783,  32739,  32695,  /* 3408-3415: 149.77° - 150.07° */
-      32652,  32608,  32565,  32521,  32477,  32434,  32390,  32346,  /* 3416-3423: 150.12° - 150.42° */
-      32303,  32259,  32215,  32171,  32127,  32084,  32040,  31996,  /* 3424-3431: 150.47° - 150.78° */
-      31952,  31908,  31864,  31820,  31776,  31732,  31688,  31644,  /* 3432-3439: 150.82° - 151.13° */
-      31600,  31556,  31512,  31468,  31424,  31380,  31336,  31292,  /* 3440-3447: 151.17° - 151.48° */
-      31248,  31203,  31159,  31115,  31071,  31026,  30982,  30938,  /* 3448-3455: 151.52° - 151.83° */
-      30893,  30849,  30805,  30760,  30716,  30672,  30627,  30583,  /* 3456-3463: 151.88° - 152.18° */
-      30538,  30494,  30449,  30405,  30360,  30316,  30271,  30226,  /* 3464-3471: 152.23° - 152.53° */
-      30182,  30137,  30093,  30048,  30003,  29959,  29914,  29869,  /* 3472-3479: 152.58° - 152.89° */
-      29824,  29780,  29735,  29690,  29645,  29600,  29555,  29511,  /* 3480-3487: 152.93° - 153.24° */
-      29466,  29421,  29376,  29331,  29286,  29241,  29196,  29151,  /* 3488-3495: 153.28° - 153.59° */
-      29106,  29061,  29016,  28971,  28926,  28881,  28835,  28790,  /* 3496-3503: 153.63° - 153.94° */
-      28745,  28700,  28655,  28610,  28564,  28519,  28474,  28429,  /* 3504-3511: 153.98° - 154.29° */
-      28383,  28338,  28293,  28247,  28202,  28156,  28111,  28066,  /* 3512-3519: 154.34° - 154.64° */
-      28020,  27975,  27929,  27884,  27838,  27793,  27747,  27702,  /* 3520-3527: 154.69° - 155.00° */
-      27656,  27611,  27565,  27519,  27474,  27428,  27382,  27337,  /* 3528-3535: 155.04° - 155.35° */
-      27291,  27245,  27200,  27154,  27108,  27062,  27017,  26971,  /* 3536-3543: 155.39° - 155.70° */
-      26925,  26879,  26833,  26787,  26742,  26696,  26650,  26604,  /* 3544-3551: 155.74° - 156.05° */
-      26558,  26512,  26466,  26420,  26374,  26328,  26282,  26236,  /* 3552-3559: 156.09° - 156.40° */
-      26190,  26144,  26098,  26051,  26005,  25959,  25913,  25867,  /* 3560-3567: 156.45° - 156.75° */
-      25821,  25774,  25728,  25682,  25636,  25589,  25543,  25497,  /* 3568-3575: 156.80° - 157.10° */
-      25451,  25404,  25358,  25312,  25265,  25219,  25172,  25126,  /* 3576-3583: 157.15° - 157.46° */
-      25080,  25033,  24987,  24940,  24894,  24847,  24801,  24754,  /* 3584-3591: 157.50° - 157.81° */
-      24708,  24661,  24614,  24568,  24521,  24475,  24428,  24381,  /* 3592-3599: 157.85° - 158.16° */
-      24335,  24288,  24241,  24195,  24148,  24101,  24054,  24008,  /* 3600-3607: 158.20° - 158.51° */
-      23961,  23914,  23867,  23820,  23774,  23727,  23680,  23633,  /* 3608-3615: 158.55° - 158.86° */
-      23586,  23539,  23492,  23445,  23398,  23351,  23304,  23257,  /* 3616-3623: 158.91° - 159.21° */
-      23210,  23163,  23116,  23069,  23022,  22975,  22928,  22881,  /* 3624-3631: 159.26° - 159.57° */
-      22834,  22787,  22740,  22693,  22645,  22598,  22551,  22504,  /* 3632-3639: 159.61° - 159.92° */
-      22457,  22409,  22362,  22315,  22268,  22220,  22173,  22126,  /* 3640-3647: 159.96° - 160.27° */
-      22078,  22031,  21984,  21936,  21889,  21842,  21794,  21747,  /* 3648-3655: 160.31° - 160.62° */
-      21699,  21652,  21604,  21557,  21510,  21462,  21415,  21367,  /* 3656-3663: 160.66° - 160.97° */
-      21320,  21272,  21224,  21177,  21129,  21082,  21034,  20987,  /* 3664-3671: 161.02° - 161.32° */
-      20939,  20891,  20844,  20796,  20748,  20701,  20653,  20605,  /* 3672-3679: 161.37° - 161.67° */
-      20557,  20510,  20462,  20414,  20366,  20319,  20271,  20223,  /* 3680-3687: 161.72° - 162.03° */
-      20175,  20127,  20080,  20032,  19984,  19936,  19888,  19840,  /* 3688-3695: 162.07° - 162.38° */
-      19792,  19744,  19696,  19648,  19600,  19553,  19505,  19457,  /* 3696-3703: 162.42° - 162.73° */
-      19409,  19361,  19313,  19264,  19216,  19168,  19120,  19072,  /* 3704-3711: 162.77° - 163.08° */
-      19024,  18976,  18928,  18880,  18832,  18783,  18735,  18687,  /* 3712-3719: 163.12° - 163.43° */
-      18639,  18591,  18543,  18494,  18446,  18398,  18350,  18301,  /* 3720-3727: 163.48° - 163.78° */
-      18253,  18205,  18156,  18108,  18060,  18012,  17963,  17915,  /* 3728-3735: 163.83° - 164.14° */
-      17867,  17818,  17770,  17721,  17673,  17625,  17576,  17528,  /* 3736-3743: 164.18° - 164.49° */
-      17479,  17431,  17382,  17334,  17285,  17237,  17188,  17140,  /* 3744-3751: 164.53° - 164.84° */
-      17091,  17043,  16994,  16946,  16897,  16849,  16800,  16751,  /* 3752-3759: 164.88° - 165.19° */
-      16703,  16654,  16606,  16557,  16508,  16460,  16411,  16362,  /* 3760-3767: 165.23° - 165.54° */
-      16314,  16265,  16216,  16168,  16119,  16070,  16021,  15973,  /* 3768-3775: 165.59° - 165.89° */
-      15924,  15875,  15826,  15778,  15729,  15680,  15631,  15582,  /* 3776-3783: 165.94° - 166.25° */
-      15534,  15485,  15436,  15387,  15338,  15289,  15240,  15192,  /* 3784-3791: 166.29° - 166.60° */
-      15143,  15094,  15045,  14996,  14947,  14898,  14849,  14800,  /* 3792-3799: 166.64° - 166.95° */
-      14751,  14702,  14653,  14604,  14555,  14506,  14457,  14408,  /* 3800-3807: 166.99° - 167.30° */
-      14359,  14310,  14261,  14212,  14163,  14114,  14065,  14016,  /* 3808-3815: 167.34° - 167.65° */
-      13966,  13917,  13868,  13819,  13770,  13721,  13672,  13622,  /* 3816-3823: 167.70° - 168.00° */
-      13573,  13524,  13475,  13426,  13376,  13327,  13278,  13229,  /* 3824-3831: 168.05° - 168.35° */
-      13180,  13130,  13081,  13032,  12983,  12933,  12884,  12835,  /* 3832-3839: 168.40° - 168.71° */
-      12785,  12736,  12687,  12638,  12588,  12539,  12490,  12440,  /* 3840-3847: 168.75° - 169.06° */
-      12391,  12341,  12292,  12243,  12193,  12144,  12095,  12045,  /* 3848-3855: 169.10° - 169.41° */
-      11996,  11946,  11897,  11847,  11798,  11749,  11699,  11650,  /* 3856-3863: 169.45° - 169.76° */
-      11600,  11551,  11501,  11452,  11402,  11353,  11303,  11254,  /* 3864-3871: 169.80° - 170.11° */
-      11204,  11155,  11105,  11056,  11006,  10956,  10907,  10857,  /* 3872-3879: 170.16° - 170.46° */
-      10808,  10758,  10709,  10659,  10609,  10560,  10510,  10461,  /* 3880-3887: 170.51° - 170.82° */
-      10411,  10361,  10312,  10262,  10212,  10163,  10113,  10063,  /* 3888-3895: 170.86° - 171.17° */
-      10014,   9964,   9914,   9865,   9815,   9765,   9716,   9666,  /* 3896-3903: 171.21° - 171.52° */
-       9616,   9566,   9517,   9467,   9417,   9367,   9318,   9268,  /* 3904-3911: 171.56° - 171.87° */
-       9218,   9168,   9119,   9069,   9019,   8969,   8919,   8870,  /* 3912-3919: 171.91° - 172.22° */
-       8820,   8770,   8720,   8670,   8621,   8571,   8521,   8471,  /* 3920-3927: 172.27° - 172.57° */
-       8421,   8371,   8322,   8272,   8222,   8172,   8122,   8072,  /* 3928-3935: 172.62° - 172.92° */
-       8022,   7972,   7923,   7873,   7823,   7773,   7723,   7673,  /* 3936-3943: 172.97° - 173.28° */
-       7623,   7573,   7523,   7473,   7423,   7373,   7323,   7273,  /* 3944-3951: 173.32° - 173.63° */
-       7224,   7174,   7124,   7074,   7024,   6974,   6924,   6874,  /* 3952-3959: 173.67° - 173.98° */
-       6824,   6774,   6724,   6674,   6624,   6574,   6524,   6474,  /* 3960-3967: 174.02° - 174.33° */
-       6424,   6374,   6324,   6274,   6224,   6173,   6123,   6073,  /* 3968-3975: 174.38° - 174.68° */
-       6023,   5973,   5923,   5873,   5823,   5773,   5723,   5673,  /* 3976-3983: 174.73° - 175.03° */
-       5623,   5573,   5523,   5473,   5422,   5372,   5322,   5272,  /* 3984-3991: 175.08° - 175.39° */
-       5222,   5172,   5122,   5072,   5022,   4972,   4921,   4871,  /* 3992-3999: 175.43° - 175.74° */
-       4821,   4771,   4721,   4671,   4621,   4570,   4520,   4470,  /* 4000-4007: 175.78° - 176.09° */
-       4420,   4370,   4320,   4270,   4219,   4169,   4119,   4069,  /* 4008-4015: 176.13° - 176.44° */
-       4019,   3969,   3918,   3868,   3818,   3768,   3718,   3667,  /* 4016-4023: 176.48° - 176.79° */
-       3617,   3567,   3517,   3467,   3417,   3366,   3316,   3266,  /* 4024-4031: 176.84° - 177.14° */
-       3216,   3165,   3115,   3065,   3015,   2965,   2914,   2864,  /* 4032-4039: 177.19° - 177.50° */
-       2814,   2764,   2714,   2663,   2613,   2563,   2513,   2462,  /* 4040-4047: 177.54° - 177.85° */
-       2412,   2362,   2312,   2261,   2211,   2161,   2111,   2061,  /* 4048-4055: 177.89° - 178.20° */
-       2010,   1960,   1910,   1860,   1809,   1759,   1709,   1659,  /* 4056-4063: 178.24° - 178.55° */
-       1608,   1558,   1508,   1458,   1407,   1357,   1307,   1257,  /* 4064-4071: 178.59° - 178.90° */
-       1206,   1156,   1106,   1056,   1005,    955,    905,    854,  /* 4072-4079: 178.95° - 179.25° */
-        804,    754,    704,    653,    603,    553,    503,    452,  /* 4080-4087: 179.30° - 179.60° */
-        402,    352,    302,    251,    201,    151,    101,     50,  /* 4088-4095: 179.65° - 179.96° */
-          0,    -50,   -101,   -151,   -201,   -251,   -302,   -352,  /* 4096-4103: 180.00° - 180.31° */
-       -402,   -452,   -503,   -553,   -603,   -653,   -704,   -754,  /* 4104-4111: 180.35° - 180.66° */
-       -804,   -854,   -905,   -955,  -1005,  -1056,  -1106,  -1156,  /* 4112-4119: 180.70° - 181.01° */
-      -1206,  -1257,  -1307,  -1357,  -1407,  -1458,  -1508,  -1558,  /* 4120-4127: 181.05° - 181.36° */
-      -1608,  -1659,  -1709,  -1759,  -1809,  -1860,  -1910,  -1960,  /* 4128-4135: 181.41° - 181.71° */
-      -2010,  -2061,  -2111,  -2161,  -2211,  -2261,  -2312,  -2362,  /* 4136-4143: 181.76° - 182.07° */
-      -2412,  -2462,  -2513,  -2563,  -2613,  -2663,  -2714,  -2764,  /* 4144-4151: 182.11° - 182.42° */
-      -2814,  -2864,  -2914,  -2965,  -3015,  -3065,  -3115,  -3165,  /* 4152-4159: 182.46° - 182.77° */
-      -3216,  -3266,  -3316,  -3366,  -3417,  -3467,  -3517,  -3567,  /* 4160-4167: 182.81° - 183.12° */
-      -3617,  -3667,  -3718,  -3768,  -3818,  -3868,  -3918,  -3969,  /* 4168-4175: 183.16° - 183.47° */
-      -4019,  -4069,  -4119,  -4169,  -4219,  -4270,  -4320,  -4370,  /* 4176-4183: 183.52° - 183.82° */
-      -4420,  -4470,  -4520,  -4570,  -4621,  -4671,  -4721,  -4771,  /* 4184-4191: 183.87° - 184.17° */
-      -4821,  -4871,  -4921,  -4972,  -5022,  -5072,  -5122,  -5172,  /* 4192-4199: 184.22° - 184.53° */
-      -5222,  -5272,  -5322,  -5372,  -5422,  -5473,  -5523,  -5573,  /* 4200-4207: 184.57° - 184.88° */
-      -5623,  -5673,  -5723,  -5773,  -5823,  -5873,  -5923,  -5973,  /* 4208-4215: 184.92° - 185.23° */
-      -6023,  -6073,  -6123,  -6173,  -6224,  -6274,  -6324,  -6374,  /* 4216-4223: 185.27° - 185.58° */
-      -6424,  -6474,  -6524,  -6574,  -6624,  -6674,  -6724,  -6774,  /* 4224-4231: 185.62° - 185.93° */
-      -6824,  -6874,  -6924,  -6974,  -7024,  -7074,  -7124,  -7174,  /* 4232-4239: 185.98° - 186.28° */
-      -7224,  -7273,  -7323,  -7373,  -7423,  -7473,  -7523,  -7573,  /* 4240-4247: 186.33° - 186.64° */
-      -7623,  -7673,  -7723,  -7773,  -7823,  -7873,  -7923,  -7972,  /* 4248-4255: 186.68° - 186.99° */
-      -8022,  -8072,  -8122,  -8172,  -8222,  -8272,  -8322,  -8371,  /* 4256-4263: 187.03° - 187.34° */
-      -8421,  -8471,  -8521,  -8571,  -8621,  -8670,  -8720,  -8770,  /* 4264-4271: 187.38° - 187.69° */
-      -8820,  -8870,  -8919,  -8969,  -9019,  -9069,  -9119,  -9168,  /* 4272-4279: 187.73° - 188.04° */
-      -9218,  -9268,  -9318,  -9367,  -9417,  -9467,  -9517,  -9566,  /* 4280-4287: 188.09° - 188.39° */
-      -9616,  -9666,  -9716,  -9765,  -9815,  -9865,  -9914,  -9964,  /* 4288-4295: 188.44° - 188.75° */
-     -10014, -10063, -10113, -10163, -10212, -10262, -10312, -10361,  /* 4296-4303: 188.79° - 189.10° */
-     -10411, -10461, -10510, -10560, -10609, -10659, -10709, -10758,  /* 4304-4311: 189.14° - 189.45° */
-     -10808, -10857, -10907, -10956, -11006, -11056, -11105, -11155,  /* 4312-4319: 189.49° - 189.80° */
-     -11204, -11254, -11303, -11353, -11402, -11452, -11501, -11551,  /* 4320-4327: 189.84° - 190.15° */
-     -11600, -11650, -11699, -11749, -11798, -11847, -11897, -11946,  /* 4328-4335: 190.20° - 190.50° */
-     -11996, -12045, -12095, -12144, -12193, -12243, -12292, -12341,  /* 4336-4343: 190.55° - 190.85° */
-     -12391, -12440, -12490, -12539, -12588, -12638, -12687, -12736,  /* 4344-4351: 190.90° - 191.21° */
-     -12785, -12835, -12884, -12933, -12983, -13032, -13081, -13130,  /* 4352-4359: 191.25° - 191.56° */
-     -13180, -13229, -13278, -13327, -13376, -13426, -13475, -13524,  /* 4360-4367: 191.60° - 191.91° */
-     -13573, -13622, -13672, -13721, -13770, -13819, -13868, -13917,  /* 4368-4375: 191.95° - 192.26° */
-     -13966, -14016, -14065, -14114, -14163, -14212, -14261, -14310,  /* 4376-4383: 192.30° - 192.61° */
-     -14359, -14408, -14457, -14506, -14555, -14604, -14653, -14702,  /* 4384-4391: 192.66° - 192.96° */
-     -14751, -14800, -14849, -14898, -14947, -14996, -15045, -15094,  /* 4392-4399: 193.01° - 193.32° */
-     -15143, -15192, -15240, -15289, -15338, -15387, -15436, -15485,  /* 4400-4407: 193.36° - 193.67° */
-     -15534, -15582, -15631, -15680, -15729, -15778, -15826, -15875,  /* 4408-4415: 193.71° - 194.02° */
-     -15924, -15973, -16021, -16070, -16119, -16168, -16216, -16265,  /* 4416-4423: 194.06° - 194.37° */
-     -16314, -16362, -16411, -16460, -16508, -16557, -16606, -16654,  /* 4424-4431: 194.41° - 194.72° */
-     -16703, -16751, -16800, -16849, -16897, -16946, -16994, -17043,  /* 4432-4439: 194.77° - 195.07° */
-     -17091, -17140, -17188, -17237, -17285, -17334, -17382, -17431,  /* 4440-4447: 195.12° - 195.42° */
-     -17479, -17528, -17576, -17625, -17673, -17721, -17770, -17818,  /* 4448-4455: 195.47° - 195.78° */
-     -17867, -17915, -17963, -18012, -18060, -18108, -18156, -18205,  /* 4456-4463: 195.82° - 196.13° */
-     -18253, -18301, -18350, -18398, -18446, -18494, -18543, -18591,  /* 4464-4471: 196.17° - 196.48° */
-     -18639, -18687, -18735, -18783, -18832, -18880, -18928, -18976,  /* 4472-4479: 196.52° - 196.83° */
-     -19024, -19072, -19120, -19168, -19216, -19264, -19313, -19361,  /* 4480-4487: 196.88° - 197.18° */
-     -19409, -19457, -19505, -19553, -19600, -19648, -19696, -19744,  /* 4488-4495: 197.23° - 197.53° */
-     -19792, -19840, -19888, -19936, -19984, -20032, -20080, -20127,  /* 4496-4503: 197.58° - 197.89° */
-     -20175, -20223, -20271, -20319, -20366, -20414, -20462, -20510,  /* 4504-4511: 197.93° - 198.24° */
-     -20557, -20605, -20653, -20701, -20748, -20796, -20844, -20891,  /* 4512-4519: 198.28° - 198.59° */
-     -20939, -20987, -21034, -21082, -21129, -21177, -21224, -21272,  /* 4520-4527: 198.63° - 198.94° */
-     -21320, -21367, -21415, -21462, -21510, -21557, -21604, -21652,  /* 4528-4535: 198.98° - 199.29° */
-     -21699, -21747, -21794, -21842, -21889, -21936, -21984, -22031,  /* 4536-4543: 199.34° - 199.64° */
-     -22078, -22126, -22173, -22220, -22268, -22315, -22362, -22409,  /* 4544-4551: 199.69° - 200.00° */
-     -22457, -22504, -22551, -22598, -22645, -22693, -22740, -22787,  /* 4552-4559: 200.04° - 200.35° */
-     -22834, -22881, -22928, -22975, -23022, -23069, -23116, -23163,  /* 4560-4567: 200.39° - 200.70° */
-     -23210, -23257, -23304, -23351, -23398, -23445, -23492, -23539,  /* 4568-4575: 200.74° - 201.05° */
-     -23586, -23633, -23680, -23727, -23774, -23820, -23867, -23914,  /* 4576-4583: 201.09° - 201.40° */
-     -23961, -24008, -24054, -24101, -24148, -24195, -24241, -24288,  /* 4584-4591: 201.45° - 201.75° */
-     -24335, -24381, -24428, -24475, -24521, -24568, -24614, -24661,  /* 4592-4599: 201.80° - 202.10° */
-     -24708, -24754, -24801, -24847, -24894, -24940, -24987, -25033,  /* 4600-4607: 202.15° - 202.46° */
-     -25080, -25126, -25172, -25219, -25265, -25312, -25358, -25404,  /* 4608-4615: 202.50° - 202.81° */
-     -25451, -25497, -25543, -25589, -25636, -25682, -25728, -25774,  /* 4616-4623: 202.85° - 203.16° */
-     -25821, -25867, -25913, -25959, -26005, -26051, -26098, -26144,  /* 4624-4631: 203.20° - 203.51° */
-     -26190, -26236, -26282, -26328, -26374, -26420, -26466, -26512,  /* 4632-4639: 203.55° - 203.86° */
-     -26558, -26604, -26650, -26696, -26742, -26787, -26833, -26879,  /* 4640-4647: 203.91° - 204.21° */
-     -26925, -26971, -27017, -27062, -27108, -27154, -27200, -27245,  /* 4648-4655: 204.26° - 204.57° */
-     -27291, -27337, -27382, -27428, -27474, -27519, -27565, -27611,  /* 4656-4663: 204.61° - 204.92° */
-     -27656, -27702, -27747, -27793, -27838, -27884, -27929, -27975,  /* 4664-4671: 204.96° - 205.27° */
-     -28020, -28066, -28111, -28156, -28202, -28247, -28293, -28338,  /* 4672-4679: 205.31° - 205.62° */
-     -28383, -28429, -28474, -28519, -28564, -28610, -28655, -28700,  /* 4680-4687: 205.66° - 205.97° */
-     -28745, -28790, -28835, -28881, -28926, -28971, -29016, -29061,  /* 4688-4695: 206.02° - 206.32° */
-     -29106, -29151, -29196, -29241, -29286, -29331, -29376, -29421,  /* 4696-4703: 206.37° - 206.67° */
-     -29466, -29511, -29555, -29600, -29645, -29690, -29735, -29780,  /* 4704-4711: 206.72° - 207.03° */
-     -29824, -29869, -29914, -29959, -30003, -30048, -30093, -30137,  /* 4712-4719: 207.07° - 207.38° */
-     -30182, -30226, -30271, -30316, -30360, -30405, -30449, -30494,  /* 4720-4727: 207.42° - 207.73° */
-     -30538, -30583, -30627, -30672, -30716, -30760, -30805, -30849,  /* 4728-4735: 207.77° - 208.08° */
-     -30893, -30938, -30982, -31026, -31071, -31115, -31159, -31203,  /* 4736-4743: 208.12° - 208.43° */
-     -31248, -31292, -31336, -31380, -31424, -31468, -31512, -31556,  /* 4744-4751: 208.48° - 208.78° */
-     -31600, -31644, -31688, -31732, -31776, -31820, -31864, -31908,  /* 4752-4759: 208.83° - 209.14° */
-     -31952, -31996, -32040, -32084, -32127, -32171, -32215, -32259,  /* 4760-4767: 209.18° - 209.49° */
-     -32303, -32346, -32390, -32434, -32477, -32521, -32565, -32608,  /* 4768-4775: 209.53° - 209.84° */
-     -32652, -32695, -32739, -32783, -32826, -32870, -32913, -32956,  /* 4776-4783: 209.88° - 210.19° */
-     -33000, -33043, -33087, -33130, -33173, -33217, -33260, -33303,  /* 4784-4791: 210.23° - 210.54° */
-     -33347, -33390, -33433, -33476, -33520, -33563, -33606, -33649,  /* 4792-4799: 210.59° - 210.89° */
-     -33692, -33735, -33778, -33821, -33865, -33908, -33951, -33994,  /* 4800-4807: 210.94° - 211.25° */
-     -34037, -34079, -34122, -34165, -34208, -34251, -34294, -34337,  /* 4808-4815: 211.29° - 211.60° */
-     -34380, -34422, -34465, -34508, -34551, -34593, -34636, -34679,  /* 4816-4823: 211.64° - 211.95° */
-     -34721, -34764, -34806, -34849, -34892, -34934, -34977, -35019,  /* 4824-4831: 211.99° - 212.30° */
-     -35062, -35104, -35146, -35189, -35231, -35274, -35316, -35358,  /* 4832-4839: 212.34° - 212.65° */
-     -35401, -35443, -35485, -35527, -35570, -35612, -35654, -35696,  /* 4840-4847: 212.70° - 213.00° */
-     -35738, -35781, -35823, -35865, -35907, -35949, -35991, -36033,  /* 4848-4855: 213.05° - 213.35° */
-     -36075, -36117, -36159, -36201, -36243, -36284, -36326, -36368,  /* 4856-4863: 213.40° - 213.71° */
-     -36410, -36452, -36493, -36535, -36577, -36619, -36660, -36702,  /* 4864-4871: 213.75° - 214.06° */
-     -36744, -36785, -36827, -36868, -36910, -36951, -36993, -37034,  /* 4872-4879: 214.10° - 214.41° */
-     -37076, -37117, -37159, -37200, -37241, -37283, -37324, -37365,  /* 4880-4887: 214.45° - 214.76° */
-     -37407, -37448, -37489, -37530, -37572, -37613, -37654, -37695,  /* 4888-4895: 214.80° - 215.11° */
-     -37736, -37777, -37818, -37859, -37900, -37941, -37982, -38023,  /* 4896-4903: 215.16° - 215.46° */
-     -38064, -38105, -38146, -38187, -38228, -38269, -38309, -38350,  /* 4904-4911: 215.51° - 215.82° */
-     -38391, -38432, -38472, -38513, -38554, -38594, -38635, -38675,  /* 4912-4919: 215.86° - 216.17° */
-     -38716, -38757, -38797, -38838, -38878, -38919, -38959, -38999,  /* 4920-4927: 216.21° - 216.52° */
-     -39040, -39080, -39120, -39161, -39201, -39241, -39282, -39322,  /* 4928-4935: 216.56° - 216.87° */
-     -39362, -39402, -39442, -39482, -39523, -39563, -39603, -39643,  /* 4936-4943: 216.91° - 217.22° */
-     -39683, -39723, -39763, -39803, -39843, -39882, -39922, -39962,  /* 4944-4951: 217.27° - 217.57° */
-     -40002, -40042, -40082, -40121, -40161, -40201, -40241, -40280,  /* 4952-4959: 217.62° - 217.92° */
-     -40320, -40359, -40399, -40439, -40478, -40518, -40557, -40597,  /* 4960-4967: 217.97° - 218.28° */
-     -40636, -40675, -40715, -40754, -40794, -40833, -40872, -40912,  /* 4968-4975: 218.32° - 218.63° */
-     -40951, -40990, -41029, -41068, -41108, -41147, -41186, -41225,  /* 4976-4983: 218.67° - 218.98° */
-     -41264, -41303, -41342, -41381, -41420, -41459, -41498, -41537,  /* 4984-4991: 219.02° - 219.33° */
-     -41576, -41614, -41653, -41692, -41731, -41770, -41808, -41847,  /* 4992-4999: 219.38° - 219.68° */
-     -41886, -41924, -41963, -42002, -42040, -42079, -42117, -42156,  /* 5000-5007: 219.73° - 220.03° */
-     -42194, -42233, -42271, -42309, -42348, -42386, -42424, -42463,  /* 5008-5015: 220.08° - 220.39° */
-     -42501, -42539, -42578, -42616, -42654, -42692, -42730, -42768,  /* 5016-5023: 220.43° - 220.74° */
-     -42806, -42844, -42882, -42920, -42958, -42996, -43034, -43072,  /* 5024-5031: 220.78° - 221.09° */
-     -43110, -43148, -43186, -43223, -43261, -43299, -43337, -43374,  /* 5032-5039: 221.13° - 221.44° */
-     -43412, -43450, -43487, -43525, -43562, -43600, -43638, -43675,  /* 5040-5047: 221.48° - 221.79° */
-     -43713, -43750, -43787, -43825, -43862, -43899, -43937, -43974,  /* 5048-5055: 221.84° - 222.14° */
-     -44011, -44049, -44086, -44123, -44160, -44197, -44234, -44271,  /* 5056-5063: 222.19° - 222.50° */
-     -44308, -44345, -44382, -44419, -44456, -44493, -44530, -44567,  /* 5064-5071: 222.54° - 222.85° */
-     -44604, -44641, -44677, -44714, -44751, -44788, -44824, -44861,  /* 5072-5079: 222.89° - 223.20° */
-     -44898, -44934, -44971, -45007, -45044, -45080, -45117, -45153,  /* 5080-5087: 223.24° - 223.55° */
-     -45190, -45226, -45262, -45299, -45335, -45371, -45408, -45444,  /* 5088-5095: 223.59° - 223.90° */
-     -45480, -45516, -45552, -45589, -45625, -45661, -45697, -45733,  /* 5096-5103: 223.95° - 224.25° */
-     -45769, -45805, -45841, -45877, -45912, -45948, -45984, -46020,  /* 5104-5111: 224.30° - 224.60° */
-     -46056, -46091, -46127, -46163, -46199, -46234, -46270, -46305,  /* 5112-5119: 224.65° - 224.96° */
-     -46341, -46376, -46412, -46447, -46483, -46518, -46554, -46589,  /* 5120-5127: 225.00° - 225.31° */
-     -46624, -46660, -46695, -46730, -46765, -46801, -46836, -46871,  /* 5128-5135: 225.35° - 225.66° */
-     -46906, -46941, -46976, -47011, -47046, -47081, -47116, -47151,  /* 5136-5143: 225.70° - 226.01° */
-     -47186, -47221, -47256, -47291, -47325, -47360, -47395, -47430,  /* 5144-5151: 226.05° - 226.36° */
-     -47464, -47499, -47534, -47568, -47603, -47637, -47672, -47706,  /* 5152-5159: 226.41° - 226.71° */
-     -47741, -47775, -47809, -47844, -47878, -47912, -47947, -47981,  /* 5160-5167: 226.76° - 227.07° */
-     -48015, -48049, -48084, -48118, -48152, -48186, -48220, -48254,  /* 5168-5175: 227.11° - 227.42° */
-     -48288, -48322, -48356, -48390, -48424, -48458, -48491, -48525,  /* 5176-5183: 227.46° - 227.77° */
-     -48559, -48593, -48626, -48660, -48694, -48727, -48761, -48795,  /* 5184-5191: 227.81° - 228.12° */
-     -48828, -48862, -48895, -48929, -48962, -48995, -49029, -49062,  /* 5192-5199: 228.16° - 228.47° */
-     -49095, -49129, -49162, -49195, -49228, -49262, -49295, -49328,  /* 5200-5207: 228.52° - 228.82° */
-     -49361, -49394, -49427, -49460, -49493, -49526, -49559, -49592,  /* 5208-5215: 228.87° - 229.17° */
-     -49624, -49657, -49690, -49723, -49756, -49788, -49821, -49854,  /* 5216-5223: 229.22° - 229.53° */
-     -49886, -49919, -49951, -49984, -50016, -50049, -50081, -50114,  /* 5224-5231: 229.57° - 229.88° */
-     -50146, -50178, -50211, -50243, -50275, -50307, -50340, -50372,  /* 5232-5239: 229.92° - 230.23° */
-     -50404, -50436, -50468, -50500, -50532, -50564, -50596, -50628,  /* 5240-5247: 230.27° - 230.58° */
-     -50660, -50692, -50724, -50756, -50787, -50819, -50851, -50882,  /* 5248-5255: 230.62° - 230.93° */
-     -50914, -50946, -50977, -51009, -51041, -51072, -51104, -51135,  /* 5256-5263: 230.98° - 231.28° */
-     -51166, -51198, -51229, -51260, -51292, -51323, -51354, -51386,  /* 5264-5271: 231.33° - 231.64° */
-     -51417, -51448, -51479, -51510, -51541, -51572, -51603, -51634,  /* 5272-5279: 231.68° - 231.99° */
-     -51665, -51696, -51727, -51758, -51789, -51819, -51850, -51881,  /* 5280-5287: 232.03° - 232.34° */
-     -51911, -51942, -51973, -52003, -52034, -52065, -52095, -52126,  /* 5288-5295: 232.38° - 232.69° */
-     -52156, -52186, -52217, -52247, -52277, -52308, -52338, -52368,  /* 5296-5303: 232.73° - 233.04° */
-     -52398, -52429, -52459, -52489, -52519, -52549, -52579, -52609,  /* 5304-5311: 233.09° - 233.39° */
-     -52639, -52669, -52699, -52729, -52759, -52788, -52818, -52848,  /* 5312-5319: 233.44° - 233.75° */
-     -52878, -52907, -52937, -52967, -52996, -53026, -53055, -53085,  /* 5320-5327: 233.79° - 234.10° */
-     -53114, -53144, -53173, -53202, -53232, -53261, -53290, -53319,  /* 5328-5335: 234.14° - 234.45° */
-     -53349, -53378, -53407, -53436, -53465, -53494, -53523, -53552,  /* 5336-5343: 234.49° - 234.80° */
-     -53581, -53610, -53639, -53668, -53697, -53726, -53754, -53783,  /* 5344-5351: 234.84° - 235.15° */
-     -53812, -53840, -53869, -53898, -53926, -53955, -53983, -54012,  /* 5352-5359: 235.20° - 235.50° */
-     -54040, -54069, -54097, -54125, -54154, -54182, -54210, -54239,  /* 5360-5367: 235.55° - 235.85° */
-     -54267, -54295, -54323, -54351, -54379, -54407, -54435, -54463,  /* 5368-5375: 235.90° - 236.21° */
-     -54491, -54519, -54547, -54575, -54603, -54630, -54658, -54686,  /* 5376-5383: 236.25° - 236.56° */
-     -54714, -54741, -54769, -54796, -54824, -54852, -54879, -54906,  /* 5384-5391: 236.60° - 236.91° */
-     -54934, -54961, -54989, -55016, -55043, -55071, -55098, -55125,  /* 5392-5399: 236.95° - 237.26° */
-     -55152, -55179, -55206, -55233, -55260, -55288, -55314, -55341,  /* 5400-5407: 237.30° - 237.61° */
-     -55368, -55395, -55422, -55449, -55476, -55502, -55529, -55556,  /* 5408-5415: 237.66° - 237.96° */
-     -55582, -55609, -55636, -55662, -55689, -55715, -55742, -55768,  /* 5416-5423: 238.01° - 238.32° */
-     -55794, -55821, -55847, -55873, -55900, -55926, -55952, -55978,  /* 5424-5431: 238.36° - 238.67° */
-     -56004, -56030, -56056, -56082, -56108, -56134, -56160, -56186,  /* 5432-5439: 238.71° - 239.02° */
-     -56212, -56238, -56264, -56289, -56315, -56341, -56367, -56392,  /* 5440-5447: 239.06° - 239.37° */
-     -56418, -56443, -56469, -56494, -56520, -56545, -56571, -56596,  /* 5448-5455: 239.41° - 239.72° */
-     -56621, -56647, -56672, -56697, -56722, -56747, -56773, -56798,  /* 5456-5463: 239.77° - 240.07° */
-     -56823, -56848, -56873, -56898, -56923, -56948, -56972, -56997,  /* 5464-5471: 240.12° - 240.42° */
-     -57022, -57047, -57072, -57096, -57121, -57145, -57170, -57195,  /* 5472-5479: 240.47° - 240.78° */
-     -57219, -57244, -57268, -57293, -57317, -57341, -57366, -57390,  /* 5480-5487: 240.82° - 241.13° */
-     -57414, -57438, -57463, -57487, -57511, -57535, -57559, -57583,  /* 5488-5495: 241.17° - 241.48° */
-     -57607, -57631, -57655, -57679, -57703, -57726, -57750, -57774,  /* 5496-5503: 241.52° - 241.83° */
-     -57798, -57821, -57845, -57869, -57892, -57916, -57939, -57963,  /* 5504-5511: 241.88° - 242.18° */
-     -57986, -58009, -58033, -58056, -58079, -58103, -58126, -58149,  /* 5512-5519: 242.23° - 242.53° */
-     -58172, -58195, -58219, -58242, -58265, -58288, -58311, -58334,  /* 5520-5527: 242.58° - 242.89° */
-     -58356, -58379, -58402, -58425, -58448, -58470, -58493, -58516,  /* 5528-5535: 242.93° - 243.24° */
-     -58538, -58561, -58583, -58606, -58628, -58651, -58673, -58696,  /* 5536-5543: 243.28° - 243.59° */
-     -58718, -58740, -58763, -58785, -58807, -58829, -58851, -58873,  /* 5544-5551: 243.63° - 243.94° */
-     -58896, -58918, -58940, -58962, -58983, -59005, -59027, -59049,  /* 5552-5559: 243.98° - 244.29° */
-     -59071, -59093, -59114, -59136, -59158, -59179, -59201, -59222,  /* 5560-5567: 244.34° - 244.64° */
-     -59244, -59265, -59287, -59308, -59330, -59351, -59372, -59393,  /* 5568-5575: 244.69° - 245.00° */
-     -59415, -59436, -59457, -59478, -59499, -59520, -59541, -59562,  /* 5576-5583: 245.04° - 245.35° */
-     -59583, -59604, -59625, -59646, -59667, -59687, -59708, -59729,  /* 5584-5591: 245.39° - 245.70° */
-     -59750, -59770, -59791, -59811, -59832, -59852, -59873, -59893,  /* 5592-5599: 245.74° - 246.05° */
-     -59914, -59934, -59954, -59975, -59995, -60015, -60035, -60055,  /* 5600-5607: 246.09° - 246.40° */
-     -60075, -60096, -60116, -60136, -60156, -60175, -60195, -60215,  /* 5608-5615: 246.45° - 246.75° */
-     -60235, -60255, -60275, -60294, -60314, -60334, -60353, -60373,  /* 5616-5623: 246.80° - 247.10° */
-     -60392, -60412, -60431, -60451, -60470, -60490, -60509, -60528,  /* 5624-5631: 247.15° - 247.46° */
-     -60547, -60567, -60586, -60605, -60624, -60643, -60662, -60681,  /* 5632-5639: 247.50° - 247.81° */
-     -60700, -60719, -60738, -60757, -60776, -60794, -60813, -60832,  /* 5640-5647: 247.85° - 248.16° */
-     -60851, -60869, -60888, -60906, -60925, -60943, -60962, -60980,  /* 5648-5655: 248.20° - 248.51° */
-     -60999, -61017, -61035, -61054, -61072, -61090, -61108, -61127,  /* 5656-5663: 248.55° - 248.86° */
-     -61145, -61163, -61181, -61199, -61217, -61235, -61253, -61270,  /* 5664-5671: 248.91° - 249.21° */
-     -61288, -61306, -61324, -61341, -61359, -61377, -61394, -61412,  /* 5672-5679: 249.26° - 249.57° */
-     -61429, -61447, -61464, -61482, -61499, -61517, -61534, -61551,  /* 5680-5687: 249.61° - 249.92° */
-     -61568, -61586, -61603, -61620, -61637, -61654, -61671, -61688,  /* 5688-5695: 249.96° - 250.27° */
-     -61705, -61722, -61739, -61756, -61772, -61789, -61806, -61823,  /* 5696-5703: 250.31° - 250.62° */
-     -61839, -61856, -61873, -61889, -61906, -61922, -61939, -61955,  /* 5704-5711: 250.66° - 250.97° */
-     -61971, -61988, -62004, -62020, -62036, -62053, -62069, -62085,  /* 5712-5719: 251.02° - 251.32° */
-     -62101, -62117, -62133, -62149, -62165, -62181, -62197, -62212,  /* 5720-5727: 251.37° - 251.67° */
-     -62228, -62244, -62260, -62275, -62291, -62307, -62322, -62338,  /* 5728-5735: 251.72° - 252.03° */
-     -62353, -62369, -62384, -62400, -62415, -62430, -62445, -62461,  /* 5736-5743: 252.07° - 252.38° */
-     -62476, -62491, -62506, -62521, -62536, -62551, -62566, -62581,  /* 5744-5751: 252.42° - 252.73° */
-     -62596, -62611, -62626, -62641, -62655, -62670, -62685, -62699,  /* 5752-5759: 252.77° - 253.08° */
-     -62714, -62729, -62743, -62758, -62772, -62787, -62801, -62815,  /* 5760-5767: 253.12° - 253.43° */
-     -62830, -62844, -62858, -62872, -62886, -62901, -62915, -62929,  /* 5768-5775: 253.48° - 253.78° */
-     -62943, -62957, -62971, -62985, -62998, -63012, -63026, -63040,  /* 5776-5783: 253.83° - 254.14° */
-     -63054, -63067, -63081, -63095, -63108, -63122, -63135, -63149,  /* 5784-5791: 254.18° - 254.49° */
-     -63162, -63175, -63189, -63202, -63215, -63229, -63242, -63255,  /* 5792-5799: 254.53° - 254.84° */
-     -63268, -63281, -63294, -63307, -63320, -63333, -63346, -63359,  /* 5800-5807: 254.88° - 255.19° */
-     -63372, -63385, -63397, -63410, -63423, -63435, -63448, -63461,  /* 5808-5815: 255.23° - 255.54° */
-     -63473, -63486, -63498, -63510, -63523, -63535, -63547, -63560,  /* 5816-5823: 255.59° - 255.89° */
-     -63572, -63584, -63596, -63608, -63621, -63633, -63645, -63657,  /* 5824-5831: 255.94° - 256.25° */
-     -63668, -63680, -63692, -63704, -63716, -63728, -63739, -63751,  /* 5832-5839: 256.29° - 256.60° */
-     -63763, -63774, -63786, -63797, -63809, -63820, -63832, -63843,  /* 5840-5847: 256.64° - 256.95° */
-     -63854, -63866, -63877, -63888, -63899, -63910, -63922, -63933,  /* 5848-5855: 256.99° - 257.30° */
-     -63944, -63955, -63966, -63976, -63987, -63998, -64009, -64020,  /* 5856-5863: 257.34° - 257.65° */
-     -64031, -64041, -64052, -64062, -64073, -64084, -64094, -64105,  /* 5864-5871: 257.70° - 258.00° */
-     -64115, -64125, -64136, -64146, -64156, -64167, -64177, -64187,  /* 5872-5879: 258.05° - 258.35° */
-     -64197, -64207, -64217, -64227, -64237, -64247, -64257, -64267,  /* 5880-5887: 258.40° - 258.71° */
-     -64277, -64287, -64296, -64306, -64316, -64325, -64335, -64344,  /* 5888-5895: 258.75° - 259.06° */
-     -64354, -64363, -64373, -64382, -64392, -64401, -64410, -64420,  /* 5896-5903: 259.10° - 259.41° */
-     -64429, -64438, -64447, -64456, -64465, -64474, -64483, -64492,  /* 5904-5911: 259.45° - 259.76° */
-     -64501, -64510, -64519, -64528, -64536, -64545, -64554, -64563,  /* 5912-5919: 259.80° - 260.11° */
-     -64571, -64580, -64588, -64597, -64605, -64614, -64622, -64630,  /* 5920-5927: 260.16° - 260.46° */
-     -64639, -64647, -64655, -64663, -64672, -64680, -64688, -64696,  /* 5928-5935: 260.51° - 260.82° */
-     -64704, -64712, -64720, -64728, -64735, -64743, -64751, -64759,  /* 5936-5943: 260.86° - 261.17° */
-     -64766, -64774, -64782, -64789, -64797, -64804, -64812, -64819,  /* 5944-5951: 261.21° - 261.52° */
-     -64827, -64834, -64841, -64849, -64856, -64863, -64870, -64877,  /* 5952-5959: 261.56° - 261.87° */
-     -64884, -64892, -64899, -64905, -64912, -64919, -64926, -64933,  /* 5960-5967: 261.91° - 262.22° */
-     -64940, -64947, -64953, -64960, -64967, -64973, -64980, -64986,  /* 5968-5975: 262.27° - 262.57° */
-     -64993, -64999, -65006, -65012, -65018, -65025, -65031, -65037,  /* 5976-5983: 262.62° - 262.92° */
-     -65043, -65049, -65055, -65061, -65067, -65073, -65079, -65085,  /* 5984-5991: 262.97° - 263.28° */
-     -65091, -65097, -65103, -65109, -65114, -65120, -65126, -65131,  /* 5992-5999: 263.32° - 263.63° */
-     -65137, -65142, -65148, -65153, -65159, -65164, -65169, -65175,  /* 6000-6007: 263.67° - 263.98° */
-     -65180, -65185, -65190, -65195, -65200, -65205, -65210, -65215,  /* 6008-6015: 264.02° - 264.33° */
-     -65220, -65225, -65230, -65235, -65240, -65245, -65249, -65254,  /* 6016-6023: 264.38° - 264.68° */
-     -65259, -65263, -65268, -65272, -65277, -65281, -65286, -65290,  /* 6024-6031: 264.73° - 265.03° */
-     -65294, -65299, -65303, -65307, -65311, -65315, -65320, -65324,  /* 6032-6039: 265.08° - 265.39° */
-     -65328, -65332, -65336, -65339, -65343, -65347, -65351, -65355,  /* 6040-6047: 265.43° - 265.74° */
-     -65358, -65362, -65366, -65369, -65373, -65376, -65380, -65383,  /* 6048-6055: 265.78° - 266.09° */
-     -65387, -65390, -65393, -65397, -65400, -65403, -65406, -65410,  /* 6056-6063: 266.13° - 266.44° */
-     -65413, -65416, -65419, -65422, -65425, -65428, -65430, -65433,  /* 6064-6071: 266.48° - 266.79° */
-     -65436, -65439, -65442, -65444, -65447, -65449, -65452, -65455,  /* 6072-6079: 266.84° - 267.14° */
-     -65457, -65460, -65462, -65464, -65467, -65469, -65471, -65473,  /* 6080-6087: 267.19° - 267.50° */
-     -65476, -65478, -65480, -65482, -65484, -65486, -65488, -65490,  /* 6088-6095: 267.54° - 267.85° */
-     -65492, -65493, -65495, -65497, -65499, -65500, -65502, -65504,  /* 6096-6103: 267.89° - 268.20° */
-     -65505, -65507, -65508, -65510, -65511, -65512, -65514, -65515,  /* 6104-6111: 268.24° - 268.55° */
-     -65516, -65517, -65519, -65520, -65521, -65522, -65523, -65524,  /* 6112-6119: 268.59° - 268.90° */
-     -65525, -65526, -65527, -65527, -65528, -65529, -65530, -65530,  /* 6120-6127: 268.95° - 269.25° */
-     -65531, -65532, -65532, -65533, -65533, -65534, -65534, -65534,  /* 6128-6135: 269.30° - 269.60° */
-     -65535, -65535, -65535, -65536, -65536, -65536, -65536, -65536,  /* 6136-6143: 269.65° - 269.96° */
-     -65536, -65536, -65536, -65536, -65536, -65536, -65535, -65535,  /* 6144-6151: 270.00° - 270.31° */
-     -65535, -65534, -65534, -65534, -65533, -65533, -65532, -65532,  /* 6152-6159: 270.35° - 270.66° */
-     -65531, -65530, -65530, -65529, -65528, -65527, -65527, -65526,  /* 6160-6167: 270.70° - 271.01° */
-     -65525, -65524, -65523, -65522, -65521, -65520, -65519, -65517,  /* 6168-6175: 271.05° - 271.36° */
-     -65516, -65515, -65514, -65512, -65511, -65510, -65508, -65507,  /* 6176-6183: 271.41° - 271.71° */
-     -65505, -65504, -65502, -65500, -65499, -65497, -65495, -65493,  /* 6184-6191: 271.76° - 272.07° */
-     -65492, -65490, -65488, -65486, -65484, -65482, -65480, -65478,  /* 6192-6199: 272.11° - 272.42° */
-     -65476, -65473, -65471, -65469, -65467, -65464, -65462, -65460,  /* 6200-6207: 272.46° - 272.77° */
-     -65457, -65455, -65452, -65449, -65447, -65444, -65442, -65439,  /* 6208-6215: 272.81° - 273.12° */
-     -65436, -65433, -65430, -65428, -65425, -65422, -65419, -65416,  /* 6216-6223: 273.16° - 273.47° */
-     -65413, -65410, -65406, -65403, -65400, -65397, -65393, -65390,  /* 6224-6231: 273.52° - 273.82° */
-     -65387, -65383, -65380, -65376, -65373, -65369, -65366, -65362,  /* 6232-6239: 273.87° - 274.17° */
-     -65358, -65355, -65351, -65347, -65343, -65339, -65336, -65332,  /* 6240-6247: 274.22° - 274.53° */
-     -65328, -65324, -65320, -65315, -65311, -65307, -65303, -65299,  /* 6248-6255: 274.57° - 274.88° */
-     -65294, -65290, -65286, -65281, -65277, -65272, -65268, -65263,  /* 6256-6263: 274.92° - 275.23° */
-     -65259, -65254, -65249, -65245, -65240, -65235, -65230, -65225,  /* 6264-6271: 275.27° - 275.58° */
-     -65220, -65215, -65210, -65205, -65200, -65195, -65190, -65185,  /* 6272-6279: 275.62° - 275.93° */
-     -65180, -65175, -65169, -65164, -65159, -65153, -65148, -65142,  /* 6280-6287: 275.98° - 276.28° */
-     -65137, -65131, -65126, -65120, -65114, -65109, -65103, -65097,  /* 6288-6295: 276.33° - 276.64° */
-     -65091, -65085, -65079, -65073, -65067, -65061, -65055, -65049,  /* 6296-6303: 276.68° - 276.99° */
-     -65043, -65037, -65031, -65025, -65018, -65012, -65006, -64999,  /* 6304-6311: 277.03° - 277.34° */
-     -64993, -64986, -64980, -64973, -64967, -64960, -64953, -64947,  /* 6312-6319: 277.38° - 277.69° */
-     -64940, -64933, -64926, -64919, -64912, -64905, -64899, -64892,  /* 6320-6327: 277.73° - 278.04° */
-     -64884, -64877, -64870, -64863, -64856, -64849, -64841, -64834,  /* 6328-6335: 278.09° - 278.39° */
-     -64827, -64819, -64812, -64804, -64797, -64789, -64782, -64774,  /* 6336-6343: 278.44° - 278.75° */
-     -64766, -64759, -64751, -64743, -64735, -64728, -64720, -64712,  /* 6344-6351: 278.79° - 279.10° */
-     -64704, -64696, -64688, -64680, -64672, -64663, -64655, -64647,  /* 6352-6359: 279.14° - 279.45° */
-     -64639, -64630, -64622, -64614, -64605, -64597, -64588, -64580,  /* 6360-6367: 279.49° - 279.80° */
-     -64571, -64563, -64554, -64545, -64536, -64528, -64519, -64510,  /* 6368-6375: 279.84° - 280.15° */
-     -64501, -64492, -64483, -64474, -64465, -64456, -64447, -64438,  /* 6376-6383: 280.20° - 280.50° */
-     -64429, -64420, -64410, -64401, -64392, -64382, -64373, -64363,  /* 6384-6391: 280.55° - 280.85° */
-     -64354, -64344, -64335, -64325, -64316, -64306, -64296, -64287,  /* 6392-6399: 280.90° - 281.21° */
-     -64277, -64267, -64257, -64247, -64237, -64227, -64217, -64207,  /* 6400-6407: 281.25° - 281.56° */
-     -64197, -64187, -64177, -64167, -64156, -64146, -64136, -64125,  /* 6408-6415: 281.60° - 281.91° */
-     -64115, -64105, -64094, -64084, -64073, -64062, -64052, -64041,  /* 6416-6423: 281.95° - 282.26° */
-     -64031, -64020, -64009, -63998, -63987, -63976, -63966, -63955,  /* 6424-6431: 282.30° - 282.61° */
-     -63944, -63933, -63922, -63910, -63899, -63888, -63877, -63866,  /* 6432-6439: 282.66° - 282.96° */
-     -63854, -63843, -63832, -63820, -63809, -63797, -63786, -63774,  /* 6440-6447: 283.01° - 283.32° */
-     -63763, -63751, -63739, -63728, -63716, -63704, -63692, -63680,  /* 6448-6455: 283.36° - 283.67° */
-     -63668, -63657, -63645, -63633, -63621, -63608, -63596, -63584,  /* 6456-6463: 283.71° - 284.02° */
-     -63572, -63560, -63547, -63535, -63523, -63510, -63498, -63486,  /* 6464-6471: 284.06° - 284.37° */
-     -63473, -63461, -63448, -63435, -63423, -63410, -63397, -63385,  /* 6472-6479: 284.41° - 284.72° */
-     -63372, -63359, -63346, -63333, -63320, -63307, -63294, -63281,  /* 6480-6487: 284.77° - 285.07° */
-     -63268, -63255, -63242, -63229, -63215, -63202, -63189, -63175,  /* 6488-6495: 285.12° - 285.42° */
-     -63162, -63149, -63135, -63122, -63108, -63095, -63081, -63067,  /* 6496-6503: 285.47° - 285.78° */
-     -63054, -63040, -63026, -63012, -62998, -62985, -62971, -62957,  /* 6504-6511: 285.82° - 286.13° */
-     -62943, -62929, -62915, -62901, -62886, -62872, -62858, -62844,  /* 6512-6519: 286.17° - 286.48° */
-     -62830, -62815, -62801, -62787, -62772, -62758, -62743, -62729,  /* 6520-6527: 286.52° - 286.83° */
-     -62714, -62699, -62685, -62670, -62655, -62641, -62626, -62611,  /* 6528-6535: 286.88° - 287.18° */
-     -62596, -62581, -62566, -62551, -62536, -62521, -62506, -62491,  /* 6536-6543: 287.23° - 287.53° */
-     -62476, -62461, -62445, -62430, -62415, -62400, -62384, -62369,  /* 6544-6551: 287.58° - 287.89° */
-     -62353, -62338, -62322, -62307, -62291, -62275, -62260, -62244,  /* 6552-6559: 287.93° - 288.24° */
-     -62228, -62212, -62197, -62181, -62165, -62149, -62133, -62117,  /* 6560-6567: 288.28° - 288.59° */
-     -62101, -62085, -62069, -62053, -62036, -62020, -62004, -61988,  /* 6568-6575: 288.63° - 288.94° */
-     -61971, -61955, -61939, -61922, -61906, -61889, -61873, -61856,  /* 6576-6583: 288.98° - 289.29° */
-     -61839, -61823, -61806, -61789, -61772, -61756, -61739, -61722,  /* 6584-6591: 289.34° - 289.64° */
-     -61705, -61688, -61671, -61654, -61637, -61620, -61603, -61586,  /* 6592-6599: 289.69° - 290.00° */
-     -61568, -61551, -61534, -61517, -61499, -61482, -61464, -61447,  /* 6600-6607: 290.04° - 290.35° */
-     -61429, -61412, -61394, -61377, -61359, -61341, -61324, -61306,  /* 6608-6615: 290.39° - 290.70° */
-     -61288, -61270, -61253, -61235, -61217, -61199, -61181, -61163,  /* 6616-6623: 290.74° - 291.05° */
-     -61145, -61127, -61108, -61090, -61072, -61054, -61035, -61017,  /* 6624-6631: 291.09° - 291.40° */
-     -60999, -60980, -60962, -60943, -60925, -60906, -60888, -60869,  /* 6632-6639: 291.45° - 291.75° */
-     -60851, -60832, -60813, -60794, -60776, -60757, -60738, -60719,  /* 6640-6647: 291.80° - 292.10° */
-     -60700, -60681, -60662, -60643, -60624, -60605, -60586, -60567,  /* 6648-6655: 292.15° - 292.46° */
-     -60547, -60528, -60509, -60490, -60470, -60451, -60431, -60412,  /* 6656-6663: 292.50° - 292.81° */
-     -60392, -60373, -60353, -60334, -60314, -60294, -60275, -60255,  /* 6664-6671: 292.85° - 293.16° */
-     -60235, -60215, -60195, -60175, -60156, -60136, -60116, -60096,  /* 6672-6679: 293.20° - 293.51° */
-     -60075, -60055, -60035, -60015, -59995, -59975, -59954, -59934,  /* 6680-6687: 293.55° - 293.86° */
-     -59914, -59893, -59873, -59852, -59832, -59811, -59791, -59770,  /* 6688-6695: 293.91° - 294.21° */
-     -59750, -59729, -59708, -59687, -59667, -59646, -59625, -59604,  /* 6696-6703: 294.26° - 294.57° */
-     -59583, -59562, -59541, -59520, -59499, -59478, -59457, -59436,  /* 6704-6711: 294.61° - 294.92° */
-     -59415, -59393, -59372, -59351, -59330, -59308, -59287, -59265,  /* 6712-6719: 294.96° - 295.27° */
-     -59244, -59222, -59201, -59179, -59158, -59136, -59114, -59093,  /* 6720-6727: 295.31° - 295.62° */
-     -59071, -59049, -59027, -59005, -58983, -58962, -58940, -58918,  /* 6728-6735: 295.66° - 295.97° */
-     -58896, -58873, -58851, -58829, -58807, -58785, -58763, -58740,  /* 6736-6743: 296.02° - 296.32° */
-     -58718, -58696, -58673, -58651, -58628, -58606, -58583, -58561,  /* 6744-6751: 296.37° - 296.67° */
-     -58538, -58516, -58493, -58470, -58448, -58425, -58402, -58379,  /* 6752-6759: 296.72° - 297.03° */
-     -58356, -58334, -58311, -58288, -58265, -58242, -58219, -58195,  /* 6760-6767: 297.07° - 297.38° */
-     -58172, -58149, -58126, -58103, -58079, -58056, -58033, -58009,  /* 6768-6775: 297.42° - 297.73° */
-     -57986, -57963, -57939, -57916, -57892, -57869, -57845, -57821,  /* 6776-6783: 297.77° - 298.08° */
-     -57798, -57774, -57750, -57726, -57703, -57679, -57655, -57631,  /* 6784-6791: 298.12° - 298.43° */
-     -57607, -57583, -57559, -57535, -57511, -57487, -57463, -57438,  /* 6792-6799: 298.48° - 298.78° */
-     -57414, -57390, -57366, -57341, -57317, -57293, -57268, -57244,  /* 6800-6807: 298.83° - 299.14° */
-     -57219, -57195, -57170, -57145, -57121, -57096, -57072, -57047,  /* 6808-6815: 299.18° - 299.49° */
-     -57022, -56997, -56972, -56948, -56923, -56898, -56873, -56848,  /* 6816-6823: 299.53° - 299.84° */
-     -56823, -56798, -56773, -56747, -56722, -56697, -56672, -56647,  /* 6824-6831: 299.88° - 300.19° */
-     -56621, -56596, -56571, -56545, -56520, -56494, -56469, -56443,  /* 6832-6839: 300.23° - 300.54° */
-     -56418, -56392, -56367, -56341, -56315, -56289, -56264, -56238,  /* 6840-6847: 300.59° - 300.89° */
-     -56212, -56186, -56160, -56134, -56108, -56082, -56056, -56030,  /* 6848-6855: 300.94° - 301.25° */
-     -56004, -55978, -55952, -55926, -55900, -55873, -55847, -55821,  /* 6856-6863: 301.29° - 301.60° */
-     -55794, -55768, -55742, -55715, -55689, -55662, -55636, -55609,  /* 6864-6871: 301.64° - 301.95° */
-     -55582, -55556, -55529, -55502, -55476, -55449, -55422, -55395,  /* 6872-6879: 301.99° - 302.30° */
-     -55368, -55341, -55314, -55288, -55260, -55233, -55206, -55179,  /* 6880-6887: 302.34° - 302.65° */
-     -55152, -55125, -55098, -55071, -55043, -55016, -54989, -54961,  /* 6888-6895: 302.70° - 303.00° */
-     -54934, -54906, -54879, -54852, -54824, -54796, -54769, -54741,  /* 6896-6903: 303.05° - 303.35° */
-     -54714, -54686, -54658, -54630, -54603, -54575, -54547, -54519,  /* 6904-6911: 303.40° - 303.71° */
-     -54491, -54463, -54435, -54407, -54379, -54351, -54323, -54295,  /* 6912-6919: 303.75° - 304.06° */
-     -54267, -54239, -54210, -54182, -54154, -54125, -54097, -54069,  /* 6920-6927: 304.10° - 304.41° */
-     -54040, -54012, -53983, -53955, -53926, -53898, -53869, -53840,  /* 6928-6935: 304.45° - 304.76° */
-     -53812, -53783, -53754, -53726, -53697, -53668, -53639, -53610,  /* 6936-6943: 304.80° - 305.11° */
-     -53581, -53552, -53523, -53494, -53465, -53436, -53407, -53378,  /* 6944-6951: 305.16° - 305.46° */
-     -53349, -53319, -53290, -53261, -53232, -53202, -53173, -53144,  /* 6952-6959: 305.51° - 305.82° */
-     -53114, -53085, -53055, -53026, -52996, -52967, -52937, -52907,  /* 6960-6967: 305.86° - 306.17° */
-     -52878, -52848, -52818, -52788, -52759, -52729, -52699, -52669,  /* 6968-6975: 306.21° - 306.52° */
-     -52639, -52609, -52579, -52549, -52519, -52489, -52459, -52429,  /* 6976-6983: 306.56° - 306.87° */
-     -52398, -52368, -52338, -52308, -52277, -52247, -52217, -52186,  /* 6984-6991: 306.91° - 307.22° */
-     -52156, -52126, -52095, -52065, -52034, -52003, -51973, -51942,  /* 6992-6999: 307.27° - 307.57° */
-     -51911, -51881, -51850, -51819, -51789, -51758, -51727, -51696,  /* 7000-7007: 307.62° - 307.92° */
-     -51665, -51634, -51603, -51572, -51541, -51510, -51479, -51448,  /* 7008-7015: 307.97° - 308.28° */
-     -51417, -51386, -51354, -51323, -51292, -51260, -51229, -51198,  /* 7016-7023: 308.32° - 308.63° */
-     -51166, -51135, -51104, -51072, -51041, -51009, -50977, -50946,  /* 7024-7031: 308.67° - 308.98° */
-     -50914, -50882, -50851, -50819, -50787, -50756, -50724, -50692,  /* 7032-7039: 309.02° - 309.33° */
-     -50660, -50628, -50596, -50564, -50532, -50500, -50468, -50436,  /* 7040-7047: 309.38° - 309.68° */
-     -50404, -50372, -50340, -50307, -50275, -50243, -50211, -50178,  /* 7048-7055: 309.73° - 310.03° */
-     -50146, -50114, -50081, -50049, -50016, -49984, -49951, -49919,  /* 7056-7063: 310.08° - 310.39° */
-     -49886, -49854, -49821, -49788, -49756, -49723, -49690, -49657,  /* 7064-7071: 310.43° - 310.74° */
-     -49624, -49592, -49559, -49526, -49493, -49460, -49427, -49394,  /* 7072-7079: 310.78° - 311.09° */
-     -49361, -49328, -49295, -49262, -49228, -49195, -49162, -49129,  /* 7080-7087: 311.13° - 311.44° */
-     -49095, -49062, -49029, -48995, -48962, -48929, -48895, -48862,  /* 7088-7095: 311.48° - 311.79° */
-     -48828, -48795, -48761, -48727, -48694, -48660, -48626, -48593,  /* 7096-7103: 311.84° - 312.14° */
-     -48559, -48525, -48491, -48458, -48424, -48390, -48356, -48322,  /* 7104-7111: 312.19° - 312.50° */
-     -48288, -48254, -48220, -48186, -48152, -48118, -48084, -48049,  /* 7112-7119: 312.54° - 312.85° */
-     -48015, -47981, -47947, -47912, -47878, -47844, -47809, -47775,  /* 7120-7127: 312.89° - 313.20° */
-     -47741, -47706, -47672, -47637, -47603, -47568, -47534, -47499,  /* 7128-7135: 313.24° - 313.55° */
-     -47464, -47430, -47395, -47360, -47325, -47291, -47256, -47221,  /* 7136-7143: 313.59° - 313.90° */
-     -47186, -47151, -47116, -47081, -47046, -47011, -46976, -46941,  /* 7144-7151: 313.95° - 314.25° */
-     -46906, -46871, -46836, -46801, -46765, -46730, -46695, -46660,  /* 7152-7159: 314.30° - 314.60° */
-     -46624, -46589, -46554, -46518, -46483, -46447, -46412, -46376,  /* 7160-7167: 314.65° - 314.96° */
-     -46341, -46305, -46270, -46234, -46199, -46163, -46127, -46091,  /* 7168-7175: 315.00° - 315.31° */
-     -46056, -46020, -45984, -45948, -45912, -45877, -45841, -45805,  /* 7176-7183: 315.35° - 315.66° */
-     -45769, -45733, -45697, -45661, -45625, -45589, -45552, -45516,  /* 7184-7191: 315.70° - 316.01° */
-     -45480, -45444, -45408, -45371, -45335, -45299, -45262, -45226,  /* 7192-7199: 316.05° - 316.36° */
-     -45190, -45153, -45117, -45080, -45044, -45007, -44971, -44934,  /* 7200-7207: 316.41° - 316.71° */
-     -44898, -44861, -44824, -44788, -44751, -44714, -44677, -44641,  /* 7208-7215: 316.76° - 317.07° */
-     -44604, -44567, -44530, -44493, -44456, -44419, -44382, -44345,  /* 7216-7223: 317.11° - 317.42° */
-     -44308, -44271, -44234, -44197, -44160, -44123, -44086, -44049,  /* 7224-7231: 317.46° - 317.77° */
-     -44011, -43974, -43937, -43899, -43862, -43825, -43787, -43750,  /* 7232-7239: 317.81° - 318.12° */
-     -43713, -43675, -43638, -43600, -43562, -43525, -43487, -43450,  /* 7240-7247: 318.16° - 318.47° */
-     -43412, -43374, -43337, -43299, -43261, -43223, -43186, -43148,  /* 7248-7255: 318.52° - 318.82° */
-     -43110, -43072, -43034, -42996, -42958, -42920, -42882, -42844,  /* 7256-7263: 318.87° - 319.17° */
-     -42806, -42768, -42730, -42692, -42654, -42616, -42578, -42539,  /* 7264-7271: 319.22° - 319.53° */
-     -42501, -42463, -42424, -42386, -42348, -42309, -42271, -42233,  /* 7272-7279: 319.57° - 319.88° */
-     -42194, -42156, -42117, -42079, -42040, -42002, -41963, -41924,  /* 7280-7287: 319.92° - 320.23° */
-     -41886, -41847, -41808, -41770, -41731, -41692, -41653, -41614,  /* 7288-7295: 320.27° - 320.58° */
-     -41576, -41537, -41498, -41459, -41420, -41381, -41342, -41303,  /* 7296-7303: 320.62° - 320.93° */
-     -41264, -41225, -41186, -41147, -41108, -41068, -41029, -40990,  /* 7304-7311: 320.98° - 321.28° */
-     -40951, -40912, -40872, -40833, -40794, -40754, -40715, -40675,  /* 7312-7319: 321.33° - 321.64° */
-     -40636, -40597, -40557, -40518, -40478, -40439, -40399, -40359,  /* 7320-7327: 321.68° - 321.99° */
-     -40320, -40280, -40241, -40201, -40161, -40121, -40082, -40042,  /* 7328-7335: 322.03° - 322.34° */
-     -40002, -39962, -39922, -39882, -39843, -39803, -39763, -39723,  /* 7336-7343: 322.38° - 322.69° */
-     -39683, -39643, -39603, -39563, -39523, -39482, -39442, -39402,  /* 7344-7351: 322.73° - 323.04° */
-     -39362, -39322, -39282, -39241, -39201, -39161, -39120, -39080,  /* 7352-7359: 323.09° - 323.39° */
-     -39040, -38999, -38959, -38919, -38878, -38838, -38797, -38757,  /* 7360-7367: 323.44° - 323.75° */
-     -38716, -38675, -38635, -38594, -38554, -38513, -38472, -38432,  /* 7368-7375: 323.79° - 324.10° */
-     -38391, -38350, -38309, -38269, -38228, -38187, -38146, -38105,  /* 7376-7383: 324.14° - 324.45° */
-     -38064, -38023, -37982, -37941, -37900, -37859, -37818, -37777,  /* 7384-7391: 324.49° - 324.80° */
-     -37736, -37695, -37654, -37613, -37572, -37530, -37489, -37448,  /* 7392-7399: 324.84° - 325.15° */
-     -37407, -37365, -37324, -37283, -37241, -37200, -37159, -37117,  /* 7400-7407: 325.20° - 325.50° */
-     -37076, -37034, -36993, -36951, -36910, -36868, -36827, -36785,  /* 7408-7415: 325.55° - 325.85° */
-     -36744, -36702, -36660, -36619, -36577, -36535, -36493, -36452,  /* 7416-7423: 325.90° - 326.21° */
-     -36410, -36368, -36326, -36284, -36243, -36201, -36159, -36117,  /* 7424-7431: 326.25° - 326.56° */
-     -36075, -36033, -35991, -35949, -35907, -35865, -35823, -35781,  /* 7432-7439: 326.60° - 326.91° */
-     -35738, -35696, -35654, -35612, -35570, -35527, -35485, -35443,  /* 7440-7447: 326.95° - 327.26° */
-     -35401, -35358, -35316, -35274, -35231, -35189, -35146, -35104,  /* 7448-7455: 327.30° - 327.61° */
-     -35062, -35019, -34977, -34934, -34892, -34849, -34806, -34764,  /* 7456-7463: 327.66° - 327.96° */
-     -34721, -34679, -34636, -34593, -34551, -34508, -34465, -34422,  /* 7464-7471: 328.01° - 328.32° */
-     -34380, -34337, -34294, -34251, -34208, -34165, -34122, -34079,  /* 7472-7479: 328.36° - 328.67° */
-     -34037, -33994, -33951, -33908, -33865, -33821, -33778, -33735,  /* 7480-7487: 328.71° - 329.02° */
-     -33692, -33649, -33606, -33563, -33520, -33476, -33433, -33390,  /* 7488-7495: 329.06° - 329.37° */
-     -33347, -33303, -33260, -33217, -33173, -33130, -33087, -33043,  /* 7496-7503: 329.41° - 329.72° */
-     -33000, -32956, -32913, -32870, -32826, -32783, -32739, -32695,  /* 7504-7511: 329.77° - 330.07° */
-     -32652, -32608, -32565, -32521, -32477, -32434, -32390, -32346,  /* 7512-7519: 330.12° - 330.42° */
-     -32303, -32259, -32215, -32171, -32127, -32084, -32040, -31996,  /* 7520-7527: 330.47° - 330.78° */
-     -31952, -31908, -31864, -31820, -31776, -31732, -31688, -31644,  /* 7528-7535: 330.82° - 331.13° */
-     -31600, -31556, -31512, -31468, -31424, -31380, -31336, -31292,  /* 7536-7543: 331.17° - 331.48° */
-     -31248, -31203, -31159, -31115, -31071, -31026, -30982, -30938,  /* 7544-7551: 331.52° - 331.83° */
-     -30893, -30849, -30805, -30760, -30716, -30672, -30627, -30583,  /* 7552-7559: 331.88° - 332.18° */
-     -30538, -30494, -30449, -30405, -30360, -30316, -30271, -30226,  /* 7560-7567: 332.23° - 332.53° */
-     -30182, -30137, -30093, -30048, -30003, -29959, -29914, -29869,  /* 7568-7575: 332.58° - 332.89° */
-     -29824, -29780, -29735, -29690, -29645, -29600, -29555, -29511,  /* 7576-7583: 332.93° - 333.24° */
-     -29466, -29421, -29376, -29331, -29286, -29241, -29196, -29151,  /* 7584-7591: 333.28° - 333.59° */
-     -29106, -29061, -29016, -28971, -28926, -28881, -28835, -28790,  /* 7592-7599: 333.63° - 333.94° */
-     -28745, -28700, -28655, -28610, -28564, -28519, -28474, -28429,  /* 7600-7607: 333.98° - 334.29° */
-     -28383, -28338, -28293, -28247, -28202, -28156, -28111, -28066,  /* 7608-7615: 334.34° - 334.64° */
-     -28020, -27975, -27929, -27884, -27838, -27793, -27747, -27702,  /* 7616-7623: 334.69° - 335.00° */
-     -27656, -27611, -27565, -27519, -27474, -27428, -27382, -27337,  /* 7624-7631: 335.04° - 335.35° */
-     -27291, -27245, -27200, -27154, -27108, -27062, -27017, -26971,  /* 7632-7639: 335.39° - 335.70° */
-     -26925, -26879, -26833, -26787, -26742, -26696, -26650, -26604,  /* 7640-7647: 335.74° - 336.05° */
-     -26558, -26512, -26466, -26420, -26374, -26328, -26282, -26236,  /* 7648-7655: 336.09° - 336.40° */
-     -26190, -26144, -26098, -26051, -26005, -25959, -25913, -25867,  /* 7656-7663: 336.45° - 336.75° */
-     -25821, -25774, -25728, -25682, -25636, -25589, -25543, -25497,  /* 7664-7671: 336.80° - 337.10° */
-     -25451, -25404, -25358, -25312, -25265, -25219, -25172, -25126,  /* 7672-7679: 337.15° - 337.46° */
-     -25080, -25033, -24987, -24940, -24894, -24847, -24801, -24754,  /* 7680-7687: 337.50° - 337.81° */
-     -24708, -24661, -24614, -24568, -24521, -24475, -24428, -24381,  /* 7688-7695: 337.85° - 338.16° */
-     -24335, -24288, -24241, -24195, -24148, -24101, -24054, -24008,  /* 7696-7703: 338.20° - 338.51° */
-     -23961, -23914, -23867, -23820, -23774, -23727, -23680, -23633,  /* 7704-7711: 338.55° - 338.86° */
-     -23586, -23539, -23492, -23445, -23398, -23351, -23304, -23257,  /* 7712-7719: 338.91° - 339.21° */
-     -23210, -23163, -23116, -23069, -23022, -22975, -22928, -22881,  /* 7720-7727: 339.26° - 339.57° */
-     -22834, -22787, -22740, -22693, -22645, -22598, -22551, -22504,  /* 7728-7735: 339.61° - 339.92° */
-     -22457, -22409, -22362, -22315, -22268, -22220, -22173, -22126,  /* 7736-7743: 339.96° - 340.27° */
-     -22078, -22031, -21984, -21936, -21889, -21842, -21794, -21747,  /* 7744-7751: 340.31° - 340.62° */
-     -21699, -21652, -21604, -21557, -21510, -21462, -21415, -21367,  /* 7752-7759: 340.66° - 340.97° */
-     -21320, -21272, -21224, -21177, -21129, -21082, -21034, -20987,  /* 7760-7767: 341.02° - 341.32° */
-     -20939, -20891, -20844, -20796, -20748, -20701, -20653, -20605,  /* 7768-7775: 341.37° - 341.67° */
-     -20557, -20510, -20462, -20414, -20366, -20319, -20271, -20223,  /* 7776-7783: 341.72° - 342.03° */
-     -20175, -20127, -20080, -20032, -19984, -19936, -19888, -19840,  /* 7784-7791: 342.07° - 342.38° */
-     -19792, -19744, -19696, -19648, -19600, -19553, -19505, -19457,  /* 7792-7799: 342.42° - 342.73° */
-     -19409, -19361, -19313, -19264, -19216, -19168, -19120, -19072,  /* 7800-7807: 342.77° - 343.08° */
-     -19024, -18976, -18928, -18880, -18832, -18783, -18735, -18687,  /* 7808-7815: 343.12° - 343.43° */
-     -18639, -18591, -18543, -18494, -18446, -18398, -18350, -18301,  /* 7816-7823: 343.48° - 343.78° */
-     -18253, -18205, -18156, -18108, -18060, -18012, -17963, -17915,  /* 7824-7831: 343.83° - 344.14° */
-     -17867, -17818, -17770, -17721, -17673, -17625, -17576, -17528,  /* 7832-7839: 344.18° - 344.49° */
-     -17479, -17431, -17382, -17334, -17285, -17237, -17188, -17140,  /* 7840-7847: 344.53° - 344.84° */
-     -17091, -17043, -16994, -16946, -16897, -16849, -16800, -16751,  /* 7848-7855: 344.88° - 345.19° */
-     -16703, -16654, -16606, -16557, -16508, -16460, -16411, -16362,  /* 7856-7863: 345.23° - 345.54° */
-     -16314, -16265, -16216, -16168, -16119, -16070, -16021, -15973,  /* 7864-7871: 345.59° - 345.89° */
-     -15924, -15875, -15826, -15778, -15729, -15680, -15631, -15582,  /* 7872-7879: 345.94° - 346.25° */
-     -15534, -15485, -15436, -15387, -15338, -15289, -15240, -15192,  /* 7880-7887: 346.29° - 346.60° */
-     -15143, -15094, -15045, -14996, -14947, -14898, -14849, -14800,  /* 7888-7895: 346.64° - 346.95° */
-     -14751, -14702, -14653, -14604, -14555, -14506, -14457, -14408,  /* 7896-7903: 346.99° - 347.30° */
-     -14359, -14310, -14261, -14212, -14163, -14114, -14065, -14016,  /* 7904-7911: 347.34° - 347.65° */
-     -13966, -13917, -13868, -13819, -13770, -13721, -13672, -13622,  /* 7912-7919: 347.70° - 348.00° */
-     -13573, -13524, -13475, -13426, -13376, -13327, -13278, -13229,  /* 7920-7927: 348.05° - 348.35° */
-     -13180, -13130, -13081, -13032, -12983, -12933, -12884, -12835,  /* 7928-7935: 348.40° - 348.71° */
-     -12785, -12736, -12687, -12638, -12588, -12539, -12490, -12440,  /* 7936-7943: 348.75° - 349.06° */
-     -12391, -12341, -12292, -12243, -12193, -12144, -12095, -12045,  /* 7944-7951: 349.10° - 349.41° */
-     -11996, -11946, -11897, -11847, -11798, -11749, -11699, -11650,  /* 7952-7959: 349.45° - 349.76° */
-     -11600, -11551, -11501, -11452, -11402, -11353, -11303, -11254,  /* 7960-7967: 349.80° - 350.11° */
-     -11204, -11155, -11105, -11056, -11006, -10956, -10907, -10857,  /* 7968-7975: 350.16° - 350.46° */
-     -10808, -10758, -10709, -10659, -10609, -10560, -10510, -10461,  /* 7976-7983: 350.51° - 350.82° */
-     -10411, -10361, -10312, -10262, -10212, -10163, -10113, -10063,  /* 7984-7991: 350.86° - 351.17° */
-     -10014,  -9964,  -9914,  -9865,  -9815,  -9765,  -9716,  -9666,  /* 7992-7999: 351.21° - 351.52° */
-      -9616,  -9566,  -9517,  -9467,  -9417,  -9367,  -9318,  -9268,  /* 8000-8007: 351.56° - 351.87° */
-      -9218,  -9168,  -9119,  -9069,  -9019,  -8969,  -8919,  -8870,  /* 8008-8015: 351.91° - 352.22° */
-      -8820,  -8770,  -8720,  -8670,  -8621,  -8571,  -8521,  -8471,  /* 8016-8023: 352.27° - 352.57° */
-      -8421,  -8371,  -8322,  -8272,  -8222,  -8172,  -8122,  -8072,  /* 8024-8031: 352.62° - 352.92° */
-      -8022,  -7972,  -7923,  -7873,  -7823,  -7773,  -7723,  -7673,  /* 8032-8039: 352.97° - 353.28° */
-      -7623,  -7573,  -7523,  -7473,  -7423,  -7373,  -7323,  -7273,  /* 8040-8047: 353.32° - 353.63° */
-      -7224,  -7174,  -7124,  -7074,  -7024,  -6974,  -6924,  -6874,  /* 8048-8055: 353.67° - 353.98° */
-      -6824,  -6774,  -6724,  -6674,  -6624,  -6574,  -6524,  -6474,  /* 8056-8063: 354.02° - 354.33° */
-      -6424,  -6374,  -6324,  -6274,  -6224,  -6173,  -6123,  -6073,  /* 8064-8071: 354.38° - 354.68° */
-      -6023,  -5973,  -5923,  -5873,  -5823,  -5773,  -5723,  -5673,  /* 8072-8079: 354.73° - 355.03° */
-      -5623,  -5573,  -5523,  -5473,  -5422,  -5372,  -5322,  -5272,  /* 8080-8087: 355.08° - 355.39° */
-      -5222,  -5172,  -5122,  -5072,  -5022,  -4972,  -4921,  -4871,  /* 8088-8095: 355.43° - 355.74° */
-      -4821,  -4771,  -4721,  -4671,  -4621,  -4570,  -4520,  -4470,  /* 8096-8103: 355.78° - 356.09° */
-      -4420,  -4370,  -4320,  -4270,  -4219,  -4169,  -4119,  -4069,  /* 8104-8111: 356.13° - 356.44° */
-      -4019,  -3969,  -3918,  -3868,  -3818,  -3768,  -3718,  -3667,  /* 8112-8119: 356.48° - 356.79° */
-      -3617,  -3567,  -3517,  -3467,  -3417,  -3366,  -3316,  -3266,  /* 8120-8127: 356.84° - 357.14° */
-      -3216,  -3165,  -3115,  -3065,  -3015,  -2965,  -2914,  -2864,  /* 8128-8135: 357.19° - 357.50° */
-      -2814,  -2764,  -2714,  -2663,  -2613,  -2563,  -2513,  -2462,  /* 8136-8143: 357.54° - 357.85° */
-      -2412,  -2362,  -2312,  -2261,  -2211,  -2161,  -2111,  -2061,  /* 8144-8151: 357.89° - 358.20° */
-      -2010,  -1960,  -1910,  -1860,  -1809,  -1759,  -1709,  -1659,  /* 8152-8159: 358.24° - 358.55° */
-      -1608,  -1558,  -1508,  -1458,  -1407,  -1357,  -1307,  -1257,  /* 8160-8167: 358.59° - 358.90° */
-      -1206,  -1156,  -1106,  -1056,  -1005,   -955,   -905,   -854,  /* 8168-8175: 358.95° - 359.25° */
-       -804,   -754,   -704,   -653,   -603,   -553,   -503,   -452,  /* 8176-8183: 359.30° - 359.60° */
-       -402,   -352,   -302,   -251,   -201,   -151,   -101,    -50  /* 8184-8191: 359.65° - 359.96° */
+      65536  /* 2048: 90.00° */
 };
 
-/* Cosine via pointer offset (cos(x) = sin(x + 90°)) */
-const fixed_t* const finecosine = &finesine[NUM_FINE_ANGLES / 4];
-
 #endif /* TRIG_TABLES_DATA_H */
@@ -0,0 +1,128 @@
+/**
+ * barrier_field.h - Field-Level Barrier Potential Kernels
+ *
+ * Evaluates the bounded barrier potential and gradient of barriers.h over
+ * a whole contiguous field in one pass, instead of one call per cell:
+ *
+ *   U(x)     = kappa / (x - x_min + eps) + kappa / (x_max - x + eps)
+ *   dU/dx(x) = -kappa / (x - x_min + eps)^2 + kappa / (x_max - x + eps)^2
+ *
+ * Two paths:
+ *   - float:  parameters per call (kappa, eps, violation value); used by
+ *             the Richards-Lite implicit column solve
+ *   - Q16.16: BARRIER_STRENGTH / BARRIER_EPS, bit-identical to
+ *             fixed_barrier_gradient_bounded() / fixed_barrier_potential_bounded()
+ *             including the sticky overflow bits they raise
+ *
+ * Implementation (src/core/math/barrier_field.c) selects at compile time:
+ *   - AVX2:          8 float / 4 double lanes
+ *   - SSE2+:         4 float / 2 double lanes
+ *   - WASM SIMD128:  4 float / 2 double lanes
+ *   - Other targets: scalar loop (ESP32 Xtensa)
+ *
+ * The Q16.16 path runs in double lanes: every intermediate is an integer
+ * below 2^53 (or already past the clamp), so truncating the IEEE quotient
+ * gives the same value as the 64-bit integer division in barriers.h.
+ *
+ * Author: negentropic-core team
+ * Version: 0.4.0-alpha-genesis
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef INCLUDE_BARRIER_FIELD_H
+#define INCLUDE_BARRIER_FIELD_H
+
+#include "barriers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * FLOAT PATH
+ * ======================================================================== */
+
+/**
+ * Float barrier parameters.
+ *
+ * At or past a bound (x - x_min + eps <= 0) the side contributes
+ * -violation to the gradient (lower) or +violation (upper), and
+ * +violation to the potential.
+ */
+typedef struct {
+    float kappa;        /* Barrier strength coefficient */
+    float eps;          /* Singularity offset */
+    float violation;    /* Magnitude returned for a violated bound */
+} BarrierFieldParamsF;
+
+/**
+ * Scalar reference: bounded barrier gradient for one value.
+ * The field kernel computes exactly this expression per lane.
+ */
+static inline float barrier_gradient_bounded_f(float x, float x_min, float x_max,
+                                               const BarrierFieldParamsF* p) {
+    float dx_lo = x - x_min + p->eps;
+    float dx_hi = x_max - x + p->eps;
+    float g_lo = (dx_lo <= 0.0f) ? -p->violation : -p->kappa * (1.0f / (dx_lo * dx_lo));
+    float g_hi = (dx_hi <= 0.0f) ? p->violation : p->kappa * (1.0f / (dx_hi * dx_hi));
+    return g_lo + g_hi;
+}
+
+/**
+ * Scalar reference: bounded barrier potential for one value.
+ */
+static inline float barrier_potential_bounded_f(float x, float x_min, float x_max,
+                                                const BarrierFieldParamsF* p) {
+    float dx_lo = x - x_min + p->eps;
+    float dx_hi = x_max - x + p->eps;
+    float u_lo = (dx_lo <= 0.0f) ? p->violation : p->kappa / dx_lo;
+    float u_hi = (dx_hi <= 0.0f) ? p->violation : p->kappa / dx_hi;
+    return u_lo + u_hi;
+}
+
+/**
+ * Bounded barrier potential and gradient over a float field.
+ *
+ * @param x      Field values [n]
+ * @param x_min  Lower bounds [n]
+ * @param x_max  Upper bounds [n]
+ * @param n      Number of cells
+ * @param params Barrier parameters
+ * @param value  Output potentials [n], or NULL to skip
+ * @param grad   Output gradients [n], or NULL to skip
+ */
+void barrier_field_bounded_f(const float* x, const float* x_min, const float* x_max,
+                             int n, const BarrierFieldParamsF* params,
+                             float* value, float* grad);
+
+/* ========================================================================
+ * Q16.16 PATH
+ * ======================================================================== */
+
+/**
+ * Bounded barrier potential and gradient over a Q16.16 field.
+ *
+ * Element i equals fixed_barrier_potential_bounded(x[i], x_min[i], x_max[i])
+ * and fixed_barrier_gradient_bounded(...); saturation raises the same
+ * FIXED_STICKY_* bits (once per call rather than once per cell).
+ *
+ * @param x      Field values [n] (Q16.16)
+ * @param x_min  Lower bounds [n] (Q16.16)
+ * @param x_max  Upper bounds [n] (Q16.16)
+ * @param n      Number of cells
+ * @param value  Output potentials [n] (Q16.16), or NULL to skip
+ * @param grad   Output gradients [n] (Q16.16), or NULL to skip
+ */
+void barrier_field_bounded_fixed(const fixed_t* x, const fixed_t* x_min, const fixed_t* x_max,
+                                 int n, fixed_t* value, fixed_t* grad);
+
+/**
+ * Float lanes per SIMD instruction on this build (8, 4 or 1).
+ */
+int barrier_field_lanes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCLUDE_BARRIER_FIELD_H */
@@ -32,6 +32,9 @@
 
 #include <stdint.h>
 
+/* Saturating primitives; g_fixed_sticky lives in the core library */
+#include "fixed_saturate.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -84,49 +87,52 @@ typedef int32_t fixed_t;
  * HELPER MACROS FOR FIXED-POINT ARITHMETIC
  * ======================================================================== */
 
+/*
+ * All helpers saturate instead of wrapping and raise the per-thread
+ * sticky bits (FIXED_STICKY_*), which state_step() merges into the
+ * simulation's NegErrorFlags. Near a bound (dx ~ BARRIER_EPS) the
+ * squared inverse exceeds Q16.16 range, so the gradient clamps to
+ * +/-INT32_MAX and reports overflow rather than flipping sign.
+ */
+
 /**
  * Fixed-point multiplication: (a * b) >> 16
- * Uses 64-bit intermediate to prevent overflow
+ * Uses 64-bit intermediate, saturates on overflow
  */
 static inline fixed_t barrier_fixed_mul(fixed_t a, fixed_t b) {
-    return (fixed_t)(((int64_t)a * (int64_t)b) >> FIXED_SHIFT);
+    return fixed_mul_sat(a, b);
 }
 
 /**
  * Fixed-point division: (a << 16) / b
- * Uses 64-bit intermediate to prevent overflow
- * Returns 0 if b is 0 (safe division)
+ * Uses 64-bit intermediate, saturates on overflow
+ * Returns 0 if b is 0 (safe division) and raises FIXED_STICKY_DIV_ZERO
  */
 static inline fixed_t barrier_fixed_div(fixed_t a, fixed_t b) {
-    if (b == 0) return 0;
-    return (fixed_t)((((int64_t)a) << FIXED_SHIFT) / b);
+    int32_t keep = -(int32_t)(b != 0);
+    return fixed_div_sat(a, b) & keep;
 }
 
 /**
  * Fixed-point subtraction with saturation
  */
 static inline fixed_t barrier_fixed_sub(fixed_t a, fixed_t b) {
-    int64_t result = (int64_t)a - (int64_t)b;
-    if (result > INT32_MAX) return INT32_MAX;
-    if (result < INT32_MIN) return INT32_MIN;
-    return (fixed_t)result;
+    return fixed_sub_sat(a, b);
 }
 
 /**
  * Fixed-point addition with saturation
  */
 static inline fixed_t barrier_fixed_add(fixed_t a, fixed_t b) {
-    int64_t result = (int64_t)a + (int64_t)b;
-    if (result > INT32_MAX) return INT32_MAX;
-    if (result < INT32_MIN) return INT32_MIN;
-    return (fixed_t)result;
+    return fixed_add_sat(a, b);
 }
 
 /**
- * Absolute value of fixed-point number
+ * Absolute value of fixed-point number (|INT32_MIN| saturates)
  */
 static inline fixed_t barrier_fixed_abs(fixed_t x) {
-    return (x < 0) ? -x : x;
+    int64_t m = x >> 31;
+    return fixed_clamp64(((int64_t)x ^ m) - m, &g_fixed_sticky);
 }
 
 /* ========================================================================
@@ -165,6 +171,42 @@ static inline fixed_t fixed_barrier_potential(fixed_t x, fixed_t x_min) {
     return U;
 }
 
+/**
+ * Compute barrier potential value for upper bound constraint.
+ *
+ * U_barrier(x) = kappa / (x_max - x + epsilon)
+ *
+ * @param x      Current state value (Q16.16)
+ * @param x_max  Upper bound constraint (Q16.16)
+ * @return       Barrier energy contribution (Q16.16), always >= 0
+ */
+static inline fixed_t fixed_barrier_potential_upper(fixed_t x, fixed_t x_max) {
+    /* dx = x_max - x + epsilon */
+    fixed_t dx = barrier_fixed_sub(x_max, x);
+    dx = barrier_fixed_add(dx, BARRIER_EPS);
+
+    /* Violation check */
+    if (dx <= 0) {
+        return (fixed_t)0x7FFFFFFF;
+    }
+
+    return barrier_fixed_div((fixed_t)BARRIER_STRENGTH, dx);
+}
+
+/**
+ * Combined barrier potential for both lower and upper bounds.
+ *
+ * @param x      Current state value (Q16.16)
+ * @param x_min  Lower bound constraint (Q16.16)
+ * @param x_max  Upper bound constraint (Q16.16)
+ * @return       Combined barrier energy (Q16.16), saturated
+ */
+static inline fixed_t fixed_barrier_potential_bounded(fixed_t x, fixed_t x_min, fixed_t x_max) {
+    fixed_t U_lower = fixed_barrier_potential(x, x_min);
+    fixed_t U_upper = fixed_barrier_potential_upper(x, x_max);
+    return barrier_fixed_add(U_lower, U_upper);
+}
+
 /**
  * Compute barrier gradient (force contribution to state derivative).
  *
@@ -250,6 +292,8 @@ static inline fixed_t fixed_barrier_gradient_upper(fixed_t x, fixed_t x_max) {
  * @param x_min  Lower bound constraint (Q16.16)
  * @param x_max  Upper bound constraint (Q16.16)
  * @return       Combined barrier gradient (Q16.16)
+ *
+ * Whole fields: barrier_field_bounded_fixed() in barrier_field.h.
  */
 static inline fixed_t fixed_barrier_gradient_bounded(fixed_t x, fixed_t x_min, fixed_t x_max) {
     fixed_t grad_lower = fixed_barrier_gradient(x, x_min);
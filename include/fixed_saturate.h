@@ -0,0 +1,128 @@
+/**
+ * fixed_saturate.h - Saturating Q16.16 Arithmetic with Sticky Overflow
+ *
+ * Branch-free clamped add/sub/mul/div for Q16.16 values. Overflow is
+ * not an error return: it ORs a bit into a per-thread accumulator that
+ * the simulation step merges into NegErrorFlags.
+ *
+ * Operates on int32_t (== fixed_t) and defines no FRACUNIT/conversion
+ * macros, so it can be included next to either fixed_math.h or
+ * embedded/se3_edge.h. g_fixed_sticky is defined in fixed_math.c, part
+ * of the core library every user of this header already links.
+ *
+ * Author: ClaudeCode (saturating fixed-point)
+ * Version: 1.0
+ */
+
+#ifndef NEG_FIXED_SATURATE_H
+#define NEG_FIXED_SATURATE_H
+
+#include <stdint.h>
+
+/* Same spelling as platform.h, which lives under src/ */
+#ifndef NEG_THREAD_LOCAL
+#if defined(__GNUC__) || defined(__clang__)
+    #define NEG_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+    #define NEG_THREAD_LOCAL __declspec(thread)
+#else
+    #define NEG_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * SATURATING ARITHMETIC WITH STICKY OVERFLOW
+ * ======================================================================== */
+
+/*
+ * FIXED_MUL / FIXED_DIV wrap silently when the Q16.16 result leaves
+ * [-32768, 32767]. The *_sat variants clamp instead and OR a sticky bit
+ * into g_fixed_sticky, a per-thread accumulator. Clamp and flag are
+ * computed with masks, not branches, so the cost is a few ALU ops.
+ *
+ * state_step() takes the accumulator and folds it into the simulation's
+ * NegErrorFlags (overflow, inf_detected), so long fixed-point runs
+ * report saturation without a validation pass over every field.
+ *
+ * Hot loops can accumulate into a local with fixed_clamp64() and
+ * publish once via fixed_sticky_raise(); this avoids a TLS access per
+ * operation in shared-library builds.
+ */
+
+#define FIXED_STICKY_OVERFLOW 0x1u  // A result was clamped to INT32_MIN/MAX
+#define FIXED_STICKY_DIV_ZERO 0x2u  // Division by zero (result saturated)
+
+/** Sticky saturation bits raised on this thread (FIXED_STICKY_*) */
+extern NEG_THREAD_LOCAL uint32_t g_fixed_sticky;
+
+/**
+ * Clamp a 64-bit intermediate to int32_t, branch-free.
+ *
+ * @param r Wide result
+ * @param sticky Accumulator; FIXED_STICKY_OVERFLOW is OR-ed in if r was clamped
+ * @return r saturated to [INT32_MIN, INT32_MAX]
+ */
+static inline int32_t fixed_clamp64(int64_t r, uint32_t* sticky) {
+    uint32_t ovf = (uint32_t)(r != (int64_t)(int32_t)r);
+    int32_t mask = -(int32_t)ovf;
+    int32_t limit = (int32_t)((r >> 63) ^ INT32_MAX);  // INT32_MIN if r < 0
+    *sticky |= ovf;  // == FIXED_STICKY_OVERFLOW
+    return ((int32_t)r & ~mask) | (limit & mask);
+}
+
+/** Saturating add: a + b, clamped */
+static inline int32_t fixed_add_sat(int32_t a, int32_t b) {
+    return fixed_clamp64((int64_t)a + b, &g_fixed_sticky);
+}
+
+/** Saturating subtract: a - b, clamped */
+static inline int32_t fixed_sub_sat(int32_t a, int32_t b) {
+    return fixed_clamp64((int64_t)a - b, &g_fixed_sticky);
+}
+
+/** Saturating multiply: (a * b) >> 16, clamped (FIXED_MUL otherwise) */
+static inline int32_t fixed_mul_sat(int32_t a, int32_t b) {
+    return fixed_clamp64(((int64_t)a * b) >> 16, &g_fixed_sticky);
+}
+
+/**
+ * Saturating divide: (a << 16) / b, clamped.
+ *
+ * Bit-identical to fixed_div_safe(), including b == 0 (INT32_MAX for
+ * a >= 0, INT32_MIN otherwise), which also raises FIXED_STICKY_DIV_ZERO.
+ * The divisor is forced to 1 rather than branched around.
+ */
+static inline int32_t fixed_div_sat(int32_t a, int32_t b) {
+    uint32_t zero = (uint32_t)(b == 0);
+    int64_t mask = -(int64_t)zero;
+    int64_t q = (((int64_t)a) << 16) / (b | (int32_t)zero);
+    int64_t limit = (int64_t)((a >> 31) ^ INT32_MAX);
+    g_fixed_sticky |= zero << 1;  // == FIXED_STICKY_DIV_ZERO
+    return fixed_clamp64((q & ~mask) | (limit & mask), &g_fixed_sticky);
+}
+
+/** Publish bits accumulated in a local (see fixed_clamp64) */
+static inline void fixed_sticky_raise(uint32_t bits) {
+    g_fixed_sticky |= bits;
+}
+
+/**
+ * Read and clear this thread's sticky bits.
+ *
+ * @return FIXED_STICKY_* bits raised since the last call
+ */
+static inline uint32_t fixed_sticky_take(void) {
+    uint32_t bits = g_fixed_sticky;
+    g_fixed_sticky = 0;
+    return bits;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_FIXED_SATURATE_H */
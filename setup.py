@@ -0,0 +1,47 @@
+"""
+setup.py - Native extension build for negentropic-core
+
+Project metadata lives in pyproject.toml; this file only adds the
+negentropic_core._native CPython extension (src/api/negentropic_python.c)
+compiled together with the core C sources, which are read from
+CORE_SOURCES in CMakeLists.txt so the two builds cannot drift apart.
+
+    pip install .                  # or: python setup.py build_ext --inplace
+
+Author: negentropic-core team
+Version: 0.1.0
+License: MIT OR GPL-3.0
+"""
+
+import re
+import sys
+from pathlib import Path
+
+from setuptools import Extension, setup
+
+ROOT = Path(__file__).resolve().parent
+
+
+def core_sources():
+    """CORE_SOURCES from CMakeLists.txt, relative to the repo root."""
+    cmake = (ROOT / "CMakeLists.txt").read_text()
+    block = re.search(r"set\(CORE_SOURCES\s+(.*?)\)", cmake, re.S)
+    if not block:
+        raise RuntimeError("CORE_SOURCES not found in CMakeLists.txt")
+    return block.group(1).split()
+
+
+compile_args = [] if sys.platform == "win32" else ["-std=c11", "-O2"]
+libraries = [] if sys.platform == "win32" else ["m"]
+if sys.platform.startswith("linux"):
+    libraries.append("rt")  # shm_open (src/core/state_shm.c) on older glibc
+
+native = Extension(
+    "negentropic_core._native",
+    sources=["src/api/negentropic_python.c"] + core_sources(),
+    include_dirs=[".", "src/core/include"],
+    extra_compile_args=compile_args,
+    libraries=libraries,
+)
+
+setup(ext_modules=[native])
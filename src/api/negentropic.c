@@ -10,6 +10,13 @@
 
 #include "negentropic.h"
 #include "../core/state.h"
+#include "../core/include/trace.h"
+#include "../core/include/mem_stats.h"
+#include "../core/include/openmetrics.h"
+#include "../core/include/step_async.h"
+#include "../core/include/event_log.h"
+#include "../core/include/replay.h"
+#include "../core/include/rollback.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -25,6 +32,17 @@ static void set_error(const char* msg) {
     last_error[sizeof(last_error) - 1] = '\0';
 }
 
+/*
+ * Calls that touch the live state wait for neg_step_async() jobs first;
+ * returns the context (NULL if the simulation never stepped async) so
+ * callers that change the state can republish it.
+ */
+static NegStepAsync* async_drain(void* sim) {
+    NegStepAsync* async = state_get_async(sim);
+    if (async) step_async_wait(async, 0);
+    return async;
+}
+
 /* ========================================================================
  * VERSION INFORMATION
  * ======================================================================== */
@@ -55,6 +73,7 @@ static bool parse_config_json(const char* json, SimulationConfig* cfg) {
     cfg->enable_atmosphere = 1;
     cfg->enable_hydrology = 0;
     cfg->enable_soil = 1;
+    neg_pool_config_default(&cfg->pool);  /* Serial unless "threads" is given */
 
     /* Very basic parsing - look for key values */
     const char* p;
@@ -83,6 +102,17 @@ static bool parse_config_json(const char* json, SimulationConfig* cfg) {
     if ((p = strstr(json, "\"integrator_type\":"))) {
         sscanf(p + 18, "%hhu", &cfg->integrator_type);
     }
+    if ((p = strstr(json, "\"threads\":"))) {
+        sscanf(p + 10, "%u", &cfg->pool.threads);
+    }
+    if ((p = strstr(json, "\"tile_size\":"))) {
+        sscanf(p + 12, "%u", &cfg->pool.tile_size);
+    }
+    if ((p = strstr(json, "\"pin_cpus\":"))) {
+        p += 11;
+        while (*p == ' ') p++;
+        cfg->pool.pin_cpus = (*p == 't' || *p == '1');
+    }
 
     return true;
 }
@@ -113,6 +143,15 @@ void* neg_create(const char* config_json) {
 }
 
 void neg_destroy(void* sim) {
+    if (!sim) return;
+
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        state_set_async(sim, NULL);
+        step_async_destroy(async);
+    }
+    neg_event_log_close(state_get_event_log(sim));
+    neg_rollback_destroy(state_get_rollback(sim));
     state_destroy(sim);
 }
 
@@ -126,7 +165,45 @@ int neg_step(void* sim, float dt) {
         return NEG_ERROR_NULL_HANDLE;
     }
 
-    if (!state_step(sim, dt)) {
+    NegStepAsync* async = async_drain(sim);
+    NegEventLog* events = state_get_event_log(sim);
+    NegRollback* rollback = state_get_rollback(sim);
+    bool ok = state_step(sim, dt);
+    if (events) neg_event_log_record_step(events, sim, dt, ok);
+    if (rollback) neg_rollback_capture(rollback, sim);
+    step_async_republish(async);
+
+    if (!ok) {
+        set_error("Numerical instability detected");
+        return NEG_ERROR_NUMERICAL_INSTABILITY;
+    }
+
+    return NEG_SUCCESS;
+}
+
+int neg_step_n(void* sim, float dt, int n) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (n < 0) {
+        set_error("Negative step count");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    NegStepAsync* async = async_drain(sim);
+    NegEventLog* events = state_get_event_log(sim);
+    NegRollback* rollback = state_get_rollback(sim);
+    bool ok = true;
+    for (int i = 0; i < n && ok; i++) {
+        ok = state_step(sim, dt);
+        if (events) neg_event_log_record_step(events, sim, dt, ok);
+        if (rollback) neg_rollback_capture(rollback, sim);
+    }
+    step_async_republish(async);
+
+    if (!ok) {
         set_error("Numerical instability detected");
         return NEG_ERROR_NUMERICAL_INSTABILITY;
     }
@@ -145,14 +222,395 @@ int neg_reset_from_binary(void* sim, const uint8_t* buffer, size_t len) {
         return NEG_ERROR_INVALID_STATE;
     }
 
+    NegStepAsync* async = async_drain(sim);
+    NegRollback* rollback = state_get_rollback(sim);
     if (!state_reset_from_binary(sim, buffer, len)) {
+        /* A rejected buffer may have been partly copied in already */
+        neg_rollback_discard(rollback, sim, NULL);
         set_error("Failed to reset from binary state");
         return NEG_ERROR_INVALID_STATE;
     }
+    neg_rollback_capture(rollback, sim);
+    step_async_republish(async);
+
+    NegEventLog* events = state_get_event_log(sim);
+    if (events) {
+        uint8_t digest[NEG_EVENT_HASH_BYTES];
+        if (neg_event_state_digest(sim, digest) == NEG_EVENT_OK) {
+            neg_event_log_record(events, sim, NEG_EVENT_RESET, digest, sizeof(digest));
+        }
+        if (neg_event_log_keyframe_interval(events)) neg_event_log_record_keyframe(events, sim);
+    }
+
+    return NEG_SUCCESS;
+}
+
+/* ========================================================================
+ * EVENT LOG
+ * ======================================================================== */
+
+int neg_open_event_log(void* sim, const char* path, uint32_t digest_interval,
+                       uint32_t keyframe_interval) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (!path) {
+        set_error("NULL event log path");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    async_drain(sim);
+    int status;
+    NegEventLog* log = neg_event_log_open(path, state_get_pool_config(sim), &status);
+    if (!log) {
+        switch (status) {
+            case NEG_EVENT_NO_MEMORY:
+                set_error("Out of memory opening event log");
+                return NEG_ERROR_OUT_OF_MEMORY;
+            case NEG_EVENT_IO_ERROR:
+                set_error("Failed to open event log");
+                return NEG_ERROR_INVALID_CONFIG;
+            default:
+                set_error("Event log failed verification");
+                return NEG_ERROR_INVALID_STATE;
+        }
+    }
+    neg_event_log_set_digest_interval(log, digest_interval);
+    neg_event_log_set_keyframe_interval(log, keyframe_interval);
+
+    /* Seeks to the steps before the first interval start from here */
+    if (keyframe_interval && neg_event_log_record_keyframe(log, sim) != NEG_EVENT_OK) {
+        neg_event_log_close(log);
+        set_error("Failed to write keyframe");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    neg_event_log_close(state_get_event_log(sim));
+    state_set_event_log(sim, log);
+    return NEG_SUCCESS;
+}
+
+int neg_log_event(void* sim, uint32_t type, const void* payload, uint32_t len) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (type != NEG_EVENT_INTERVENTION && type != NEG_EVENT_PARAMETER && type < NEG_EVENT_HOST) {
+        set_error("Event type reserved for the simulation");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    if ((len && !payload) || len > NEG_EVENT_MAX_PAYLOAD) {
+        set_error("Invalid event payload");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    async_drain(sim);
+    NegEventLog* events = state_get_event_log(sim);
+    if (!events) {
+        set_error("No event log open");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    int rc = neg_event_log_record(events, sim, type, payload, len);
+    if (rc == NEG_EVENT_NO_MEMORY) {
+        set_error("Out of memory appending event");
+        return NEG_ERROR_OUT_OF_MEMORY;
+    }
+    if (rc != NEG_EVENT_OK) {
+        set_error("Failed to write event log");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    return NEG_SUCCESS;
+}
+
+int neg_close_event_log(void* sim) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    async_drain(sim);
+    NegEventLog* events = state_get_event_log(sim);
+    state_set_event_log(sim, NULL);
+    int rc = neg_event_log_flush(events);
+    neg_event_log_close(events);
+    if (events && rc != NEG_EVENT_OK) {
+        set_error("Failed to flush event log");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    return NEG_SUCCESS;
+}
+
+int64_t neg_verify_event_log(const char* path, int threads) {
+    if (!path) {
+        set_error("NULL event log path");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    NegPoolConfig pool;
+    neg_pool_config_default(&pool);
+    pool.threads = threads < 0 ? 1u : (uint32_t)threads;
+
+    NegEventVerify v;
+    int status = neg_event_log_verify_file(path, &pool, &v);
+    switch (status) {
+        case NEG_EVENT_OK:
+            return (int64_t)v.records;
+        case NEG_EVENT_IO_ERROR:
+            set_error("Failed to read event log");
+            return NEG_ERROR_INVALID_CONFIG;
+        case NEG_EVENT_NO_MEMORY:
+            set_error("Out of memory verifying event log");
+            return NEG_ERROR_OUT_OF_MEMORY;
+        default: {
+            char msg[96];
+            snprintf(msg, sizeof(msg), "Event log %s at record %lld",
+                     status == NEG_EVENT_TRUNCATED ? "truncated" : "chain broken",
+                     (long long)v.first_bad);
+            set_error(msg);
+            return NEG_ERROR_INVALID_STATE;
+        }
+    }
+}
+
+/* ========================================================================
+ * ASYNCHRONOUS STEPPING
+ * ======================================================================== */
+
+static int async_status_code(int status) {
+    switch (status) {
+        case NEG_ASYNC_DONE:
+            return 1;
+        case NEG_ASYNC_PENDING:
+            return 0;
+        case NEG_ASYNC_FAILED:
+            set_error("Numerical instability detected");
+            return NEG_ERROR_NUMERICAL_INSTABILITY;
+        default:
+            set_error("Unknown async ticket");
+            return NEG_ERROR_INVALID_STATE;
+    }
+}
+
+int64_t neg_step_async(void* sim, float dt, int n) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (n < 0) {
+        set_error("Negative step count");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    NegStepAsync* async = state_get_async(sim);
+    if (!async) {
+        async = step_async_create(sim);
+        if (!async) {
+            set_error("Failed to start async stepping");
+            return NEG_ERROR_OUT_OF_MEMORY;
+        }
+        state_set_async(sim, async);
+    }
+
+    int64_t ticket = step_async_submit(async, dt, (uint32_t)n);
+    if (ticket < 0) {
+        set_error("Async step queue full");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    return ticket;
+}
+
+int neg_poll(void* sim, int64_t ticket) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    NegStepAsync* async = state_get_async(sim);
+    if (!async) return async_status_code(ticket == 0 ? NEG_ASYNC_DONE : NEG_ASYNC_BAD_TICKET);
+    return async_status_code(step_async_poll(async, ticket));
+}
+
+int neg_wait(void* sim, int64_t ticket) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    NegStepAsync* async = state_get_async(sim);
+    int status = async ? step_async_wait(async, ticket)
+                       : (ticket == 0 ? NEG_ASYNC_DONE : NEG_ASYNC_BAD_TICKET);
+    int rc = async_status_code(status);
+    return rc < 0 ? rc : NEG_SUCCESS;
+}
+
+/* ========================================================================
+ * REPLAY AND SEEK
+ * ======================================================================== */
+
+NegReplay* neg_open_replay(const char* path, int threads) {
+    if (!path) {
+        set_error("NULL event log path");
+        return NULL;
+    }
+
+    NegPoolConfig pool;
+    neg_pool_config_default(&pool);
+    pool.threads = threads < 0 ? 1u : (uint32_t)threads;
+
+    int status;
+    NegReplay* replay = neg_replay_open_file(path, &pool, &status);
+    if (!replay) {
+        switch (status) {
+            case NEG_EVENT_IO_ERROR:
+                set_error("Failed to read event log");
+                break;
+            case NEG_EVENT_NO_MEMORY:
+                set_error("Out of memory indexing event log");
+                break;
+            default:
+                set_error("Event log failed verification");
+                break;
+        }
+    }
+    return replay;
+}
+
+int neg_seek(void* sim, NegReplay* replay, uint64_t step, NegReplayEventFn fn, void* ctx) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (!replay) {
+        set_error("NULL replay");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+
+    NegStepAsync* async = async_drain(sim);
+    if (state_get_event_log(sim)) {
+        /* Later records would be stamped with earlier steps than those written */
+        set_error("Close the event log before seeking");
+        return NEG_ERROR_INVALID_STATE;
+    }
 
+    NegRollback* rollback = state_get_rollback(sim);
+    NegReplaySeek seek;
+    int rc = neg_replay_seek(replay, sim, step, fn, ctx, &seek);
+    if (rc == NEG_EVENT_OK) {
+        neg_rollback_capture(rollback, sim);
+    } else {
+        neg_rollback_discard(rollback, sim, NULL);
+    }
+    step_async_republish(async);
+
+    char msg[96];
+    switch (rc) {
+        case NEG_EVENT_OK:
+            return NEG_SUCCESS;
+        case NEG_EVENT_NO_MEMORY:
+            set_error("Out of memory during seek");
+            return NEG_ERROR_OUT_OF_MEMORY;
+        case NEG_EVENT_IO_ERROR:
+            set_error("Failed to read event log");
+            return NEG_ERROR_INVALID_CONFIG;
+        case NEG_REPLAY_OUT_OF_RANGE:
+            set_error("Step beyond the end of the event log");
+            return NEG_ERROR_INVALID_CONFIG;
+        case NEG_REPLAY_NO_KEYFRAME:
+            set_error("No keyframe to seek from");
+            return NEG_ERROR_INVALID_STATE;
+        case NEG_REPLAY_DIVERGED:
+            snprintf(msg, sizeof(msg), "Replay diverged from the log at step %lld",
+                     (long long)seek.diverged_step);
+            set_error(msg);
+            return NEG_ERROR_INVALID_STATE;
+        default:
+            set_error("Keyframe does not match the simulation");
+            return NEG_ERROR_INVALID_STATE;
+    }
+}
+
+void neg_close_replay(NegReplay* replay) {
+    neg_replay_close(replay);
+}
+
+/* ========================================================================
+ * ROLLBACK
+ * ======================================================================== */
+
+int neg_enable_rollback(void* sim, uint32_t max_steps, size_t budget_bytes) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    NegStepAsync* async = async_drain(sim);
+    NegRollback* ring = NULL;
+    if (max_steps > 0) {
+        ring = neg_rollback_create(sim, max_steps, budget_bytes, state_get_pool_config(sim));
+        if (!ring) {
+            set_error("Out of memory for rollback history");
+            return NEG_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    neg_rollback_destroy(state_get_rollback(sim));
+    state_set_rollback(sim, ring);
+    step_async_republish(async);  /* Published rollback depth */
     return NEG_SUCCESS;
 }
 
+int neg_rollback(void* sim, uint32_t steps) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    NegStepAsync* async = async_drain(sim);
+    NegRollback* ring = state_get_rollback(sim);
+    if (!ring) {
+        set_error("Rollback not enabled");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    if (state_get_event_log(sim)) {
+        set_error("Close the event log before rolling back");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    if (neg_rollback_restore(ring, sim, steps, NULL) != NEG_ROLLBACK_OK) {
+        set_error("Not that many steps in the rollback history");
+        return NEG_ERROR_INVALID_CONFIG;
+    }
+    step_async_republish(async);
+
+    return NEG_SUCCESS;
+}
+
+int neg_get_rollback_depth(void* sim) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        NegAsyncFrame frame;
+        step_async_frame(async, &frame);
+        return (int)frame.rollback_depth;
+    }
+    return (int)neg_rollback_depth(state_get_rollback(sim));
+}
+
 /* ========================================================================
  * STATE RETRIEVAL
  * ======================================================================== */
@@ -174,7 +632,9 @@ int neg_get_state_binary(void* sim, uint8_t* buffer, size_t max_len) {
         return NEG_ERROR_BUFFER_TOO_SMALL;
     }
 
-    size_t written = state_to_binary(sim, buffer, max_len);
+    NegStepAsync* async = state_get_async(sim);
+    size_t written = async ? step_async_read(async, buffer, max_len, NULL)
+                           : state_to_binary(sim, buffer, max_len);
     if (written == 0) {
         set_error("Failed to serialize state");
         return NEG_ERROR_INVALID_STATE;
@@ -188,6 +648,43 @@ size_t neg_get_state_binary_size(void* sim) {
     return state_get_binary_size(sim);
 }
 
+int64_t neg_publish_state(void* sim, NegShmWriter* writer) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (!writer) {
+        set_error("NULL shared-memory writer");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    size_t capacity = neg_shm_writer_capacity(writer);
+    if (state_get_binary_size(sim) > capacity) {
+        set_error("State larger than shared-memory segment");
+        return NEG_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    NegStepAsync* async = state_get_async(sim);
+    uint8_t* slot = neg_shm_begin(writer);
+    uint64_t hash = 0;
+    size_t written = 0;
+    if (slot) {
+        written = async ? step_async_read(async, slot, capacity, &hash)
+                        : state_to_binary(sim, slot, capacity);
+    }
+    if (written == 0) {
+        neg_shm_commit(writer, SIZE_MAX, 0, 0);  /* Abandon the frame */
+        set_error("Failed to serialize state");
+        return NEG_ERROR_INVALID_STATE;
+    }
+    if (!async) hash = state_hash_binary(slot, written);
+
+    uint64_t frame = neg_shm_commit(writer, written, hash,
+                                    state_binary_timestamp_ms(slot, written));
+    return (int64_t)frame;
+}
+
 int neg_get_state_json(void* sim, char* buffer, size_t max_len) {
     if (!sim) {
         set_error("NULL simulation handle");
@@ -200,7 +697,16 @@ int neg_get_state_json(void* sim, char* buffer, size_t max_len) {
     }
 
     SimulationState state;
-    if (!state_get_view(sim, &state)) {
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        NegAsyncFrame frame;
+        step_async_frame(async, &frame);
+        state.timestamp = frame.timestamp;
+        state.version = 1;
+        state.num_entities = frame.num_entities;
+        state.num_scalar_values = frame.num_scalar_values;
+        state.state_hash = frame.hash;
+    } else if (!state_get_view(sim, &state)) {
         set_error("Failed to get state view");
         return NEG_ERROR_INVALID_STATE;
     }
@@ -230,9 +736,25 @@ int neg_get_state_json(void* sim, char* buffer, size_t max_len) {
 
 uint64_t neg_get_state_hash(void* sim) {
     if (!sim) return 0;
+
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        NegAsyncFrame frame;
+        step_async_frame(async, &frame);
+        return frame.hash;
+    }
     return state_hash(sim);
 }
 
+const float* neg_get_scalar_fields(void* sim, uint32_t* count) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NULL;
+    }
+    async_drain(sim);  /* Live values: the worker must be idle */
+    return state_scalar_fields(sim, count);
+}
+
 const char* neg_get_last_error(void) {
     return last_error[0] ? last_error : NULL;
 }
@@ -245,6 +767,12 @@ NegErrorFlags neg_get_error_flags(void* sim) {
         return flags;
     }
 
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        NegAsyncFrame frame;
+        step_async_frame(async, &frame);
+        return frame.error_flags;
+    }
     if (!state_get_error_flags(sim, &flags)) {
         neg_error_init(&flags);
     }
@@ -264,14 +792,22 @@ int neg_get_diagnostics(void* sim, char* buffer, size_t max_len) {
     }
 
     SimulationState state;
-    if (!state_get_view(sim, &state)) {
+    const NegPhaseTimers* timers = state_get_phase_timers(sim);
+    NegAsyncFrame frame;
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        step_async_frame(async, &frame);
+        state.energy = frame.energy;
+        state.max_error = frame.max_error;
+        state.timestamp = frame.timestamp;
+        timers = &frame.timers;
+    } else if (!state_get_view(sim, &state)) {
         set_error("Failed to get state view");
         return NEG_ERROR_INVALID_STATE;
     }
 
-    /* TODO: More detailed diagnostics */
     int written = snprintf(buffer, max_len,
-        "{\"energy\":%.6f,\"max_error\":%.9f,\"timestamp\":%llu}",
+        "{\"energy\":%.6f,\"max_error\":%.9f,\"timestamp\":%llu,\"timers\":",
         state.energy,
         state.max_error,
         (unsigned long long)state.timestamp
@@ -282,5 +818,94 @@ int neg_get_diagnostics(void* sim, char* buffer, size_t max_len) {
         return NEG_ERROR_BUFFER_TOO_SMALL;
     }
 
+    /* Per-phase timers: last step, rolling mean and max */
+    int timers_len = neg_phase_timers_json(timers, buffer + written, max_len - (size_t)written);
+    if (timers_len < 0 || (size_t)(written + timers_len) + 1 >= max_len) {
+        set_error("Buffer too small for diagnostics");
+        return NEG_ERROR_BUFFER_TOO_SMALL;
+    }
+    written += timers_len;
+    buffer[written++] = '}';
+    buffer[written] = '\0';
+
+    return written;
+}
+
+int neg_get_metrics_text(void* sim, char* buffer, size_t max_len) {
+    if (!sim) {
+        set_error("NULL simulation handle");
+        return NEG_ERROR_NULL_HANDLE;
+    }
+
+    if (!buffer || max_len == 0) {
+        set_error("Invalid buffer");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    NegErrorFlags flags;
+    const NegPhaseTimers* timers = state_get_phase_timers(sim);
+    NegAsyncFrame frame;
+    NegStepAsync* async = state_get_async(sim);
+    if (async) {
+        step_async_frame(async, &frame);
+        flags = frame.error_flags;
+        timers = &frame.timers;
+    } else if (!state_get_error_flags(sim, &flags)) {
+        set_error("Failed to read error flags");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    int written = neg_openmetrics_text(timers, &flags, buffer, max_len);
+    if (written < 0) {
+        set_error("Buffer too small for metrics");
+        return NEG_ERROR_BUFFER_TOO_SMALL;
+    }
+
     return written;
 }
+
+/* ========================================================================
+ * MEMORY
+ * ======================================================================== */
+
+int neg_get_memory_report(char* buffer, size_t max_len) {
+    if (!buffer || max_len == 0) {
+        set_error("Invalid buffer");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    int written = neg_mem_report_json(buffer, max_len);
+    if (written < 0) {
+        set_error("Buffer too small for memory report");
+        return NEG_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return written;
+}
+
+/* ========================================================================
+ * TRACING
+ * ======================================================================== */
+
+size_t neg_get_trace_json_size(void) {
+    return neg_trace_json_size();
+}
+
+int neg_get_trace_json(char* buffer, size_t max_len) {
+    if (!buffer || max_len == 0) {
+        set_error("Invalid buffer");
+        return NEG_ERROR_INVALID_STATE;
+    }
+
+    int written = neg_trace_json(buffer, max_len);
+    if (written < 0) {
+        set_error("Buffer too small for trace");
+        return NEG_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    return written;
+}
+
+void neg_clear_trace(void) {
+    neg_trace_clear();
+}
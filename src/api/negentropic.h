@@ -13,6 +13,8 @@
  *   3. Get state: neg_get_state_json() or neg_get_state_binary()
  *   4. Validate: neg_get_state_hash()
  *   5. Replay: neg_reset_from_binary() + neg_step() loop
+ *      (or neg_step_async() + neg_wait() to step in the background,
+ *      or neg_open_event_log() + neg_seek() to jump to any step)
  *   6. Destroy: neg_destroy(sim)
  *
  * Author: negentropic-core team
@@ -26,6 +28,8 @@
 #include <stdint.h>
 #include <stddef.h>
 #include "../core/include/neg_error.h"
+#include "../core/include/state_shm.h"
+#include "../core/include/replay.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,9 +69,16 @@ const char* neg_get_version(void);
  *   "integrator_type": 0,
  *   "enable_atmosphere": true,
  *   "enable_hydrology": false,
- *   "enable_soil": true
+ *   "enable_soil": true,
+ *   "threads": 4,
+ *   "tile_size": 64,
+ *   "pin_cpus": false
  * }
  *
+ * "threads" (default 1, 0: online CPUs), "tile_size" and "pin_cpus"
+ * configure this simulation's share of the process-wide worker pool
+ * (src/core/include/thread_pool.h); results do not depend on them.
+ *
  * @param config_json Null-terminated JSON string
  * @return Opaque simulation handle (NULL on error)
  */
@@ -76,6 +87,8 @@ void* neg_create(const char* config_json);
 /**
  * Destroy simulation and free all resources.
  *
+ * Waits for jobs queued with neg_step_async() first.
+ *
  * @param sim Opaque simulation handle (NULL is safe)
  */
 void neg_destroy(void* sim);
@@ -93,10 +106,26 @@ void neg_destroy(void* sim);
  */
 int neg_step(void* sim, float dt);
 
+/**
+ * Advance simulation by n timesteps in one call.
+ *
+ * Same result as n calls to neg_step(); bindings that drop their
+ * interpreter lock around the call (Python) pay for it once per batch.
+ * Stops at the first failing step, leaving the state after that step.
+ *
+ * @param sim Opaque simulation handle
+ * @param dt Timestep in seconds (use 0.0 for config default)
+ * @param n Number of steps (0 is a no-op)
+ * @return 0 on success, negative error code on failure
+ */
+int neg_step_n(void* sim, float dt, int n);
+
 /**
  * Reset simulation to a specific binary state (for deterministic replay).
  *
  * Use case: Load a checkpoint and re-run simulation from that point.
+ * With rollback enabled (neg_enable_rollback()), a rejected buffer
+ * leaves the state as it was; otherwise it may be partly loaded.
  *
  * @param sim Opaque simulation handle
  * @param buffer Binary state buffer (from neg_get_state_binary)
@@ -105,6 +134,185 @@ int neg_step(void* sim, float dt);
  */
 int neg_reset_from_binary(void* sim, const uint8_t* buffer, size_t len);
 
+/* ========================================================================
+ * ASYNCHRONOUS STEPPING
+ * ======================================================================== */
+
+/*
+ * The first neg_step_async() attaches a worker thread to the simulation
+ * and from then on the state is double-buffered: the worker steps the
+ * live state and, after each job, swaps a serialized copy in as the
+ * published state. While jobs run:
+ *
+ *   - neg_get_state_binary(), neg_get_state_hash(), neg_get_state_json()
+ *     and neg_publish_state() return the published state (as of the last
+ *     completed job) and are safe from any thread;
+ *   - neg_get_diagnostics(), neg_get_metrics_text(), neg_get_error_flags()
+ *     and neg_get_rollback_depth() report the timers, flags and history
+ *     published with that state, also without waiting;
+ *   - every other call that takes sim first waits for the queued jobs,
+ *     and must come from the thread that submits them.
+ *
+ * Results are bit-identical to stepping synchronously (same hashes).
+ */
+
+/**
+ * Queue n timesteps on the simulation's worker and return at once.
+ *
+ * Jobs run in submission order. A failing step ends its job (like
+ * neg_step_n()) and fails the jobs queued behind it.
+ *
+ * @param sim Opaque simulation handle
+ * @param dt Timestep in seconds (use 0.0 for config default)
+ * @param n Number of steps (0 republishes the current state)
+ * @return Ticket (>= 1, increasing), or negative error code
+ *         (NEG_ERROR_INVALID_STATE if 64 jobs are already queued)
+ */
+int64_t neg_step_async(void* sim, float dt, int n);
+
+/**
+ * Check whether a job has finished, without blocking.
+ *
+ * @param sim Opaque simulation handle
+ * @param ticket From neg_step_async(), or 0 for the last one submitted
+ * @return 1 if finished, 0 if still queued or running, or negative error
+ *         code (NEG_ERROR_NUMERICAL_INSTABILITY if the job failed)
+ */
+int neg_poll(void* sim, int64_t ticket);
+
+/**
+ * Block until a job has finished.
+ *
+ * @param sim Opaque simulation handle
+ * @param ticket From neg_step_async(), or 0 for every job submitted
+ * @return 0 on success, or negative error code
+ *         (NEG_ERROR_NUMERICAL_INSTABILITY if the job failed)
+ */
+int neg_wait(void* sim, int64_t ticket);
+
+/* ========================================================================
+ * EVENT LOG
+ * ======================================================================== */
+
+/*
+ * A hash-chained, append-only record of what drove the simulation
+ * (src/core/include/event_log.h): every step with its dt, the
+ * interventions and parameter changes the host logs, resets, and a
+ * SHA-256 digest of the state every digest_interval steps, and a full
+ * keyframe every keyframe_interval steps for neg_seek(). Each record
+ * hashes the one before it, so a log replayed from the same initial
+ * state reproduces the same digests, and any edit to the file shows up
+ * in neg_verify_event_log().
+ */
+
+/**
+ * Start recording to a log file (appending to and continuing the chain
+ * of an existing one). Replaces any log already open.
+ *
+ * @param sim Opaque simulation handle
+ * @param path Log file
+ * @param digest_interval Steps between state digests (0: none)
+ * @param keyframe_interval Steps between keyframes (0: none); one is
+ *        also written now and after each neg_reset_from_binary()
+ * @return 0 on success, or negative error code
+ *         (NEG_ERROR_INVALID_STATE if the existing file fails verification)
+ */
+int neg_open_event_log(void* sim, const char* path, uint32_t digest_interval,
+                       uint32_t keyframe_interval);
+
+/**
+ * Record a host event, stamped with the current step and time.
+ *
+ * @param type NEG_EVENT_INTERVENTION (2), NEG_EVENT_PARAMETER (3), or a
+ *             host type >= NEG_EVENT_HOST (256)
+ * @return 0 on success, or negative error code
+ *         (NEG_ERROR_INVALID_STATE if no log is open)
+ */
+int neg_log_event(void* sim, uint32_t type, const void* payload, uint32_t len);
+
+/** Flush and close the simulation's event log (no-op if none is open) */
+int neg_close_event_log(void* sim);
+
+/**
+ * Verify a log file's hash chain.
+ *
+ * @param threads Verification threads (0: online CPUs)
+ * @return Number of records, or negative error code
+ *         (NEG_ERROR_INVALID_STATE if damaged; neg_get_last_error() names
+ *         the first bad record)
+ */
+int64_t neg_verify_event_log(const char* path, int threads);
+
+/* ========================================================================
+ * REPLAY AND SEEK
+ * ======================================================================== */
+
+/**
+ * Verify and index an event log for seeking (src/core/include/replay.h).
+ * A torn last record is ignored; other damage is refused.
+ *
+ * @param threads Verification threads (0: online CPUs)
+ * @return Replay handle (release with neg_close_replay()), or NULL
+ */
+NegReplay* neg_open_replay(const char* path, int threads);
+
+/**
+ * Put the simulation in the state it had after a recorded step: restore
+ * the nearest keyframe at or before it and re-simulate the rest, which
+ * takes fewer steps than the log's keyframe interval. Every state digest
+ * passed on the way is checked.
+ *
+ * The simulation must have the configuration the log was recorded with,
+ * and no event log of its own open: its step count would go backwards
+ * in that log (NEG_ERROR_INVALID_STATE). With rollback enabled, a failed
+ * seek leaves the state as it was; otherwise it is left part-way.
+ *
+ * @param fn Called with each host record (interventions, parameter
+ *           changes, host types) in order, to apply it again; must not
+ *           step the simulation (NULL: host records are skipped)
+ * @return 0 on success, or negative error code
+ *         (NEG_ERROR_INVALID_STATE if the replay diverged from a digest;
+ *         neg_get_last_error() names the step)
+ */
+int neg_seek(void* sim, NegReplay* replay, uint64_t step, NegReplayEventFn fn, void* ctx);
+
+/** Release a replay handle (NULL is ignored) */
+void neg_close_replay(NegReplay* replay);
+
+/* ========================================================================
+ * ROLLBACK
+ * ======================================================================== */
+
+/**
+ * Keep the last max_steps states in memory for neg_rollback()
+ * (src/core/include/rollback.h). Each step, reset and seek is recorded
+ * as the tiles of the state it changed; memory is one copy of the state
+ * plus those deltas, capped by budget_bytes (oldest steps dropped first).
+ *
+ * @param max_steps Steps kept (0: turn rollback off and free the history)
+ * @param budget_bytes Cap on the deltas (0: only max_steps limits them)
+ * @return 0 on success, or negative error code
+ */
+int neg_enable_rollback(void* sim, uint32_t max_steps, size_t budget_bytes);
+
+/**
+ * Wind the simulation back steps recorded changes (steps, resets or
+ * seeks), state and clock alike. Takes time proportional to the data
+ * those changes touched. Not allowed while an event log is open (the log
+ * would no longer describe the run).
+ *
+ * @return 0 on success, or negative error code
+ *         (NEG_ERROR_INVALID_CONFIG if fewer steps are held)
+ */
+int neg_rollback(void* sim, uint32_t steps);
+
+/**
+ * Steps neg_rollback() can currently undo.
+ *
+ * @return Depth (0 if rollback is off), or negative error code
+ */
+int neg_get_rollback_depth(void* sim);
+
 /* ========================================================================
  * STATE RETRIEVAL (Safe, Caller-Allocated Buffers)
  * ======================================================================== */
@@ -134,6 +342,23 @@ int neg_get_state_binary(void* sim, uint8_t* buffer, size_t max_len);
  */
 size_t neg_get_state_binary_size(void* sim);
 
+/**
+ * Publish the current binary state to a shared-memory segment.
+ *
+ * Serializes straight into the writer's free slot (no intermediate
+ * buffer) and stamps the frame with neg_get_state_hash() and the
+ * simulation time, so local readers (neg_shm_reader_open) can verify and
+ * order frames. Call from the thread that steps the simulation, or from
+ * any thread once it steps with neg_step_async() (the published state is
+ * copied then).
+ *
+ * @param sim Opaque simulation handle
+ * @param writer Segment from neg_shm_writer_create()
+ * @return Frame number (>= 1), or negative error code
+ *         (NEG_ERROR_BUFFER_TOO_SMALL if the state outgrew the segment)
+ */
+int64_t neg_publish_state(void* sim, NegShmWriter* writer);
+
 /**
  * Get current state as JSON string.
  *
@@ -165,6 +390,23 @@ int neg_get_state_json(void* sim, char* buffer, size_t max_len);
  */
 uint64_t neg_get_state_hash(void* sim);
 
+/**
+ * Get the scalar field values in place (zero-copy).
+ *
+ * Points into the simulation's memory block: the address is fixed until
+ * neg_destroy(), and neg_step() / neg_reset_from_binary() update the
+ * values behind it. Do not write through it (the state hash and replay
+ * assume changes come from stepping or a binary reset), and do not read
+ * it while another thread steps the same simulation or neg_step_async()
+ * jobs are queued. After neg_step_async() this call waits for the queued
+ * jobs, and the values are only valid until the next neg_step_async().
+ *
+ * @param sim Opaque simulation handle
+ * @param count Output: number of float values (optional)
+ * @return Pointer to count floats, or NULL on error
+ */
+const float* neg_get_scalar_fields(void* sim, uint32_t* count);
+
 /**
  * Get last error message (if any).
  *
@@ -190,10 +432,24 @@ NegErrorFlags neg_get_error_flags(void* sim);
  * {
  *   "energy": 1234.5,
  *   "max_error": 0.0001,
- *   "step_count": 1000,
- *   "so3_drift": 1.2e-8
+ *   "timestamp": 16000,
+ *   "timers": {
+ *     "window": 64, "steps": 1000,
+ *     "step": {"last_ns": 812000, "mean_ns": 790000, "max_ns": 1450000},
+ *     "phases": {
+ *       "vertical_solve": {"last_ns": 540000, "mean_ns": 520000, "max_ns": 600000, "calls": 1},
+ *       "surface_flow": {...}, "atmosphere": {...}, "regeneration": {...},
+ *       "lod_dispatch": {...}, "hash": {...}, "snapshot": {...}
+ *     }
+ *   }
  * }
  *
+ * "last_ns" is the last completed step; mean/max are over the rolling
+ * window of recent steps (src/core/include/phase_timers.h). Reading the
+ * diagnostics hashes the state, which is itself charged to "hash"
+ * (after neg_step_async(), the published frame is read instead).
+ * About 1.5 KB; pass a 2 KB buffer.
+ *
  * @param sim Opaque simulation handle
  * @param buffer Caller-allocated buffer
  * @param max_len Buffer size in bytes
@@ -201,6 +457,105 @@ NegErrorFlags neg_get_error_flags(void* sim);
  */
 int neg_get_diagnostics(void* sim, char* buffer, size_t max_len);
 
+/**
+ * Get runtime metrics in the OpenMetrics text format (Prometheus scrape).
+ *
+ * Example output (abridged):
+ *   # TYPE negentropic_steps counter
+ *   negentropic_steps_total 1000
+ *   # TYPE negentropic_phase_seconds histogram
+ *   negentropic_phase_seconds_bucket{phase="vertical_solve",le="0.001"} 987
+ *   ...
+ *   negentropic_cfl_substeps_total 4000
+ *   negentropic_memory_bytes{subsystem="state"} 1052800
+ *   negentropic_error_flag{flag="overflow"} 0
+ *   # EOF
+ *
+ * Covers steps, whole-step and per-phase time histograms, LoD escalation
+ * and CFL substep counters, memory by subsystem and error flags
+ * (src/core/include/openmetrics.h). Unlike neg_get_diagnostics() it does
+ * not hash the state and allocates nothing, so it can back every scrape.
+ * Always fits in 32 KB.
+ *
+ * @param sim Opaque simulation handle
+ * @param buffer Caller-allocated buffer
+ * @param max_len Buffer size in bytes
+ * @return Number of bytes written (excluding null terminator), or negative error code
+ */
+int neg_get_metrics_text(void* sim, char* buffer, size_t max_len);
+
+/* ========================================================================
+ * MEMORY
+ * ======================================================================== */
+
+/**
+ * Get the process-wide memory report (JSON format).
+ *
+ * Example output:
+ * {
+ *   "current_bytes": 4196368, "peak_bytes": 5244944, "static_bytes": 1311744,
+ *   "allocs": 42, "frees": 40, "mapped_bytes": 4194352,
+ *   "numa_nodes": [2097152, 2101248],
+ *   "subsystems": {
+ *     "state": {"current_bytes": 4194352, "peak_bytes": 4194352, "static_bytes": 0,
+ *               "allocs": 1, "frees": 0, "mapped_bytes": 4194352},
+ *     "octree": {...}, "integrator": {...}, "solver": {...}, "lut": {...},
+ *     "io": {...}, "diagnostics": {...}
+ *   }
+ * }
+ *
+ * Heap bytes are live (current) and high-water (peak) for every
+ * simulation in the process; static_bytes is the fixed scratch, slab and
+ * LUT storage of the solvers initialized so far
+ * (src/core/include/mem_stats.h). Reads counters only, so it can be
+ * polled every second; allocs - frees (live blocks) growing across steps
+ * means a leak.
+ *
+ * State blocks of 2 MB or more are mapped for transparent huge pages
+ * (mapped_bytes) and first touched by the "threads" pool workers;
+ * numa_nodes is where their pages landed, by node (Linux with NUMA;
+ * [0] elsewhere). A single entry on a multi-socket host means the
+ * workers all ran on one node (try "pin_cpus": true).
+ * About 1.4 KB; pass a 2 KB buffer.
+ *
+ * @param buffer Caller-allocated buffer
+ * @param max_len Buffer size in bytes
+ * @return Number of bytes written (excluding null terminator), or negative error code
+ */
+int neg_get_memory_report(char* buffer, size_t max_len);
+
+/* ========================================================================
+ * TRACING (builds with NEG_TRACE=1)
+ * ======================================================================== */
+
+/**
+ * Upper bound on the size of the trace JSON currently held, in bytes
+ * (including the terminator).
+ */
+size_t neg_get_trace_json_size(void);
+
+/**
+ * Dump the recorded step trace as Chrome trace-event JSON.
+ *
+ * Load the output in chrome://tracing or ui.perfetto.dev. Events cover
+ * the simulation step, solver phases (HYD vertical/surface, ATM, REG
+ * cadence ticks), LoD tiles and escalations, hashing and snapshots,
+ * one track per thread. Builds without NEG_TRACE return an empty trace.
+ *
+ * Safe to call while other threads are stepping; events overwritten
+ * during the dump are dropped.
+ *
+ * @param buffer Caller-allocated buffer (size from neg_get_trace_json_size())
+ * @param max_len Buffer size in bytes
+ * @return Number of bytes written (excluding null terminator), or negative error code
+ */
+int neg_get_trace_json(char* buffer, size_t max_len);
+
+/**
+ * Discard all recorded trace events.
+ */
+void neg_clear_trace(void);
+
 /* ========================================================================
  * ERROR CODES
  * ======================================================================== */
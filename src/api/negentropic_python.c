@@ -0,0 +1,772 @@
+/*
+ * negentropic_python.c - CPython Extension over the Public C API
+ *
+ * Builds the negentropic_core._native module (setup.py, or CMake with
+ * -DBUILD_PYTHON=ON) so Python tooling can step the core and read its
+ * fields in place instead of round-tripping the whole state through
+ * neg_get_state_binary() / neg_get_state_json() every step:
+ *
+ *   from negentropic_core import _native
+ *
+ *   sim = _native.Simulation('{"num_scalar_fields": 4096}')
+ *   sim.step_n(0.016, 100)           # one call, GIL released throughout
+ *   fields = sim.scalar_fields       # numpy.ndarray over simulation memory
+ *
+ *   grid = _native.Grid(64, 64, 8)   # Richards-Lite Cell grid
+ *   grid.theta[:, :, 0] = 0.30       # initial conditions, written in place
+ *   grid.step(60.0, rainfall=1e-6, n=10)
+ *   ponding = grid.h_surface[:, :, 0]
+ *
+ * The opaque simulation handle owns no Cell grid, so the hydrology and
+ * REGv2 fields (theta, psi, h_surface, C_labile, FB_ratio, ...) come from
+ * a Grid: a Cell array owned by the extension (charged to "state" in
+ * neg_get_memory_report()) and stepped with richards_lite_step().
+ *
+ * Zero-copy: each field is a FieldView exporting the buffer protocol over
+ * its owner's memory. Grid fields are shape (ny, nx, nz) with the Cell
+ * stride (cells[(j * nx + i) * nz + k], layer 0 on top); NumPy sees them
+ * as strided float32 arrays. Arrays keep their owner alive and the memory
+ * never moves, so an array taken once sees every later step.
+ * Without NumPy, fields are returned as memoryviews.
+ *
+ * Simulation fields are read-only: the state hash and replay assume the
+ * state changes only by stepping or neg_reset_from_binary(). Grid fields
+ * are writable.
+ *
+ * metrics_batch() runs compute_regenerative_metrics() for a packed batch
+ * of trajectories in C (src/core/metrics_batch.c) with the GIL released:
+ *
+ *   raw = _native.metrics_batch(poses, offsets, format=0, workers=0)
+ *   rows = numpy.frombuffer(raw, dtype=...)  # METRICS_RESULT_FIELDS
+ *
+ * Threads: step()/step_n() release the GIL, so other Python threads run
+ * meanwhile; reading the arrays of an object being stepped sees a step in
+ * progress. Calls on one Simulation are serialized by its lock. Grid steps
+ * are serialized process-wide because Richards-Lite solves in static
+ * scratch (hydrology_richards_lite.c).
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "negentropic.h"
+#include "../core/include/mem_stats.h"
+#include "../core/include/metrics_batch.h"
+#include "../core/include/openmetrics.h"
+#include "../solvers/hydrology_richards_lite.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Richards-Lite stack scratch limits (hydrology_richards_lite.c) */
+#define GRID_MAX_ROW     1024
+#define GRID_MAX_LAYERS  256
+
+/* JSON outputs are documented to fit in 2 KB (negentropic.h) */
+#define JSON_BUFFER_SIZE 4096
+
+/* numpy.asarray, or NULL when NumPy is not importable */
+static PyObject* g_asarray = NULL;
+
+static PyObject* raise_neg_error(int code) {
+    const char* msg = neg_get_last_error();
+    PyErr_Format(code == NEG_ERROR_INVALID_CONFIG ? PyExc_ValueError : PyExc_RuntimeError,
+                 "%s (error %d)", msg ? msg : "negentropic-core call failed", code);
+    return NULL;
+}
+
+/* ========================================================================
+ * FIELD VIEW
+ * ======================================================================== */
+
+typedef struct {
+    PyObject_HEAD
+    PyObject* owner;            /* Keeps the memory alive */
+    char* data;
+    int ndim;
+    int readonly;
+    int contiguous;             /* C-contiguous float32 */
+    Py_ssize_t shape[3];
+    Py_ssize_t strides[3];
+} FieldView;
+
+static void FieldView_dealloc(PyObject* obj) {
+    FieldView* self = (FieldView*)obj;
+    Py_XDECREF(self->owner);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+static int FieldView_getbuffer(PyObject* obj, Py_buffer* view, int flags) {
+    FieldView* self = (FieldView*)obj;
+    view->obj = NULL;
+
+    if ((flags & PyBUF_WRITABLE) && self->readonly) {
+        PyErr_SetString(PyExc_BufferError, "field is read-only");
+        return -1;
+    }
+    if (!self->contiguous &&
+        ((flags & PyBUF_STRIDES) != PyBUF_STRIDES ||
+         (flags & (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS) &
+          ~PyBUF_STRIDES))) {
+        PyErr_SetString(PyExc_BufferError, "field is strided (Cell layout)");
+        return -1;
+    }
+    if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && self->ndim > 1) {
+        PyErr_SetString(PyExc_BufferError, "field is not Fortran-contiguous");
+        return -1;
+    }
+
+    Py_ssize_t count = 1;
+    for (int d = 0; d < self->ndim; d++) count *= self->shape[d];
+
+    view->buf = self->data;
+    view->obj = obj;
+    Py_INCREF(obj);
+    view->len = count * (Py_ssize_t)sizeof(float);
+    view->readonly = self->readonly;
+    view->itemsize = sizeof(float);
+    view->format = (flags & PyBUF_FORMAT) ? (char*)"f" : NULL;
+    view->ndim = self->ndim;
+    view->shape = ((flags & PyBUF_ND) == PyBUF_ND) ? self->shape : NULL;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static PyBufferProcs FieldView_as_buffer = {
+    .bf_getbuffer = FieldView_getbuffer,
+    .bf_releasebuffer = NULL,
+};
+
+static PyTypeObject FieldViewType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "negentropic_core._native.FieldView",
+    .tp_doc = "Buffer over a simulation field (wrapped by numpy.asarray)",
+    .tp_basicsize = sizeof(FieldView),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = FieldView_dealloc,
+    .tp_as_buffer = &FieldView_as_buffer,
+};
+
+/**
+ * Array over float32 memory of owner: numpy.ndarray when NumPy is
+ * importable, memoryview otherwise. Either way no data is copied.
+ */
+static PyObject* field_array(PyObject* owner, char* data, int ndim,
+                             const Py_ssize_t* shape, const Py_ssize_t* strides,
+                             int readonly) {
+    FieldView* view = PyObject_New(FieldView, &FieldViewType);
+    if (!view) return NULL;
+
+    Py_INCREF(owner);
+    view->owner = owner;
+    view->data = data;
+    view->ndim = ndim;
+    view->readonly = readonly;
+    view->contiguous = 1;
+    Py_ssize_t expected = (Py_ssize_t)sizeof(float);
+    for (int d = ndim - 1; d >= 0; d--) {
+        view->shape[d] = shape[d];
+        view->strides[d] = strides[d];
+        if (shape[d] > 1 && strides[d] != expected) view->contiguous = 0;
+        expected *= shape[d];
+    }
+
+    PyObject* array = g_asarray
+        ? PyObject_CallFunctionObjArgs(g_asarray, (PyObject*)view, NULL)
+        : PyMemoryView_FromObject((PyObject*)view);
+    Py_DECREF(view);
+    return array;
+}
+
+/* ========================================================================
+ * SIMULATION
+ * ======================================================================== */
+
+typedef struct {
+    PyObject_HEAD
+    void* sim;
+    PyThread_type_lock lock;    /* Serializes calls into sim */
+} SimulationObject;
+
+static int Simulation_init(PyObject* obj, PyObject* args, PyObject* kwds) {
+    SimulationObject* self = (SimulationObject*)obj;
+    static char* kwlist[] = {"config_json", NULL};
+    const char* config_json = "{}";
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|s", kwlist, &config_json)) return -1;
+    if (self->sim) {
+        /* Arrays handed out point into the current block */
+        PyErr_SetString(PyExc_RuntimeError, "Simulation already initialized");
+        return -1;
+    }
+
+    self->lock = PyThread_allocate_lock();
+    if (!self->lock) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    self->sim = neg_create(config_json);
+    if (!self->sim) {
+        raise_neg_error(NEG_ERROR_INVALID_CONFIG);
+        return -1;
+    }
+    return 0;
+}
+
+static void Simulation_dealloc(PyObject* obj) {
+    SimulationObject* self = (SimulationObject*)obj;
+    if (self->sim) neg_destroy(self->sim);
+    if (self->lock) PyThread_free_lock(self->lock);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+static void* checked_sim(SimulationObject* self) {
+    if (!self->sim) PyErr_SetString(PyExc_RuntimeError, "Simulation not initialized");
+    return self->sim;
+}
+
+static PyObject* run_steps(SimulationObject* self, float dt, int n) {
+    if (!checked_sim(self)) return NULL;
+
+    int rc;
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    rc = neg_step_n(self->sim, dt, n);
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    if (rc != NEG_SUCCESS) return raise_neg_error(rc);
+    Py_RETURN_NONE;
+}
+
+static PyObject* Simulation_step(PyObject* obj, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"dt", NULL};
+    float dt = 0.0f;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|f", kwlist, &dt)) return NULL;
+    return run_steps((SimulationObject*)obj, dt, 1);
+}
+
+static PyObject* Simulation_step_n(PyObject* obj, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"dt", "n", NULL};
+    float dt;
+    int n;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "fi", kwlist, &dt, &n)) return NULL;
+    return run_steps((SimulationObject*)obj, dt, n);
+}
+
+static PyObject* Simulation_state_hash(PyObject* obj, PyObject* unused) {
+    SimulationObject* self = (SimulationObject*)obj;
+    (void)unused;
+    if (!checked_sim(self)) return NULL;
+
+    uint64_t hash;
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    hash = neg_get_state_hash(self->sim);
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    return PyLong_FromUnsignedLongLong((unsigned long long)hash);
+}
+
+static PyObject* Simulation_diagnostics(PyObject* obj, PyObject* unused) {
+    SimulationObject* self = (SimulationObject*)obj;
+    (void)unused;
+    if (!checked_sim(self)) return NULL;
+
+    char buffer[JSON_BUFFER_SIZE];
+    int n;
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    n = neg_get_diagnostics(self->sim, buffer, sizeof(buffer));
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    if (n < 0) return raise_neg_error(n);
+    return PyUnicode_FromStringAndSize(buffer, n);
+}
+
+static PyObject* Simulation_metrics_text(PyObject* obj, PyObject* unused) {
+    SimulationObject* self = (SimulationObject*)obj;
+    (void)unused;
+    if (!checked_sim(self)) return NULL;
+
+    char* buffer = (char*)PyMem_RawMalloc(NEG_OPENMETRICS_MAX_SIZE);
+    if (!buffer) return PyErr_NoMemory();
+
+    int n;
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(self->lock, WAIT_LOCK);
+    n = neg_get_metrics_text(self->sim, buffer, NEG_OPENMETRICS_MAX_SIZE);
+    PyThread_release_lock(self->lock);
+    Py_END_ALLOW_THREADS
+
+    PyObject* text = n < 0 ? raise_neg_error(n) : PyUnicode_FromStringAndSize(buffer, n);
+    PyMem_RawFree(buffer);
+    return text;
+}
+
+static PyObject* Simulation_scalar_fields(PyObject* obj, void* closure) {
+    SimulationObject* self = (SimulationObject*)obj;
+    (void)closure;
+    if (!checked_sim(self)) return NULL;
+
+    uint32_t count = 0;
+    const float* values = neg_get_scalar_fields(self->sim, &count);
+    if (!values) return raise_neg_error(NEG_ERROR_NULL_HANDLE);
+
+    Py_ssize_t shape[1] = { (Py_ssize_t)count };
+    Py_ssize_t strides[1] = { (Py_ssize_t)sizeof(float) };
+    return field_array(obj, (char*)values, 1, shape, strides, 1);
+}
+
+static PyMethodDef Simulation_methods[] = {
+    { "step", (PyCFunction)(void (*)(void))Simulation_step, METH_VARARGS | METH_KEYWORDS,
+      "step(dt=0.0)\n\nAdvance one timestep (neg_step) with the GIL released." },
+    { "step_n", (PyCFunction)(void (*)(void))Simulation_step_n, METH_VARARGS | METH_KEYWORDS,
+      "step_n(dt, n)\n\nAdvance n timesteps (neg_step_n) with the GIL released." },
+    { "state_hash", Simulation_state_hash, METH_NOARGS,
+      "state_hash() -> int\n\n64-bit state hash (neg_get_state_hash)." },
+    { "diagnostics", Simulation_diagnostics, METH_NOARGS,
+      "diagnostics() -> str\n\nDiagnostics JSON (neg_get_diagnostics)." },
+    { "metrics_text", Simulation_metrics_text, METH_NOARGS,
+      "metrics_text() -> str\n\nOpenMetrics text for a /metrics scrape (neg_get_metrics_text)." },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyGetSetDef Simulation_getset[] = {
+    { "scalar_fields", Simulation_scalar_fields, NULL,
+      "Read-only float32 array over the scalar field values (zero-copy)", NULL },
+    { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyTypeObject SimulationType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "negentropic_core._native.Simulation",
+    .tp_doc = "Simulation(config_json='{}')\n\nOwns a neg_create() handle.",
+    .tp_basicsize = sizeof(SimulationObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = PyType_GenericNew,
+    .tp_init = Simulation_init,
+    .tp_dealloc = Simulation_dealloc,
+    .tp_methods = Simulation_methods,
+    .tp_getset = Simulation_getset,
+};
+
+/* ========================================================================
+ * GRID
+ * ======================================================================== */
+
+typedef struct {
+    PyObject_HEAD
+    Cell* cells;
+    Py_ssize_t nx, ny, nz;
+    RichardsLiteParams params;
+} GridObject;
+
+/** Degraded Loess Plateau cell (tests/physics_integration_benchmark.c) */
+static void init_cell(Cell* cell, float dz, float dx) {
+    memset(cell, 0, sizeof(*cell));
+    cell->theta = 0.12f;
+    cell->psi = -10.0f;
+    cell->K_s = 5.0e-6f;
+    cell->alpha_vG = 1.5f;
+    cell->n_vG = 1.4f;
+    cell->theta_s = 0.45f;
+    cell->theta_r = 0.05f;
+    cell->M_K_zz = 1.0f;
+    cell->M_K_xx = 1.0f;
+    cell->kappa_evap = 1.0f;
+    cell->zeta_c = 0.005f;
+    cell->a_c = 0.5f;
+    cell->vegetation_cover = 0.15f;
+    cell->SOM_percent = 0.5f;
+    cell->vegetation_cover_fxp = (int32_t)(0.15f * 65536.0f);
+    cell->SOM_percent_fxp = (int32_t)(0.5f * 65536.0f);
+    cell->porosity_eff = 0.45f;
+    cell->K_tensor[0] = 5.0e-6f;
+    cell->K_tensor[4] = 5.0e-6f;
+    cell->K_tensor[8] = 5.0e-6f;
+    cell->dz = dz;
+    cell->dx = dx;
+    cell->soil_temp_C = 15.0f;
+    cell->Phi_agg = 0.5f;
+    cell->FB_ratio = 0.5f;
+    cell->O2 = 1.0f;
+    cell->theta_deep = 0.05f;
+}
+
+static void init_params(RichardsLiteParams* p) {
+    p->K_r = 1.0e-4f;
+    p->phi_r = 0.5f;
+    p->l_r = 0.005f;
+    p->b_T = 1.5f;
+    p->E_bare_ref = 5.0e-7f;
+    p->dt_max = 3600.0f;
+    p->CFL_factor = 0.5f;
+    p->picard_tol = 1.0e-4f;
+    p->picard_max_iter = 20;
+    p->use_free_drainage = 1;
+}
+
+static int Grid_init(PyObject* obj, PyObject* args, PyObject* kwds) {
+    GridObject* self = (GridObject*)obj;
+    static char* kwlist[] = {"nx", "ny", "nz", "dz", "dx", NULL};
+    Py_ssize_t nx, ny, nz;
+    float dz = 0.2f;
+    float dx = 10.0f;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "nnn|ff", kwlist, &nx, &ny, &nz, &dz, &dx)) {
+        return -1;
+    }
+    if (self->cells) {
+        PyErr_SetString(PyExc_RuntimeError, "Grid already initialized");
+        return -1;
+    }
+    if (nx < 1 || ny < 1 || nz < 1 || nx > GRID_MAX_ROW || nz > GRID_MAX_LAYERS) {
+        PyErr_Format(PyExc_ValueError,
+                     "grid %zdx%zdx%zd outside Richards-Lite limits (nx <= %d, nz <= %d)",
+                     nx, ny, nz, GRID_MAX_ROW, GRID_MAX_LAYERS);
+        return -1;
+    }
+
+    size_t count = (size_t)(nx * ny * nz);
+    self->cells = (Cell*)neg_mem_calloc(NEG_MEM_STATE, count, sizeof(Cell));
+    if (!self->cells) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (size_t c = 0; c < count; c++) init_cell(&self->cells[c], dz, dx);
+    init_params(&self->params);
+    self->nx = nx;
+    self->ny = ny;
+    self->nz = nz;
+    return 0;
+}
+
+static void Grid_dealloc(PyObject* obj) {
+    GridObject* self = (GridObject*)obj;
+    neg_mem_free(self->cells);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+static PyObject* Grid_step(PyObject* obj, PyObject* args, PyObject* kwds) {
+    GridObject* self = (GridObject*)obj;
+    static char* kwlist[] = {"dt", "rainfall", "n", NULL};
+    float dt;
+    float rainfall = 0.0f;
+    int n = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "f|fi", kwlist, &dt, &rainfall, &n)) {
+        return NULL;
+    }
+    if (!self->cells) {
+        PyErr_SetString(PyExc_RuntimeError, "Grid not initialized");
+        return NULL;
+    }
+    if (n < 0) {
+        PyErr_SetString(PyExc_ValueError, "n must be >= 0");
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (int i = 0; i < n; i++) {
+        richards_lite_step(self->cells, &self->params, (size_t)self->nx, (size_t)self->ny,
+                           (size_t)self->nz, dt, rainfall, NULL);
+    }
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* Grid_shape(PyObject* obj, void* closure) {
+    GridObject* self = (GridObject*)obj;
+    (void)closure;
+    return Py_BuildValue("(nnn)", self->ny, self->nx, self->nz);
+}
+
+/* closure: offsetof(Cell, field) */
+static PyObject* Grid_field(PyObject* obj, void* closure) {
+    GridObject* self = (GridObject*)obj;
+    if (!self->cells) {
+        PyErr_SetString(PyExc_RuntimeError, "Grid not initialized");
+        return NULL;
+    }
+
+    const Py_ssize_t cell = (Py_ssize_t)sizeof(Cell);
+    Py_ssize_t shape[3] = { self->ny, self->nx, self->nz };
+    Py_ssize_t strides[3] = { self->nx * self->nz * cell, self->nz * cell, cell };
+    return field_array(obj, (char*)self->cells + (uintptr_t)closure, 3, shape, strides, 0);
+}
+
+#define GRID_FIELD(name, doc) \
+    { #name, Grid_field, NULL, doc, (void*)(uintptr_t)offsetof(Cell, name) }
+
+static PyGetSetDef Grid_getset[] = {
+    { "shape", Grid_shape, NULL, "(ny, nx, nz) of every field array", NULL },
+    /* Hydrology */
+    GRID_FIELD(theta, "Volumetric water content [m3/m3]"),
+    GRID_FIELD(psi, "Matric head [m]"),
+    GRID_FIELD(h_surface, "Surface water depth [m] (top layer)"),
+    GRID_FIELD(zeta, "Depression storage [m] (top layer)"),
+    GRID_FIELD(vegetation_cover, "Vegetation fractional cover [-]"),
+    GRID_FIELD(SOM_percent, "Soil organic matter [%]"),
+    GRID_FIELD(porosity_eff, "Effective porosity [m3/m3]"),
+    GRID_FIELD(theta_deep, "Deep soil moisture for hydraulic lift [m3/m3]"),
+    /* REGv2 */
+    GRID_FIELD(C_labile, "Labile carbon pool [g C m-2]"),
+    GRID_FIELD(soil_temp_C, "Soil temperature [C]"),
+    GRID_FIELD(N_fix, "Nitrogen fixation rate [g N m-2 d-1]"),
+    GRID_FIELD(Phi_agg, "Aggregate stability index [-]"),
+    GRID_FIELD(FB_ratio, "Fungal:bacterial biomass ratio [-]"),
+    GRID_FIELD(Phi_hyphae, "Mycorrhizal hyphal density index [-]"),
+    GRID_FIELD(O2, "Soil oxygen availability [-]"),
+    GRID_FIELD(C_sup, "Host carbon supply to mycorrhizae [g C m-2 d-1]"),
+    GRID_FIELD(LAI, "Leaf area index [-]"),
+    { NULL, NULL, NULL, NULL, NULL }
+};
+
+#undef GRID_FIELD
+
+static PyMethodDef Grid_methods[] = {
+    { "step", (PyCFunction)(void (*)(void))Grid_step, METH_VARARGS | METH_KEYWORDS,
+      "step(dt, rainfall=0.0, n=1)\n\n"
+      "Advance n Richards-Lite steps (rainfall in m/s) with the GIL released." },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyTypeObject GridType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "negentropic_core._native.Grid",
+    .tp_doc = "Grid(nx, ny, nz, dz=0.2, dx=10.0)\n\n"
+              "Richards-Lite Cell grid (degraded loess defaults); fields are\n"
+              "writable zero-copy arrays of shape (ny, nx, nz).",
+    .tp_basicsize = sizeof(GridObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = PyType_GenericNew,
+    .tp_init = Grid_init,
+    .tp_dealloc = Grid_dealloc,
+    .tp_methods = Grid_methods,
+    .tp_getset = Grid_getset,
+};
+
+/* ========================================================================
+ * BATCH METRICS
+ * ======================================================================== */
+
+/**
+ * C-contiguous 1-D view of obj with 8-byte items of one of the struct
+ * codes in codes (native byte order); sets TypeError otherwise.
+ */
+static int get_packed_buffer(PyObject* obj, Py_buffer* view, const char* codes,
+                             const char* name) {
+    if (PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) return -1;
+
+    const char* format = view->format ? view->format : "B";
+    if (*format == '@' || *format == '=' || *format == '<') format++;
+    if (view->itemsize != 8 || strlen(format) != 1 || !strchr(codes, *format)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a contiguous %s array", name,
+                     codes[0] == 'd' ? "float64" : "int64");
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* module_metrics_batch(PyObject* module, PyObject* args, PyObject* kwds) {
+    static char* kwlist[] = {"poses", "offsets", "format", "lambda_bounds", "r_max",
+                             "bounded", "resonance", "verification", "noise_trials",
+                             "noise_level", "seed", "workers", NULL};
+    (void)module;
+    PyObject* poses_obj;
+    PyObject* offsets_obj;
+    int format = NEG_POSE_ROTVEC;
+    int workers = 0;
+    unsigned long long seed = 0;
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|i(dd)dpppidKi", kwlist,
+                                     &poses_obj, &offsets_obj, &format,
+                                     &opt.lambda_lo, &opt.lambda_hi, &opt.r_max,
+                                     &opt.bounded, &opt.resonance, &opt.verification,
+                                     &opt.noise_trials, &opt.noise_level, &seed, &workers)) {
+        return NULL;
+    }
+    opt.seed = (uint64_t)seed;
+    if (format != NEG_POSE_ROTVEC && format != NEG_POSE_MATRIX && format != NEG_POSE_TIMESERIES) {
+        PyErr_Format(PyExc_ValueError, "unknown pose format %d", format);
+        return NULL;
+    }
+    if (!(opt.lambda_lo <= opt.lambda_hi)) {
+        PyErr_SetString(PyExc_ValueError, "The lower bound exceeds the upper bound.");
+        return NULL;
+    }
+
+    Py_buffer poses, offsets;
+    if (get_packed_buffer(poses_obj, &poses, "d", "poses") < 0) return NULL;
+    if (get_packed_buffer(offsets_obj, &offsets, "qlQL", "offsets") < 0) {
+        PyBuffer_Release(&poses);
+        return NULL;
+    }
+
+    const int64_t* off = (const int64_t*)offsets.buf;
+    Py_ssize_t count = offsets.len / 8 - 1;
+    Py_ssize_t stride = format == NEG_POSE_MATRIX ? 12 : 6;
+    Py_ssize_t num_poses = poses.len / 8 / stride;
+    PyObject* raw = NULL;
+
+    if (count < 0 || poses.len % (8 * stride) != 0) {
+        PyErr_Format(PyExc_ValueError, "need count + 1 offsets and %zd doubles per pose", stride);
+        goto done;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (off[i] < 0 || off[i + 1] < off[i] || off[i + 1] > num_poses) {
+            PyErr_Format(PyExc_ValueError, "offsets must be non-decreasing within [0, %zd]",
+                         num_poses);
+            goto done;
+        }
+    }
+
+    raw = PyBytes_FromStringAndSize(NULL, count * (Py_ssize_t)sizeof(NegMetricsResult));
+    if (!raw) goto done;
+
+    int rc;
+    Py_BEGIN_ALLOW_THREADS
+    rc = neg_metrics_batch((const double*)poses.buf, off, (size_t)count, (NegPoseFormat)format,
+                           &opt, (NegMetricsResult*)PyBytes_AS_STRING(raw), workers);
+    Py_END_ALLOW_THREADS
+
+    if (rc != 0) {
+        Py_CLEAR(raw);
+        PyErr_NoMemory();
+    }
+
+done:
+    PyBuffer_Release(&offsets);
+    PyBuffer_Release(&poses);
+    return raw;
+}
+
+/** (name, struct code, byte offset) of each NegMetricsResult column */
+static PyObject* metrics_result_fields(void) {
+    return Py_BuildValue(
+        "((sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn)(sCn))",
+        "optimal_lambda", 'd', (Py_ssize_t)offsetof(NegMetricsResult, optimal_lambda),
+        "return_error", 'd', (Py_ssize_t)offsetof(NegMetricsResult, return_error),
+        "verification_score", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verification_score),
+        "confidence", 'd', (Py_ssize_t)offsetof(NegMetricsResult, confidence),
+        "topological", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verifications[NEG_VERIFY_TOPOLOGICAL]),
+        "energetic", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verifications[NEG_VERIFY_ENERGETIC]),
+        "temporal", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verifications[NEG_VERIFY_TEMPORAL]),
+        "spatial", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verifications[NEG_VERIFY_SPATIAL]),
+        "stochastic", 'd', (Py_ssize_t)offsetof(NegMetricsResult, verifications[NEG_VERIFY_STOCHASTIC]),
+        "fail_value", 'd', (Py_ssize_t)offsetof(NegMetricsResult, fail_value),
+        "status", 'i', (Py_ssize_t)offsetof(NegMetricsResult, status),
+        "success", 'i', (Py_ssize_t)offsetof(NegMetricsResult, success),
+        "nfev", 'i', (Py_ssize_t)offsetof(NegMetricsResult, nfev),
+        "resonance", 'i', (Py_ssize_t)offsetof(NegMetricsResult, resonance));
+}
+
+static PyObject* resonance_names(void) {
+    PyObject* names = PyTuple_New(NEG_RESONANCE_COUNT);
+    if (!names) return NULL;
+    for (int i = 0; i < NEG_RESONANCE_COUNT; i++) {
+        PyObject* name = PyUnicode_FromString(neg_metrics_resonance_name(i));
+        if (!name) {
+            Py_DECREF(names);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(names, i, name);
+    }
+    return names;
+}
+
+/* ========================================================================
+ * MODULE
+ * ======================================================================== */
+
+static PyObject* module_version(PyObject* module, PyObject* unused) {
+    (void)module;
+    (void)unused;
+    return PyUnicode_FromString(neg_get_version());
+}
+
+static PyObject* module_memory_report(PyObject* module, PyObject* unused) {
+    (void)module;
+    (void)unused;
+    char buffer[JSON_BUFFER_SIZE];
+    int n = neg_get_memory_report(buffer, sizeof(buffer));
+    if (n < 0) return raise_neg_error(n);
+    return PyUnicode_FromStringAndSize(buffer, n);
+}
+
+static PyMethodDef module_methods[] = {
+    { "version", module_version, METH_NOARGS, "Core version string (neg_get_version)." },
+    { "memory_report", module_memory_report, METH_NOARGS,
+      "Process-wide memory report JSON (neg_get_memory_report)." },
+    { "metrics_batch", (PyCFunction)(void (*)(void))module_metrics_batch,
+      METH_VARARGS | METH_KEYWORDS,
+      "metrics_batch(poses, offsets, format=0, lambda_bounds=(0.1, 2.0), r_max=1.0,\n"
+      "              bounded=True, resonance=True, verification=True, noise_trials=10,\n"
+      "              noise_level=0.05, seed=0, workers=0) -> bytes\n\n"
+      "Regenerative metrics of trajectory i = poses[offsets[i]:offsets[i + 1]]\n"
+      "(neg_metrics_batch). Returns one packed record per trajectory; see\n"
+      "METRICS_RESULT_FIELDS and METRICS_RESULT_SIZE." },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef native_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_native",
+    .m_doc = "Zero-copy binding of the negentropic-core C API",
+    .m_size = -1,
+    .m_methods = module_methods,
+};
+
+static int add_type(PyObject* module, const char* name, PyTypeObject* type) {
+    Py_INCREF(type);
+    if (PyModule_AddObject(module, name, (PyObject*)type) < 0) {
+        Py_DECREF(type);
+        return -1;
+    }
+    return 0;
+}
+
+PyMODINIT_FUNC PyInit__native(void) {
+    if (PyType_Ready(&FieldViewType) < 0 || PyType_Ready(&SimulationType) < 0 ||
+        PyType_Ready(&GridType) < 0) {
+        return NULL;
+    }
+
+    richards_lite_init();
+
+    if (!g_asarray) {
+        PyObject* numpy = PyImport_ImportModule("numpy");
+        if (numpy) {
+            g_asarray = PyObject_GetAttrString(numpy, "asarray");
+            Py_DECREF(numpy);
+        }
+        if (!g_asarray) PyErr_Clear();
+    }
+
+    PyObject* module = PyModule_Create(&native_module);
+    if (!module) return NULL;
+    if (add_type(module, "Simulation", &SimulationType) < 0 ||
+        add_type(module, "Grid", &GridType) < 0 ||
+        add_type(module, "FieldView", &FieldViewType) < 0 ||
+        PyModule_AddIntConstant(module, "HAS_NUMPY", g_asarray != NULL) < 0 ||
+        PyModule_AddIntConstant(module, "METRICS_RESULT_SIZE", sizeof(NegMetricsResult)) < 0 ||
+        PyModule_AddObject(module, "METRICS_RESULT_FIELDS", metrics_result_fields()) < 0 ||
+        PyModule_AddObject(module, "RESONANCE_NAMES", resonance_names()) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
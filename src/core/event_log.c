@@ -0,0 +1,574 @@
+/*
+ * event_log.c - Hash-Chained Binary Event Log
+ *
+ * See event_log.h for the record layout and the verification contract.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "include/event_log.h"
+#include "include/mem_stats.h"
+#include "state.h"
+#include "../../embedded/sha256.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#define EVENT_VERIFY_TILE   4096    /* Default records per pool tile */
+#define EVENT_VERIFY_BATCH  16      /* Records per sha256_multi() call */
+#define EVENT_MIN_CAPACITY  4096
+#define EVENT_SEGMENT_BYTES (8u << 20)  /* File bytes verified per pass */
+
+struct NegEventLog {
+    FILE* file;                     /* NULL: in memory */
+    int failed;                     /* File write failed: no further appends */
+    uint8_t* data;                  /* In-memory records; for files, one record */
+    size_t len;
+    size_t capacity;
+    uint64_t count;                 /* Records, including pre-existing ones */
+    uint8_t head[NEG_EVENT_HASH_BYTES];
+    uint32_t digest_interval;
+    uint32_t keyframe_interval;
+};
+
+static const uint8_t k_genesis[NEG_EVENT_HASH_BYTES] = { 0 };
+
+/* ========================================================================
+ * LITTLE-ENDIAN FIELDS
+ * ======================================================================== */
+
+static void put_u32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static void put_u64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint32_t get_u32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static uint64_t get_u64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+/* ========================================================================
+ * WRITING
+ * ======================================================================== */
+
+NegEventLog* neg_event_log_create(void) {
+    return (NegEventLog*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegEventLog));
+}
+
+NegEventLog* neg_event_log_open(const char* path, const NegPoolConfig* pool, int* status) {
+    int st = NEG_EVENT_IO_ERROR;
+    NegEventLog* log = NULL;
+    if (!path) goto done;
+
+    st = NEG_EVENT_NO_MEMORY;
+    log = neg_event_log_create();
+    if (!log) goto done;
+
+    /* Continue an existing chain only if all of it verifies */
+    FILE* probe = fopen(path, "rb");
+    if (probe) {
+        fclose(probe);
+        NegEventVerify v;
+        st = neg_event_log_verify_file(path, pool, &v);
+        if (st != NEG_EVENT_OK) goto done;
+        log->count = v.records;
+        memcpy(log->head, v.head, NEG_EVENT_HASH_BYTES);
+    }
+
+    st = NEG_EVENT_IO_ERROR;
+    log->file = fopen(path, "ab");
+    if (log->file) st = NEG_EVENT_OK;
+
+done:
+    if (status) *status = st;
+    if (st != NEG_EVENT_OK) {
+        neg_mem_free(log);
+        return NULL;
+    }
+    return log;
+}
+
+void neg_event_log_close(NegEventLog* log) {
+    if (!log) return;
+    if (log->file) fclose(log->file);
+    neg_mem_free(log->data);
+    neg_mem_free(log);
+}
+
+static int reserve(NegEventLog* log, size_t extra) {
+    if (log->len + extra <= log->capacity) return NEG_EVENT_OK;
+    size_t capacity = log->capacity ? log->capacity * 2 : EVENT_MIN_CAPACITY;
+    while (capacity < log->len + extra) capacity *= 2;
+    uint8_t* data = (uint8_t*)neg_mem_realloc(NEG_MEM_IO, log->data, capacity);
+    if (!data) return NEG_EVENT_NO_MEMORY;
+    log->data = data;
+    log->capacity = capacity;
+    return NEG_EVENT_OK;
+}
+
+int neg_event_log_append(NegEventLog* log, uint32_t type, uint64_t step, uint64_t time_us,
+                         const void* payload, uint32_t payload_len) {
+    if (!log || log->failed) return NEG_EVENT_IO_ERROR;
+    if (payload_len > NEG_EVENT_MAX_PAYLOAD || (payload_len && !payload)) {
+        return NEG_EVENT_CORRUPT;
+    }
+
+    /* Whole record in one buffer: a file gets it in a single write */
+    size_t record_bytes = NEG_EVENT_RECORD_BYTES(payload_len);
+    if (log->file) log->len = 0;
+    if (reserve(log, record_bytes) != NEG_EVENT_OK) return NEG_EVENT_NO_MEMORY;
+
+    uint8_t* p = log->data + log->len;
+    memcpy(p, NEG_EVENT_MAGIC, 4);
+    put_u32(p + 4, type);
+    put_u64(p + 8, log->count);
+    put_u64(p + 16, step);
+    put_u64(p + 24, time_us);
+    put_u32(p + 32, payload_len);
+    memcpy(p + 36, log->head, NEG_EVENT_HASH_BYTES);
+    if (payload_len) memcpy(p + NEG_EVENT_HEADER_BYTES, payload, payload_len);
+    uint8_t* hash = p + NEG_EVENT_HEADER_BYTES + payload_len;
+    sha256(p, NEG_EVENT_HEADER_BYTES + payload_len, hash);
+
+    if (log->file) {
+        /* A short write may leave a torn record; nothing may chain after it */
+        if (fwrite(p, record_bytes, 1, log->file) != 1) {
+            log->failed = 1;
+            return NEG_EVENT_IO_ERROR;
+        }
+    } else {
+        log->len += record_bytes;
+    }
+
+    log->count++;
+    memcpy(log->head, hash, NEG_EVENT_HASH_BYTES);
+    return NEG_EVENT_OK;
+}
+
+int neg_event_log_flush(NegEventLog* log) {
+    if (!log || log->failed) return NEG_EVENT_IO_ERROR;
+    if (log->file && fflush(log->file) != 0) {
+        log->failed = 1;
+        return NEG_EVENT_IO_ERROR;
+    }
+    return NEG_EVENT_OK;
+}
+
+uint64_t neg_event_log_count(const NegEventLog* log) {
+    return log ? log->count : 0;
+}
+
+void neg_event_log_head(const NegEventLog* log, uint8_t hash[NEG_EVENT_HASH_BYTES]) {
+    if (!hash) return;
+    memcpy(hash, log ? log->head : k_genesis, NEG_EVENT_HASH_BYTES);
+}
+
+const uint8_t* neg_event_log_data(const NegEventLog* log, size_t* len) {
+    if (len) *len = (log && !log->file) ? log->len : 0;
+    return (log && !log->file) ? log->data : NULL;
+}
+
+/* ========================================================================
+ * SIMULATION RECORDS
+ * ======================================================================== */
+
+void neg_event_log_set_digest_interval(NegEventLog* log, uint32_t interval) {
+    if (log) log->digest_interval = interval;
+}
+
+int neg_event_state_digest(void* sim, uint8_t digest[NEG_EVENT_HASH_BYTES]) {
+    size_t size = state_get_binary_size(sim);
+    uint8_t* buffer = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, size ? size : 1);
+    if (!buffer) return NEG_EVENT_NO_MEMORY;
+    size_t written = state_to_binary(sim, buffer, size);
+    sha256(buffer, written, digest);
+    neg_mem_free(buffer);
+    return NEG_EVENT_OK;
+}
+
+void neg_event_log_set_keyframe_interval(NegEventLog* log, uint32_t interval) {
+    if (log) log->keyframe_interval = interval;
+}
+
+uint32_t neg_event_log_keyframe_interval(const NegEventLog* log) {
+    return log ? log->keyframe_interval : 0;
+}
+
+static uint64_t sim_time_us(void* sim) {
+    SimulationState view;
+    return state_get_view_unhashed(sim, &view) ? view.timestamp : 0;
+}
+
+int neg_event_log_record(NegEventLog* log, void* sim, uint32_t type,
+                         const void* payload, uint32_t payload_len) {
+    return neg_event_log_append(log, type, state_get_step_count(sim), sim_time_us(sim),
+                                payload, payload_len);
+}
+
+int neg_event_log_record_step(NegEventLog* log, void* sim, float dt, int ok) {
+    if (!log) return NEG_EVENT_IO_ERROR;
+
+    uint32_t dt_bits;
+    memcpy(&dt_bits, &dt, sizeof(dt_bits));
+    uint8_t payload[8];
+    put_u32(payload, dt_bits);
+    put_u32(payload + 4, ok ? 1u : 0u);
+
+    int rc = neg_event_log_record(log, sim, NEG_EVENT_STEP, payload, sizeof(payload));
+    uint64_t step = state_get_step_count(sim);
+    if (rc == NEG_EVENT_OK && log->digest_interval && step % log->digest_interval == 0) {
+        uint8_t digest[NEG_EVENT_HASH_BYTES];
+        rc = neg_event_state_digest(sim, digest);
+        if (rc == NEG_EVENT_OK) {
+            rc = neg_event_log_record(log, sim, NEG_EVENT_DIGEST, digest, sizeof(digest));
+        }
+    }
+    if (rc == NEG_EVENT_OK && log->keyframe_interval && step % log->keyframe_interval == 0) {
+        rc = neg_event_log_record_keyframe(log, sim);
+    }
+    return rc;
+}
+
+int neg_event_log_record_keyframe(NegEventLog* log, void* sim) {
+    if (!log) return NEG_EVENT_IO_ERROR;
+
+    size_t size = state_get_binary_size(sim);
+    if (size > NEG_EVENT_MAX_PAYLOAD - 8) return NEG_EVENT_NO_MEMORY;
+    uint8_t* payload = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, 8 + size);
+    if (!payload) return NEG_EVENT_NO_MEMORY;
+
+    SimulationClock clock;
+    state_get_clock(sim, &clock);
+    put_u64(payload, clock.rng_state);
+    size_t written = state_to_binary(sim, payload + 8, size);
+    int rc = neg_event_log_append(log, NEG_EVENT_KEYFRAME, clock.step_count, clock.timestamp,
+                                  payload, (uint32_t)(8 + written));
+    neg_mem_free(payload);
+    return rc;
+}
+
+/* ========================================================================
+ * READING
+ * ======================================================================== */
+
+int neg_event_log_next(const uint8_t* data, size_t len, size_t* offset, NegEventRecord* out) {
+    if (!data || !offset) return NEG_EVENT_CORRUPT;
+    if (*offset >= len) return 0;
+
+    const uint8_t* p = data + *offset;
+    size_t remaining = len - *offset;
+    if (memcmp(p, NEG_EVENT_MAGIC, remaining < 4 ? remaining : 4) != 0) return NEG_EVENT_CORRUPT;
+    if (remaining < NEG_EVENT_HEADER_BYTES) return NEG_EVENT_TRUNCATED;
+
+    uint32_t payload_len = get_u32(p + 32);
+    if (payload_len > NEG_EVENT_MAX_PAYLOAD) return NEG_EVENT_CORRUPT;
+    if (remaining < NEG_EVENT_RECORD_BYTES(payload_len)) return NEG_EVENT_TRUNCATED;
+
+    if (out) {
+        out->type = get_u32(p + 4);
+        out->payload_len = payload_len;
+        out->seq = get_u64(p + 8);
+        out->step = get_u64(p + 16);
+        out->time_us = get_u64(p + 24);
+        out->prev_hash = p + 36;
+        out->payload = p + NEG_EVENT_HEADER_BYTES;
+        out->hash = p + NEG_EVENT_HEADER_BYTES + payload_len;
+    }
+    *offset += NEG_EVENT_RECORD_BYTES(payload_len);
+    return 1;
+}
+
+uint8_t* neg_event_log_load(const char* path, size_t* len, int* status) {
+    int st = NEG_EVENT_IO_ERROR;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    size_t capacity = 0;
+    FILE* f = path ? fopen(path, "rb") : NULL;
+    if (!f) goto done;
+
+    /* Read to the end rather than trust a long-sized ftell() */
+    for (;;) {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : EVENT_SEGMENT_BYTES;
+            uint8_t* grown = (uint8_t*)neg_mem_realloc(NEG_MEM_IO, data, capacity);
+            if (!grown) {
+                st = NEG_EVENT_NO_MEMORY;
+                goto done;
+            }
+            data = grown;
+        }
+        size_t n = fread(data + size, 1, capacity - size, f);
+        size += n;
+        if (size < capacity) break;
+    }
+    if (!ferror(f)) st = NEG_EVENT_OK;
+
+done:
+    if (f) fclose(f);
+    if (st != NEG_EVENT_OK) {
+        neg_mem_free(data);
+        data = NULL;
+    }
+    if (len) *len = data ? size : 0;
+    if (status) *status = st;
+    return data;
+}
+
+/* ========================================================================
+ * VERIFICATION
+ * ======================================================================== */
+
+typedef struct {
+    const uint8_t* data;
+    const size_t* offsets;          /* Start of each framed record */
+    uint64_t base_seq;              /* Sequence number of offsets[0] */
+    const uint8_t* base_prev;       /* Hash the first record links to */
+    _Atomic uint64_t first_bad;     /* Lowest failing record so far */
+} VerifyPass;
+
+static const uint8_t* record_hash(const uint8_t* record) {
+    return record + NEG_EVENT_HEADER_BYTES + get_u32(record + 32);
+}
+
+static void lower_first_bad(VerifyPass* pass, uint64_t index) {
+    uint64_t seen = atomic_load_explicit(&pass->first_bad, memory_order_relaxed);
+    while (index < seen &&
+           !atomic_compare_exchange_weak_explicit(&pass->first_bad, &seen, index,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+/* Records [begin, end): own hash, sequence number, link to the previous */
+static void verify_tile(void* ctx, size_t begin, size_t end, int slot) {
+    VerifyPass* pass = (VerifyPass*)ctx;
+    (void)slot;
+
+    for (size_t first = begin; first < end; first += EVENT_VERIFY_BATCH) {
+        if (atomic_load_explicit(&pass->first_bad, memory_order_relaxed) < first) return;
+
+        int n = end - first < EVENT_VERIFY_BATCH ? (int)(end - first) : EVENT_VERIFY_BATCH;
+        const uint8_t* msgs[EVENT_VERIFY_BATCH];
+        size_t lens[EVENT_VERIFY_BATCH];
+        uint8_t digests[EVENT_VERIFY_BATCH][SHA256_DIGEST_BYTES];
+        for (int j = 0; j < n; j++) {
+            msgs[j] = pass->data + pass->offsets[first + j];
+            lens[j] = NEG_EVENT_HEADER_BYTES + get_u32(msgs[j] + 32);
+        }
+        sha256_multi(msgs, lens, n, digests);
+
+        for (int j = 0; j < n; j++) {
+            size_t i = first + (size_t)j;
+            const uint8_t* prev = i == 0 ? pass->base_prev
+                                         : record_hash(pass->data + pass->offsets[i - 1]);
+            if (memcmp(digests[j], msgs[j] + lens[j], NEG_EVENT_HASH_BYTES) != 0 ||
+                get_u64(msgs[j] + 8) != pass->base_seq + i ||
+                memcmp(msgs[j] + 36, prev, NEG_EVENT_HASH_BYTES) != 0) {
+                lower_first_bad(pass, i);
+                return;
+            }
+        }
+    }
+}
+
+/*
+ * Pass 1 (serial): boundaries of the whole records at the start of data.
+ * Returns what ended the framing: 0 (end of data), NEG_EVENT_CORRUPT,
+ * NEG_EVENT_TRUNCATED or NEG_EVENT_NO_MEMORY.
+ */
+static int frame_records(const uint8_t* data, size_t len, size_t** offsets, size_t* capacity,
+                         size_t* count, size_t* framed_end) {
+    size_t offset = 0;
+    *count = 0;
+    *framed_end = 0;
+    for (;;) {
+        size_t at = offset;
+        int rc = data ? neg_event_log_next(data, len, &offset, NULL) : 0;
+        if (rc <= 0) return rc;
+        if (*count == *capacity) {
+            size_t grown_capacity = *capacity ? *capacity * 2 : 1024;
+            size_t* grown = (size_t*)neg_mem_realloc(NEG_MEM_IO, *offsets,
+                                                     grown_capacity * sizeof(size_t));
+            if (!grown) return NEG_EVENT_NO_MEMORY;
+            *offsets = grown;
+            *capacity = grown_capacity;
+        }
+        (*offsets)[(*count)++] = at;
+        *framed_end = offset;
+    }
+}
+
+/* Pass 2 (parallel): index of the first bad framed record, or count */
+static size_t verify_framed(const uint8_t* data, const size_t* offsets, size_t count,
+                            uint64_t base_seq, const uint8_t* base_prev,
+                            const NegPoolConfig* pool) {
+    VerifyPass pass;
+    pass.data = data;
+    pass.offsets = offsets;
+    pass.base_seq = base_seq;
+    pass.base_prev = base_prev;
+    atomic_init(&pass.first_bad, (uint64_t)count);
+    neg_pool_run(pool, count, EVENT_VERIFY_TILE, verify_tile, &pass);
+    return (size_t)atomic_load(&pass.first_bad);
+}
+
+int neg_event_log_verify(const uint8_t* data, size_t len, const NegPoolConfig* pool,
+                         NegEventVerify* out) {
+    NegEventVerify v;
+    memset(&v, 0, sizeof(v));
+    v.first_bad = -1;
+
+    size_t* offsets = NULL;
+    size_t capacity = 0;
+    size_t count;
+    size_t framed_end;
+    int status = frame_records(data, len, &offsets, &capacity, &count, &framed_end);
+    if (status == NEG_EVENT_NO_MEMORY) {
+        neg_mem_free(offsets);
+        return status;
+    }
+
+    size_t bad = verify_framed(data, offsets, count, 0, k_genesis, pool);
+    if (bad < count) {
+        status = NEG_EVENT_CORRUPT;
+        v.records = bad;
+        v.valid_bytes = offsets[bad];
+    } else {
+        v.records = count;
+        v.valid_bytes = framed_end;
+    }
+    if (status != NEG_EVENT_OK) v.first_bad = (int64_t)v.records;
+    if (v.records > 0) {
+        memcpy(v.head, record_hash(data + offsets[v.records - 1]), NEG_EVENT_HASH_BYTES);
+    }
+
+    neg_mem_free(offsets);
+    if (out) *out = v;
+    return status;
+}
+
+/*
+ * A record larger than the segment buffer, whose first `have` bytes are
+ * in buf: hash it as the rest streams through buf. On success *bytes is
+ * its size and head its hash.
+ */
+static int verify_large(FILE* f, uint8_t* buf, size_t have, size_t capacity, uint64_t seq,
+                        uint8_t head[NEG_EVENT_HASH_BYTES], size_t* bytes) {
+    if (get_u64(buf + 8) != seq || memcmp(buf + 36, head, NEG_EVENT_HASH_BYTES) != 0) {
+        return NEG_EVENT_CORRUPT;
+    }
+
+    size_t body = NEG_EVENT_HEADER_BYTES + get_u32(buf + 32);
+    size_t total = body + NEG_EVENT_HASH_BYTES;
+    uint8_t stored[NEG_EVENT_HASH_BYTES];
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+
+    size_t pos = 0;                 /* Record bytes consumed */
+    size_t n = have;
+    for (;;) {
+        size_t hashed = pos < body ? (body - pos < n ? body - pos : n) : 0;
+        if (hashed) sha256_update(&ctx, buf, hashed);
+        if (n > hashed) memcpy(stored + (pos + hashed - body), buf + hashed, n - hashed);
+        pos += n;
+        if (pos == total) break;
+
+        size_t want = total - pos < capacity ? total - pos : capacity;
+        n = fread(buf, 1, want, f);
+        if (n == 0) return ferror(f) ? NEG_EVENT_IO_ERROR : NEG_EVENT_TRUNCATED;
+    }
+
+    uint8_t digest[NEG_EVENT_HASH_BYTES];
+    sha256_final(&ctx, digest);
+    if (memcmp(digest, stored, NEG_EVENT_HASH_BYTES) != 0) return NEG_EVENT_CORRUPT;
+    memcpy(head, digest, NEG_EVENT_HASH_BYTES);
+    *bytes = total;
+    return NEG_EVENT_OK;
+}
+
+int neg_event_log_verify_file(const char* path, const NegPoolConfig* pool, NegEventVerify* out) {
+    FILE* f = path ? fopen(path, "rb") : NULL;
+    if (!f) return NEG_EVENT_IO_ERROR;
+
+    NegEventVerify v;
+    memset(&v, 0, sizeof(v));
+    v.first_bad = -1;
+
+    size_t* offsets = NULL;
+    size_t capacity = 0;
+    uint8_t* buf = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, EVENT_SEGMENT_BYTES);
+    int status = buf ? NEG_EVENT_OK : NEG_EVENT_NO_MEMORY;
+
+    /* One segment at a time: frame and verify its whole records, carry the rest */
+    size_t have = 0;
+    int eof = 0;
+    while (status == NEG_EVENT_OK) {
+        if (!eof) {
+            have += fread(buf + have, 1, EVENT_SEGMENT_BYTES - have, f);
+            if (have < EVENT_SEGMENT_BYTES) {
+                if (ferror(f)) {
+                    status = NEG_EVENT_IO_ERROR;
+                    break;
+                }
+                eof = 1;
+            }
+        }
+
+        size_t count;
+        size_t framed_end;
+        int rc = frame_records(buf, have, &offsets, &capacity, &count, &framed_end);
+        if (rc == NEG_EVENT_NO_MEMORY) {
+            status = rc;
+            break;
+        }
+        size_t bad = verify_framed(buf, offsets, count, v.records, v.head, pool);
+        if (bad < count) {
+            framed_end = offsets[bad];
+            count = bad;
+            rc = NEG_EVENT_CORRUPT;
+        }
+        if (count > 0) {
+            memcpy(v.head, record_hash(buf + offsets[count - 1]), NEG_EVENT_HASH_BYTES);
+        }
+        v.records += count;
+        v.valid_bytes += framed_end;
+
+        if (rc == NEG_EVENT_CORRUPT || (rc == NEG_EVENT_TRUNCATED && eof)) {
+            status = rc;
+        } else if (rc == NEG_EVENT_TRUNCATED && count == 0 && have == EVENT_SEGMENT_BYTES) {
+            size_t bytes = 0;
+            status = verify_large(f, buf, have, EVENT_SEGMENT_BYTES, v.records, v.head, &bytes);
+            if (status == NEG_EVENT_OK) {
+                v.records++;
+                v.valid_bytes += bytes;
+            }
+            have = 0;
+        } else if (rc == 0 && eof) {
+            break;
+        } else {
+            memmove(buf, buf + framed_end, have - framed_end);
+            have -= framed_end;
+        }
+    }
+
+    if (status != NEG_EVENT_OK && status != NEG_EVENT_IO_ERROR && status != NEG_EVENT_NO_MEMORY) {
+        v.first_bad = (int64_t)v.records;
+    }
+    fclose(f);
+    neg_mem_free(buf);
+    neg_mem_free(offsets);
+    if (out && (status == NEG_EVENT_OK || v.first_bad >= 0)) *out = v;
+    return status;
+}
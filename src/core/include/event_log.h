@@ -0,0 +1,241 @@
+/*
+ * event_log.h - Hash-Chained Binary Event Log
+ *
+ * Append-only audit trail of what drove a simulation: steps, host
+ * interventions and parameter changes, periodic state digests, and
+ * keyframes that replay.h seeks from. Each
+ * record carries the SHA-256 of the record before it and ends with its
+ * own, so editing, dropping or reordering any record breaks the chain
+ * from that point on. SHA-256 is the in-tree implementation
+ * (embedded/sha256.h); there is no external crypto dependency.
+ *
+ * Record layout (little-endian, no padding):
+ *
+ *   offset  size  field
+ *        0     4  magic "NEVT"
+ *        4     4  type (NegEventType)
+ *        8     8  seq (0, 1, 2, ... within the log)
+ *       16     8  step (simulation step count when recorded)
+ *       24     8  time_us (simulation time when recorded)
+ *       32     4  payload_len
+ *       36    32  prev_hash (hash of record seq - 1; zeros for seq 0)
+ *       68     n  payload
+ *     68+n    32  hash = SHA-256(bytes [0, 68 + n))
+ *
+ * Verification re-hashes every record and checks prev_hash links and
+ * sequence numbers. Records are independent once their boundaries are
+ * known, so after one serial pass over the headers the log is verified
+ * in tiles on the worker pool (thread_pool.h), with sha256_multi()
+ * hashing several records per SIMD pass: a long chain verifies at the
+ * speed the file can be read. Files are read and verified a fixed-size
+ * segment at a time, so memory does not grow with the length of the log.
+ *
+ * A log is written by one thread at a time (the simulation serializes
+ * its own appends; see neg_open_event_log()).
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_EVENT_LOG_H
+#define NEG_EVENT_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * FORMAT
+ * ======================================================================== */
+
+#define NEG_EVENT_MAGIC         "NEVT"
+#define NEG_EVENT_HASH_BYTES    32
+#define NEG_EVENT_HEADER_BYTES  68
+#define NEG_EVENT_MAX_PAYLOAD   (1u << 30)      /* Larger lengths are corruption */
+
+/* Record size for a payload of n bytes */
+#define NEG_EVENT_RECORD_BYTES(n) ((size_t)NEG_EVENT_HEADER_BYTES + (n) + NEG_EVENT_HASH_BYTES)
+
+typedef enum {
+    NEG_EVENT_STEP = 1,             /* payload: f32 dt, u32 ok (1: step succeeded) */
+    NEG_EVENT_INTERVENTION = 2,     /* payload: host-defined */
+    NEG_EVENT_PARAMETER = 3,        /* payload: host-defined */
+    NEG_EVENT_DIGEST = 4,           /* payload: SHA-256 of state_to_binary() */
+    NEG_EVENT_RESET = 5,            /* payload: SHA-256 of the state loaded */
+    NEG_EVENT_KEYFRAME = 6,         /* payload: u64 RNG state, state_to_binary() */
+    NEG_EVENT_HOST = 256            /* First type free for host records */
+} NegEventType;
+
+/* Status codes */
+#define NEG_EVENT_OK          0
+#define NEG_EVENT_CORRUPT    -1     /* Hash, link, sequence or framing mismatch */
+#define NEG_EVENT_TRUNCATED  -2     /* Intact records followed by a partial one */
+#define NEG_EVENT_IO_ERROR   -3
+#define NEG_EVENT_NO_MEMORY  -4
+
+/** One record, pointing into the log bytes */
+typedef struct {
+    uint32_t type;
+    uint32_t payload_len;
+    uint64_t seq;
+    uint64_t step;
+    uint64_t time_us;
+    const uint8_t* payload;
+    const uint8_t* prev_hash;       /* NEG_EVENT_HASH_BYTES */
+    const uint8_t* hash;            /* NEG_EVENT_HASH_BYTES */
+} NegEventRecord;
+
+/* ========================================================================
+ * WRITING
+ * ======================================================================== */
+
+typedef struct NegEventLog NegEventLog;
+
+/** In-memory log (bytes via neg_event_log_data()) */
+NegEventLog* neg_event_log_create(void);
+
+/**
+ * Append to a log file, creating it if missing.
+ *
+ * An existing file is verified first and the chain continues from its
+ * last record; a damaged file is not appended to.
+ *
+ * @param status [OUT] NEG_EVENT_* (may be NULL)
+ * @return Log, or NULL (see *status)
+ */
+NegEventLog* neg_event_log_open(const char* path, const NegPoolConfig* pool, int* status);
+
+/** Flush and release (NULL is ignored) */
+void neg_event_log_close(NegEventLog* log);
+
+/**
+ * Append one record. A file gets the whole record in one write; if that
+ * (or a flush) fails, the file may end in a torn record, so the log
+ * refuses every later append and flush with NEG_EVENT_IO_ERROR rather
+ * than chain records after it.
+ *
+ * @return NEG_EVENT_OK, NEG_EVENT_IO_ERROR, NEG_EVENT_NO_MEMORY, or
+ *         NEG_EVENT_CORRUPT if payload_len exceeds NEG_EVENT_MAX_PAYLOAD
+ */
+int neg_event_log_append(NegEventLog* log, uint32_t type, uint64_t step, uint64_t time_us,
+                         const void* payload, uint32_t payload_len);
+
+/** Push buffered records to the file (no-op in memory) */
+int neg_event_log_flush(NegEventLog* log);
+
+/** Records in the log, including those there before it was opened */
+uint64_t neg_event_log_count(const NegEventLog* log);
+
+/** Hash of the last record (zeros for an empty log) */
+void neg_event_log_head(const NegEventLog* log, uint8_t hash[NEG_EVENT_HASH_BYTES]);
+
+/** Bytes of an in-memory log (NULL for file logs) */
+const uint8_t* neg_event_log_data(const NegEventLog* log, size_t* len);
+
+/* ========================================================================
+ * SIMULATION RECORDS
+ * ======================================================================== */
+
+/**
+ * Write a DIGEST record every interval steps (0: never). Applies to
+ * neg_event_log_record_step().
+ */
+void neg_event_log_set_digest_interval(NegEventLog* log, uint32_t interval);
+
+/**
+ * Write a KEYFRAME record every interval steps (0: never). Applies to
+ * neg_event_log_record_step(); seeks replay at most this many steps.
+ */
+void neg_event_log_set_keyframe_interval(NegEventLog* log, uint32_t interval);
+
+/** Keyframe interval in effect (0: none) */
+uint32_t neg_event_log_keyframe_interval(const NegEventLog* log);
+
+/**
+ * Record one simulation step just taken: a STEP record, then DIGEST and
+ * KEYFRAME records when the step count reaches a multiple of their
+ * intervals.
+ *
+ * @param dt Timestep as passed to state_step() (0: config default)
+ */
+int neg_event_log_record_step(NegEventLog* log, void* sim, float dt, int ok);
+
+/**
+ * Snapshot the simulation into a KEYFRAME record. The record's step and
+ * time_us fields carry the exact clock; the payload the RNG state and
+ * the serialized state.
+ *
+ * @return NEG_EVENT_OK, NEG_EVENT_NO_MEMORY or NEG_EVENT_IO_ERROR
+ */
+int neg_event_log_record_keyframe(NegEventLog* log, void* sim);
+
+/** Append a record stamped with the simulation's current step and time */
+int neg_event_log_record(NegEventLog* log, void* sim, uint32_t type,
+                         const void* payload, uint32_t payload_len);
+
+/**
+ * SHA-256 of the simulation's serialized state (state_to_binary()).
+ *
+ * @return NEG_EVENT_OK or NEG_EVENT_NO_MEMORY
+ */
+int neg_event_state_digest(void* sim, uint8_t digest[NEG_EVENT_HASH_BYTES]);
+
+/* ========================================================================
+ * READING AND VERIFICATION
+ * ======================================================================== */
+
+/**
+ * Parse the record at *offset and advance past it. Checks framing only;
+ * neg_event_log_verify() checks hashes.
+ *
+ * @return 1 with *out filled, 0 at the end of the data, or
+ *         NEG_EVENT_CORRUPT / NEG_EVENT_TRUNCATED
+ */
+int neg_event_log_next(const uint8_t* data, size_t len, size_t* offset, NegEventRecord* out);
+
+typedef struct {
+    uint64_t records;               /* Records in the intact prefix */
+    int64_t first_bad;              /* Index of the first bad record, -1 if none */
+    size_t valid_bytes;             /* Bytes of the intact prefix */
+    uint8_t head[NEG_EVENT_HASH_BYTES];  /* Hash of the last intact record */
+} NegEventVerify;
+
+/**
+ * Verify a whole log in parallel.
+ *
+ * @param pool Threads / tile size (tile: records, default 4096; NULL: serial)
+ * @param out [OUT] Intact prefix and first bad record (may be NULL)
+ * @return NEG_EVENT_OK, NEG_EVENT_CORRUPT, NEG_EVENT_TRUNCATED or
+ *         NEG_EVENT_NO_MEMORY
+ */
+int neg_event_log_verify(const uint8_t* data, size_t len, const NegPoolConfig* pool,
+                         NegEventVerify* out);
+
+/**
+ * Read a whole log file into memory (for tools and tests; verification
+ * and replay of files do not need it).
+ *
+ * @return Bytes (release with neg_mem_free()), or NULL with *status set
+ */
+uint8_t* neg_event_log_load(const char* path, size_t* len, int* status);
+
+/**
+ * neg_event_log_verify() on a file, streamed in segments: each is framed
+ * and verified in parallel, and the chain carries over to the next. A
+ * record larger than a segment (a big keyframe) is hashed as it streams
+ * past.
+ *
+ * @return As neg_event_log_verify(), or NEG_EVENT_IO_ERROR if unreadable
+ */
+int neg_event_log_verify_file(const char* path, const NegPoolConfig* pool, NegEventVerify* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_EVENT_LOG_H */
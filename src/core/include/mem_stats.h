@@ -0,0 +1,163 @@
+/*
+ * mem_stats.h - Memory Accounting by Subsystem
+ *
+ * Process-wide byte and call counts for the heap the core allocates (state
+ * blocks, octree nodes, trace rings, snapshot scratch) and the fixed
+ * footprint it keeps in static storage (solver scratch arrays, workspace
+ * slabs, LUTs), so hosts can size containers and spot leaks from a poll.
+ *
+ * Heap:
+ *   void* p = neg_mem_calloc(NEG_MEM_OCTREE, 1, sizeof(OctreeNode));
+ *   ...
+ *   neg_mem_free(p);
+ *
+ * Each block carries a small header (16 bytes on x86-64) recording its size
+ * and subsystem, so neg_mem_free() needs only the pointer. Counters are
+ * relaxed atomics: an allocation costs two atomic adds plus a peak update.
+ *
+ * Static storage is registered once by the module that owns it:
+ *   neg_mem_register_static(NEG_MEM_SOLVER, "richards_scratch", bytes);
+ * Registration is idempotent per name and only covers modules that have
+ * been initialized.
+ *
+ * Large blocks that workers fill in parallel (field storage) can be
+ * page-mapped instead:
+ *   void* p = neg_mem_map(NEG_MEM_STATE, bytes);   zeroed, untouched
+ *   ... each worker writes its own slice first ...
+ *   neg_mem_locality(p, NULL);                      record NUMA placement
+ *   neg_mem_free(p);
+ * Mappings are aligned to NEG_MEM_HUGE_PAGE and advised for transparent
+ * huge pages when at least that large. Apart from the block header's, no
+ * page is touched before the caller writes it, so under Linux's
+ * first-touch policy each page lands on the NUMA node of the thread that
+ * writes it first. Without mmap
+ * (Windows, Emscripten) neg_mem_map() is neg_mem_calloc().
+ *
+ * neg_mem_report() reads a fixed number of counters (no allocation, no
+ * lock) and is cheap enough to poll every second.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_MEM_STATS_H
+#define NEG_MEM_STATS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * SUBSYSTEMS
+ * ======================================================================== */
+
+typedef enum {
+    NEG_MEM_STATE = 0,      /* SimulationInternal + poses + scalar fields, rollback */
+    NEG_MEM_OCTREE,         /* Sparse octree nodes and active-cell lists */
+    NEG_MEM_INTEGRATOR,     /* Integrator / Clebsch workspace slabs */
+    NEG_MEM_SOLVER,         /* Solver scratch buffers */
+    NEG_MEM_LUT,            /* Lookup tables */
+    NEG_MEM_IO,             /* Hash / snapshot scratch */
+    NEG_MEM_DIAGNOSTICS,    /* Trace rings and dump scratch */
+    NEG_MEM_SUBSYSTEM_COUNT
+} NegMemSubsystem;
+
+/* Static registrations kept (later ones are ignored) */
+#define NEG_MEM_MAX_STATIC 32
+
+/* NUMA nodes tracked by the locality report (higher nodes count as the last) */
+#define NEG_MEM_MAX_NODES 8
+
+/* Transparent huge page size assumed for alignment and first-touch tiles */
+#define NEG_MEM_HUGE_PAGE ((size_t)2 << 20)
+
+/* ========================================================================
+ * ALLOCATION
+ * ======================================================================== */
+
+void* neg_mem_malloc(NegMemSubsystem sub, size_t size);
+void* neg_mem_calloc(NegMemSubsystem sub, size_t count, size_t size);
+
+/**
+ * Resize a block from neg_mem_malloc/calloc (NULL allocates). The block
+ * stays charged to the subsystem it was allocated under. Mapped blocks
+ * cannot be resized (returns NULL, block unchanged).
+ */
+void* neg_mem_realloc(NegMemSubsystem sub, void* ptr, size_t size);
+
+/**
+ * Allocate a zeroed, page-mapped block whose pages are placed by their
+ * first writer (see above).
+ */
+void* neg_mem_map(NegMemSubsystem sub, size_t size);
+
+/**
+ * Record where the pages of a mapped block reside, replacing its previous
+ * contribution to the report's node_bytes.
+ *
+ * @param node_bytes [OUT] Resident bytes per node, or NULL
+ * @return Nodes seen (highest node + 1), 0 if the placement cannot be
+ *         queried (no NUMA support, not a mapped block)
+ */
+int neg_mem_locality(void* ptr, uint64_t node_bytes[NEG_MEM_MAX_NODES]);
+
+/** Free a block from neg_mem_malloc/calloc/realloc/map (NULL is ignored) */
+void neg_mem_free(void* ptr);
+
+/**
+ * Record static storage owned by a module.
+ *
+ * @param name String literal identifying the storage (dedup key)
+ */
+void neg_mem_register_static(NegMemSubsystem sub, const char* name, size_t bytes);
+
+/* ========================================================================
+ * REPORTING
+ * ======================================================================== */
+
+typedef struct {
+    uint64_t current_bytes;     /* Live heap bytes */
+    uint64_t peak_bytes;        /* High-water mark of current_bytes */
+    uint64_t static_bytes;      /* Registered static storage */
+    uint64_t allocs;            /* Blocks allocated (resizes not counted) */
+    uint64_t frees;             /* Blocks released; allocs - frees = live blocks */
+    uint64_t mapped_bytes;      /* Part of current_bytes in neg_mem_map() blocks */
+} NegMemStats;
+
+typedef struct {
+    NegMemStats total;          /* Whole process; peak is the peak of the sum */
+    NegMemStats subsystems[NEG_MEM_SUBSYSTEM_COUNT];
+    uint64_t node_bytes[NEG_MEM_MAX_NODES];  /* Mapped bytes resident per NUMA node,
+                                              * as of each block's neg_mem_locality() */
+} NegMemReport;
+
+/** Snapshot all counters */
+void neg_mem_report(NegMemReport* report);
+
+/** Subsystem name ("state", "octree", ...) */
+const char* neg_mem_subsystem_name(NegMemSubsystem sub);
+
+/**
+ * Write the report as JSON:
+ *
+ *   {"current_bytes":..,"peak_bytes":..,"static_bytes":..,"allocs":..,"frees":..,
+ *    "mapped_bytes":..,"numa_nodes":[..],
+ *    "subsystems":{"state":{...},"octree":{...},...}}
+ *
+ * numa_nodes lists node_bytes up to the highest node holding any ([0]
+ * when nothing was recorded).
+ *
+ * @return Bytes written (excluding the terminator), or -1 if the buffer is
+ *         too small
+ */
+int neg_mem_report_json(char* buffer, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_MEM_STATS_H */
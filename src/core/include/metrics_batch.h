@@ -0,0 +1,143 @@
+/*
+ * metrics_batch.h - Batched SE(3) Double-and-Scale Metrics
+ *
+ * C engine behind compute_batch_metrics() (src/core/metrics_service.py):
+ * encodes packed trajectories as SE(3) poses, finds the scaling factor λ
+ * minimising the doubled return error ||G_λ² - I||, and optionally runs
+ * resonance detection and the verification cascade, for thousands of
+ * trajectories across a pool of worker threads.
+ *
+ * Each step mirrors the Python reference in the same order with the same
+ * constants:
+ *   - rotation-vector / matrix conversions follow scipy Rotation (Taylor
+ *     branches below 1e-3 rad, Markley's matrix-to-quaternion choice,
+ *     polar factor for matrices that are not orthogonal to 1e-12)
+ *   - the λ search is a port of scipy's bounded Brent minimiser
+ *     (xatol 1e-5, 500 evaluations), with identical branch structure
+ *   - sums and means use NumPy's pairwise summation order
+ *   - bounds are checked wherever SE3Trajectory would assert, so
+ *     trajectories the Python path rejects fail here with the same value
+ *
+ * Tolerance against the Python path: 3x3 products and norms accumulate
+ * with fused multiply-adds in the order of OpenBLAS's small-size kernels,
+ * so with NumPy's bundled OpenBLAS λ and the return error are normally
+ * bit-identical. Other BLAS builds round differently: relative 1e-12 on
+ * the return error, λ within xatol. Noise-robustness trials use a
+ * per-trajectory xorshift64* stream (src/core/include/rng.h) instead of
+ * numpy.random: the "stochastic" level and the verification score agree
+ * in distribution, not value, and are independent of the worker count.
+ *
+ * Usage:
+ *   NegMetricsOptions opt;
+ *   neg_metrics_options_default(&opt);
+ *   neg_metrics_batch(poses, offsets, count, NEG_POSE_ROTVEC, &opt, results, 0);
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_METRICS_BATCH_H
+#define NEG_METRICS_BATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * INPUT
+ * ======================================================================== */
+
+/** Packed pose layout (doubles per pose) */
+typedef enum {
+    NEG_POSE_ROTVEC = 0,        /* rotation vector (3), translation (3) */
+    NEG_POSE_MATRIX = 1,        /* rotation matrix row-major (9), translation (3) */
+    NEG_POSE_TIMESERIES = 2     /* orientation (3), position (3); encoded as
+                                 * increments, first pose at the origin frame */
+} NegPoseFormat;
+
+/** Verification cascade levels (VerificationCascade.verify_regeneration) */
+typedef enum {
+    NEG_VERIFY_TOPOLOGICAL = 0,
+    NEG_VERIFY_ENERGETIC,
+    NEG_VERIFY_TEMPORAL,
+    NEG_VERIFY_SPATIAL,
+    NEG_VERIFY_STOCHASTIC,
+    NEG_VERIFY_COUNT
+} NegVerifyLevel;
+
+/** Natural resonances tested by ResonanceDetector */
+#define NEG_RESONANCE_COUNT 7
+
+typedef struct {
+    double lambda_lo;           /* λ search bounds (0.1, 2.0) */
+    double lambda_hi;
+    double r_max;               /* Translation bound (1.0) */
+    int bounded;                /* Enforce |p| <= r_max (1) */
+    int resonance;              /* Resonance detection (1) */
+    int verification;           /* Verification cascade (1) */
+    int noise_trials;           /* Noise robustness trials (10) */
+    double noise_level;         /* Noise standard deviation (0.05) */
+    uint64_t seed;              /* Noise stream seed; trajectory i uses its own stream */
+} NegMetricsOptions;
+
+/** Defaults of compute_regenerative_metrics() */
+void neg_metrics_options_default(NegMetricsOptions* opt);
+
+/* ========================================================================
+ * OUTPUT
+ * ======================================================================== */
+
+typedef enum {
+    NEG_METRICS_OK = 0,
+    NEG_METRICS_OUT_OF_BOUNDS,  /* A (scaled) translation norm exceeded r_max */
+    NEG_METRICS_BAD_DETERMINANT,/* Input rotation determinant not 1 */
+    NEG_METRICS_NOT_ORTHOGONAL, /* Input rotation not orthogonal */
+    NEG_METRICS_EMPTY           /* No poses and the cascade divides by length */
+} NegMetricsStatus;
+
+typedef struct {
+    double optimal_lambda;
+    double return_error;        /* ε at optimal_lambda */
+    double verification_score;  /* Weighted cascade score, 0 when disabled */
+    double confidence;
+    double verifications[NEG_VERIFY_COUNT];  /* Raw level values */
+    double fail_value;          /* Offending norm / determinant when status != OK */
+    int32_t status;             /* NegMetricsStatus */
+    int32_t success;            /* λ search converged */
+    int32_t nfev;               /* Cost evaluations of the λ search */
+    int32_t resonance;          /* Index for neg_metrics_resonance_name(), -1 if none */
+} NegMetricsResult;
+
+/** "golden_ratio", "silver_ratio", ... (NULL when out of range) */
+const char* neg_metrics_resonance_name(int index);
+
+/* ========================================================================
+ * BATCH
+ * ======================================================================== */
+
+/**
+ * Compute metrics for count trajectories.
+ *
+ * Trajectory i is poses[offsets[i] .. offsets[i + 1]) in units of poses;
+ * a pose is 6 or 12 doubles depending on format. Trajectories are handed
+ * to workers one at a time (their lengths vary), and every result depends
+ * only on its own trajectory, so output is the same for any worker count.
+ *
+ * @param workers Threads to use, including the caller (<= 0: online CPUs),
+ *                taken from the process-wide pool (thread_pool.h)
+ * @return 0 on success (per-trajectory failures are in results[i].status),
+ *         -1 on invalid arguments or allocation failure
+ */
+int neg_metrics_batch(const double* poses, const int64_t* offsets, size_t count,
+                      NegPoseFormat format, const NegMetricsOptions* opt,
+                      NegMetricsResult* results, int workers);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_METRICS_BATCH_H */
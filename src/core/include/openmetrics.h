@@ -0,0 +1,61 @@
+/*
+ * openmetrics.h - OpenMetrics Text Exposition of Runtime Metrics
+ *
+ * Renders the core's runtime counters in the OpenMetrics text format
+ * (the Prometheus exposition format, terminated by "# EOF"), so any
+ * local HTTP shim can serve it on /metrics without parsing JSON:
+ *
+ *   negentropic_steps_total                      counter
+ *   negentropic_step_seconds{le}                 histogram (whole step)
+ *   negentropic_phase_seconds{phase,le}          histogram (per solver phase)
+ *   negentropic_lod_escalations_total            counter (process-wide)
+ *   negentropic_cfl_substeps_total               counter (process-wide)
+ *   negentropic_memory_bytes{subsystem}          gauge
+ *   negentropic_memory_peak_bytes{subsystem}     gauge
+ *   negentropic_memory_static_bytes{subsystem}   gauge
+ *   negentropic_memory_allocs_total{subsystem}   counter
+ *   negentropic_memory_frees_total{subsystem}    counter
+ *   negentropic_memory_mapped_bytes{subsystem}   gauge
+ *   negentropic_memory_node_bytes{node}          gauge (mapped bytes per NUMA node)
+ *   negentropic_errors_total                     counter
+ *   negentropic_error_flag{flag}                 gauge (0/1)
+ *
+ * Everything is read from counters already maintained by the step: no
+ * allocation, no state hashing, one pass of snprintf into the caller's
+ * buffer. The output never exceeds NEG_OPENMETRICS_MAX_SIZE.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_OPENMETRICS_H
+#define NEG_OPENMETRICS_H
+
+#include <stddef.h>
+#include "phase_timers.h"
+#include "neg_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Buffer size that always fits the exposition (including the terminator) */
+#define NEG_OPENMETRICS_MAX_SIZE 32768
+
+/**
+ * Write the exposition.
+ *
+ * @param timers Phase timers of the simulation (steps and histograms)
+ * @param flags Error flags of the simulation
+ * @return Bytes written (excluding the terminator), or -1 if the buffer is
+ *         too small
+ */
+int neg_openmetrics_text(const NegPhaseTimers* timers, const NegErrorFlags* flags,
+                         char* buffer, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_OPENMETRICS_H */
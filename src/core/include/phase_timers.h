@@ -0,0 +1,217 @@
+/*
+ * phase_timers.h - Per-Phase Step Timers
+ *
+ * Low-overhead wall-clock timers for the solver phases of a simulation
+ * step, so a production build can report which solver blew the frame
+ * budget without attaching a profiler.
+ *
+ * Usage (one NegPhaseTimers per simulation, single-threaded):
+ *
+ *   uint64_t t0 = neg_phase_start(timers);
+ *   solve_vertical(...);
+ *   neg_phase_stop(timers, NEG_PHASE_VERTICAL_SOLVE, t0);
+ *   ...
+ *   neg_phase_end_step(timers);
+ *
+ * Time accumulates per phase until neg_phase_end_step() closes the step
+ * and pushes it into a rolling window of the last NEG_PHASE_WINDOW steps
+ * and into cumulative per-phase histograms (for scraping, see
+ * openmetrics.h). Work done between steps (hash, snapshot) is charged to
+ * the next step.
+ *
+ * Event counters (LoD escalations, CFL substeps) are process-wide, like
+ * the memory counters: solvers that count them have no simulation handle.
+ *
+ * Clock: clock_gettime(CLOCK_MONOTONIC_RAW) where available (vDSO, no
+ * syscall, unaffected by NTP slewing), else CLOCK_MONOTONIC. A start/stop
+ * pair costs ~40 ns; phases are timed once per step, never per cell.
+ *
+ * Build with -DNEG_PHASE_TIMERS=0 to compile the timers out.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_PHASE_TIMERS_H
+#define NEG_PHASE_TIMERS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef NEG_PHASE_TIMERS
+#define NEG_PHASE_TIMERS 1
+#endif
+
+/* ========================================================================
+ * PHASES
+ * ======================================================================== */
+
+typedef enum {
+    NEG_PHASE_VERTICAL_SOLVE = 0,   /* HYD: implicit column solves */
+    NEG_PHASE_SURFACE_FLOW,         /* HYD: explicit surface substeps */
+    NEG_PHASE_ATMOSPHERE,           /* ATM: biotic pump */
+    NEG_PHASE_REGENERATION,         /* REG: vegetation/SOM cascade */
+    NEG_PHASE_LOD_DISPATCH,         /* Level-of-detail / region dispatch */
+    NEG_PHASE_HASH,                 /* State hashing */
+    NEG_PHASE_SNAPSHOT,             /* Binary save / restore */
+    NEG_PHASE_COUNT
+} NegPhase;
+
+/* Steps kept for the rolling mean / max */
+#define NEG_PHASE_WINDOW 64
+
+/* Histogram buckets: 10 us .. 100 ms upper bounds, then +Inf */
+#define NEG_PHASE_HIST_BUCKETS 14
+
+/**
+ * Phase timers of one simulation. All times in nanoseconds.
+ */
+typedef struct {
+    uint64_t current[NEG_PHASE_COUNT];      /* Step in progress */
+    uint32_t current_calls[NEG_PHASE_COUNT];/* Timed sections in the step in progress */
+    uint64_t last[NEG_PHASE_COUNT];         /* Last completed step */
+    uint32_t last_calls[NEG_PHASE_COUNT];
+    uint64_t last_step_ns;                  /* Wall time of the last completed step */
+
+    uint64_t window[NEG_PHASE_WINDOW][NEG_PHASE_COUNT];
+    uint64_t window_step_ns[NEG_PHASE_WINDOW];
+    uint32_t window_head;                   /* Next slot to overwrite */
+    uint32_t window_fill;                   /* Valid slots (<= NEG_PHASE_WINDOW) */
+
+    /* Cumulative since init; index NEG_PHASE_COUNT is the whole step. A
+     * phase is observed once per step in which it ran. */
+    uint64_t hist[NEG_PHASE_COUNT + 1][NEG_PHASE_HIST_BUCKETS];  /* Per bucket, not cumulative */
+    uint64_t hist_sum_ns[NEG_PHASE_COUNT + 1];
+    uint64_t hist_count[NEG_PHASE_COUNT + 1];
+
+    uint64_t step_start;                    /* neg_phase_begin_step() timestamp */
+    uint64_t steps;                         /* Completed steps */
+} NegPhaseTimers;
+
+/**
+ * Rolling-window summary of one phase (or of the whole step).
+ */
+typedef struct {
+    uint64_t last_ns;
+    uint64_t mean_ns;
+    uint64_t max_ns;
+} NegPhaseStats;
+
+/* ========================================================================
+ * RECORDING
+ * ======================================================================== */
+
+/**
+ * Monotonic clock in nanoseconds (0 when timers are compiled out).
+ */
+uint64_t neg_phase_now(void);
+
+/**
+ * Reset all timers.
+ */
+void neg_phase_timers_init(NegPhaseTimers* t);
+
+/**
+ * Start timing a section.
+ *
+ * @param t Timers, or NULL to disable timing at this call site
+ * @return Start timestamp to pass to neg_phase_stop()
+ */
+static inline uint64_t neg_phase_start(const NegPhaseTimers* t) {
+#if NEG_PHASE_TIMERS
+    return t ? neg_phase_now() : 0;
+#else
+    (void)t;
+    return 0;
+#endif
+}
+
+/**
+ * Charge the time since neg_phase_start() to a phase of the current step.
+ */
+static inline void neg_phase_stop(NegPhaseTimers* t, NegPhase phase, uint64_t start) {
+#if NEG_PHASE_TIMERS
+    if (!t) return;
+    t->current[phase] += neg_phase_now() - start;
+    t->current_calls[phase]++;
+#else
+    (void)t;
+    (void)phase;
+    (void)start;
+#endif
+}
+
+/**
+ * Mark the start of a simulation step (for the step wall time).
+ */
+void neg_phase_begin_step(NegPhaseTimers* t);
+
+/**
+ * Close the current step: publish it as "last", push it into the
+ * rolling window and start accumulating the next step.
+ */
+void neg_phase_end_step(NegPhaseTimers* t);
+
+/* ========================================================================
+ * EVENT COUNTERS (process-wide)
+ * ======================================================================== */
+
+typedef enum {
+    NEG_COUNTER_LOD_ESCALATIONS = 0,    /* Cells retried with a higher-order integrator */
+    NEG_COUNTER_CFL_SUBSTEPS,           /* HYD explicit surface substeps */
+    NEG_COUNTER_COUNT
+} NegCounter;
+
+/** Add to a counter (relaxed atomic; safe from any thread) */
+void neg_counter_add(NegCounter counter, uint64_t n);
+
+/** Current value (0 for an unknown counter) */
+uint64_t neg_counter_get(NegCounter counter);
+
+/** Short snake_case name ("lod_escalations", ...) */
+const char* neg_counter_name(NegCounter counter);
+
+/* ========================================================================
+ * REPORTING
+ * ======================================================================== */
+
+/**
+ * Short snake_case name of a phase ("vertical_solve", ...).
+ */
+const char* neg_phase_name(NegPhase phase);
+
+/**
+ * Last / rolling mean / rolling max of one phase.
+ *
+ * @param phase Phase, or NEG_PHASE_COUNT for the whole step
+ */
+NegPhaseStats neg_phase_stats(const NegPhaseTimers* t, NegPhase phase);
+
+/**
+ * Upper bound of a histogram bucket in nanoseconds (UINT64_MAX for the
+ * last, +Inf, bucket).
+ */
+uint64_t neg_phase_hist_bound_ns(int bucket);
+
+/**
+ * Write the timers as a JSON object:
+ *
+ *   {"window":64,"steps":N,
+ *    "step":{"last_ns":..,"mean_ns":..,"max_ns":..},
+ *    "phases":{"vertical_solve":{"last_ns":..,"mean_ns":..,"max_ns":..,"calls":..},...}}
+ *
+ * @return Bytes written (excluding the terminator), or -1 if the buffer is
+ *         too small
+ */
+int neg_phase_timers_json(const NegPhaseTimers* t, char* buffer, size_t max_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_PHASE_TIMERS_H */
@@ -56,6 +56,21 @@
     #define NEG_INLINE static inline
 #endif
 
+/* ========================================================================
+ * THREAD-LOCAL STORAGE
+ * ======================================================================== */
+
+/* include/fixed_saturate.h carries the same definition */
+#ifndef NEG_THREAD_LOCAL
+#if defined(__GNUC__) || defined(__clang__)
+    #define NEG_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+    #define NEG_THREAD_LOCAL __declspec(thread)
+#else
+    #define NEG_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
 /* ========================================================================
  * RESTRICT KEYWORD
  * ======================================================================== */
@@ -0,0 +1,111 @@
+/*
+ * replay.h - Keyframe-Accelerated Deterministic Replay
+ *
+ * Seeks a simulation to any step recorded in an event log (event_log.h)
+ * without replaying from step 0: restore the last KEYFRAME at or before
+ * the target step, then re-run the STEP records after it and hand the
+ * host's own records (interventions, parameter changes, host types) back
+ * to it in log order. Every DIGEST record passed on the way is checked
+ * against the re-simulated state, so a seek either lands on the recorded
+ * state or reports the first step where it diverged.
+ *
+ * A seek re-simulates fewer steps than the keyframe interval the log was
+ * written with, however long the run was. The log is verified and
+ * indexed once when opened; seeks only read it.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_REPLAY_H
+#define NEG_REPLAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "event_log.h"
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status codes (besides NEG_EVENT_*) */
+#define NEG_REPLAY_NO_KEYFRAME   -5     /* No keyframe at or before the step */
+#define NEG_REPLAY_OUT_OF_RANGE  -6     /* Step beyond the end of the log */
+#define NEG_REPLAY_DIVERGED      -7     /* Re-simulated state missed a digest */
+#define NEG_REPLAY_INCOMPATIBLE  -8     /* Keyframe does not fit the simulation */
+
+typedef struct NegReplay NegReplay;
+
+/**
+ * Host records met while seeking (INTERVENTION, PARAMETER and types
+ * >= NEG_EVENT_HOST). Apply them to sim as they were applied when
+ * recorded; they arrive in log order between the steps they fell
+ * between. Must not step sim. rec points into a buffer that is only
+ * valid during the call.
+ */
+typedef void (*NegReplayEventFn)(void* ctx, void* sim, const NegEventRecord* rec);
+
+/**
+ * Index a log held in memory. The bytes must stay valid and unchanged
+ * until neg_replay_close(). A torn last record (crash while writing) is
+ * ignored; any other damage is refused.
+ *
+ * @param pool Threads for the verification pass (NULL: serial)
+ * @param status [OUT] NEG_EVENT_* (may be NULL)
+ * @return Replay, or NULL (see *status)
+ */
+NegReplay* neg_replay_open(const uint8_t* data, size_t len, const NegPoolConfig* pool,
+                           int* status);
+
+/**
+ * neg_replay_open() on a log file. The file is verified in segments and
+ * only the record offsets are kept; each seek reads its keyframe and the
+ * records after it from the file, so memory stays at the index plus one
+ * keyframe however long the log. The file must not be rewritten while
+ * the replay is open (appending to it is harmless).
+ */
+NegReplay* neg_replay_open_file(const char* path, const NegPoolConfig* pool, int* status);
+
+void neg_replay_close(NegReplay* replay);
+
+/** Keyframes in the log */
+size_t neg_replay_keyframes(const NegReplay* replay);
+
+/** Earliest step a seek can reach (first keyframe's), 0 if none */
+uint64_t neg_replay_first_step(const NegReplay* replay);
+
+/** Last step recorded */
+uint64_t neg_replay_last_step(const NegReplay* replay);
+
+/** Outcome of one seek */
+typedef struct {
+    uint64_t step;                  /* Step reached */
+    uint64_t keyframe_step;         /* Step of the keyframe restored */
+    uint32_t steps_replayed;        /* Steps re-simulated from it */
+    uint32_t events;                /* Host records delivered */
+    uint32_t digests_checked;       /* DIGEST records matched on the way */
+    int64_t diverged_step;          /* First mismatching digest's step, -1 if none */
+    uint8_t digest[NEG_EVENT_HASH_BYTES];  /* SHA-256 of the state reached */
+} NegReplaySeek;
+
+/**
+ * Put sim in the state it had after step (and the host records stamped
+ * with it). sim must have the configuration the log was recorded with;
+ * it is stepped with state_step(), so nothing is appended to a log open
+ * on it.
+ *
+ * @param fn Host record handler (NULL: host records are skipped)
+ * @param out [OUT] Seek summary (may be NULL)
+ * @return NEG_EVENT_OK, NEG_REPLAY_*, NEG_EVENT_NO_MEMORY, or
+ *         NEG_EVENT_IO_ERROR (log file unreadable)
+ */
+int neg_replay_seek(NegReplay* replay, void* sim, uint64_t step,
+                    NegReplayEventFn fn, void* ctx, NegReplaySeek* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_REPLAY_H */
@@ -0,0 +1,98 @@
+/*
+ * rollback.h - In-Memory Rollback Ring of Recent States
+ *
+ * Keeps the last K states of a simulation as undo deltas so it can be
+ * wound back without re-creating and re-running it. The ring holds one
+ * shadow copy of the state as of the last capture; each capture compares
+ * the live state with it in NEG_ROLLBACK_TILE_BYTES tiles (in parallel
+ * on the worker pool, thread_pool.h) and stores the previous contents of
+ * the tiles that changed, plus the clock (SimulationClock) before the
+ * change. Rolling back n captures copies those tiles back, newest first,
+ * so it costs time proportional to what changed, not to the state size.
+ *
+ * Memory: the shadow copy plus the deltas, which are capped by a byte
+ * budget and a capture count; the oldest captures go first. Tiles
+ * unchanged for several steps are stored by none of them.
+ *
+ * Everything that changes the state between captures must be captured
+ * (the public API captures after each step, reset and seek); otherwise
+ * rolling back leaves the uncaptured changes in place.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_ROLLBACK_H
+#define NEG_ROLLBACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "thread_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NEG_ROLLBACK_TILE_BYTES 256
+
+/* Status codes */
+#define NEG_ROLLBACK_OK          0
+#define NEG_ROLLBACK_TOO_FAR    -1      /* Fewer captures held than asked for */
+#define NEG_ROLLBACK_NO_MEMORY  -2      /* History dropped */
+
+typedef struct NegRollback NegRollback;
+
+/**
+ * Start a ring for sim with its current state as the base.
+ *
+ * @param max_steps Captures kept (K >= 1)
+ * @param budget_bytes Cap on the deltas held (0: no cap besides K)
+ * @param pool Threads for the compare pass (NULL: serial)
+ * @return Ring, or NULL (out of memory or max_steps == 0)
+ */
+NegRollback* neg_rollback_create(void* sim, uint32_t max_steps, size_t budget_bytes,
+                                 const NegPoolConfig* pool);
+
+void neg_rollback_destroy(NegRollback* ring);
+
+/**
+ * Record the changes since the last capture as one undo step.
+ *
+ * A delta larger than the budget empties the ring (the steps before it
+ * could no longer be reached); the new state is still the base.
+ *
+ * @return NEG_ROLLBACK_OK, or NEG_ROLLBACK_NO_MEMORY (ring emptied)
+ */
+int neg_rollback_capture(NegRollback* ring, void* sim);
+
+/** Captures that can be rolled back */
+uint32_t neg_rollback_depth(const NegRollback* ring);
+
+/** Delta bytes held (tile contents and indices; the shadow copy excluded) */
+size_t neg_rollback_bytes(const NegRollback* ring);
+
+/**
+ * Undo the last steps captures: state and clock return to what they were
+ * before them, and the ring forgets them.
+ *
+ * @param tiles [OUT] Tiles copied back (may be NULL)
+ * @return NEG_ROLLBACK_OK, or NEG_ROLLBACK_TOO_FAR (nothing changed)
+ */
+int neg_rollback_restore(NegRollback* ring, void* sim, uint32_t steps, uint64_t* tiles);
+
+/**
+ * Throw away the changes made since the last capture: state and clock
+ * return to the last captured state. Used when an operation fails
+ * halfway through writing the state.
+ *
+ * @param tiles [OUT] Tiles copied back (may be NULL)
+ * @return NEG_ROLLBACK_OK
+ */
+int neg_rollback_discard(NegRollback* ring, void* sim, uint64_t* tiles);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_ROLLBACK_H */
@@ -0,0 +1,144 @@
+/*
+ * state_shm.h - Shared-Memory State Publication (POSIX shm)
+ *
+ * Native counterpart of the web SharedArrayBuffer pipeline
+ * (web/src/workers/core-worker.ts): the simulation thread publishes each
+ * frame (a neg_get_state_binary() blob) into a POSIX shared-memory
+ * segment, and any number of local processes map it read-only and copy
+ * out consistent frames without involving the simulation thread.
+ *
+ * Segment layout (native byte order):
+ *
+ *   [0, 128)                   NegShmHeader (same 128-byte budget as the SAB header)
+ *   [128, 128 + cap)           slot A
+ *   [128 + cap, 128 + 2 cap)   slot B     (cap rounded up to 64 bytes)
+ *
+ * Frame n (n >= 1) is written into slot n & 1, so the writer never
+ * touches the slot holding the newest complete frame. Each slot carries a
+ * seqlock: its sequence is odd while the frame is being written and
+ * 2 n once frame n is complete. A reader takes the newest frame number
+ * from the header, copies that slot, and keeps the copy only if the
+ * slot's sequence was 2 n before and after; it retries only when the
+ * writer lapped it (published two frames during one copy).
+ *
+ * One writer per segment; readers never write, so a stuck or crashed
+ * reader cannot block the simulation. A restarted writer unlinks and
+ * recreates the segment: readers still mapping the old one see its frame
+ * number stop advancing and reopen.
+ *
+ * Usage:
+ *   NegShmWriter* w = neg_shm_writer_create("/negentropic", neg_get_state_binary_size(sim));
+ *   neg_publish_state(sim, w);                      // after each step
+ *
+ *   NegShmReader* r = neg_shm_reader_open("/negentropic");
+ *   int64_t n = neg_shm_read(r, buffer, sizeof(buffer), &frame);
+ *
+ * POSIX only: on Windows and Emscripten (use the SharedArrayBuffer path)
+ * create/open return NULL.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_STATE_SHM_H
+#define NEG_STATE_SHM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NEG_SHM_MAGIC        0x5347454Eu    /* "NEGS" in memory (little-endian) */
+#define NEG_SHM_LAYOUT       1u
+#define NEG_SHM_HEADER_SIZE  128u
+
+/* neg_shm_read() results besides a byte count */
+#define NEG_SHM_EMPTY      0    /* Nothing published yet */
+#define NEG_SHM_ERROR     -1    /* Bad arguments or corrupt header */
+#define NEG_SHM_TOO_SMALL -2    /* Frame larger than the caller's buffer */
+#define NEG_SHM_RETRY     -3    /* Writer kept lapping the reader; try again */
+
+/** Frame metadata, copied out together with the frame */
+typedef struct {
+    uint64_t frame;         /* Frame number, 1 for the first publish */
+    uint64_t size;          /* Bytes in the frame */
+    uint64_t state_hash;    /* neg_get_state_hash() of the published state */
+    uint64_t timestamp_ms;  /* Simulation time of the state */
+} NegShmFrame;
+
+typedef struct NegShmWriter NegShmWriter;
+typedef struct NegShmReader NegShmReader;
+
+/* ========================================================================
+ * WRITER (simulation thread)
+ * ======================================================================== */
+
+/**
+ * Create (or replace) the segment.
+ *
+ * @param name POSIX shm name, "/" followed by no further slashes
+ * @param capacity Largest frame in bytes
+ * @return Writer, or NULL (errno from shm_open/ftruncate/mmap)
+ */
+NegShmWriter* neg_shm_writer_create(const char* name, size_t capacity);
+
+/**
+ * Start frame n + 1: marks its slot as being written and returns it.
+ * Fill at most neg_shm_writer_capacity() bytes, then neg_shm_commit().
+ */
+uint8_t* neg_shm_begin(NegShmWriter* writer);
+
+/**
+ * Publish the frame started by neg_shm_begin().
+ *
+ * @return Frame number, or 0 if size exceeds the capacity or no frame
+ *         was started (nothing is published; readers keep the previous frame)
+ */
+uint64_t neg_shm_commit(NegShmWriter* writer, size_t size, uint64_t state_hash,
+                        uint64_t timestamp_ms);
+
+size_t neg_shm_writer_capacity(const NegShmWriter* writer);
+
+/**
+ * Unmap and close. The segment name stays until unlink_segment is set
+ * (or the next writer replaces it), so readers can keep the last frame.
+ */
+void neg_shm_writer_destroy(NegShmWriter* writer, int unlink_segment);
+
+/* ========================================================================
+ * READER (any local process)
+ * ======================================================================== */
+
+/**
+ * Map an existing segment read-only.
+ *
+ * @return Reader, or NULL if the segment does not exist or is not a
+ *         layout-1 state segment
+ */
+NegShmReader* neg_shm_reader_open(const char* name);
+
+/** Newest complete frame number (0: none yet); one atomic load */
+uint64_t neg_shm_latest(const NegShmReader* reader);
+
+/** Largest frame the writer can publish */
+size_t neg_shm_reader_capacity(const NegShmReader* reader);
+
+/**
+ * Copy the newest complete frame.
+ *
+ * @param frame Output metadata (optional)
+ * @return Bytes copied, or NEG_SHM_EMPTY / NEG_SHM_TOO_SMALL /
+ *         NEG_SHM_RETRY / NEG_SHM_ERROR
+ */
+int64_t neg_shm_read(NegShmReader* reader, void* buffer, size_t max_len, NegShmFrame* frame);
+
+void neg_shm_reader_close(NegShmReader* reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_STATE_SHM_H */
@@ -0,0 +1,123 @@
+/*
+ * step_async.h - Background Stepping with a Double-Buffered Published State
+ *
+ * Runs simulation steps on a worker thread owned by the simulation, so a
+ * host (render loop, web worker, server) keeps rendering, doing I/O and
+ * taking snapshots while the next physics step runs.
+ *
+ * Jobs ("n steps of dt") are queued FIFO and numbered with tickets 1, 2,
+ * ... in submission order; a ticket is complete once its steps ran. After
+ * each job the worker serializes the state (state_to_binary) into the
+ * back buffer and swaps it with the front buffer under a short lock. Readers
+ * copy from the front buffer only, so while jobs run they see the state
+ * after the last completed job, never a half-stepped one:
+ *
+ *   front: state after job k      <- neg_get_state_binary / hash / shm publish,
+ *                                    diagnostics, metrics, error flags
+ *   back:  being filled by job k+1
+ *   sim:   mutated by the worker only
+ *
+ * Failure: a job stops at its first failing step (like neg_step_n()); the
+ * jobs queued behind it are dropped and complete with the same error, and
+ * the published state is the one after the failing step.
+ *
+ * Threads: one host thread submits and waits; any thread may read the
+ * published state. Without threads (Windows, Emscripten without pthreads)
+ * step_async_submit() runs the job inline and returns a completed ticket.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_STEP_ASYNC_H
+#define NEG_STEP_ASYNC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "phase_timers.h"
+#include "neg_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Jobs that can wait behind the running one */
+#define NEG_ASYNC_QUEUE 64
+
+/* step_async_submit() / _poll() / _wait() results besides tickets */
+#define NEG_ASYNC_PENDING     0     /* Poll: ticket not complete yet */
+#define NEG_ASYNC_DONE        1     /* Poll: ticket complete */
+#define NEG_ASYNC_FAILED     -1     /* Ticket's job (or one ahead of it) failed */
+#define NEG_ASYNC_QUEUE_FULL -2     /* Submit: NEG_ASYNC_QUEUE jobs already waiting */
+#define NEG_ASYNC_BAD_TICKET -3     /* Ticket never issued */
+
+typedef struct NegStepAsync NegStepAsync;
+
+/* Published state, as of the last completed job */
+typedef struct {
+    size_t size;                    /* Binary state bytes */
+    uint64_t hash;                  /* neg_get_state_hash() of that state */
+    uint64_t timestamp;             /* Simulation time (microseconds) */
+    uint32_t num_entities;
+    uint32_t num_scalar_values;
+
+    /* Bookkeeping outside the binary state, copied with it */
+    uint64_t step_count;
+    uint32_t rollback_depth;        /* neg_rollback_depth() */
+    float energy;
+    float max_error;
+    NegErrorFlags error_flags;
+    NegPhaseTimers timers;          /* ~5 KB */
+} NegAsyncFrame;
+
+/**
+ * Attach a worker to a simulation and publish its current state.
+ *
+ * @return Context, or NULL on allocation / thread creation failure
+ */
+NegStepAsync* step_async_create(void* sim);
+
+/** Wait for all jobs, stop the worker and free the buffers */
+void step_async_destroy(NegStepAsync* async);
+
+/**
+ * Queue n steps of dt (dt 0: config default).
+ *
+ * @return Ticket (>= 1), or NEG_ASYNC_QUEUE_FULL
+ */
+int64_t step_async_submit(NegStepAsync* async, float dt, uint32_t n);
+
+/** NEG_ASYNC_DONE, NEG_ASYNC_PENDING, NEG_ASYNC_FAILED or NEG_ASYNC_BAD_TICKET */
+int step_async_poll(NegStepAsync* async, int64_t ticket);
+
+/**
+ * Block until a ticket is complete (0: every ticket issued so far).
+ *
+ * @return NEG_ASYNC_DONE, NEG_ASYNC_FAILED or NEG_ASYNC_BAD_TICKET
+ */
+int step_async_wait(NegStepAsync* async, int64_t ticket);
+
+/**
+ * Re-serialize the simulation into the published state. For callers that
+ * changed the state directly (reset, synchronous step) after
+ * step_async_wait(0).
+ */
+void step_async_republish(NegStepAsync* async);
+
+/**
+ * Copy the published state.
+ *
+ * @param hash Output: its neg_get_state_hash() value (optional)
+ * @return Bytes copied, or 0 if max_len is too small
+ */
+size_t step_async_read(NegStepAsync* async, uint8_t* buffer, size_t max_len, uint64_t* hash);
+
+/** Describe the published state without copying it */
+void step_async_frame(NegStepAsync* async, NegAsyncFrame* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_STEP_ASYNC_H */
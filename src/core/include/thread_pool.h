@@ -0,0 +1,104 @@
+/*
+ * thread_pool.h - Process-Wide Worker Pool with Static Tiling
+ *
+ * One pool of worker threads per process, shared by every simulation and
+ * batch call, so an ensemble of neg_create() instances asking for 4
+ * threads each runs on 3 shared workers plus the calling threads instead
+ * of spawning 4 threads per instance.
+ *
+ * Work is a range [0, count) cut into tiles of tile_size items. Tile
+ * boundaries depend only on count and tile_size, never on the thread
+ * count, and each tile writes only outputs it owns, so results are
+ * bit-identical for any number of threads (including 1, which runs the
+ * tiles in order on the caller without touching the pool).
+ *
+ * Scheduling is static. A job with n participants splits its tiles into
+ * n contiguous blocks, one per slot: the caller runs slot 0 and pool
+ * worker w always runs slot w + 1. For the same count, tile size and
+ * thread count, every tile is therefore run by the same thread on every
+ * call, so memory first touched by a pooled pass (state_create() does
+ * this for large blocks) sits on the node of the worker that later
+ * computes on it. A worker busy with another job leaves its block to the
+ * caller, which runs any block still unclaimed after its own. An idle
+ * worker joins, among the jobs whose block for its slot is open, the one
+ * with the fewest participants.
+ *
+ * Configuration (simulation config JSON, see neg_create()):
+ *   "threads"    Participants per job including the caller
+ *                (default 1: serial; 0: online CPUs)
+ *   "tile_size"  Items per tile (default 0: the caller's default)
+ *   "pin_cpus"   Pin pool workers to CPUs round-robin (Linux only;
+ *                once any job asks, for the life of the pool)
+ *
+ * The pool grows to the largest thread count requested so far (minus
+ * the caller, at most NEG_POOL_MAX_THREADS - 1 workers) and lives until
+ * neg_pool_shutdown() or process exit. Without threads (Windows,
+ * Emscripten without pthreads) every job runs serially.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_THREAD_POOL_H
+#define NEG_THREAD_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Participants per job, caller included */
+#define NEG_POOL_MAX_THREADS 64
+
+typedef struct {
+    uint32_t threads;               /* Participants per job (0: online CPUs) */
+    uint32_t tile_size;             /* Items per tile (0: caller's default) */
+    uint8_t pin_cpus;               /* Pin pool workers to CPUs */
+} NegPoolConfig;
+
+/**
+ * Work on items [begin, end) of one tile.
+ *
+ * @param slot Block index in [0, neg_pool_slots()), unique among the
+ *             threads running this job at once (for per-thread scratch)
+ */
+typedef void (*NegPoolTileFn)(void* ctx, size_t begin, size_t end, int slot);
+
+/** Serial configuration: 1 thread, default tiles, no pinning */
+void neg_pool_config_default(NegPoolConfig* cfg);
+
+/** Participants a job with this configuration uses (NULL: 1) */
+int neg_pool_slots(const NegPoolConfig* cfg);
+
+/**
+ * Run fn over [0, count) in tiles and return when every tile is done.
+ *
+ * Fixed-point sticky bits (include/fixed_saturate.h) raised by
+ * tiles on pool workers are taken at the end of each worker's block and
+ * OR-ed into the caller's g_fixed_sticky before returning, so a clamp
+ * inside a pooled pass reaches the caller's next fixed_sticky_take()
+ * exactly as it would serially.
+ *
+ * @param cfg Threads / tile size / pinning (NULL: serial)
+ * @param default_tile Tile size when cfg->tile_size is 0 (0 counts as 1)
+ */
+void neg_pool_run(const NegPoolConfig* cfg, size_t count, size_t default_tile,
+                  NegPoolTileFn fn, void* ctx);
+
+/** Worker threads currently in the pool */
+int neg_pool_workers(void);
+
+/**
+ * Stop and join the pool's workers (the next neg_pool_run() starts new
+ * ones). No job may be running.
+ */
+void neg_pool_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_THREAD_POOL_H */
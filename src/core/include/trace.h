@@ -0,0 +1,126 @@
+/*
+ * trace.h - Step Tracing (Chrome trace-event / Perfetto JSON)
+ *
+ * Optional event tracing of the simulation step: solver phases, tiles,
+ * LoD escalations and REG cadence ticks are recorded into a per-thread
+ * ring and dumped as Chrome trace-event JSON, loadable in
+ * chrome://tracing or ui.perfetto.dev. Where the phase timers
+ * (phase_timers.h) say which solver was slow on average, a trace shows
+ * when, on which thread, and what the other threads were doing.
+ *
+ * Build with -DNEG_TRACE=1 (CMake: -DNEG_ENABLE_TRACE=ON). Without it the
+ * macros below compile to nothing and the dump returns an empty trace.
+ *
+ * Recording:
+ *   - Each thread writes only its own ring (NEG_TRACE_RING_EVENTS events,
+ *     oldest overwritten), so recording takes no lock and no atomic RMW:
+ *     two clock reads and one release store per scope (~50 ns).
+ *   - A wrapped ring dumps its newest NEG_TRACE_RING_EVENTS - 1 events;
+ *     the slot the writer may be filling is skipped.
+ *   - Scopes are stored as complete ("ph":"X") events rather than B/E
+ *     pairs, so a wrapped ring never leaves an unmatched begin.
+ *   - Names and categories must be string literals (stored by pointer).
+ *
+ * Usage:
+ *   NEG_TRACE_SCOPE_BEGIN(t0);
+ *   solve_vertical(...);
+ *   NEG_TRACE_SCOPE_END(t0, "hyd", "vertical_solve", ncols);
+ *   NEG_TRACE_INSTANT("lod", "escalate", new_method);
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef NEG_TRACE_H
+#define NEG_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef NEG_TRACE
+#define NEG_TRACE 0
+#endif
+
+/* Events per thread ring (power of two) */
+#ifndef NEG_TRACE_RING_EVENTS
+#define NEG_TRACE_RING_EVENTS 16384
+#endif
+
+/* Threads that can own a ring; later threads are not traced */
+#define NEG_TRACE_MAX_THREADS 64
+
+/* ========================================================================
+ * RECORDING
+ * ======================================================================== */
+
+/**
+ * Trace clock in nanoseconds (monotonic).
+ */
+uint64_t neg_trace_now(void);
+
+/**
+ * Record a complete event [start, now) on the calling thread's ring.
+ *
+ * @param cat Category literal ("sim", "hyd", "atm", "reg", "lod", "io")
+ * @param name Event name literal
+ * @param start neg_trace_now() at the start of the scope
+ * @param arg Free integer shown under args.n (cells, tile size, ...)
+ */
+void neg_trace_complete(const char* cat, const char* name, uint64_t start, int64_t arg);
+
+/**
+ * Record an instant event on the calling thread's ring.
+ */
+void neg_trace_instant(const char* cat, const char* name, int64_t arg);
+
+#if NEG_TRACE
+#define NEG_TRACE_SCOPE_BEGIN(var) uint64_t var = neg_trace_now()
+#define NEG_TRACE_SCOPE_END(var, cat, name, arg) \
+    neg_trace_complete((cat), (name), (var), (int64_t)(arg))
+#define NEG_TRACE_INSTANT(cat, name, arg) neg_trace_instant((cat), (name), (int64_t)(arg))
+#else
+#define NEG_TRACE_SCOPE_BEGIN(var) ((void)0)
+#define NEG_TRACE_SCOPE_END(var, cat, name, arg) ((void)0)
+#define NEG_TRACE_INSTANT(cat, name, arg) ((void)0)
+#endif
+
+/* ========================================================================
+ * DUMP
+ * ======================================================================== */
+
+/**
+ * Upper bound on the size of neg_trace_json() output for the events
+ * currently held (including the terminator).
+ */
+size_t neg_trace_json_size(void);
+
+/**
+ * Write all rings as a Chrome trace-event JSON object:
+ *
+ *   {"displayTimeUnit":"ns","traceEvents":[
+ *     {"name":"step","cat":"sim","ph":"X","ts":12.345,"dur":810.2,
+ *      "pid":1,"tid":1,"args":{"n":0}}, ...]}
+ *
+ * Timestamps are microseconds since the first traced event. Rings may be
+ * written concurrently; events overwritten during the dump are dropped.
+ *
+ * @return Bytes written (excluding the terminator), or -1 if the buffer is
+ *         too small
+ */
+int neg_trace_json(char* buffer, size_t max_len);
+
+/**
+ * Discard all recorded events (rings stay registered).
+ */
+void neg_trace_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEG_TRACE_H */
@@ -20,6 +20,7 @@
 #include "clebsch.h"
 #include "integrators.h"
 #include "workspace_slab.h"
+#include "../include/mem_stats.h"
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
@@ -80,9 +81,9 @@ int clebsch_lut_init(ClebschLUT* lut) {
 
     // Allocate LUT arrays
     lut->num_bins = CLEBSCH_LUT_SIZE;
-    lut->q_table = (double*)calloc(CLEBSCH_LUT_SIZE * 8, sizeof(double));
-    lut->p_table = (double*)calloc(CLEBSCH_LUT_SIZE * 8, sizeof(double));
-    lut->casimir_table = (double*)calloc(CLEBSCH_LUT_SIZE, sizeof(double));
+    lut->q_table = (double*)neg_mem_calloc(NEG_MEM_LUT, CLEBSCH_LUT_SIZE * 8, sizeof(double));
+    lut->p_table = (double*)neg_mem_calloc(NEG_MEM_LUT, CLEBSCH_LUT_SIZE * 8, sizeof(double));
+    lut->casimir_table = (double*)neg_mem_calloc(NEG_MEM_LUT, CLEBSCH_LUT_SIZE, sizeof(double));
 
     if (!lut->q_table || !lut->p_table || !lut->casimir_table) {
         clebsch_lut_destroy(lut);
@@ -114,9 +115,9 @@ int clebsch_lut_init(ClebschLUT* lut) {
 void clebsch_lut_destroy(ClebschLUT* lut) {
     if (!lut) return;
 
-    if (lut->q_table) free(lut->q_table);
-    if (lut->p_table) free(lut->p_table);
-    if (lut->casimir_table) free(lut->casimir_table);
+    if (lut->q_table) neg_mem_free(lut->q_table);
+    if (lut->p_table) neg_mem_free(lut->p_table);
+    if (lut->casimir_table) neg_mem_free(lut->casimir_table);
 
     memset(lut, 0, sizeof(ClebschLUT));
 }
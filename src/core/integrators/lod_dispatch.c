@@ -17,6 +17,8 @@
 
 #include "integrators.h"
 #include "../torsion/torsion.h"
+#include "../include/trace.h"
+#include "../include/phase_timers.h"
 #include <math.h>
 #include <string.h>
 
@@ -156,11 +158,11 @@ int lod_gated_step_cell(GridCell* cell, const IntegratorConfig* cfg, IntegratorW
         *cell = prev_state;
 
         integrator_e escalated_method = escalate_integrator(method);
+        NEG_TRACE_INSTANT("lod", "escalate", escalated_method);
         result = integrator_step_cell(cell, cfg, escalated_method, ws);
         if (result != 0) return result;
 
-        // Mark that escalation occurred (for statistics)
-        // TODO: Add escalation counter to workspace
+        neg_counter_add(NEG_COUNTER_LOD_ESCALATIONS, 1);
     }
 
     // Compute torsion for fine LoD levels
@@ -199,6 +201,8 @@ int lod_gated_step_tile(GridCell* cells, size_t num_cells,
                         IntegratorWorkspace* ws) {
     if (!cells || num_cells == 0 || !cfg || !ws) return -1;
 
+    NEG_TRACE_SCOPE_BEGIN(trace_tile);
+
     // Determine LoD level for tile (assume all cells have same LoD)
     int tile_lod = cells[0].lod_level;
 
@@ -241,6 +245,7 @@ int lod_gated_step_tile(GridCell* cells, size_t num_cells,
         */
     }
 
+    NEG_TRACE_SCOPE_END(trace_tile, "lod", "tile", num_cells);
     return 0;
 }
 
@@ -9,6 +9,7 @@
  */
 
 #include "workspace_slab.h"
+#include "../include/mem_stats.h"
 #include <string.h>
 #include <stdatomic.h>
 
@@ -58,6 +59,8 @@ int workspace_slab_init(void) {
     // Zero out all pools (ensures deterministic initial state)
     memset(integrator_pool, 0, sizeof(integrator_pool));
     memset(clebsch_pool, 0, sizeof(clebsch_pool));
+    neg_mem_register_static(NEG_MEM_INTEGRATOR, "integrator_slab", sizeof(integrator_pool));
+    neg_mem_register_static(NEG_MEM_INTEGRATOR, "clebsch_slab", sizeof(clebsch_pool));
 
     // Reset allocation bitmaps
     atomic_store(&integrator_bitmap, 0);
@@ -0,0 +1,299 @@
+/**
+ * barrier_field.c - SIMD Field-Level Barrier Potential Kernels
+ *
+ * One pass over contiguous x / x_min / x_max arrays computing the bounded
+ * barrier potential and gradient (see include/barrier_field.h).
+ *
+ * Float path: the scalar expressions of barrier_gradient_bounded_f() /
+ * barrier_potential_bounded_f() lane-wise; violated bounds are handled by
+ * a select instead of a branch.
+ *
+ * Q16.16 path: the integer sequence of barriers.h (saturating sub, add,
+ * div, mul) evaluated in double lanes. Sums and differences of two int32
+ * are exact; quotients are truncated after an IEEE division, which equals
+ * the int64 division because numerator and denominator are integers below
+ * 2^53; products that could exceed 2^53 are already past the INT32_MAX
+ * clamp. Overflow masks are OR-ed per lane and published once per call.
+ *
+ * Author: negentropic-core team
+ * Version: 0.4.0-alpha-genesis
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../../../include/barrier_field.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+/* ========================================================================
+ * SIMD PRIMITIVES
+ * ======================================================================== */
+
+#if defined(__AVX2__)
+
+#define BF_LANES 8
+typedef __m256 bf_vec_t;
+#define BF_LOAD(p)          _mm256_loadu_ps(p)
+#define BF_STORE(p, v)      _mm256_storeu_ps(p, v)
+#define BF_SET1(c)          _mm256_set1_ps(c)
+#define BF_ADD(a, b)        _mm256_add_ps(a, b)
+#define BF_SUB(a, b)        _mm256_sub_ps(a, b)
+#define BF_MUL(a, b)        _mm256_mul_ps(a, b)
+#define BF_DIV(a, b)        _mm256_div_ps(a, b)
+#define BF_CMPLE(a, b)      _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+#define BF_SELECT(m, a, b)  _mm256_blendv_ps(b, a, m)
+
+#define BD_LANES 4
+typedef __m256d bd_vec_t;
+#define BD_LOAD_I32(p)      _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)(p)))
+#define BD_STORE_I32(p, v)  _mm_storeu_si128((__m128i*)(p), _mm256_cvttpd_epi32(v))
+#define BD_TRUNC(v)         _mm256_round_pd(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+#define BD_SET1(c)          _mm256_set1_pd(c)
+#define BD_ADD(a, b)        _mm256_add_pd(a, b)
+#define BD_SUB(a, b)        _mm256_sub_pd(a, b)
+#define BD_MUL(a, b)        _mm256_mul_pd(a, b)
+#define BD_DIV(a, b)        _mm256_div_pd(a, b)
+#define BD_MIN(a, b)        _mm256_min_pd(a, b)
+#define BD_MAX(a, b)        _mm256_max_pd(a, b)
+#define BD_CMPGT(a, b)      _mm256_cmp_pd(a, b, _CMP_GT_OQ)
+#define BD_CMPLE(a, b)      _mm256_cmp_pd(a, b, _CMP_LE_OQ)
+#define BD_OR(a, b)         _mm256_or_pd(a, b)
+#define BD_ANDNOT(m, v)     _mm256_andnot_pd(m, v)
+#define BD_SELECT(m, a, b)  _mm256_blendv_pd(b, a, m)
+#define BD_ANY(m)           (_mm256_movemask_pd(m) != 0)
+
+#elif defined(__SSE2__)
+
+#define BF_LANES 4
+typedef __m128 bf_vec_t;
+#define BF_LOAD(p)          _mm_loadu_ps(p)
+#define BF_STORE(p, v)      _mm_storeu_ps(p, v)
+#define BF_SET1(c)          _mm_set1_ps(c)
+#define BF_ADD(a, b)        _mm_add_ps(a, b)
+#define BF_SUB(a, b)        _mm_sub_ps(a, b)
+#define BF_MUL(a, b)        _mm_mul_ps(a, b)
+#define BF_DIV(a, b)        _mm_div_ps(a, b)
+#define BF_CMPLE(a, b)      _mm_cmple_ps(a, b)
+
+#define BD_LANES 2
+typedef __m128d bd_vec_t;
+#define BD_LOAD_I32(p)      _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*)(p)))
+#define BD_STORE_I32(p, v)  _mm_storel_epi64((__m128i*)(p), _mm_cvttpd_epi32(v))
+#define BD_TRUNC(v)         _mm_cvtepi32_pd(_mm_cvttpd_epi32(v))  /* |v| < 2^31 */
+#define BD_SET1(c)          _mm_set1_pd(c)
+#define BD_ADD(a, b)        _mm_add_pd(a, b)
+#define BD_SUB(a, b)        _mm_sub_pd(a, b)
+#define BD_MUL(a, b)        _mm_mul_pd(a, b)
+#define BD_DIV(a, b)        _mm_div_pd(a, b)
+#define BD_MIN(a, b)        _mm_min_pd(a, b)
+#define BD_MAX(a, b)        _mm_max_pd(a, b)
+#define BD_CMPGT(a, b)      _mm_cmpgt_pd(a, b)
+#define BD_CMPLE(a, b)      _mm_cmple_pd(a, b)
+#define BD_OR(a, b)         _mm_or_pd(a, b)
+#define BD_ANDNOT(m, v)     _mm_andnot_pd(m, v)
+#define BD_ANY(m)           (_mm_movemask_pd(m) != 0)
+
+#if defined(__SSE4_1__)
+#define BF_SELECT(m, a, b)  _mm_blendv_ps(b, a, m)
+#define BD_SELECT(m, a, b)  _mm_blendv_pd(b, a, m)
+#else
+#define BF_SELECT(m, a, b)  _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define BD_SELECT(m, a, b)  _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b))
+#endif
+
+#elif defined(__wasm_simd128__)
+
+#define BF_LANES 4
+typedef v128_t bf_vec_t;
+#define BF_LOAD(p)          wasm_v128_load(p)
+#define BF_STORE(p, v)      wasm_v128_store(p, v)
+#define BF_SET1(c)          wasm_f32x4_splat(c)
+#define BF_ADD(a, b)        wasm_f32x4_add(a, b)
+#define BF_SUB(a, b)        wasm_f32x4_sub(a, b)
+#define BF_MUL(a, b)        wasm_f32x4_mul(a, b)
+#define BF_DIV(a, b)        wasm_f32x4_div(a, b)
+#define BF_CMPLE(a, b)      wasm_f32x4_le(a, b)
+#define BF_SELECT(m, a, b)  wasm_v128_bitselect(a, b, m)
+
+#define BD_LANES 2
+typedef v128_t bd_vec_t;
+#define BD_LOAD_I32(p)      wasm_f64x2_convert_low_i32x4(wasm_v128_load64_zero(p))
+#define BD_STORE_I32(p, v)  wasm_v128_store64_lane(p, wasm_i32x4_trunc_sat_f64x2_zero(v), 0)
+#define BD_TRUNC(v)         wasm_f64x2_trunc(v)
+#define BD_SET1(c)          wasm_f64x2_splat(c)
+#define BD_ADD(a, b)        wasm_f64x2_add(a, b)
+#define BD_SUB(a, b)        wasm_f64x2_sub(a, b)
+#define BD_MUL(a, b)        wasm_f64x2_mul(a, b)
+#define BD_DIV(a, b)        wasm_f64x2_div(a, b)
+#define BD_MIN(a, b)        wasm_f64x2_min(a, b)
+#define BD_MAX(a, b)        wasm_f64x2_max(a, b)
+#define BD_CMPGT(a, b)      wasm_f64x2_gt(a, b)
+#define BD_CMPLE(a, b)      wasm_f64x2_le(a, b)
+#define BD_OR(a, b)         wasm_v128_or(a, b)
+#define BD_ANDNOT(m, v)     wasm_v128_andnot(v, m)
+#define BD_SELECT(m, a, b)  wasm_v128_bitselect(a, b, m)
+#define BD_ANY(m)           wasm_v128_any_true(m)
+
+#else
+#define BF_LANES 1
+#define BD_LANES 1
+#endif
+
+#if BF_LANES > 1
+
+/* ========================================================================
+ * FLOAT LANE KERNEL
+ * ======================================================================== */
+
+static inline void bf_bounded_lanes(const float* x, const float* x_min, const float* x_max,
+                                    const BarrierFieldParamsF* p, float* value, float* grad) {
+    const bf_vec_t zero = BF_SET1(0.0f);
+    const bf_vec_t eps = BF_SET1(p->eps);
+    bf_vec_t vx = BF_LOAD(x);
+
+    bf_vec_t dx_lo = BF_ADD(BF_SUB(vx, BF_LOAD(x_min)), eps);
+    bf_vec_t dx_hi = BF_ADD(BF_SUB(BF_LOAD(x_max), vx), eps);
+    bf_vec_t viol_lo = BF_CMPLE(dx_lo, zero);
+    bf_vec_t viol_hi = BF_CMPLE(dx_hi, zero);
+
+    if (grad) {
+        const bf_vec_t one = BF_SET1(1.0f);
+        bf_vec_t g_lo = BF_MUL(BF_SET1(-p->kappa), BF_DIV(one, BF_MUL(dx_lo, dx_lo)));
+        bf_vec_t g_hi = BF_MUL(BF_SET1(p->kappa), BF_DIV(one, BF_MUL(dx_hi, dx_hi)));
+        g_lo = BF_SELECT(viol_lo, BF_SET1(-p->violation), g_lo);
+        g_hi = BF_SELECT(viol_hi, BF_SET1(p->violation), g_hi);
+        BF_STORE(grad, BF_ADD(g_lo, g_hi));
+    }
+    if (value) {
+        const bf_vec_t kappa = BF_SET1(p->kappa);
+        const bf_vec_t viol = BF_SET1(p->violation);
+        bf_vec_t u_lo = BF_SELECT(viol_lo, viol, BF_DIV(kappa, dx_lo));
+        bf_vec_t u_hi = BF_SELECT(viol_hi, viol, BF_DIV(kappa, dx_hi));
+        BF_STORE(value, BF_ADD(u_lo, u_hi));
+    }
+}
+
+/* ========================================================================
+ * Q16.16 LANE KERNEL (double lanes)
+ * ======================================================================== */
+
+#define BD_INT32_MAX 2147483647.0
+#define BD_INT32_MIN (-2147483648.0)
+#define BD_TWO_POW_31 2147483648.0
+#define BD_INV_FRACUNIT (1.0 / 65536.0)
+
+/** Saturate an exact integer to int32 range (barrier_fixed_add/sub) */
+static inline bd_vec_t bd_clamp(bd_vec_t v, bd_vec_t* ovf) {
+    *ovf = BD_OR(*ovf, BD_OR(BD_CMPGT(v, BD_SET1(BD_INT32_MAX)),
+                             BD_CMPGT(BD_SET1(BD_INT32_MIN), v)));
+    return BD_MIN(BD_MAX(v, BD_SET1(BD_INT32_MIN)), BD_SET1(BD_INT32_MAX));
+}
+
+/**
+ * Truncate a non-negative quotient / scaled product and saturate
+ * (barrier_fixed_div/mul). Lanes in dead (violated bounds) never reach
+ * this step in the scalar code, so they raise no overflow.
+ */
+static inline bd_vec_t bd_floor_clamp(bd_vec_t v, bd_vec_t dead, bd_vec_t* ovf) {
+    *ovf = BD_OR(*ovf, BD_ANDNOT(dead, BD_CMPLE(BD_SET1(BD_TWO_POW_31), v)));
+    return BD_TRUNC(BD_MIN(v, BD_SET1(BD_INT32_MAX)));
+}
+
+/** kappa / dx^2 as barriers.h computes it: inv = 1/dx, inv*inv, kappa*inv_sq */
+static inline bd_vec_t bd_inv_sq_kappa(bd_vec_t dx, bd_vec_t dead, bd_vec_t* ovf) {
+    const bd_vec_t scale = BD_SET1(BD_INV_FRACUNIT);
+    bd_vec_t inv = bd_floor_clamp(BD_DIV(BD_SET1((double)FRACUNIT * FRACUNIT), dx), dead, ovf);
+    bd_vec_t inv_sq = bd_floor_clamp(BD_MUL(BD_MUL(inv, inv), scale), dead, ovf);
+    return bd_floor_clamp(BD_MUL(BD_MUL(BD_SET1((double)BARRIER_STRENGTH), inv_sq), scale),
+                          dead, ovf);
+}
+
+static inline void bd_bounded_lanes(const fixed_t* x, const fixed_t* x_min, const fixed_t* x_max,
+                                    fixed_t* value, fixed_t* grad, bd_vec_t* ovf) {
+    const bd_vec_t zero = BD_SET1(0.0);
+    const bd_vec_t one = BD_SET1(1.0);
+    const bd_vec_t eps = BD_SET1((double)BARRIER_EPS);
+    bd_vec_t vx = BD_LOAD_I32(x);
+
+    /* dx = sat(sat(x - x_min) + eps), likewise for the upper side */
+    bd_vec_t dx_lo = bd_clamp(BD_ADD(bd_clamp(BD_SUB(vx, BD_LOAD_I32(x_min)), ovf), eps), ovf);
+    bd_vec_t dx_hi = bd_clamp(BD_ADD(bd_clamp(BD_SUB(BD_LOAD_I32(x_max), vx), ovf), eps), ovf);
+    bd_vec_t viol_lo = BD_CMPLE(dx_lo, zero);
+    bd_vec_t viol_hi = BD_CMPLE(dx_hi, zero);
+    dx_lo = BD_SELECT(viol_lo, one, dx_lo);
+    dx_hi = BD_SELECT(viol_hi, one, dx_hi);
+
+    if (grad) {
+        bd_vec_t g_lo = BD_SUB(zero, bd_inv_sq_kappa(dx_lo, viol_lo, ovf));
+        bd_vec_t g_hi = bd_inv_sq_kappa(dx_hi, viol_hi, ovf);
+        g_lo = BD_SELECT(viol_lo, BD_SET1(-BD_INT32_MAX), g_lo);
+        g_hi = BD_SELECT(viol_hi, BD_SET1(BD_INT32_MAX), g_hi);
+        BD_STORE_I32(grad, bd_clamp(BD_ADD(g_lo, g_hi), ovf));
+    }
+    if (value) {
+        const bd_vec_t kappa = BD_SET1((double)BARRIER_STRENGTH * FRACUNIT);
+        bd_vec_t u_lo = bd_floor_clamp(BD_DIV(kappa, dx_lo), viol_lo, ovf);
+        bd_vec_t u_hi = bd_floor_clamp(BD_DIV(kappa, dx_hi), viol_hi, ovf);
+        u_lo = BD_SELECT(viol_lo, BD_SET1(BD_INT32_MAX), u_lo);
+        u_hi = BD_SELECT(viol_hi, BD_SET1(BD_INT32_MAX), u_hi);
+        BD_STORE_I32(value, bd_clamp(BD_ADD(u_lo, u_hi), ovf));
+    }
+}
+
+#endif /* BF_LANES > 1 */
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+int barrier_field_lanes(void) {
+    return BF_LANES;
+}
+
+void barrier_field_bounded_f(const float* x, const float* x_min, const float* x_max,
+                             int n, const BarrierFieldParamsF* params,
+                             float* value, float* grad) {
+    int i = 0;
+#if BF_LANES > 1
+    for (; i + BF_LANES <= n; i += BF_LANES) {
+        bf_bounded_lanes(x + i, x_min + i, x_max + i, params,
+                         value ? value + i : NULL, grad ? grad + i : NULL);
+    }
+#endif
+    for (; i < n; i++) {
+        /* Compute both before storing: outputs may alias the inputs */
+        float g = grad ? barrier_gradient_bounded_f(x[i], x_min[i], x_max[i], params) : 0.0f;
+        float u = value ? barrier_potential_bounded_f(x[i], x_min[i], x_max[i], params) : 0.0f;
+        if (grad) grad[i] = g;
+        if (value) value[i] = u;
+    }
+}
+
+void barrier_field_bounded_fixed(const fixed_t* x, const fixed_t* x_min, const fixed_t* x_max,
+                                 int n, fixed_t* value, fixed_t* grad) {
+    int i = 0;
+#if BD_LANES > 1
+    bd_vec_t ovf = BD_SET1(0.0);
+    for (; i + BD_LANES <= n; i += BD_LANES) {
+        bd_bounded_lanes(x + i, x_min + i, x_max + i,
+                         value ? value + i : NULL, grad ? grad + i : NULL, &ovf);
+    }
+    if (BD_ANY(ovf)) {
+        fixed_sticky_raise(FIXED_STICKY_OVERFLOW);
+    }
+#endif
+    for (; i < n; i++) {
+        /* Compute both before storing: outputs may alias the inputs */
+        fixed_t g = grad ? fixed_barrier_gradient_bounded(x[i], x_min[i], x_max[i]) : 0;
+        fixed_t u = value ? fixed_barrier_potential_bounded(x[i], x_min[i], x_max[i]) : 0;
+        if (grad) grad[i] = g;
+        if (value) value[i] = u;
+    }
+}
@@ -9,7 +9,7 @@
  */
 
 #include "fixed_math.h"
-#include <math.h>  // Only for LUT generation, not in hot paths
+#include <math.h>  // Only for LUT verification, not in hot paths
 #include <stdio.h>
 #include <string.h>
 
@@ -17,85 +17,35 @@
  * STATIC LUT STORAGE
  * ======================================================================== */
 
-/**
+/*
  * Reciprocal LUT: 1/x for x ∈ [1.0, 256.0]
- * Generated at initialization with perfect FP64 precision.
- */
-static fixed_t reciprocal_lut_data[RECIPROCAL_LUT_SIZE];
-
-/**
  * Square root LUT: sqrt(x) for x ∈ [0.0, 1024.0]
- * Generated at initialization with perfect FP64 precision.
- */
-static fixed_t sqrt_lut_data[SQRT_LUT_SIZE];
-
-/* Export const pointers for external access */
-const fixed_t* reciprocal_lut = reciprocal_lut_data;
-const fixed_t* sqrt_lut = sqrt_lut_data;
-
-/* Initialization flag */
-static bool luts_initialized = false;
-
-/* ========================================================================
- * LUT GENERATION (called once at startup)
- * ======================================================================== */
-
-/**
- * Generate reciprocal LUT: 1/x for x ∈ [1.0, 256.0]
  *
- * Method: Direct computation using FP64, then round to Q16.16
- * Entries: reciprocal_lut[i] = 1.0 / (1.0 + i)
+ * Emitted by tools/generate_luts.c (FP64 value, rounded through
+ * FLOAT_TO_FIXED) as const arrays: read-only memory, no startup cost,
+ * identical bits on every target.
  */
-static void generate_reciprocal_lut(void) {
-    for (int i = 0; i < RECIPROCAL_LUT_SIZE; i++) {
-        double x = 1.0 + (double)i;  // Range: [1.0, 256.0]
-        double recip = 1.0 / x;
-        reciprocal_lut_data[i] = FLOAT_TO_FIXED((float)recip);
-    }
-}
+#include "fixed_math_luts.h"
 
-/**
- * Generate sqrt LUT: sqrt(x) for x ∈ [0.0, 1024.0]
- *
- * Method: Direct computation using FP64 sqrt, then round to Q16.16
- * Entries: sqrt_lut[i] = sqrt(2.0 * i)  (spaced for better coverage)
- */
-static void generate_sqrt_lut(void) {
-    for (int i = 0; i < SQRT_LUT_SIZE; i++) {
-        double x = 2.0 * (double)i;  // Range: [0.0, 1024.0]
-        double sqrt_val = sqrt(x);
-        sqrt_lut_data[i] = FLOAT_TO_FIXED((float)sqrt_val);
-    }
-}
+/* Per-thread sticky saturation bits (see fixed_clamp64) */
+NEG_THREAD_LOCAL uint32_t g_fixed_sticky = 0;
 
 /* ========================================================================
  * PUBLIC LUT INITIALIZATION
  * ======================================================================== */
 
 int fixed_math_init(void) {
-    if (luts_initialized) {
-        return 0;  // Already initialized
-    }
-
-    generate_reciprocal_lut();
-    generate_sqrt_lut();
-
-    luts_initialized = true;
-    return 0;
+    return 0;  /* Tables are static const; kept for API compatibility */
 }
 
 float fixed_math_verify_lut(const char* lut_name) {
-    if (!luts_initialized) {
-        return -1.0f;  // Error: LUTs not initialized
-    }
-
     float max_error = 0.0f;
 
     if (strcmp(lut_name, "reciprocal") == 0) {
         for (int i = 0; i < RECIPROCAL_LUT_SIZE; i++) {
             float x = 1.0f + (float)i;
             float expected = 1.0f / x;
-            float actual = FIXED_TO_FLOAT(reciprocal_lut_data[i]);
+            float actual = FIXED_TO_FLOAT(reciprocal_lut[i]);
             float error = fabsf((actual - expected) / expected);
             if (error > max_error) max_error = error;
         }
@@ -103,7 +53,7 @@ float fixed_math_verify_lut(const char* lut_name) {
         for (int i = 1; i < SQRT_LUT_SIZE; i++) {  // Skip i=0 to avoid divide by zero
             float x = 2.0f * (float)i;
             float expected = sqrtf(x);
-            float actual = FIXED_TO_FLOAT(sqrt_lut_data[i]);
+            float actual = FIXED_TO_FLOAT(sqrt_lut[i]);
             float error = fabsf((actual - expected) / expected);
             if (error > max_error) max_error = error;
         }
@@ -114,98 +64,100 @@ float fixed_math_verify_lut(const char* lut_name) {
     return max_error;
 }
 
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/*
+ * Every step below is a shift, add or 64-bit product truncated by
+ * FIXED_MUL; fixed_math_batch.c runs the same sequence lane-wise.
+ */
+
+/* Extra fraction bits of the inverse sqrt Newton step (Q16.16 -> Q2.30) */
+#define INV_SQRT_Y_SHIFT 14
+
+/** Linear interpolation: lut[idx] + frac * (lut[idx+1] - lut[idx]) */
+static inline fixed_t lut_interp(const fixed_t* lut, int32_t idx, int32_t frac) {
+    fixed_t v0 = lut[idx];
+    fixed_t v1 = lut[idx + 1];
+    return v0 + FIXED_MUL(frac, v1 - v0);
+}
+
+/**
+ * Scale x (> 0) by a power of four into [SQRT_NORM_LO, SQRT_NORM_HI).
+ *
+ * @param x Input, replaced by the normalized value
+ * @return k such that normalized = x * 4^k (k < 0: low bits dropped)
+ */
+static inline int normalize_sqrt(int32_t* x) {
+    int k = 0;
+    while (*x < SQRT_NORM_LO) { *x <<= 2; k++; }
+    while (*x >= SQRT_NORM_HI) { *x >>= 2; k--; }
+    return k;
+}
+
 /* ========================================================================
  * LUT-ACCELERATED FUNCTIONS
  * ======================================================================== */
 
 fixed_t fixed_reciprocal(fixed_t x) {
     if (x == 0) return 0;  // Division by zero guard
-    if (x < 0) x = -x;     // Handle negative (return positive reciprocal)
+    if (x < 0) x = (x == INT32_MIN) ? INT32_MAX : -x;  // Positive reciprocal
 
-    // Check if x is in LUT range [1.0, 256.0]
     if (x < RECIPROCAL_MIN_VAL) {
-        // x < 1.0: reciprocal is > 1.0, use direct division
-        return FIXED_DIV(FRACUNIT, x);
-    }
-    if (x >= RECIPROCAL_MAX_VAL) {
-        // x >= 256.0: reciprocal is < 1/256, use direct division
+        // x < 1.0: reciprocal is > 1.0 and may overflow, use direct division
         return FIXED_DIV(FRACUNIT, x);
     }
 
-    // Map x to LUT index with fractional part
-    // x ranges from 1.0 to 256.0, map to [0, 255]
-    int32_t x_shifted = x - FRACUNIT;  // Subtract 1.0
-    int32_t index_fixed = x_shifted >> FIXED_SHIFT;  // Integer part
-    int32_t frac = x_shifted & 0xFFFF;  // Fractional part
+    // Scale by 2^k into [128.0, 256.0): LUT spacing is fine relative to x there
+    int32_t xn = x;
+    int k = 0;
+    while (xn < RECIPROCAL_NORM_LO) { xn <<= 1; k++; }
+    while (xn >= RECIPROCAL_NORM_HI) { xn >>= 1; k--; }
 
-    // Clamp index to valid range
-    if (index_fixed < 0) index_fixed = 0;
-    if (index_fixed >= RECIPROCAL_LUT_SIZE - 1) index_fixed = RECIPROCAL_LUT_SIZE - 2;
+    // Interpolate 1/xn, then 1/x = 2^k / xn
+    int32_t x_shifted = xn - FRACUNIT;  // Subtract 1.0
+    fixed_t y = lut_interp(reciprocal_lut, x_shifted >> FIXED_SHIFT, x_shifted & 0xFFFF);
+    y = (k >= 0) ? (y << k) : (y >> -k);
 
-    // Linear interpolation
-    fixed_t v0 = reciprocal_lut_data[index_fixed];
-    fixed_t v1 = reciprocal_lut_data[index_fixed + 1];
-    fixed_t delta = v1 - v0;
-
-    // result = v0 + frac * (v1 - v0)
-    fixed_t interp = FIXED_MUL(INT_TO_FIXED(frac) >> FIXED_SHIFT, delta);
-    return v0 + interp;
+    // One Newton step at full scale: y = y * (2 - x*y)
+    return FIXED_MUL(y, 2 * FRACUNIT - FIXED_MUL(x, y));
 }
 
 fixed_t fixed_sqrt(fixed_t x) {
     if (x <= 0) return 0;  // sqrt of negative is undefined
 
-    // Check if x is in LUT range [0.0, 1024.0]
-    if (x >= SQRT_MAX_VAL) {
-        // x >= 1024.0: use iterative Newton-Raphson (2 iterations)
-        // Initial guess: x / 2
-        fixed_t guess = x >> 1;
-        // Iteration 1: guess = (guess + x/guess) / 2
-        fixed_t div1 = FIXED_DIV(x, guess);
-        guess = (guess + div1) >> 1;
-        // Iteration 2
-        fixed_t div2 = FIXED_DIV(x, guess);
-        guess = (guess + div2) >> 1;
-        return guess;
-    }
-
-    // Map x to LUT index with fractional part
-    // x ranges from 0.0 to 1024.0, LUT has 512 entries spaced by 2.0
-    // index = x / 2.0
-    int32_t index_fixed = x >> 1;  // Divide by 2.0 (shift right by FIXED_SHIFT+1, but we want Q16.16 index)
-    index_fixed >>= FIXED_SHIFT;   // Get integer index
-    int32_t frac = (x >> 1) & 0xFFFF;  // Fractional part
+    // sqrt(x) = sqrt(x * 4^k) / 2^k
+    int32_t xn = x;
+    int k = normalize_sqrt(&xn);
 
-    // Clamp index to valid range
-    if (index_fixed >= SQRT_LUT_SIZE - 1) index_fixed = SQRT_LUT_SIZE - 2;
-
-    // Linear interpolation
-    fixed_t v0 = sqrt_lut_data[index_fixed];
-    fixed_t v1 = sqrt_lut_data[index_fixed + 1];
-    fixed_t delta = v1 - v0;
-
-    // result = v0 + frac * (v1 - v0)
-    fixed_t interp = FIXED_MUL(INT_TO_FIXED(frac) >> FIXED_SHIFT, delta);
-    return v0 + interp;
+    // LUT entries are spaced by 2.0: index = xn / 2.0
+    fixed_t s = lut_interp(sqrt_lut, xn >> (FIXED_SHIFT + 1), (xn >> 1) & 0xFFFF);
+    return (k >= 0) ? (s >> k) : (s << -k);
 }
 
 fixed_t fixed_inv_sqrt(fixed_t x) {
     if (x <= 0) return 0;
 
-    // Quake III fast inverse square root adapted to Q16.16
-    // Use Newton-Raphson: y = y * (1.5 - 0.5 * x * y * y)
-
-    // Initial guess using bit hack (approximate)
-    // Convert to float for magic constant trick
-    float xf = FIXED_TO_FLOAT(x);
-    int32_t i = *(int32_t*)&xf;
-    i = 0x5f3759df - (i >> 1);  // Magic constant
-    float yf = *(float*)&i;
-
-    // One Newton-Raphson iteration
-    yf = yf * (1.5f - 0.5f * xf * yf * yf);
-
-    return FLOAT_TO_FIXED(yf);
+    // 1/sqrt(x) = 2^k / sqrt(x * 4^k)
+    int32_t xn = x;
+    int k = normalize_sqrt(&xn);
+
+    // Seed: reciprocal LUT of the sqrt LUT (sqrt(xn) ∈ [11.3, 22.6])
+    fixed_t s = lut_interp(sqrt_lut, xn >> (FIXED_SHIFT + 1), (xn >> 1) & 0xFFFF);
+    int32_t s_shifted = s - FRACUNIT;
+    fixed_t yn = lut_interp(reciprocal_lut, s_shifted >> FIXED_SHIFT, s_shifted & 0xFFFF);
+
+    // One Newton step on the normalized input, y = y * (3 - xn*y*y) / 2,
+    // with y in Q2.30 so the seed error rather than Q16.16 truncation
+    // limits the result; every product is 32x32 -> 64 bits
+    int32_t y = yn << INV_SQRT_Y_SHIFT;
+    int32_t u = (int32_t)(((int64_t)xn * y) >> 30);  // sqrt(xn), Q16.16
+    int32_t e = (int32_t)(((int64_t)u * y) >> 30);   // ~1.0, Q16.16
+    y = (int32_t)(((int64_t)y * (3 * FRACUNIT - e)) >> (FIXED_SHIFT + 1));
+
+    // Back to Q16.16 and undo the normalization: y / 2^14 * 2^k
+    return y >> (INV_SQRT_Y_SHIFT - k);
 }
 
 fixed_t fixed_div_safe(fixed_t a, fixed_t b) {
@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "../../../include/fixed_saturate.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,18 +73,34 @@ typedef int32_t fixed_t;
 #define SQRT_LUT_SIZE 512
 #define SQRT_MAX_VAL (1024 * FRACUNIT)  // 1024.0
 
+/**
+ * Normalization windows.
+ *
+ * Inputs are scaled by powers of two (reciprocal) or four (sqrt,
+ * inv_sqrt) into the part of each LUT where linear interpolation is
+ * most accurate; the result is shifted back by the matching power.
+ * Each window spans exactly one scaling factor, so the scale is unique
+ * and scalar and batch code compute the same one.
+ */
+#define RECIPROCAL_NORM_LO (128 * FRACUNIT)  // [128.0, 256.0)
+#define RECIPROCAL_NORM_HI (256 * FRACUNIT)
+#define SQRT_NORM_LO (128 * FRACUNIT)        // [128.0, 512.0)
+#define SQRT_NORM_HI (512 * FRACUNIT)
+
 /* ========================================================================
  * LUT INITIALIZATION
  * ======================================================================== */
 
 /**
  * Initialize all fixed-point LUTs.
- * Must be called once at startup before any fixed_* functions are used.
  *
- * Thread safety: Not thread-safe. Call from main thread before worker spawn.
- * Memory: Allocates 3 KB static data (reciprocal + sqrt LUTs)
+ * The reciprocal and sqrt LUTs are static const arrays emitted by
+ * tools/generate_luts.c, so this is a no-op kept for API compatibility.
+ *
+ * Thread safety: Safe from any thread.
+ * Memory: 3 KB read-only data (reciprocal + sqrt LUTs)
  *
- * @return 0 on success, -1 on failure
+ * @return 0 (always succeeds)
  */
 int fixed_math_init(void);
 
@@ -101,41 +118,45 @@ float fixed_math_verify_lut(const char* lut_name);
  * ======================================================================== */
 
 /**
- * LUT-based reciprocal: 1/x
+ * LUT-based reciprocal: 1/|x|
  *
- * Uses 256-entry lookup table with linear interpolation.
- * For x outside [1.0, 256.0], falls back to FIXED_DIV.
+ * Normalizes |x| into [128.0, 256.0), interpolates the 256-entry LUT,
+ * shifts back, then applies one integer Newton step y' = y(2 - xy).
+ * For |x| < 1.0, falls back to FIXED_DIV. Integer-only.
  *
  * Performance: ~10 cycles (vs ~50 for division)
- * Accuracy: < 1e-4 relative error within LUT range
+ * Accuracy: within 2 LSB of the exact Q16.16 reciprocal for |x| >= 1.0
  *
- * @param x Input value (Q16.16), must be > 0
- * @return 1/x (Q16.16), or 0 if x == 0
+ * @param x Input value (Q16.16), must be != 0
+ * @return 1/|x| (Q16.16), or 0 if x == 0
  */
 fixed_t fixed_reciprocal(fixed_t x);
 
 /**
  * LUT-based square root: sqrt(x)
  *
- * Uses 512-entry lookup table with linear interpolation.
- * For x outside [0.0, 1024.0], uses iterative refinement.
+ * Normalizes x by a power of four into [128.0, 512.0), interpolates the
+ * 512-entry LUT and shifts the result back by the matching power of two.
+ * Covers the whole Q16.16 range without division. Integer-only.
  *
  * Performance: ~12 cycles (vs ~80 for float sqrt)
- * Accuracy: < 1e-4 relative error within LUT range
+ * Accuracy: < 2e-5 relative error, plus 1 LSB of truncation
  *
  * @param x Input value (Q16.16), must be >= 0
- * @return sqrt(x) (Q16.16), or 0 if x < 0
+ * @return sqrt(x) (Q16.16), or 0 if x <= 0
  */
 fixed_t fixed_sqrt(fixed_t x);
 
 /**
- * Fast inverse square root: 1/sqrt(x)
+ * Inverse square root: 1/sqrt(x)
  *
- * Uses Quake III algorithm with one Newton-Raphson iteration.
- * Faster than fixed_reciprocal(fixed_sqrt(x)).
+ * Seeds with the sqrt and reciprocal LUTs on the normalized input, then
+ * applies one integer Newton step y' = y(3 - xy²)/2 at full scale.
+ * Integer-only, so results are bit-identical on every target (replaces
+ * the former float magic-constant seed).
  *
- * Performance: ~15 cycles
- * Accuracy: < 5e-4 relative error
+ * Performance: ~20 cycles
+ * Accuracy: within 2 LSB for x >= 1.0, < 2e-5 relative error below
  *
  * @param x Input value (Q16.16), must be > 0
  * @return 1/sqrt(x) (Q16.16), or 0 if x <= 0
@@ -166,8 +187,80 @@ static inline bool fixed_will_overflow_mul(fixed_t a, fixed_t b) {
     return result > INT32_MAX || result < INT32_MIN;
 }
 
+/*
+ * Saturating add/sub/mul/div with sticky overflow bits live in
+ * fixed_saturate.h (included above), which defines no Q16.16 macros so
+ * that headers with their own (se3_edge.h, barriers.h) can use it too.
+ */
+
+/* ========================================================================
+ * BATCH FUNCTIONS (fixed_math_batch.c)
+ * ======================================================================== */
+
+/*
+ * Array versions of the functions above. Lanes run the same integer
+ * sequence with SIMD gathers from the LUTs, so every element is
+ * bit-identical to the scalar call on every path:
+ *   - AVX2:          8 lanes (__AVX2__, vpgatherdd)
+ *   - SSE4.1 / SSE2: 4 lanes (__SSE2__)
+ *   - WASM SIMD128:  4 lanes (__wasm_simd128__)
+ *   - Other targets: 1 lane  (scalar loop, e.g. ESP32 Xtensa)
+ *
+ * out may alias the input arrays.
+ */
+
+/**
+ * Number of elements processed per SIMD instruction on this build.
+ *
+ * @return Lane count (8 for AVX2, 4 for SSE/WASM SIMD128, 1 otherwise)
+ */
+int fixed_math_batch_lanes(void);
+
+/**
+ * Batch reciprocal: out[i] = fixed_reciprocal(x[i]).
+ *
+ * Lanes with |x| < 1.0 take the scalar FIXED_DIV fallback.
+ *
+ * @param x Input values (Q16.16)
+ * @param out Output values (Q16.16)
+ * @param n Number of elements
+ */
+void fixed_reciprocal_n(const fixed_t* x, fixed_t* out, int n);
+
+/**
+ * Batch square root: out[i] = fixed_sqrt(x[i]).
+ *
+ * @param x Input values (Q16.16)
+ * @param out Output values (Q16.16)
+ * @param n Number of elements
+ */
+void fixed_sqrt_n(const fixed_t* x, fixed_t* out, int n);
+
+/**
+ * Batch inverse square root: out[i] = fixed_inv_sqrt(x[i]).
+ *
+ * @param x Input values (Q16.16)
+ * @param out Output values (Q16.16)
+ * @param n Number of elements
+ */
+void fixed_inv_sqrt_n(const fixed_t* x, fixed_t* out, int n);
+
+/**
+ * Batch clamped division: out[i] = fixed_div_safe(a[i], b[i]).
+ *
+ * None of the SIMD targets has integer division, so this is a tight
+ * scalar loop; use fixed_reciprocal_n() + FIXED_MUL when 1 LSB of
+ * difference is acceptable.
+ *
+ * @param a Numerators (Q16.16)
+ * @param b Denominators (Q16.16)
+ * @param out Output values (Q16.16)
+ * @param n Number of elements
+ */
+void fixed_div_safe_n(const fixed_t* a, const fixed_t* b, fixed_t* out, int n);
+
 /* ========================================================================
- * EXTERNAL LUT TABLES (defined in fixed_math.c)
+ * EXTERNAL LUT TABLES (defined in fixed_math_luts.h, generated)
  * ======================================================================== */
 
 extern const fixed_t reciprocal_lut[RECIPROCAL_LUT_SIZE];
@@ -0,0 +1,415 @@
+/**
+ * fixed_math_batch.c - SIMD Batch Fixed-Point Math (sqrt, reciprocal, inv_sqrt, div)
+ *
+ * Lane-wise versions of fixed_sqrt(), fixed_reciprocal() and
+ * fixed_inv_sqrt(). Each kernel runs exactly the integer sequence of the
+ * scalar function in fixed_math.c:
+ *
+ *   1. normalize: power-of-two steps selected by compares (greedy
+ *      16/8/4/2/1 bits, then one final step), which reaches the same
+ *      unique scale as the scalar while-loops
+ *   2. gather lut[idx], lut[idx+1] and interpolate
+ *   3. shift back and run the integer Newton step
+ *
+ * Products are 32x32 -> 64 bit and keep bits [shift, shift+32), as the
+ * scalar casts do, so results are bit-identical on every path. Lanes that
+ * need a division (reciprocal of |x| < 1.0) are patched with the scalar
+ * call after the vector store.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/r_draw.c (R_DrawColumn)
+ * Author: ClaudeCode (batch fixed-point math)
+ * Version: 1.0
+ */
+
+#include "fixed_math.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+/* ========================================================================
+ * SIMD PRIMITIVES
+ * ======================================================================== */
+
+#if defined(__AVX2__)
+
+#define FM_LANES 8
+typedef __m256i fm_vec_t;
+#define FM_LOAD(p)          _mm256_loadu_si256((const __m256i*)(p))
+#define FM_STORE(p, v)      _mm256_storeu_si256((__m256i*)(p), v)
+#define FM_SET1(c)          _mm256_set1_epi32(c)
+#define FM_ADD(a, b)        _mm256_add_epi32(a, b)
+#define FM_SUB(a, b)        _mm256_sub_epi32(a, b)
+#define FM_AND(a, b)        _mm256_and_si256(a, b)
+#define FM_SLLI(v, n)       _mm256_slli_epi32(v, n)
+#define FM_SRAI(v, n)       _mm256_srai_epi32(v, n)
+#define FM_CMPGT(a, b)      _mm256_cmpgt_epi32(a, b)
+#define FM_SELECT(m, a, b)  _mm256_blendv_epi8(b, a, m)
+#define FM_MASKBITS(m)      _mm256_movemask_ps(_mm256_castsi256_ps(m))
+#define FM_ABS(v)           _mm256_abs_epi32(v)
+#define FM_SLLV(v, n)       _mm256_sllv_epi32(v, n)
+#define FM_SRAV(v, n)       _mm256_srav_epi32(v, n)
+#define FM_GATHER(lut, idx) _mm256_i32gather_epi32((const int*)(lut), idx, 4)
+
+/** Per lane: (int32)(((int64)a * b) >> shift), vpmuldq on even/odd lanes */
+static inline fm_vec_t fm_mulshift(fm_vec_t a, fm_vec_t b, const int shift) {
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi32(_mm256_srli_epi64(even, shift),
+                              _mm256_slli_epi64(odd, 32 - shift), 0xAA);
+}
+
+#elif defined(__SSE2__)
+
+#define FM_LANES 4
+typedef __m128i fm_vec_t;
+#define FM_LOAD(p)          _mm_loadu_si128((const __m128i*)(p))
+#define FM_STORE(p, v)      _mm_storeu_si128((__m128i*)(p), v)
+#define FM_SET1(c)          _mm_set1_epi32(c)
+#define FM_ADD(a, b)        _mm_add_epi32(a, b)
+#define FM_SUB(a, b)        _mm_sub_epi32(a, b)
+#define FM_AND(a, b)        _mm_and_si128(a, b)
+#define FM_SLLI(v, n)       _mm_slli_epi32(v, n)
+#define FM_SRAI(v, n)       _mm_srai_epi32(v, n)
+#define FM_CMPGT(a, b)      _mm_cmpgt_epi32(a, b)
+#define FM_MASKBITS(m)      _mm_movemask_ps(_mm_castsi128_ps(m))
+
+#if defined(__SSE4_1__)
+#define FM_SELECT(m, a, b)  _mm_blendv_epi8(b, a, m)
+#define FM_ABS(v)           _mm_abs_epi32(v)
+
+/** Signed 32×32→64 products of the even lanes (pmuldq) */
+static inline __m128i fm_mul_even(__m128i a, __m128i b) {
+    return _mm_mul_epi32(a, b);
+}
+#else
+#define FM_SELECT(m, a, b)  _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b))
+
+static inline __m128i fm_abs(__m128i v) {
+    __m128i sign = _mm_srai_epi32(v, 31);
+    return _mm_sub_epi32(_mm_xor_si128(v, sign), sign);
+}
+#define FM_ABS(v)           fm_abs(v)
+
+/**
+ * Signed 32×32→64 products of the even lanes with SSE2 only
+ * (pmuludq plus sign correction, as in embedded/se3_batch.c).
+ */
+static inline __m128i fm_mul_even(__m128i a, __m128i b) {
+    __m128i corr = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                 _mm_and_si128(_mm_srai_epi32(b, 31), a));
+    return _mm_sub_epi64(_mm_mul_epu32(a, b), _mm_slli_epi64(corr, 32));
+}
+#endif
+
+/** Per lane: (int32)(((int64)a * b) >> shift) */
+static inline fm_vec_t fm_mulshift(fm_vec_t a, fm_vec_t b, const int shift) {
+    __m128i even = _mm_srli_epi64(fm_mul_even(a, b), shift);
+    __m128i odd = _mm_slli_epi64(fm_mul_even(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)),
+                                 32 - shift);
+    const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+    return FM_SELECT(lo_mask, even, odd);
+}
+
+/** Four scalar loads; SSE has no gather */
+static inline fm_vec_t fm_gather(const fixed_t* lut, fm_vec_t idx) {
+    int32_t i[4];
+    _mm_storeu_si128((__m128i*)i, idx);
+    return _mm_setr_epi32(lut[i[0]], lut[i[1]], lut[i[2]], lut[i[3]]);
+}
+#define FM_GATHER(lut, idx) fm_gather(lut, idx)
+
+#elif defined(__wasm_simd128__)
+
+#define FM_LANES 4
+typedef v128_t fm_vec_t;
+#define FM_LOAD(p)          wasm_v128_load(p)
+#define FM_STORE(p, v)      wasm_v128_store(p, v)
+#define FM_SET1(c)          wasm_i32x4_splat(c)
+#define FM_ADD(a, b)        wasm_i32x4_add(a, b)
+#define FM_SUB(a, b)        wasm_i32x4_sub(a, b)
+#define FM_AND(a, b)        wasm_v128_and(a, b)
+#define FM_SLLI(v, n)       wasm_i32x4_shl(v, n)
+#define FM_SRAI(v, n)       wasm_i32x4_shr(v, n)
+#define FM_CMPGT(a, b)      wasm_i32x4_gt(a, b)
+#define FM_SELECT(m, a, b)  wasm_v128_bitselect(a, b, m)
+#define FM_MASKBITS(m)      ((int)wasm_i32x4_bitmask(m))
+#define FM_ABS(v)           wasm_i32x4_abs(v)
+
+/** Per lane: (int32)(((int64)a * b) >> shift), i64x2.extmul */
+static inline fm_vec_t fm_mulshift(fm_vec_t a, fm_vec_t b, const int shift) {
+    v128_t lo = wasm_u64x2_shr(wasm_i64x2_extmul_low_i32x4(a, b), shift);
+    v128_t hi = wasm_u64x2_shr(wasm_i64x2_extmul_high_i32x4(a, b), shift);
+    return wasm_i32x4_shuffle(lo, hi, 0, 2, 4, 6);
+}
+
+static inline fm_vec_t fm_gather(const fixed_t* lut, fm_vec_t idx) {
+    return wasm_i32x4_make(lut[wasm_i32x4_extract_lane(idx, 0)],
+                           lut[wasm_i32x4_extract_lane(idx, 1)],
+                           lut[wasm_i32x4_extract_lane(idx, 2)],
+                           lut[wasm_i32x4_extract_lane(idx, 3)]);
+}
+#define FM_GATHER(lut, idx) fm_gather(lut, idx)
+
+#else
+#define FM_LANES 1
+#endif
+
+#if FM_LANES > 1
+
+#if defined(__SSE2__) && !defined(__AVX2__)
+/*
+ * Per-lane variable shifts for non-negative v and n ∈ [0, 30] (AVX2 has
+ * vpsllvd/vpsravd): multiply by 2^n or 2^(30-n) built from float
+ * exponent bits, keeping the low dword or bits [30, 62) of the product.
+ */
+static inline __m128i fm_pow2(__m128i n) {
+    return _mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)));
+}
+
+static inline fm_vec_t fm_sllv(fm_vec_t v, fm_vec_t n) {
+    __m128i p = fm_pow2(n);
+    __m128i even = _mm_mul_epu32(v, p);
+    __m128i odd = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(v, 32), _mm_srli_epi64(p, 32)), 32);
+    const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+    return FM_SELECT(lo_mask, even, odd);
+}
+
+static inline fm_vec_t fm_srav(fm_vec_t v, fm_vec_t n) {
+    __m128i p = fm_pow2(_mm_sub_epi32(_mm_set1_epi32(30), n));
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(v, p), 30);
+    __m128i odd = _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(v, 32), _mm_srli_epi64(p, 32)), 2);
+    const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+    return FM_SELECT(lo_mask, even, odd);
+}
+#define FM_SLLV(v, n)       fm_sllv(v, n)
+#define FM_SRAV(v, n)       fm_srav(v, n)
+
+#elif !defined(__AVX2__)
+/*
+ * Per-lane variable shifts (AVX2 has vpsllvd/vpsravd): binary steps of
+ * 16/8/4/2/1 bits. Arithmetic right shifts compose exactly (floor).
+ */
+static inline fm_vec_t fm_bit(fm_vec_t n, int bit) {
+    return FM_CMPGT(FM_AND(n, FM_SET1(bit)), FM_SET1(0));
+}
+
+static inline fm_vec_t fm_sllv(fm_vec_t v, fm_vec_t n) {
+    v = FM_SELECT(fm_bit(n, 16), FM_SLLI(v, 16), v);
+    v = FM_SELECT(fm_bit(n, 8), FM_SLLI(v, 8), v);
+    v = FM_SELECT(fm_bit(n, 4), FM_SLLI(v, 4), v);
+    v = FM_SELECT(fm_bit(n, 2), FM_SLLI(v, 2), v);
+    return FM_SELECT(fm_bit(n, 1), FM_SLLI(v, 1), v);
+}
+
+static inline fm_vec_t fm_srav(fm_vec_t v, fm_vec_t n) {
+    v = FM_SELECT(fm_bit(n, 16), FM_SRAI(v, 16), v);
+    v = FM_SELECT(fm_bit(n, 8), FM_SRAI(v, 8), v);
+    v = FM_SELECT(fm_bit(n, 4), FM_SRAI(v, 4), v);
+    v = FM_SELECT(fm_bit(n, 2), FM_SRAI(v, 2), v);
+    return FM_SELECT(fm_bit(n, 1), FM_SRAI(v, 1), v);
+}
+#define FM_SLLV(v, n)       fm_sllv(v, n)
+#define FM_SRAV(v, n)       fm_srav(v, n)
+#endif
+
+/* ========================================================================
+ * INTERNAL HELPERS
+ * ======================================================================== */
+
+/**
+ * Normalization step towards [lo, hi): where xn < limit, shift xn left
+ * by bits and add kstep to k. Greedy steps use limit = lo >> bits (the
+ * shift still lands below lo); the final step uses limit = lo.
+ */
+#define FM_NORM_UP(xn, k, limit, bits, kstep) do { \
+    fm_vec_t m_ = FM_CMPGT(FM_SET1(limit), xn); \
+    xn = FM_SELECT(m_, FM_SLLI(xn, bits), xn); \
+    k = FM_ADD(k, FM_AND(m_, FM_SET1(kstep))); \
+} while (0)
+
+/** Mirror of FM_NORM_UP: where xn >= limit, shift right and subtract */
+#define FM_NORM_DOWN(xn, k, limit, bits, kstep) do { \
+    fm_vec_t m_ = FM_CMPGT(xn, FM_SET1((limit) - 1)); \
+    xn = FM_SELECT(m_, FM_SRAI(xn, bits), xn); \
+    k = FM_SUB(k, FM_AND(m_, FM_SET1(kstep))); \
+} while (0)
+
+/** lut[idx] + frac * (lut[idx+1] - lut[idx]), as lut_interp() */
+static inline fm_vec_t fm_interp(const fixed_t* lut, fm_vec_t idx, fm_vec_t frac) {
+    fm_vec_t v0 = FM_GATHER(lut, idx);
+    fm_vec_t v1 = FM_GATHER(lut, FM_ADD(idx, FM_SET1(1)));
+    return FM_ADD(v0, fm_mulshift(frac, FM_SUB(v1, v0), FIXED_SHIFT));
+}
+
+/** Scale by 4^k into [SQRT_NORM_LO, SQRT_NORM_HI), as normalize_sqrt() */
+static inline fm_vec_t fm_normalize_sqrt(fm_vec_t xn, fm_vec_t* k_out) {
+    fm_vec_t k = FM_SET1(0);
+
+    FM_NORM_UP(xn, k, SQRT_NORM_LO >> 16, 16, 8);
+    FM_NORM_UP(xn, k, SQRT_NORM_LO >> 8, 8, 4);
+    FM_NORM_UP(xn, k, SQRT_NORM_LO >> 4, 4, 2);
+    FM_NORM_UP(xn, k, SQRT_NORM_LO >> 2, 2, 1);
+    FM_NORM_UP(xn, k, SQRT_NORM_LO, 2, 1);
+
+    FM_NORM_DOWN(xn, k, SQRT_NORM_HI << 4, 4, 2);
+    FM_NORM_DOWN(xn, k, SQRT_NORM_HI << 2, 2, 1);
+    FM_NORM_DOWN(xn, k, SQRT_NORM_HI, 2, 1);
+
+    *k_out = k;
+    return xn;
+}
+
+/** sqrt LUT at normalized xn (entries spaced by 2.0) */
+static inline fm_vec_t fm_sqrt_interp(fm_vec_t xn) {
+    return fm_interp(sqrt_lut, FM_SRAI(xn, FIXED_SHIFT + 1),
+                     FM_AND(FM_SRAI(xn, 1), FM_SET1(0xFFFF)));
+}
+
+/** reciprocal LUT at v ∈ [1.0, 256.0) */
+static inline fm_vec_t fm_reciprocal_interp(fm_vec_t v) {
+    fm_vec_t shifted = FM_SUB(v, FM_SET1(FRACUNIT));
+    return fm_interp(reciprocal_lut, FM_SRAI(shifted, FIXED_SHIFT),
+                     FM_AND(shifted, FM_SET1(0xFFFF)));
+}
+
+/* ========================================================================
+ * LANE KERNELS (FM_LANES elements each)
+ * ======================================================================== */
+
+static inline void fm_reciprocal_lanes(const fixed_t* x, fixed_t* out) {
+    const fm_vec_t zero = FM_SET1(0);
+    const fm_vec_t one = FM_SET1(FRACUNIT);
+    fm_vec_t v = FM_LOAD(x);
+    fm_vec_t ax = FM_ABS(v);
+
+    /* |x| < 1.0 (incl. 0 and INT32_MIN) needs a division: scalar patch */
+    fm_vec_t slow = FM_CMPGT(one, ax);
+    ax = FM_SELECT(slow, one, ax);
+
+    /* Scale by 2^k into [128.0, 256.0) */
+    fm_vec_t xn = ax, k = zero;
+    FM_NORM_UP(xn, k, RECIPROCAL_NORM_LO >> 4, 4, 4);
+    FM_NORM_UP(xn, k, RECIPROCAL_NORM_LO >> 2, 2, 2);
+    FM_NORM_UP(xn, k, RECIPROCAL_NORM_LO >> 1, 1, 1);
+    FM_NORM_UP(xn, k, RECIPROCAL_NORM_LO, 1, 1);
+    FM_NORM_DOWN(xn, k, RECIPROCAL_NORM_HI << 4, 4, 4);
+    FM_NORM_DOWN(xn, k, RECIPROCAL_NORM_HI << 2, 2, 2);
+    FM_NORM_DOWN(xn, k, RECIPROCAL_NORM_HI << 1, 1, 1);
+    FM_NORM_DOWN(xn, k, RECIPROCAL_NORM_HI, 1, 1);
+
+    /* y = interp << k (or >> -k) */
+    fm_vec_t y = fm_reciprocal_interp(xn);
+    fm_vec_t k_pos = FM_SELECT(FM_CMPGT(k, zero), k, zero);
+    fm_vec_t k_neg = FM_SELECT(FM_CMPGT(zero, k), FM_SUB(zero, k), zero);
+    y = FM_SLLV(FM_SRAV(y, k_neg), k_pos);
+
+    /* Newton: y = y * (2 - x*y) */
+    fm_vec_t e = fm_mulshift(ax, y, FIXED_SHIFT);
+    y = fm_mulshift(y, FM_SUB(FM_SET1(2 * FRACUNIT), e), FIXED_SHIFT);
+
+    int slow_bits = FM_MASKBITS(slow);
+    if (slow_bits) {
+        fixed_t in[FM_LANES];
+        FM_STORE(in, v);  /* out may alias x */
+        FM_STORE(out, y);
+        for (int l = 0; l < FM_LANES; l++) {
+            if (slow_bits & (1 << l)) {
+                out[l] = fixed_reciprocal(in[l]);
+            }
+        }
+    } else {
+        FM_STORE(out, y);
+    }
+}
+
+static inline void fm_sqrt_lanes(const fixed_t* x, fixed_t* out) {
+    const fm_vec_t zero = FM_SET1(0);
+    fm_vec_t v = FM_LOAD(x);
+    fm_vec_t nonpos = FM_CMPGT(FM_SET1(1), v);
+    fm_vec_t k;
+    fm_vec_t xn = fm_normalize_sqrt(FM_SELECT(nonpos, FM_SET1(SQRT_NORM_LO), v), &k);
+
+    /* s = interp >> k (or << -k) */
+    fm_vec_t s = fm_sqrt_interp(xn);
+    fm_vec_t k_pos = FM_SELECT(FM_CMPGT(k, zero), k, zero);
+    fm_vec_t k_neg = FM_SELECT(FM_CMPGT(zero, k), FM_SUB(zero, k), zero);
+    s = FM_SLLV(FM_SRAV(s, k_pos), k_neg);
+
+    FM_STORE(out, FM_SELECT(nonpos, zero, s));
+}
+
+static inline void fm_inv_sqrt_lanes(const fixed_t* x, fixed_t* out) {
+    fm_vec_t v = FM_LOAD(x);
+    fm_vec_t nonpos = FM_CMPGT(FM_SET1(1), v);
+    fm_vec_t k;
+    fm_vec_t xn = fm_normalize_sqrt(FM_SELECT(nonpos, FM_SET1(SQRT_NORM_LO), v), &k);
+
+    /* Seed from the LUTs, Newton in Q2.30 (see fixed_inv_sqrt) */
+    fm_vec_t y = FM_SLLI(fm_reciprocal_interp(fm_sqrt_interp(xn)), 14);
+    fm_vec_t u = fm_mulshift(xn, y, 30);
+    fm_vec_t e = fm_mulshift(u, y, 30);
+    y = fm_mulshift(y, FM_SUB(FM_SET1(3 * FRACUNIT), e), FIXED_SHIFT + 1);
+
+    /* Q16.16 and 2^k: y >> (14 - k) */
+    y = FM_SRAV(y, FM_SUB(FM_SET1(14), k));
+    FM_STORE(out, FM_SELECT(nonpos, FM_SET1(0), y));
+}
+
+#endif /* FM_LANES > 1 */
+
+/* ========================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ======================================================================== */
+
+int fixed_math_batch_lanes(void) {
+    return FM_LANES;
+}
+
+void fixed_reciprocal_n(const fixed_t* x, fixed_t* out, int n) {
+    int i = 0;
+#if FM_LANES > 1
+    for (; i + FM_LANES <= n; i += FM_LANES) {
+        fm_reciprocal_lanes(x + i, out + i);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = fixed_reciprocal(x[i]);
+    }
+}
+
+void fixed_sqrt_n(const fixed_t* x, fixed_t* out, int n) {
+    int i = 0;
+#if FM_LANES > 1
+    for (; i + FM_LANES <= n; i += FM_LANES) {
+        fm_sqrt_lanes(x + i, out + i);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = fixed_sqrt(x[i]);
+    }
+}
+
+void fixed_inv_sqrt_n(const fixed_t* x, fixed_t* out, int n) {
+    int i = 0;
+#if FM_LANES > 1
+    for (; i + FM_LANES <= n; i += FM_LANES) {
+        fm_inv_sqrt_lanes(x + i, out + i);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = fixed_inv_sqrt(x[i]);
+    }
+}
+
+void fixed_div_safe_n(const fixed_t* a, const fixed_t* b, fixed_t* out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = fixed_div_safe(a[i], b[i]);
+    }
+}
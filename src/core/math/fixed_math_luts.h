@@ -0,0 +1,110 @@
+/* Generated by tools/generate_luts.c - DO NOT EDIT MANUALLY */
+/* This file contains the LUT data and should be included in fixed_math.c */
+#ifndef FIXED_MATH_LUTS_H
+#define FIXED_MATH_LUTS_H
+
+/* Reciprocal LUT: 1/(1 + i), i = 0..255 (Q16.16) */
+const fixed_t reciprocal_lut[RECIPROCAL_LUT_SIZE] = {
+       65536,   32768,   21845,   16384,   13107,   10923,    9362,    8192,  /*   0-  7 */
+        7282,    6554,    5958,    5461,    5041,    4681,    4369,    4096,  /*   8- 15 */
+        3855,    3641,    3449,    3277,    3121,    2979,    2849,    2731,  /*  16- 23 */
+        2621,    2521,    2427,    2341,    2260,    2185,    2114,    2048,  /*  24- 31 */
+        1986,    1928,    1872,    1820,    1771,    1725,    1680,    1638,  /*  32- 39 */
+        1598,    1560,    1524,    1489,    1456,    1425,    1394,    1365,  /*  40- 47 */
+        1337,    1311,    1285,    1260,    1237,    1214,    1192,    1170,  /*  48- 55 */
+        1150,    1130,    1111,    1092,    1074,    1057,    1040,    1024,  /*  56- 63 */
+        1008,     993,     978,     964,     950,     936,     923,     910,  /*  64- 71 */
+         898,     886,     874,     862,     851,     840,     830,     819,  /*  72- 79 */
+         809,     799,     790,     780,     771,     762,     753,     745,  /*  80- 87 */
+         736,     728,     720,     712,     705,     697,     690,     683,  /*  88- 95 */
+         676,     669,     662,     655,     649,     643,     636,     630,  /*  96-103 */
+         624,     618,     612,     607,     601,     596,     590,     585,  /* 104-111 */
+         580,     575,     570,     565,     560,     555,     551,     546,  /* 112-119 */
+         542,     537,     533,     529,     524,     520,     516,     512,  /* 120-127 */
+         508,     504,     500,     496,     493,     489,     485,     482,  /* 128-135 */
+         478,     475,     471,     468,     465,     462,     458,     455,  /* 136-143 */
+         452,     449,     446,     443,     440,     437,     434,     431,  /* 144-151 */
+         428,     426,     423,     420,     417,     415,     412,     410,  /* 152-159 */
+         407,     405,     402,     400,     397,     395,     392,     390,  /* 160-167 */
+         388,     386,     383,     381,     379,     377,     374,     372,  /* 168-175 */
+         370,     368,     366,     364,     362,     360,     358,     356,  /* 176-183 */
+         354,     352,     350,     349,     347,     345,     343,     341,  /* 184-191 */
+         340,     338,     336,     334,     333,     331,     329,     328,  /* 192-199 */
+         326,     324,     323,     321,     320,     318,     317,     315,  /* 200-207 */
+         314,     312,     311,     309,     308,     306,     305,     303,  /* 208-215 */
+         302,     301,     299,     298,     297,     295,     294,     293,  /* 216-223 */
+         291,     290,     289,     287,     286,     285,     284,     282,  /* 224-231 */
+         281,     280,     279,     278,     277,     275,     274,     273,  /* 232-239 */
+         272,     271,     270,     269,     267,     266,     265,     264,  /* 240-247 */
+         263,     262,     261,     260,     259,     258,     257,     256  /* 248-255 */
+};
+
+/* Square root LUT: sqrt(2i), i = 0..511 (Q16.16) */
+const fixed_t sqrt_lut[SQRT_LUT_SIZE] = {
+           0,   92682,  131072,  160530,  185364,  207243,  227023,  245213,  /*   0-  7 */
+      262144,  278046,  293086,  307391,  321060,  334169,  346784,  358955,  /*   8- 15 */
+      370728,  382137,  393216,  403991,  414486,  424722,  434717,  444487,  /*  16- 23 */
+      454047,  463410,  472587,  481589,  490427,  499107,  507640,  516031,  /*  24- 31 */
+      524288,  532417,  540424,  548314,  556091,  563762,  571330,  578798,  /*  32- 39 */
+      586172,  593454,  600647,  607756,  614782,  621729,  628599,  635395,  /*  40- 47 */
+      642119,  648773,  655360,  661881,  668339,  674734,  681070,  687347,  /*  48- 55 */
+      693568,  699733,  705844,  711903,  717911,  723869,  729778,  735640,  /*  56- 63 */
+      741455,  747225,  752951,  758634,  764275,  769874,  775432,  780952,  /*  64- 71 */
+      786432,  791875,  797280,  802649,  807982,  813280,  818544,  823775,  /*  72- 79 */
+      828972,  834137,  839270,  844372,  849444,  854485,  859497,  864479,  /*  80- 87 */
+      869433,  874359,  879258,  884129,  888974,  893792,  898584,  903351,  /*  88- 95 */
+      908093,  912811,  917504,  922173,  926819,  931442,  936041,  940619,  /*  96-103 */
+      945174,  949707,  954219,  958709,  963179,  967627,  972056,  976464,  /* 104-111 */
+      980853,  985222,  989572,  993903,  998215, 1002508, 1006783, 1011040,  /* 112-119 */
+     1015279, 1019501, 1023705, 1027892, 1032062, 1036215, 1040352, 1044472,  /* 120-127 */
+     1048576, 1052664, 1056736, 1060793, 1064834, 1068860, 1072871, 1076866,  /* 128-135 */
+     1080847, 1084814, 1088766, 1092704, 1096627, 1100537, 1104432, 1108314,  /* 136-143 */
+     1112183, 1116038, 1119880, 1123708, 1127524, 1131327, 1135117, 1138894,  /* 144-151 */
+     1142659, 1146412, 1150152, 1153880, 1157597, 1161301, 1164993, 1168674,  /* 152-159 */
+     1172344, 1176002, 1179648, 1183283, 1186908, 1190521, 1194123, 1197714,  /* 160-167 */
+     1201295, 1204865, 1208424, 1211973, 1215512, 1219040, 1222558, 1226066,  /* 168-175 */
+     1229564, 1233053, 1236531, 1239999, 1243458, 1246908, 1250347, 1253778,  /* 176-183 */
+     1257199, 1260610, 1264013, 1267406, 1270790, 1274166, 1277532, 1280889,  /* 184-191 */
+     1284238, 1287578, 1290910, 1294232, 1297547, 1300853, 1304150, 1307439,  /* 192-199 */
+     1310720, 1313993, 1317257, 1320514, 1323762, 1327003, 1330236, 1333460,  /* 200-207 */
+     1336677, 1339887, 1343088, 1346282, 1349469, 1352648, 1355819, 1358983,  /* 208-215 */
+     1362140, 1365290, 1368432, 1371567, 1374695, 1377816, 1380929, 1384036,  /* 216-223 */
+     1387136, 1390229, 1393315, 1396394, 1399466, 1402532, 1405591, 1408643,  /* 224-231 */
+     1411689, 1414728, 1417761, 1420787, 1423806, 1426820, 1429827, 1432827,  /* 232-239 */
+     1435822, 1438810, 1441792, 1444768, 1447738, 1450701, 1453659, 1456610,  /* 240-247 */
+     1459556, 1462496, 1465430, 1468358, 1471280, 1474196, 1477106, 1480011,  /* 248-255 */
+     1482910, 1485804, 1488692, 1491574, 1494451, 1497322, 1500188, 1503048,  /* 256-263 */
+     1505903, 1508752, 1511596, 1514435, 1517268, 1520096, 1522919, 1525737,  /* 264-271 */
+     1528549, 1531356, 1534158, 1536955, 1539747, 1542534, 1545316, 1548093,  /* 272-279 */
+     1550865, 1553632, 1556394, 1559151, 1561903, 1564651, 1567393, 1570131,  /* 280-287 */
+     1572864, 1575592, 1578316, 1581035, 1583749, 1586459, 1589164, 1591864,  /* 288-295 */
+     1594560, 1597251, 1599938, 1602620, 1605298, 1607971, 1610640, 1613304,  /* 296-303 */
+     1615964, 1618620, 1621271, 1623918, 1626561, 1629199, 1631833, 1634463,  /* 304-311 */
+     1637089, 1639710, 1642328, 1644941, 1647550, 1650154, 1652755, 1655352,  /* 312-319 */
+     1657944, 1660533, 1663117, 1665698, 1668274, 1670847, 1673415, 1675980,  /* 320-327 */
+     1678541, 1681097, 1683650, 1686199, 1688745, 1691286, 1693824, 1696357,  /* 328-335 */
+     1698887, 1701414, 1703936, 1706455, 1708970, 1711481, 1713989, 1716493,  /* 336-343 */
+     1718993, 1721490, 1723983, 1726473, 1728958, 1731441, 1733920, 1736395,  /* 344-351 */
+     1738867, 1741335, 1743800, 1746261, 1748719, 1751173, 1753624, 1756071,  /* 352-359 */
+     1758515, 1760956, 1763393, 1765827, 1768258, 1770685, 1773109, 1775530,  /* 360-367 */
+     1777947, 1780361, 1782772, 1785180, 1787584, 1789985, 1792383, 1794777,  /* 368-375 */
+     1797169, 1799557, 1801942, 1804324, 1806703, 1809079, 1811451, 1813821,  /* 376-383 */
+     1816187, 1818550, 1820910, 1823268, 1825622, 1827973, 1830321, 1832666,  /* 384-391 */
+     1835008, 1837347, 1839683, 1842016, 1844347, 1846674, 1848998, 1851320,  /* 392-399 */
+     1853638, 1855954, 1858266, 1860576, 1862883, 1865187, 1867489, 1869787,  /* 400-407 */
+     1872083, 1874375, 1876666, 1878953, 1881237, 1883519, 1885798, 1888074,  /* 408-415 */
+     1890347, 1892618, 1894886, 1897151, 1899414, 1901674, 1903931, 1906185,  /* 416-423 */
+     1908437, 1910686, 1912933, 1915177, 1917418, 1919657, 1921893, 1924126,  /* 424-431 */
+     1926357, 1928585, 1930811, 1933034, 1935255, 1937473, 1939689, 1941902,  /* 432-439 */
+     1944112, 1946320, 1948525, 1950728, 1952929, 1955127, 1957322, 1959516,  /* 440-447 */
+     1961706, 1963894, 1966080, 1968263, 1970444, 1972623, 1974799, 1976973,  /* 448-455 */
+     1979144, 1981313, 1983479, 1985644, 1987805, 1989965, 1992122, 1994277,  /* 456-463 */
+     1996429, 1998579, 2000727, 2002873, 2005016, 2007157, 2009296, 2011432,  /* 464-471 */
+     2013566, 2015698, 2017828, 2019955, 2022080, 2024203, 2026324, 2028442,  /* 472-479 */
+     2030559, 2032673, 2034785, 2036894, 2039002, 2041107, 2043210, 2045311,  /* 480-487 */
+     2047410, 2049507, 2051601, 2053694, 2055784, 2057872, 2059958, 2062042,  /* 488-495 */
+     2064124, 2066204, 2068281, 2070357, 2072430, 2074502, 2076571, 2078638,  /* 496-503 */
+     2080704, 2082767, 2084828, 2086887, 2088944, 2090999, 2093052, 2095103  /* 504-511 */
+};
+
+#endif /* FIXED_MATH_LUTS_H */
@@ -0,0 +1,369 @@
+/*
+ * mem_stats.c - Memory Accounting by Subsystem
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _GNU_SOURCE     /* MAP_ANONYMOUS, madvise, syscall */
+
+#include "include/mem_stats.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+#define NEG_MEM_NO_MMAP 1
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+/* Block header; the alignment members keep the payload aligned like malloc's
+ * (max_align_t is C11, the Makefile tests build as C99) */
+typedef union {
+    struct {
+        size_t size;
+        uint32_t sub;
+    } info;
+    long double align_ld;
+    long long align_ll;
+    void* align_ptr;
+} MemHeader;
+
+/* MemHeader.info.sub flag: block comes from neg_mem_map() */
+#define MEM_MAPPED 0x80000000u
+
+/* Precedes the MemHeader of a mapped block, at the start of the mapping */
+typedef union {
+    struct {
+        void* base;                         /* munmap() arguments */
+        size_t length;
+        uint64_t nodes[NEG_MEM_MAX_NODES];  /* Last neg_mem_locality() result */
+    } map;
+    MemHeader align;
+} MapHeader;
+
+typedef struct {
+    _Atomic uint64_t current;
+    _Atomic uint64_t peak;
+    _Atomic uint64_t statics;
+    _Atomic uint64_t allocs;
+    _Atomic uint64_t frees;
+    _Atomic uint64_t mapped;
+} MemCounters;
+
+static MemCounters g_subsystems[NEG_MEM_SUBSYSTEM_COUNT];
+static MemCounters g_total;
+static _Atomic uint64_t g_node_bytes[NEG_MEM_MAX_NODES];
+
+/* Static registrations: name -> bytes, guarded by a spinlock (init only) */
+static const char* g_static_names[NEG_MEM_MAX_STATIC];
+static int g_static_count = 0;
+static atomic_flag g_static_lock = ATOMIC_FLAG_INIT;
+
+static const char* const k_subsystem_names[NEG_MEM_SUBSYSTEM_COUNT] = {
+    "state",
+    "octree",
+    "integrator",
+    "solver",
+    "lut",
+    "io",
+    "diagnostics",
+};
+
+/* ========================================================================
+ * COUNTERS
+ * ======================================================================== */
+
+static void raise_peak(_Atomic uint64_t* peak, uint64_t value) {
+    uint64_t seen = atomic_load_explicit(peak, memory_order_relaxed);
+    while (value > seen &&
+           !atomic_compare_exchange_weak_explicit(peak, &seen, value,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+    }
+}
+
+/* count_block: 0 for the two halves of a resize, so allocs - frees stays
+ * the live block count */
+static void charge(MemCounters* c, uint64_t bytes, int count_block) {
+    uint64_t now = atomic_fetch_add_explicit(&c->current, bytes, memory_order_relaxed) + bytes;
+    if (count_block) atomic_fetch_add_explicit(&c->allocs, 1, memory_order_relaxed);
+    raise_peak(&c->peak, now);
+}
+
+static void release(MemCounters* c, uint64_t bytes, int count_block) {
+    atomic_fetch_sub_explicit(&c->current, bytes, memory_order_relaxed);
+    if (count_block) atomic_fetch_add_explicit(&c->frees, 1, memory_order_relaxed);
+}
+
+static uint32_t clamp_sub(NegMemSubsystem sub) {
+    return ((int)sub >= 0 && (int)sub < NEG_MEM_SUBSYSTEM_COUNT) ? (uint32_t)sub
+                                                                  : (uint32_t)NEG_MEM_STATE;
+}
+
+/* ========================================================================
+ * ALLOCATION
+ * ======================================================================== */
+
+static void* finish_alloc(MemHeader* h, uint32_t sub, size_t size, int count_block) {
+    if (!h) return NULL;
+    h->info.size = size;
+    h->info.sub = sub;
+    charge(&g_subsystems[sub], size, count_block);
+    charge(&g_total, size, count_block);
+    return h + 1;
+}
+
+void* neg_mem_malloc(NegMemSubsystem sub, size_t size) {
+    if (size > SIZE_MAX - sizeof(MemHeader)) return NULL;
+    return finish_alloc((MemHeader*)malloc(sizeof(MemHeader) + size), clamp_sub(sub), size, 1);
+}
+
+void* neg_mem_calloc(NegMemSubsystem sub, size_t count, size_t size) {
+    if (size != 0 && count > (SIZE_MAX - sizeof(MemHeader)) / size) return NULL;
+    size_t bytes = count * size;
+    return finish_alloc((MemHeader*)calloc(1, sizeof(MemHeader) + bytes), clamp_sub(sub),
+                        bytes, 1);
+}
+
+void* neg_mem_realloc(NegMemSubsystem sub, void* ptr, size_t size) {
+    if (!ptr) return neg_mem_malloc(sub, size);
+    if (size > SIZE_MAX - sizeof(MemHeader)) return NULL;
+
+    MemHeader* old = (MemHeader*)ptr - 1;
+    if (old->info.sub & MEM_MAPPED) return NULL;
+    size_t old_size = old->info.size;
+    uint32_t owner = old->info.sub;
+
+    MemHeader* h = (MemHeader*)realloc(old, sizeof(MemHeader) + size);
+    if (!h) return NULL;
+
+    release(&g_subsystems[owner], old_size, 0);
+    release(&g_total, old_size, 0);
+    return finish_alloc(h, owner, size, 0);
+}
+
+/* Move a mapped block's recorded placement from old to now (NULL: clear) */
+static void swap_nodes(uint64_t old[NEG_MEM_MAX_NODES], const uint64_t* now) {
+    for (int n = 0; n < NEG_MEM_MAX_NODES; n++) {
+        uint64_t bytes = now ? now[n] : 0;
+        atomic_fetch_sub_explicit(&g_node_bytes[n], old[n], memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_node_bytes[n], bytes, memory_order_relaxed);
+        old[n] = bytes;
+    }
+}
+
+void* neg_mem_map(NegMemSubsystem sub, size_t size) {
+#ifdef NEG_MEM_NO_MMAP
+    return neg_mem_calloc(sub, 1, size);
+#else
+    const size_t head = sizeof(MapHeader) + sizeof(MemHeader);
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if (size > SIZE_MAX - head - page - NEG_MEM_HUGE_PAGE) return NULL;
+
+    size_t length = (head + size + page - 1) / page * page;
+    size_t slack = length >= NEG_MEM_HUGE_PAGE ? NEG_MEM_HUGE_PAGE : 0;
+    uint8_t* raw = (uint8_t*)mmap(NULL, length + slack, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+
+    /* Trim to a huge-page-aligned start so whole huge pages back the block */
+    uint8_t* base = raw;
+    if (slack) {
+        base = (uint8_t*)(((uintptr_t)raw + NEG_MEM_HUGE_PAGE - 1) &
+                          ~(uintptr_t)(NEG_MEM_HUGE_PAGE - 1));
+        if (base > raw) munmap(raw, (size_t)(base - raw));
+        if (base + length < raw + length + slack) {
+            munmap(base + length, (size_t)(raw + length + slack - (base + length)));
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(base, length, MADV_HUGEPAGE);   /* Advisory: ignored without THP */
+#endif
+    }
+
+    /* Only the header's page is touched here */
+    MapHeader* m = (MapHeader*)base;
+    m->map.base = base;
+    m->map.length = length;
+
+    uint32_t owner = clamp_sub(sub);
+    void* ptr = finish_alloc((MemHeader*)(m + 1), owner, size, 1);
+    ((MemHeader*)ptr - 1)->info.sub = owner | MEM_MAPPED;
+    atomic_fetch_add_explicit(&g_subsystems[owner].mapped, size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_total.mapped, size, memory_order_relaxed);
+    return ptr;
+#endif
+}
+
+int neg_mem_locality(void* ptr, uint64_t node_bytes[NEG_MEM_MAX_NODES]) {
+    if (node_bytes) memset(node_bytes, 0, NEG_MEM_MAX_NODES * sizeof(uint64_t));
+    if (!ptr) return 0;
+    MemHeader* h = (MemHeader*)ptr - 1;
+    if (!(h->info.sub & MEM_MAPPED)) return 0;
+
+#if defined(NEG_MEM_NO_MMAP) || !defined(SYS_move_pages)
+    return 0;
+#else
+    /* move_pages() with no target nodes only reports each page's node */
+    MapHeader* m = (MapHeader*)h - 1;
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t pages = m->map.length / page;
+    uint64_t nodes[NEG_MEM_MAX_NODES] = { 0 };
+    int seen = 0;
+
+    enum { BATCH = 512 };
+    void* addrs[BATCH];
+    int status[BATCH];
+    for (size_t first = 0; first < pages; first += BATCH) {
+        size_t n = pages - first < BATCH ? pages - first : BATCH;
+        for (size_t i = 0; i < n; i++) {
+            addrs[i] = (uint8_t*)m->map.base + (first + i) * page;
+        }
+        if (syscall(SYS_move_pages, 0, (unsigned long)n, addrs, NULL, status, 0) != 0) {
+            return 0;   /* No NUMA support: placement unknown */
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (status[i] < 0) continue;    /* Not resident yet */
+            int node = status[i] < NEG_MEM_MAX_NODES ? status[i] : NEG_MEM_MAX_NODES - 1;
+            nodes[node] += page;
+            if (node + 1 > seen) seen = node + 1;
+        }
+    }
+
+    swap_nodes(m->map.nodes, nodes);
+    if (node_bytes) memcpy(node_bytes, nodes, sizeof(nodes));
+    return seen;
+#endif
+}
+
+void neg_mem_free(void* ptr) {
+    if (!ptr) return;
+    MemHeader* h = (MemHeader*)ptr - 1;
+    uint32_t sub = h->info.sub & ~MEM_MAPPED;
+    release(&g_subsystems[sub], h->info.size, 1);
+    release(&g_total, h->info.size, 1);
+
+#ifndef NEG_MEM_NO_MMAP
+    if (h->info.sub & MEM_MAPPED) {
+        MapHeader* m = (MapHeader*)h - 1;
+        atomic_fetch_sub_explicit(&g_subsystems[sub].mapped, h->info.size, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&g_total.mapped, h->info.size, memory_order_relaxed);
+        swap_nodes(m->map.nodes, NULL);
+        munmap(m->map.base, m->map.length);
+        return;
+    }
+#endif
+    free(h);
+}
+
+void neg_mem_register_static(NegMemSubsystem sub, const char* name, size_t bytes) {
+    if (!name) return;
+
+    while (atomic_flag_test_and_set_explicit(&g_static_lock, memory_order_acquire)) {
+    }
+    int known = 0;
+    for (int i = 0; i < g_static_count && !known; i++) {
+        known = (strcmp(g_static_names[i], name) == 0);
+    }
+    if (!known && g_static_count < NEG_MEM_MAX_STATIC) {
+        g_static_names[g_static_count++] = name;
+        atomic_fetch_add_explicit(&g_subsystems[clamp_sub(sub)].statics, bytes,
+                                  memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_total.statics, bytes, memory_order_relaxed);
+    }
+    atomic_flag_clear_explicit(&g_static_lock, memory_order_release);
+}
+
+/* ========================================================================
+ * REPORTING
+ * ======================================================================== */
+
+static NegMemStats read_counters(MemCounters* c) {
+    NegMemStats s;
+    s.current_bytes = atomic_load_explicit(&c->current, memory_order_relaxed);
+    s.peak_bytes = atomic_load_explicit(&c->peak, memory_order_relaxed);
+    s.static_bytes = atomic_load_explicit(&c->statics, memory_order_relaxed);
+    s.allocs = atomic_load_explicit(&c->allocs, memory_order_relaxed);
+    s.frees = atomic_load_explicit(&c->frees, memory_order_relaxed);
+    s.mapped_bytes = atomic_load_explicit(&c->mapped, memory_order_relaxed);
+    return s;
+}
+
+void neg_mem_report(NegMemReport* report) {
+    if (!report) return;
+    report->total = read_counters(&g_total);
+    for (int i = 0; i < NEG_MEM_SUBSYSTEM_COUNT; i++) {
+        report->subsystems[i] = read_counters(&g_subsystems[i]);
+    }
+    for (int n = 0; n < NEG_MEM_MAX_NODES; n++) {
+        report->node_bytes[n] = atomic_load_explicit(&g_node_bytes[n], memory_order_relaxed);
+    }
+}
+
+const char* neg_mem_subsystem_name(NegMemSubsystem sub) {
+    return ((int)sub >= 0 && (int)sub < NEG_MEM_SUBSYSTEM_COUNT) ? k_subsystem_names[sub]
+                                                                  : "unknown";
+}
+
+/* snprintf at *pos; returns -1 once the buffer is exhausted */
+static int append(char* buffer, size_t max_len, size_t* pos, const char* fmt, ...) {
+    if (*pos >= max_len) return -1;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buffer + *pos, max_len - *pos, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= max_len - *pos) return -1;
+    *pos += (size_t)n;
+    return 0;
+}
+
+static int append_stats(char* buffer, size_t max_len, size_t* pos, const NegMemStats* s) {
+    return append(buffer, max_len, pos,
+                  "\"current_bytes\":%llu,\"peak_bytes\":%llu,\"static_bytes\":%llu,"
+                  "\"allocs\":%llu,\"frees\":%llu,\"mapped_bytes\":%llu",
+                  (unsigned long long)s->current_bytes, (unsigned long long)s->peak_bytes,
+                  (unsigned long long)s->static_bytes, (unsigned long long)s->allocs,
+                  (unsigned long long)s->frees, (unsigned long long)s->mapped_bytes);
+}
+
+int neg_mem_report_json(char* buffer, size_t max_len) {
+    if (!buffer || max_len == 0) return -1;
+
+    NegMemReport r;
+    neg_mem_report(&r);
+
+    size_t pos = 0;
+    if (append(buffer, max_len, &pos, "{") != 0 ||
+        append_stats(buffer, max_len, &pos, &r.total) != 0 ||
+        append(buffer, max_len, &pos, ",\"numa_nodes\":[") != 0) {
+        return -1;
+    }
+    int nodes = 1;
+    for (int n = 1; n < NEG_MEM_MAX_NODES; n++) {
+        if (r.node_bytes[n]) nodes = n + 1;
+    }
+    for (int n = 0; n < nodes; n++) {
+        if (append(buffer, max_len, &pos, "%s%llu", n ? "," : "",
+                   (unsigned long long)r.node_bytes[n]) != 0) {
+            return -1;
+        }
+    }
+    if (append(buffer, max_len, &pos, "],\"subsystems\":{") != 0) return -1;
+    for (int i = 0; i < NEG_MEM_SUBSYSTEM_COUNT; i++) {
+        if (append(buffer, max_len, &pos, "%s\"%s\":{", i ? "," : "", k_subsystem_names[i]) != 0 ||
+            append_stats(buffer, max_len, &pos, &r.subsystems[i]) != 0 ||
+            append(buffer, max_len, &pos, "}") != 0) {
+            return -1;
+        }
+    }
+    if (append(buffer, max_len, &pos, "}}") != 0) return -1;
+    return (int)pos;
+}
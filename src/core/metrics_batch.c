@@ -0,0 +1,819 @@
+/*
+ * metrics_batch.c - Batched SE(3) Double-and-Scale Metrics
+ *
+ * Double-precision port of the λ-estimation path in
+ * src/core/se3_double_scale.py and src/core/resonance_aware.py. Function
+ * names follow the Python they mirror; see metrics_batch.h for the
+ * tolerance contract.
+ *
+ * Built without -ffast-math (CMakeLists.txt): the port relies on IEEE
+ * evaluation order, and on explicit fma() where NumPy goes through BLAS,
+ * to reproduce NumPy's rounding.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "include/metrics_batch.h"
+#include "include/mem_stats.h"
+#include "include/rng.h"
+#include "include/thread_pool.h"
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+
+/* scipy.optimize bounded Brent defaults */
+#define BRENT_XATOL   1.0e-5
+#define BRENT_MAXFUN  500
+
+/* ResonanceDetector: tolerance and the wide search used for comparison */
+#define RESONANCE_TOLERANCE 0.1
+#define RESONANCE_LAMBDA_LO 0.1
+#define RESONANCE_LAMBDA_HI 10.0
+
+#define TWO_PI 6.283185307179586
+
+static const char* const k_resonance_names[NEG_RESONANCE_COUNT] = {
+    "golden_ratio",
+    "silver_ratio",
+    "plastic_number",
+    "octave",
+    "perfect_fifth",
+    "perfect_fourth",
+    "major_third",
+};
+
+/* VerificationCascade default weights, in dict order */
+static const double k_verify_weights[NEG_VERIFY_COUNT] = { 0.3, 0.2, 0.2, 0.2, 0.1 };
+
+void neg_metrics_options_default(NegMetricsOptions* opt) {
+    opt->lambda_lo = 0.1;
+    opt->lambda_hi = 2.0;
+    opt->r_max = 1.0;
+    opt->bounded = 1;
+    opt->resonance = 1;
+    opt->verification = 1;
+    opt->noise_trials = 10;
+    opt->noise_level = 0.05;
+    opt->seed = 0;
+}
+
+const char* neg_metrics_resonance_name(int index) {
+    return (index >= 0 && index < NEG_RESONANCE_COUNT) ? k_resonance_names[index] : NULL;
+}
+
+/* ========================================================================
+ * NUMPY REDUCTIONS
+ * ======================================================================== */
+
+/** numpy pairwise_sum: 8 accumulators per 128-element block */
+static double pairwise_sum(const double* a, size_t n) {
+    if (n < 8) {
+        double res = 0.0;
+        for (size_t i = 0; i < n; i++) res += a[i];
+        return res;
+    }
+    if (n <= 128) {
+        double r[8];
+        for (int k = 0; k < 8; k++) r[k] = a[k];
+        size_t i;
+        for (i = 8; i < n - (n % 8); i += 8) {
+            for (int k = 0; k < 8; k++) r[k] += a[i + k];
+        }
+        double res = ((r[0] + r[1]) + (r[2] + r[3])) + ((r[4] + r[5]) + (r[6] + r[7]));
+        for (; i < n; i++) res += a[i];
+        return res;
+    }
+    size_t n2 = n / 2;
+    n2 -= n2 % 8;
+    return pairwise_sum(a, n2) + pairwise_sum(a + n2, n - n2);
+}
+
+static double norm3(const double v[3]) {
+    return sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+}
+
+/**
+ * np.linalg.norm (vector, or 'fro' of a raveled matrix): sqrt(x.dot(x)),
+ * where the BLAS dot of a few elements is a sequential fused multiply-add.
+ */
+static double blas_norm(const double* v, int n) {
+    double sq = 0.0;
+    for (int i = 0; i < n; i++) sq = fma(v[i], v[i], sq);
+    return sqrt(sq);
+}
+
+/* ========================================================================
+ * ROTATIONS (scipy.spatial.transform.Rotation)
+ * ======================================================================== */
+
+/** Rotation.from_rotvec -> quaternion (x, y, z, w) */
+static void quat_from_rotvec(const double rv[3], double q[4]) {
+    double angle = norm3(rv);
+    double scale;
+    if (angle <= 1e-3) {
+        double angle2 = angle * angle;
+        scale = 0.5 - angle2 / 48 + angle2 * angle2 / 3840;
+    } else {
+        scale = sin(angle / 2) / angle;
+    }
+    q[0] = rv[0] * scale;
+    q[1] = rv[1] * scale;
+    q[2] = rv[2] * scale;
+    q[3] = cos(angle / 2);
+}
+
+/** Rotation.as_matrix (row-major) */
+static void quat_to_matrix(const double q[4], double m[9]) {
+    double x = q[0], y = q[1], z = q[2], w = q[3];
+    double x2 = x * x, y2 = y * y, z2 = z * z, w2 = w * w;
+    double xy = x * y, zw = z * w, xz = x * z, yw = y * w, yz = y * z, xw = x * w;
+
+    m[0] = x2 - y2 - z2 + w2;
+    m[1] = 2 * (xy - zw);
+    m[2] = 2 * (xz + yw);
+    m[3] = 2 * (xy + zw);
+    m[4] = -x2 + y2 - z2 + w2;
+    m[5] = 2 * (yz - xw);
+    m[6] = 2 * (xz - yw);
+    m[7] = 2 * (yz + xw);
+    m[8] = -x2 - y2 + z2 + w2;
+}
+
+static void rotvec_to_matrix(const double rv[3], double m[9]) {
+    double q[4];
+    quat_from_rotvec(rv, q);
+    quat_to_matrix(q, m);
+}
+
+static double det3(const double m[9]) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7]) -
+           m[1] * (m[3] * m[8] - m[5] * m[6]) +
+           m[2] * (m[3] * m[7] - m[4] * m[6]);
+}
+
+/** Gramian M M^T */
+static void gramian(const double m[9], double g[9]) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            g[i * 3 + j] = m[i * 3] * m[j * 3] + m[i * 3 + 1] * m[j * 3 + 1] +
+                           m[i * 3 + 2] * m[j * 3 + 2];
+        }
+    }
+}
+
+/** np.isclose(g, I, rtol=1e-5, atol) for every element */
+static int gramian_is_identity(const double g[9], double atol) {
+    for (int i = 0; i < 9; i++) {
+        double eye = (i % 4 == 0) ? 1.0 : 0.0;
+        if (!(fabs(g[i] - eye) <= atol + 1e-5 * eye)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Orthogonal polar factor (scipy takes U Vt of the SVD, the same matrix)
+ * by Newton iteration X <- (X + X^-T) / 2, quadratic for near-rotations.
+ */
+static void polar_factor(double m[9]) {
+    for (int iter = 0; iter < 32; iter++) {
+        double det = det3(m);
+        if (det == 0.0) return;
+        /* X^-T = cofactor(X) / det */
+        double cof[9] = {
+            m[4] * m[8] - m[5] * m[7], m[5] * m[6] - m[3] * m[8], m[3] * m[7] - m[4] * m[6],
+            m[2] * m[7] - m[1] * m[8], m[0] * m[8] - m[2] * m[6], m[1] * m[6] - m[0] * m[7],
+            m[1] * m[5] - m[2] * m[4], m[2] * m[3] - m[0] * m[5], m[0] * m[4] - m[1] * m[3],
+        };
+        double delta = 0.0;
+        for (int i = 0; i < 9; i++) {
+            double next = 0.5 * (m[i] + cof[i] / det);
+            delta = fmax(delta, fabs(next - m[i]));
+            m[i] = next;
+        }
+        if (delta < 1e-16) return;
+    }
+}
+
+/** Rotation.from_matrix (Markley) -> normalized quaternion */
+static void quat_from_matrix(const double matrix[9], double q[4]) {
+    double m[9];
+    double g[9];
+    memcpy(m, matrix, sizeof(m));
+    gramian(m, g);
+    if (!gramian_is_identity(g, 1e-12)) polar_factor(m);
+
+    double trace = m[0] + m[4] + m[8];
+    double decision[4] = { m[0], m[4], m[8], trace };
+    int choice = 0;
+    for (int c = 1; c < 4; c++) {
+        if (decision[c] > decision[choice]) choice = c;
+    }
+
+    if (choice != 3) {
+        int i = choice, j = (i + 1) % 3, k = (j + 1) % 3;
+        q[i] = 1 - decision[3] + 2 * m[i * 3 + i];
+        q[j] = m[j * 3 + i] + m[i * 3 + j];
+        q[k] = m[k * 3 + i] + m[i * 3 + k];
+        q[3] = m[k * 3 + j] - m[j * 3 + k];
+    } else {
+        q[0] = m[7] - m[5];
+        q[1] = m[2] - m[6];
+        q[2] = m[3] - m[1];
+        q[3] = 1 + decision[3];
+    }
+
+    double n = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (int c = 0; c < 4; c++) q[c] /= n;
+}
+
+/** Rotation.as_rotvec (canonical quaternion, Taylor branch below 1e-3) */
+static void quat_to_rotvec(const double quat[4], double rv[3]) {
+    double q[4] = { quat[0], quat[1], quat[2], quat[3] };
+    int flip = q[3] < 0;
+    if (q[3] == 0) {
+        for (int c = 0; c < 3; c++) {
+            if (q[c] != 0) {
+                flip = q[c] < 0;
+                break;
+            }
+        }
+    }
+    if (flip) {
+        for (int c = 0; c < 4; c++) q[c] = -q[c];
+    }
+
+    double angle = 2 * atan2(norm3(q), q[3]);
+    double scale;
+    if (angle <= 1e-3) {
+        double angle2 = angle * angle;
+        scale = 2 + angle2 / 12 + 7 * (angle2 * angle2) / 2880;
+    } else {
+        scale = angle / sin(angle / 2.0);
+    }
+    rv[0] = scale * q[0];
+    rv[1] = scale * q[1];
+    rv[2] = scale * q[2];
+}
+
+static void matrix_to_rotvec(const double m[9], double rv[3]) {
+    double q[4];
+    quat_from_matrix(m, q);
+    quat_to_rotvec(q, rv);
+}
+
+/* ========================================================================
+ * PER-TRAJECTORY WORKSPACE
+ * ======================================================================== */
+
+typedef struct {
+    double* rv;         /* Canonical rotation vectors [T][3] */
+    double* t;          /* Translations [T][3] */
+    double* rs;         /* Scaled rotations of the last cost call [T][9] */
+    double* ts;         /* Scaled translations [T][3] */
+    double* noisy_rv;   /* Noise trial poses [T][3] */
+    double* noisy_t;
+    double* steps;      /* Step sizes [T], then noise trial errors */
+    size_t capacity;    /* Poses (at least the trial count) */
+    void* block;
+} Workspace;
+
+static int workspace_reserve(Workspace* ws, size_t n) {
+    if (n <= ws->capacity) return 0;
+    /* 3 + 3 + 9 + 3 + 3 + 3 + 1 doubles per pose */
+    void* block = neg_mem_realloc(NEG_MEM_SOLVER, ws->block, n * 25 * sizeof(double));
+    if (!block) return -1;
+    double* p = (double*)block;
+    ws->block = block;
+    ws->rv = p;
+    ws->t = p + n * 3;
+    ws->rs = p + n * 6;
+    ws->ts = p + n * 15;
+    ws->noisy_rv = p + n * 18;
+    ws->noisy_t = p + n * 21;
+    ws->steps = p + n * 24;
+    ws->capacity = n;
+    return 0;
+}
+
+/** Outcome of one evaluation; fail_value set when status != OK */
+typedef struct {
+    int status;
+    double fail_value;
+} Check;
+
+static int check_bounds(const double t[3], const NegMetricsOptions* opt, Check* chk) {
+    if (!opt->bounded) return 0;
+    double n = blas_norm(t, 3);
+    if (n <= opt->r_max) return 0;
+    chk->status = NEG_METRICS_OUT_OF_BOUNDS;
+    chk->fail_value = n;
+    return -1;
+}
+
+/** SE3Pose.__post_init__: allclose(det, 1) and allclose(R R^T, I), atol 1e-6 */
+static int check_rotation(const double m[9], Check* chk) {
+    double det = det3(m);
+    if (!(fabs(det - 1.0) <= 1e-6 + 1e-5)) {
+        chk->status = NEG_METRICS_BAD_DETERMINANT;
+        chk->fail_value = det;
+        return -1;
+    }
+    double g[9];
+    gramian(m, g);
+    if (!gramian_is_identity(g, 1e-6)) {
+        chk->status = NEG_METRICS_NOT_ORTHOGONAL;
+        chk->fail_value = det;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * TrajectoryEncoder + SE3Trajectory: fill ws->rv / ws->t with the
+ * rotation vectors scale_se3_pose() recovers from each pose's matrix.
+ */
+static int encode(const double* in, size_t n, NegPoseFormat format,
+                  const NegMetricsOptions* opt, Workspace* ws, Check* chk) {
+    double m[9];
+    for (size_t i = 0; i < n; i++) {
+        double* rv = ws->rv + i * 3;
+        double* t = ws->t + i * 3;
+
+        if (format == NEG_POSE_MATRIX) {
+            const double* p = in + i * 12;
+            memcpy(m, p, sizeof(m));
+            memcpy(t, p + 9, 3 * sizeof(double));
+            if (check_rotation(m, chk) != 0) return -1;
+        } else {
+            const double* p = in + i * 6;
+            double raw[3];
+            if (format == NEG_POSE_TIMESERIES && i > 0) {
+                const double* prev = p - 6;
+                for (int c = 0; c < 3; c++) {
+                    raw[c] = p[c] - prev[c];
+                    t[c] = p[3 + c] - prev[3 + c];
+                }
+            } else if (format == NEG_POSE_TIMESERIES) {
+                raw[0] = raw[1] = raw[2] = 0.0;
+                memcpy(t, p + 3, 3 * sizeof(double));
+            } else {
+                memcpy(raw, p, sizeof(raw));
+                memcpy(t, p + 3, 3 * sizeof(double));
+            }
+            rotvec_to_matrix(raw, m);
+        }
+        matrix_to_rotvec(m, rv);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (check_bounds(ws->t + i * 3, opt, chk) != 0) return -1;
+    }
+    return 0;
+}
+
+/** 3x3 row-major a @ b, accumulated like the BLAS kernel behind np.matmul */
+static void matmul3(const double a[9], const double b[9], double out[9]) {
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            out[i * 3 + j] = fma(a[i * 3 + 2], b[6 + j], fma(a[i * 3 + 1], b[3 + j], a[i * 3] * b[j]));
+        }
+    }
+}
+
+/**
+ * compute_return_error(trajectory, λ, double=True) over (rv, t); leaves
+ * the scaled poses in ws->rs / ws->ts.
+ */
+static int compute_return_error(const double* rv, const double* t, size_t n, double lam,
+                                 const NegMetricsOptions* opt, Workspace* ws,
+                                 double* error, Check* chk) {
+    for (size_t i = 0; i < n; i++) {
+        double srv[3] = { lam * rv[i * 3], lam * rv[i * 3 + 1], lam * rv[i * 3 + 2] };
+        rotvec_to_matrix(srv, ws->rs + i * 9);
+        for (int c = 0; c < 3; c++) ws->ts[i * 3 + c] = lam * t[i * 3 + c];
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (check_bounds(ws->ts + i * 3, opt, chk) != 0) return -1;
+    }
+
+    /* compose_trajectory over the doubled sequence */
+    double r[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    double p[3] = { 0, 0, 0 };
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < n; i++) {
+            const double* rs = ws->rs + i * 9;
+            const double* ts = ws->ts + i * 3;
+            double rn[9];
+            double pn[3];
+            matmul3(r, rs, rn);
+            for (int c = 0; c < 3; c++) {
+                pn[c] = fma(r[c * 3 + 2], ts[2], fma(r[c * 3 + 1], ts[1], r[c * 3] * ts[0])) + p[c];
+            }
+            memcpy(r, rn, sizeof(r));
+            memcpy(p, pn, sizeof(p));
+        }
+    }
+
+    /* frobenius_distance_to_identity */
+    for (int i = 0; i < 9; i += 4) r[i] -= 1.0;
+    *error = blas_norm(r, 9) + blas_norm(p, 3);
+    return 0;
+}
+
+/* ========================================================================
+ * BOUNDED BRENT (scipy.optimize._minimize_scalar_bounded)
+ * ======================================================================== */
+
+typedef struct {
+    double x;
+    double fun;
+    int nfev;
+    int success;
+} Minimum;
+
+static double sign(double v) {
+    return (double)((v > 0) - (v < 0));
+}
+
+static int minimize_bounded(const double* rv, const double* t, size_t n,
+                            double lo, double hi, const NegMetricsOptions* opt,
+                            Workspace* ws, Minimum* out, Check* chk) {
+    const double sqrt_eps = sqrt(2.2e-16);
+    const double golden_mean = 0.5 * (3.0 - sqrt(5.0));
+    int flag = 0;
+
+    double a = lo, b = hi;
+    double fulc = a + golden_mean * (b - a);
+    double nfc = fulc, xf = fulc;
+    double rat = 0.0, e = 0.0;
+    double x = xf;
+    double fx;
+    if (compute_return_error(rv, t, n, x, opt, ws, &fx, chk) != 0) return -1;
+    int num = 1;
+    double fu = INFINITY;
+
+    double ffulc = fx, fnfc = fx;
+    double xm = 0.5 * (a + b);
+    double tol1 = sqrt_eps * fabs(xf) + BRENT_XATOL / 3.0;
+    double tol2 = 2.0 * tol1;
+
+    while (fabs(xf - xm) > (tol2 - 0.5 * (b - a))) {
+        int golden = 1;
+        if (fabs(e) > tol1) {
+            golden = 0;
+            double r = (xf - nfc) * (fx - ffulc);
+            double q = (xf - fulc) * (fx - fnfc);
+            double p = (xf - fulc) * q - (xf - nfc) * r;
+            q = 2.0 * (q - r);
+            if (q > 0.0) p = -p;
+            q = fabs(q);
+            r = e;
+            e = rat;
+
+            if ((fabs(p) < fabs(0.5 * q * r)) && (p > q * (a - xf)) && (p < q * (b - xf))) {
+                rat = (p + 0.0) / q;
+                x = xf + rat;
+                if (((x - a) < tol2) || ((b - x) < tol2)) {
+                    double si = sign(xm - xf) + ((xm - xf) == 0);
+                    rat = tol1 * si;
+                }
+            } else {
+                golden = 1;
+            }
+        }
+
+        if (golden) {
+            e = (xf >= xm) ? a - xf : b - xf;
+            rat = golden_mean * e;
+        }
+
+        double si = sign(rat) + (rat == 0);
+        x = xf + si * fmax(fabs(rat), tol1);
+        if (compute_return_error(rv, t, n, x, opt, ws, &fu, chk) != 0) return -1;
+        num++;
+
+        if (fu <= fx) {
+            if (x >= xf) {
+                a = xf;
+            } else {
+                b = xf;
+            }
+            fulc = nfc;
+            ffulc = fnfc;
+            nfc = xf;
+            fnfc = fx;
+            xf = x;
+            fx = fu;
+        } else {
+            if (x < xf) {
+                a = x;
+            } else {
+                b = x;
+            }
+            if ((fu <= fnfc) || (nfc == xf)) {
+                fulc = nfc;
+                ffulc = fnfc;
+                nfc = x;
+                fnfc = fu;
+            } else if ((fu <= ffulc) || (fulc == xf) || (fulc == nfc)) {
+                fulc = x;
+                ffulc = fu;
+            }
+        }
+
+        xm = 0.5 * (a + b);
+        tol1 = sqrt_eps * fabs(xf) + BRENT_XATOL / 3.0;
+        tol2 = 2.0 * tol1;
+
+        if (num >= BRENT_MAXFUN) {
+            flag = 1;
+            break;
+        }
+    }
+
+    if (isnan(xf) || isnan(fx) || isnan(fu)) flag = 2;
+
+    out->x = xf;
+    out->fun = fx;
+    out->nfev = num;
+    out->success = (flag == 0);
+    return 0;
+}
+
+/* ========================================================================
+ * RESONANCE DETECTION AND VERIFICATION CASCADE
+ * ======================================================================== */
+
+/** ResonanceDetector.detect_natural_scaling: index, or -1 if not natural */
+static int detect_natural_scaling(const double* rv, const double* t, size_t n,
+                                  const NegMetricsOptions* opt, Workspace* ws,
+                                  int* resonance, Check* chk) {
+    const double constants[NEG_RESONANCE_COUNT] = {
+        (sqrt(5.0) - 1) / 2, 1 + sqrt(2.0), 1.324717957244, 2.0, 3.0 / 2.0, 4.0 / 3.0, 5.0 / 4.0,
+    };
+
+    int best = 0;
+    double best_error = 0.0;
+    for (int c = 0; c < NEG_RESONANCE_COUNT; c++) {
+        double err;
+        if (compute_return_error(rv, t, n, constants[c], opt, ws, &err, chk) != 0) return -1;
+        if (c == 0 || err < best_error) {
+            best = c;
+            best_error = err;
+        }
+    }
+
+    Minimum opt_result;
+    if (minimize_bounded(rv, t, n, RESONANCE_LAMBDA_LO, RESONANCE_LAMBDA_HI, opt, ws,
+                         &opt_result, chk) != 0) {
+        return -1;
+    }
+    *resonance = (best_error <= opt_result.fun * (1 + RESONANCE_TOLERANCE)) ? best : -1;
+    return 0;
+}
+
+/** Box-Muller normal deviate from the trajectory's own stream */
+typedef struct {
+    NegRNG rng;
+    double spare;
+    int has_spare;
+} NoiseStream;
+
+static double normal(NoiseStream* s, double sigma) {
+    if (s->has_spare) {
+        s->has_spare = 0;
+        return sigma * s->spare;
+    }
+    double u1 = 1.0 - neg_rng_next_double(&s->rng);  /* (0, 1] */
+    double u2 = neg_rng_next_double(&s->rng);
+    double radius = sqrt(-2.0 * log(u1));
+    s->spare = radius * sin(TWO_PI * u2);
+    s->has_spare = 1;
+    return sigma * radius * cos(TWO_PI * u2);
+}
+
+/** splitmix64: decorrelated per-trajectory seeds */
+static uint64_t mix_seed(uint64_t seed, uint64_t index) {
+    uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/** VerificationCascade.verify_regeneration; fills res->verifications and score */
+static int verify_regeneration(size_t n, double lam, const NegMetricsOptions* opt,
+                               uint64_t index, Workspace* ws, NegMetricsResult* res,
+                               Check* chk) {
+    double* v = res->verifications;
+
+    /* Topological; leaves the poses scaled by λ in ws->rs / ws->ts */
+    if (compute_return_error(ws->rv, ws->t, n, lam, opt, ws, &v[NEG_VERIFY_TOPOLOGICAL],
+                             chk) != 0) {
+        return -1;
+    }
+
+    /* Energetic: mean transformation magnitude over the doubled trajectory */
+    if (n == 0) {
+        chk->status = NEG_METRICS_EMPTY;  /* total_work / len(doubled) */
+        chk->fail_value = 0.0;
+        return -1;
+    }
+    double total_work = 0.0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < n; i++) {
+            double srv[3];
+            matrix_to_rotvec(ws->rs + i * 9, srv);
+            total_work += blas_norm(srv, 3) + blas_norm(ws->ts + i * 3, 3);
+        }
+    }
+    v[NEG_VERIFY_ENERGETIC] = total_work / (double)(2 * n);
+
+    /* Temporal: coefficient of variation of pose-to-pose step sizes */
+    size_t n_steps = n - 1;
+    v[NEG_VERIFY_TEMPORAL] = 0.0;
+    if (n_steps > 0) {
+        for (size_t i = 0; i < n_steps; i++) {
+            double dr[3], dt[3];
+            for (int c = 0; c < 3; c++) {
+                dr[c] = ws->rv[(i + 1) * 3 + c] - ws->rv[i * 3 + c];
+                dt[c] = ws->t[(i + 1) * 3 + c] - ws->t[i * 3 + c];
+            }
+            ws->steps[i] = blas_norm(dr, 3) + blas_norm(dt, 3);
+        }
+        double mean = pairwise_sum(ws->steps, n_steps) / (double)n_steps;
+        for (size_t i = 0; i < n_steps; i++) {
+            double d = ws->steps[i] - mean;
+            ws->steps[i] = d * d;
+        }
+        double std = sqrt(pairwise_sum(ws->steps, n_steps) / (double)n_steps);
+        if (!(mean < 1e-10)) v[NEG_VERIFY_TEMPORAL] = std / mean;
+    }
+
+    /* Spatial: encode() already rejected out-of-bounds translations */
+    v[NEG_VERIFY_SPATIAL] = 1.0;
+
+    /* Stochastic: return error under Gaussian pose noise */
+    double baseline = v[NEG_VERIFY_TOPOLOGICAL];
+    double* noisy_errors = ws->steps;  /* Temporal level is done with it */
+    int trials = opt->noise_trials > 0 ? opt->noise_trials : 0;
+    NoiseStream stream;
+    neg_rng_seed(&stream.rng, mix_seed(opt->seed, index));
+    stream.has_spare = 0;
+    for (int k = 0; k < trials; k++) {
+        for (size_t i = 0; i < n; i++) {
+            double noisy[3], m[9];
+            for (int c = 0; c < 3; c++) {
+                noisy[c] = ws->rv[i * 3 + c] + normal(&stream, opt->noise_level);
+            }
+            for (int c = 0; c < 3; c++) {
+                ws->noisy_t[i * 3 + c] = ws->t[i * 3 + c] + normal(&stream, opt->noise_level);
+            }
+            rotvec_to_matrix(noisy, m);
+            matrix_to_rotvec(m, ws->noisy_rv + i * 3);
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (check_bounds(ws->noisy_t + i * 3, opt, chk) != 0) return -1;
+        }
+        if (compute_return_error(ws->noisy_rv, ws->noisy_t, n, lam, opt, ws, &noisy_errors[k],
+                                 chk) != 0) {
+            return -1;
+        }
+    }
+    double mean_noisy = trials > 0 ? pairwise_sum(noisy_errors, (size_t)trials) / trials : NAN;
+    if (baseline < 1e-10) {
+        v[NEG_VERIFY_STOCHASTIC] = 0.5;
+    } else {
+        double degradation = (mean_noisy - baseline) / baseline;
+        v[NEG_VERIFY_STOCHASTIC] = fmax(0.0, fmin(1.0, 1.0 - degradation));
+    }
+
+    /* Normalize to [0, 1] and weight (sum() order) */
+    double normalized[NEG_VERIFY_COUNT] = {
+        fmax(0.0, 1.0 - v[NEG_VERIFY_TOPOLOGICAL] / 2.0),
+        fmax(0.0, 1.0 - v[NEG_VERIFY_ENERGETIC] / 0.5),
+        fmax(0.0, 1.0 - v[NEG_VERIFY_TEMPORAL] / 1.0),
+        v[NEG_VERIFY_SPATIAL],
+        v[NEG_VERIFY_STOCHASTIC],
+    };
+    double score = 0.0;
+    for (int l = 0; l < NEG_VERIFY_COUNT; l++) score += k_verify_weights[l] * normalized[l];
+    res->verification_score = score;
+    return 0;
+}
+
+/* ========================================================================
+ * BATCH
+ * ======================================================================== */
+
+/** compute_regenerative_metrics() for one trajectory */
+static void compute_one(const double* poses, size_t n, NegPoseFormat format,
+                        const NegMetricsOptions* opt, uint64_t index, Workspace* ws,
+                        NegMetricsResult* res) {
+    Check chk = { NEG_METRICS_OK, 0.0 };
+    memset(res, 0, sizeof(*res));
+    res->resonance = -1;
+
+    Minimum best;
+    if (encode(poses, n, format, opt, ws, &chk) != 0 ||
+        minimize_bounded(ws->rv, ws->t, n, opt->lambda_lo, opt->lambda_hi, opt, ws, &best,
+                         &chk) != 0) {
+        goto fail;
+    }
+    res->optimal_lambda = best.x;
+    res->return_error = best.fun;
+    res->success = best.success;
+    res->nfev = best.nfev;
+
+    if (opt->resonance &&
+        detect_natural_scaling(ws->rv, ws->t, n, opt, ws, &res->resonance, &chk) != 0) {
+        goto fail;
+    }
+    if (opt->verification &&
+        verify_regeneration(n, best.x, opt, index, ws, res, &chk) != 0) {
+        goto fail;
+    }
+
+    res->confidence = best.success ? fmin(1.0, 1.0 / (1.0 + best.fun)) : 0.5;
+    return;
+
+fail:
+    res->status = chk.status;
+    res->fail_value = chk.fail_value;
+}
+
+typedef struct {
+    const double* poses;
+    const int64_t* offsets;
+    size_t count;
+    NegPoseFormat format;
+    const NegMetricsOptions* opt;
+    NegMetricsResult* results;
+    size_t stride;              /* Doubles per pose */
+    size_t min_capacity;        /* Workspace floor: noise trials, at least 1 */
+    Workspace ws[NEG_POOL_MAX_THREADS];     /* One per pool slot */
+    _Atomic int failed;         /* Workspace allocation failed */
+} Batch;
+
+/* Trajectories [begin, end), on the workspace of the running slot */
+static void run_tile(void* ctx, size_t begin, size_t end, int slot) {
+    Batch* batch = (Batch*)ctx;
+    Workspace* ws = &batch->ws[slot];
+
+    for (size_t i = begin; i < end; i++) {
+        if (atomic_load_explicit(&batch->failed, memory_order_relaxed)) return;
+
+        size_t first = (size_t)batch->offsets[i];
+        size_t n = (size_t)(batch->offsets[i + 1] - batch->offsets[i]);
+        size_t need = n > batch->min_capacity ? n : batch->min_capacity;
+        if (workspace_reserve(ws, need) != 0) {
+            atomic_store_explicit(&batch->failed, 1, memory_order_relaxed);
+            return;
+        }
+        compute_one(batch->poses + first * batch->stride, n, batch->format, batch->opt,
+                    (uint64_t)i, ws, &batch->results[i]);
+    }
+}
+
+int neg_metrics_batch(const double* poses, const int64_t* offsets, size_t count,
+                      NegPoseFormat format, const NegMetricsOptions* opt,
+                      NegMetricsResult* results, int workers) {
+    if (!offsets || !opt || (count > 0 && !results)) return -1;
+    if (format != NEG_POSE_ROTVEC && format != NEG_POSE_MATRIX &&
+        format != NEG_POSE_TIMESERIES) {
+        return -1;
+    }
+    if (!(opt->lambda_lo <= opt->lambda_hi) || !isfinite(opt->lambda_lo) ||
+        !isfinite(opt->lambda_hi)) {
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (offsets[i] < 0 || offsets[i + 1] < offsets[i]) return -1;
+    }
+    if (count > 0 && offsets[count] > offsets[0] && !poses) return -1;
+
+    Batch batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.poses = poses;
+    batch.offsets = offsets;
+    batch.count = count;
+    batch.format = format;
+    batch.opt = opt;
+    batch.results = results;
+    batch.stride = (format == NEG_POSE_MATRIX) ? 12 : 6;
+    batch.min_capacity = opt->noise_trials > 1 ? (size_t)opt->noise_trials : 1;
+    atomic_init(&batch.failed, 0);
+
+    /* One trajectory per tile: lengths vary, so workers claim them singly */
+    NegPoolConfig pool;
+    neg_pool_config_default(&pool);
+    pool.threads = workers > 0 ? (uint32_t)workers : 0;
+    pool.tile_size = 1;
+    neg_pool_run(&pool, count, 1, run_tile, &batch);
+
+    for (int w = 0; w < NEG_POOL_MAX_THREADS; w++) {
+        neg_mem_free(batch.ws[w].block);
+    }
+    return atomic_load_explicit(&batch.failed, memory_order_relaxed) ? -1 : 0;
+}
@@ -43,10 +43,31 @@ from .resonance_aware import (
     ResonanceDetector
 )
 
+try:
+    from .. import _native
+except ImportError:
+    try:
+        from negentropic_core import _native
+    except ImportError:
+        _native = None
+
 # Configure logging
 logging.basicConfig(level=logging.INFO)
 logger = logging.getLogger(__name__)
 
+# Pose layouts of _native.metrics_batch (src/core/include/metrics_batch.h)
+POSE_ROTVEC = 0
+POSE_MATRIX = 1
+POSE_TIMESERIES = 2
+
+# NegMetricsStatus -> message of the exception the Python path raises
+_NATIVE_ERRORS = {
+    1: "Translation norm {value} exceeds r_max {r_max}",
+    2: "Rotation determinant must be 1",
+    3: "Rotation must be orthogonal",
+    4: "float division by zero",
+}
+
 
 @dataclass
 class RegenerativeMetrics:
@@ -389,32 +410,194 @@ def compute_regenerative_metrics(
         raise
 
 
+def pack_trajectory(trajectory_data: Any) -> Optional[tuple]:
+    """
+    Pack one trajectory for the native batch engine.
+
+    Accepts the same formats as compute_regenerative_metrics(), in the same
+    order of precedence.
+
+    Returns:
+        (pose_format, (T, 6) or (T, 12) float64 array), or None when the
+        data must go through the Python path (mixed rotation kinds,
+        malformed input: the Python path raises the matching error)
+    """
+    try:
+        if isinstance(trajectory_data, list):
+            poses = trajectory_data
+        elif isinstance(trajectory_data, dict) and 'poses' in trajectory_data:
+            poses = trajectory_data['poses']
+        elif isinstance(trajectory_data, dict) and \
+                'positions' in trajectory_data and 'orientations' in trajectory_data:
+            positions = np.asarray(trajectory_data['positions'], dtype=np.float64)
+            orientations = np.asarray(trajectory_data['orientations'], dtype=np.float64)
+            if positions.ndim != 2 or positions.shape[1] != 3 or orientations.ndim != 2 or \
+                    orientations.shape[1] < 3 or len(positions) != len(orientations):
+                return None
+            return POSE_TIMESERIES, np.hstack([orientations[:, :3], positions])
+        elif isinstance(trajectory_data, dict) and 'state_vectors' in trajectory_data:
+            states = np.asarray(trajectory_data['state_vectors'], dtype=np.float64)
+            if states.ndim != 2 or states.shape[1] < 6:
+                return None
+            return POSE_ROTVEC, np.ascontiguousarray(states[:, :6])
+        else:
+            return None
+
+        rows = []
+        kinds = set()
+        for pose in poses:
+            rotation = np.asarray(pose['rotation'], dtype=np.float64)
+            translation = np.asarray(pose['translation'], dtype=np.float64)
+            if translation.shape != (3,) or rotation.shape not in ((3,), (3, 3)):
+                return None
+            kinds.add(rotation.shape)
+            rows.append(np.concatenate([rotation.ravel(), translation]))
+    except (KeyError, TypeError, ValueError):
+        return None
+
+    if len(kinds) > 1:
+        return None
+    if kinds == {(3, 3)}:
+        return POSE_MATRIX, np.array(rows).reshape(-1, 12)
+    return POSE_ROTVEC, np.array(rows).reshape(-1, 6)
+
+
+def _native_batch_metrics(
+    trajectories: List[Any],
+    workers: int,
+    seed: Optional[int],
+    enable_resonance_detection: bool = True,
+    enable_verification_cascade: bool = True,
+    bounded: bool = True,
+    r_max: float = 1.0,
+    lambda_bounds: tuple = (0.1, 2.0)
+) -> List[Optional[Dict[str, Any]]]:
+    """Native engine over every packable trajectory; None where not packed."""
+    results: List[Optional[Dict[str, Any]]] = [None] * len(trajectories)
+    if not lambda_bounds[0] <= lambda_bounds[1]:
+        return results  # scipy raises per trajectory
+
+    if seed is None:
+        seed = int(np.random.randint(0, 2**63 - 1, dtype=np.int64))
+
+    fields = _native.METRICS_RESULT_FIELDS
+    dtype = np.dtype({
+        "names": [f[0] for f in fields],
+        "formats": [f[1] for f in fields],
+        "offsets": [f[2] for f in fields],
+        "itemsize": _native.METRICS_RESULT_SIZE,
+    })
+
+    groups: Dict[int, List[tuple]] = {}
+    for i, trajectory_data in enumerate(trajectories):
+        packed = pack_trajectory(trajectory_data)
+        if packed is not None:
+            groups.setdefault(packed[0], []).append((i, packed[1]))
+
+    timestamp = np.datetime64('now').astype(str)
+
+    for pose_format, members in groups.items():
+        lengths = [len(poses) for _, poses in members]
+        offsets = np.zeros(len(members) + 1, dtype=np.int64)
+        np.cumsum(lengths, out=offsets[1:])
+        width = 12 if pose_format == POSE_MATRIX else 6
+        poses = np.concatenate([p.reshape(-1, width) for _, p in members]) \
+            if offsets[-1] else np.zeros((0, width))
+
+        raw = _native.metrics_batch(
+            np.ascontiguousarray(poses, dtype=np.float64), offsets,
+            format=pose_format,
+            lambda_bounds=(float(lambda_bounds[0]), float(lambda_bounds[1])),
+            r_max=float(r_max),
+            bounded=bool(bounded),
+            resonance=bool(enable_resonance_detection),
+            verification=bool(enable_verification_cascade),
+            seed=seed,
+            workers=workers
+        )
+
+        for (i, _), length, row in zip(members, lengths, np.frombuffer(raw, dtype=dtype)):
+            if row["status"] != 0:
+                message = _NATIVE_ERRORS[int(row["status"])].format(
+                    value=float(row["fail_value"]), r_max=r_max)
+                results[i] = {"error": message, "trajectory_index": i}
+                continue
+
+            resonance = int(row["resonance"])
+            metrics = RegenerativeMetrics(
+                optimal_lambda=float(row["optimal_lambda"]),
+                return_error_epsilon=float(row["return_error"]),
+                verification_score=float(row["verification_score"]),
+                resonance_detected=_native.RESONANCE_NAMES[resonance] if resonance >= 0 else None,
+                confidence=float(row["confidence"]),
+                metadata={
+                    "trajectory_length": length,
+                    "bounded": bounded,
+                    "r_max": r_max,
+                    "lambda_bounds": lambda_bounds,
+                    "optimization_success": bool(row["success"]),
+                    "optimization_iterations": int(row["nfev"]),
+                    "timestamp": timestamp
+                }
+            )
+            results[i] = metrics.to_dict()
+
+    return results
+
+
 def compute_batch_metrics(
     trajectories: List[Dict[str, Any]],
+    engine: str = "auto",
+    workers: int = 0,
+    seed: Optional[int] = None,
     **kwargs
 ) -> List[Dict[str, Any]]:
     """
     Compute regenerative metrics for multiple trajectories in batch.
 
+    The native engine (negentropic_core._native, src/core/metrics_batch.c)
+    runs the same computation in C across worker threads: λ within the
+    optimizer tolerance (xatol 1e-5, in practice to ~1e-12) and ε to a
+    relative 1e-12 of the Python path, with the same error entries. The
+    noise-robustness level draws from a C generator seeded by ``seed``, so
+    it and verification_score agree with the Python path in distribution
+    only. Trajectories it cannot pack (mixed rotation kinds, malformed
+    data) go through the Python path.
+
     Args:
         trajectories: List of trajectory data dictionaries
+        engine: "auto" (native when the extension is built), "native" or "python"
+        workers: Native worker threads (0: one per online CPU)
+        seed: Native noise seed (None: drawn from numpy.random)
         **kwargs: Additional arguments passed to compute_regenerative_metrics
 
     Returns:
         List of metrics dictionaries
     """
-    results = []
+    if engine not in ("auto", "native", "python"):
+        raise ValueError(f"Unknown engine: {engine}")
+    if engine == "native" and _native is None:
+        raise RuntimeError("negentropic_core._native is not built")
+
+    native_kwargs = {"enable_resonance_detection", "enable_verification_cascade",
+                     "bounded", "r_max", "lambda_bounds"}
+    results: List[Optional[Dict[str, Any]]] = [None] * len(trajectories)
+    if engine != "python" and _native is not None and set(kwargs) <= native_kwargs:
+        logger.info(f"Processing {len(trajectories)} trajectories with the native engine")
+        results = _native_batch_metrics(trajectories, workers, seed, **kwargs)
 
     for i, trajectory_data in enumerate(trajectories):
+        if results[i] is not None:
+            continue
         logger.info(f"Processing trajectory {i + 1}/{len(trajectories)}")
         try:
             metrics = compute_regenerative_metrics(trajectory_data, **kwargs)
-            results.append(metrics)
+            results[i] = metrics
         except Exception as e:
             logger.error(f"Error processing trajectory {i + 1}: {str(e)}")
-            results.append({
+            results[i] = {
                 "error": str(e),
                 "trajectory_index": i
-            })
+            }
 
     return results
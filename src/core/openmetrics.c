@@ -0,0 +1,207 @@
+/*
+ * openmetrics.c - OpenMetrics Text Exposition of Runtime Metrics
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "include/openmetrics.h"
+#include "include/mem_stats.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* snprintf at *pos; returns -1 once the buffer is exhausted */
+static int append(char* buffer, size_t max_len, size_t* pos, const char* fmt, ...) {
+    if (*pos >= max_len) return -1;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buffer + *pos, max_len - *pos, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= max_len - *pos) return -1;
+    *pos += (size_t)n;
+    return 0;
+}
+
+/* Nanoseconds as decimal seconds without trailing zeros ("0.000025") */
+static void format_seconds(uint64_t ns, char out[32]) {
+    unsigned long long sec = ns / 1000000000ULL;
+    unsigned long long frac = ns % 1000000000ULL;
+    if (frac == 0) {
+        snprintf(out, 32, "%llu", sec);
+        return;
+    }
+    int digits = 9;
+    while (frac % 10 == 0) {
+        frac /= 10;
+        digits--;
+    }
+    snprintf(out, 32, "%llu.%0*llu", sec, digits, frac);
+}
+
+static int family(char* buffer, size_t max_len, size_t* pos, const char* name,
+                  const char* type, const char* unit, const char* help) {
+    if (append(buffer, max_len, pos, "# TYPE %s %s\n", name, type) != 0) return -1;
+    if (unit && append(buffer, max_len, pos, "# UNIT %s %s\n", name, unit) != 0) return -1;
+    return append(buffer, max_len, pos, "# HELP %s %s\n", name, help);
+}
+
+/* One histogram; phase labels the series when not NULL */
+static int histogram(char* buffer, size_t max_len, size_t* pos, const char* name,
+                     const char* phase, const NegPhaseTimers* t, int index) {
+    char label[48] = "";
+    char set[48] = "";
+    if (phase) {
+        snprintf(label, sizeof(label), "phase=\"%s\",", phase);
+        snprintf(set, sizeof(set), "{phase=\"%s\"}", phase);
+    }
+
+    uint64_t cumulative = 0;
+    for (int b = 0; b < NEG_PHASE_HIST_BUCKETS; b++) {
+        char le[32] = "+Inf";
+        if (b < NEG_PHASE_HIST_BUCKETS - 1) format_seconds(neg_phase_hist_bound_ns(b), le);
+        cumulative += t->hist[index][b];
+        if (append(buffer, max_len, pos, "%s_bucket{%sle=\"%s\"} %llu\n", name, label, le,
+                   (unsigned long long)cumulative) != 0) {
+            return -1;
+        }
+    }
+
+    uint64_t sum = t->hist_sum_ns[index];
+    return append(buffer, max_len, pos, "%s_count%s %llu\n%s_sum%s %llu.%09llu\n",
+                  name, set, (unsigned long long)t->hist_count[index],
+                  name, set, (unsigned long long)(sum / 1000000000ULL),
+                  (unsigned long long)(sum % 1000000000ULL));
+}
+
+int neg_openmetrics_text(const NegPhaseTimers* t, const NegErrorFlags* flags,
+                         char* buffer, size_t max_len) {
+    if (!t || !flags || !buffer || max_len == 0) return -1;
+
+    size_t pos = 0;
+
+    /* Steps and timing */
+    if (family(buffer, max_len, &pos, "negentropic_steps", "counter", NULL,
+               "Completed simulation steps.") != 0 ||
+        append(buffer, max_len, &pos, "negentropic_steps_total %llu\n",
+               (unsigned long long)t->steps) != 0) {
+        return -1;
+    }
+
+    if (family(buffer, max_len, &pos, "negentropic_step_seconds", "histogram", "seconds",
+               "Wall time of a simulation step.") != 0 ||
+        histogram(buffer, max_len, &pos, "negentropic_step_seconds", NULL, t,
+                  NEG_PHASE_COUNT) != 0) {
+        return -1;
+    }
+
+    if (family(buffer, max_len, &pos, "negentropic_phase_seconds", "histogram", "seconds",
+               "Time per step spent in a solver phase (steps in which it ran).") != 0) {
+        return -1;
+    }
+    for (int p = 0; p < NEG_PHASE_COUNT; p++) {
+        if (histogram(buffer, max_len, &pos, "negentropic_phase_seconds",
+                      neg_phase_name((NegPhase)p), t, p) != 0) {
+            return -1;
+        }
+    }
+
+    /* Process-wide solver events */
+    static const char* const counter_help[NEG_COUNTER_COUNT] = {
+        "Cells re-integrated with a higher-order integrator (process-wide).",
+        "Explicit surface-flow substeps taken for CFL stability (process-wide).",
+    };
+    for (int c = 0; c < NEG_COUNTER_COUNT; c++) {
+        char name[64];
+        snprintf(name, sizeof(name), "negentropic_%s", neg_counter_name((NegCounter)c));
+        if (family(buffer, max_len, &pos, name, "counter", NULL, counter_help[c]) != 0 ||
+            append(buffer, max_len, &pos, "%s_total %llu\n", name,
+                   (unsigned long long)neg_counter_get((NegCounter)c)) != 0) {
+            return -1;
+        }
+    }
+
+    /* Memory by subsystem */
+    NegMemReport mem;
+    neg_mem_report(&mem);
+    static const struct {
+        const char* name;
+        const char* type;
+        const char* unit;
+        const char* help;
+    } mem_families[] = {
+        { "negentropic_memory_bytes", "gauge", "bytes", "Live heap bytes (process-wide)." },
+        { "negentropic_memory_peak_bytes", "gauge", "bytes", "High-water mark of live heap bytes." },
+        { "negentropic_memory_static_bytes", "gauge", "bytes", "Registered static storage." },
+        { "negentropic_memory_allocs", "counter", NULL, "Heap blocks allocated." },
+        { "negentropic_memory_frees", "counter", NULL, "Heap blocks released." },
+        { "negentropic_memory_mapped_bytes", "gauge", "bytes",
+          "Live bytes in page-mapped (huge page, first-touch) blocks." },
+    };
+    for (size_t f = 0; f < sizeof(mem_families) / sizeof(mem_families[0]); f++) {
+        if (family(buffer, max_len, &pos, mem_families[f].name, mem_families[f].type,
+                   mem_families[f].unit, mem_families[f].help) != 0) {
+            return -1;
+        }
+        for (int s = 0; s < NEG_MEM_SUBSYSTEM_COUNT; s++) {
+            const NegMemStats* st = &mem.subsystems[s];
+            uint64_t values[] = { st->current_bytes, st->peak_bytes, st->static_bytes,
+                                  st->allocs, st->frees, st->mapped_bytes };
+            int counter = strcmp(mem_families[f].type, "counter") == 0;
+            if (append(buffer, max_len, &pos, "%s%s{subsystem=\"%s\"} %llu\n",
+                       mem_families[f].name, counter ? "_total" : "",
+                       neg_mem_subsystem_name((NegMemSubsystem)s),
+                       (unsigned long long)values[f]) != 0) {
+                return -1;
+            }
+        }
+    }
+
+    /* Placement of page-mapped blocks */
+    if (family(buffer, max_len, &pos, "negentropic_memory_node_bytes", "gauge", "bytes",
+               "Mapped bytes resident per NUMA node (at allocation).") != 0) {
+        return -1;
+    }
+    for (int n = 0; n < NEG_MEM_MAX_NODES; n++) {
+        if (append(buffer, max_len, &pos, "negentropic_memory_node_bytes{node=\"%d\"} %llu\n",
+                   n, (unsigned long long)mem.node_bytes[n]) != 0) {
+            return -1;
+        }
+    }
+
+    /* Error flags */
+    if (family(buffer, max_len, &pos, "negentropic_errors", "counter", NULL,
+               "Numerical errors recorded by the simulation.") != 0 ||
+        append(buffer, max_len, &pos, "negentropic_errors_total %llu\n",
+               (unsigned long long)flags->total_errors) != 0 ||
+        family(buffer, max_len, &pos, "negentropic_error_flag", "gauge", NULL,
+               "Sticky numerical error flags (1: raised since the last clear).") != 0) {
+        return -1;
+    }
+    const struct {
+        const char* name;
+        unsigned value;
+    } flag_values[] = {
+        { "overflow", flags->overflow },
+        { "underflow", flags->underflow },
+        { "nan_detected", flags->nan_detected },
+        { "inf_detected", flags->inf_detected },
+        { "so3_drift", flags->so3_drift },
+        { "energy_drift", flags->energy_drift },
+        { "step_failed", flags->step_failed },
+        { "mass_violation", flags->mass_violation },
+        { "convergence_failed", flags->convergence_failed },
+        { "memory_error", flags->memory_error },
+        { "invalid_state", flags->invalid_state },
+    };
+    for (size_t i = 0; i < sizeof(flag_values) / sizeof(flag_values[0]); i++) {
+        if (append(buffer, max_len, &pos, "negentropic_error_flag{flag=\"%s\"} %u\n",
+                   flag_values[i].name, flag_values[i].value) != 0) {
+            return -1;
+        }
+    }
+
+    if (append(buffer, max_len, &pos, "# EOF\n") != 0) return -1;
+    return (int)pos;
+}
@@ -0,0 +1,197 @@
+/*
+ * phase_timers.c - Per-Phase Step Timers
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+/* CLOCK_MONOTONIC_RAW is a Linux extension hidden by strict -std=c11 */
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 199309L
+
+#include "include/phase_timers.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ========================================================================
+ * RECORDING
+ * ======================================================================== */
+
+/* Bucket upper bounds: 1 - 2.5 - 5 steps from 10 us to 100 ms */
+static const uint64_t k_hist_bounds_ns[NEG_PHASE_HIST_BUCKETS] = {
+    10000, 25000, 50000, 100000, 250000, 500000, 1000000,
+    2500000, 5000000, 10000000, 25000000, 50000000, 100000000, UINT64_MAX
+};
+
+#if NEG_PHASE_TIMERS
+static void hist_observe(NegPhaseTimers* t, int index, uint64_t ns) {
+    int b = 0;
+    while (ns > k_hist_bounds_ns[b]) b++;   /* Last bound is UINT64_MAX */
+    t->hist[index][b]++;
+    t->hist_sum_ns[index] += ns;
+    t->hist_count[index]++;
+}
+#endif
+
+uint64_t neg_phase_now(void) {
+#if !NEG_PHASE_TIMERS
+    return 0;
+#else
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#elif defined(CLOCK_MONOTONIC_RAW)
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void neg_phase_timers_init(NegPhaseTimers* t) {
+    if (!t) return;
+    memset(t, 0, sizeof(*t));
+}
+
+void neg_phase_begin_step(NegPhaseTimers* t) {
+    if (!t) return;
+    t->step_start = neg_phase_now();
+}
+
+void neg_phase_end_step(NegPhaseTimers* t) {
+    if (!t) return;
+
+    uint64_t now = neg_phase_now();
+    t->last_step_ns = t->step_start ? now - t->step_start : 0;
+    t->step_start = 0;
+
+    memcpy(t->last, t->current, sizeof(t->last));
+    memcpy(t->last_calls, t->current_calls, sizeof(t->last_calls));
+    memcpy(t->window[t->window_head], t->current, sizeof(t->current));
+    t->window_step_ns[t->window_head] = t->last_step_ns;
+
+#if NEG_PHASE_TIMERS
+    for (int p = 0; p < NEG_PHASE_COUNT; p++) {
+        if (t->current_calls[p]) hist_observe(t, p, t->current[p]);
+    }
+    hist_observe(t, NEG_PHASE_COUNT, t->last_step_ns);
+#endif
+
+    t->window_head = (t->window_head + 1) % NEG_PHASE_WINDOW;
+    if (t->window_fill < NEG_PHASE_WINDOW) t->window_fill++;
+    t->steps++;
+
+    memset(t->current, 0, sizeof(t->current));
+    memset(t->current_calls, 0, sizeof(t->current_calls));
+}
+
+/* ========================================================================
+ * EVENT COUNTERS
+ * ======================================================================== */
+
+static _Atomic uint64_t g_counters[NEG_COUNTER_COUNT];
+
+static const char* const k_counter_names[NEG_COUNTER_COUNT] = {
+    "lod_escalations",
+    "cfl_substeps",
+};
+
+void neg_counter_add(NegCounter counter, uint64_t n) {
+    if ((int)counter < 0 || (int)counter >= NEG_COUNTER_COUNT) return;
+    atomic_fetch_add_explicit(&g_counters[counter], n, memory_order_relaxed);
+}
+
+uint64_t neg_counter_get(NegCounter counter) {
+    if ((int)counter < 0 || (int)counter >= NEG_COUNTER_COUNT) return 0;
+    return atomic_load_explicit(&g_counters[counter], memory_order_relaxed);
+}
+
+const char* neg_counter_name(NegCounter counter) {
+    return ((int)counter >= 0 && (int)counter < NEG_COUNTER_COUNT)
+        ? k_counter_names[counter] : "unknown";
+}
+
+/* ========================================================================
+ * REPORTING
+ * ======================================================================== */
+
+static const char* const k_phase_names[NEG_PHASE_COUNT] = {
+    "vertical_solve",
+    "surface_flow",
+    "atmosphere",
+    "regeneration",
+    "lod_dispatch",
+    "hash",
+    "snapshot",
+};
+
+const char* neg_phase_name(NegPhase phase) {
+    return ((int)phase >= 0 && (int)phase < NEG_PHASE_COUNT) ? k_phase_names[phase] : "unknown";
+}
+
+NegPhaseStats neg_phase_stats(const NegPhaseTimers* t, NegPhase phase) {
+    NegPhaseStats s = { 0, 0, 0 };
+    if (!t || (int)phase < 0 || (int)phase > NEG_PHASE_COUNT) return s;
+
+    int whole_step = (phase == NEG_PHASE_COUNT);
+    s.last_ns = whole_step ? t->last_step_ns : t->last[phase];
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < t->window_fill; i++) {
+        uint64_t v = whole_step ? t->window_step_ns[i] : t->window[i][phase];
+        sum += v;
+        if (v > s.max_ns) s.max_ns = v;
+    }
+    s.mean_ns = t->window_fill ? sum / t->window_fill : 0;
+    return s;
+}
+
+uint64_t neg_phase_hist_bound_ns(int bucket) {
+    return (bucket >= 0 && bucket < NEG_PHASE_HIST_BUCKETS) ? k_hist_bounds_ns[bucket] : UINT64_MAX;
+}
+
+/* snprintf at *pos; returns -1 once the buffer is exhausted */
+static int append(char* buffer, size_t max_len, size_t* pos, const char* fmt, ...) {
+    if (*pos >= max_len) return -1;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buffer + *pos, max_len - *pos, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= max_len - *pos) return -1;
+    *pos += (size_t)n;
+    return 0;
+}
+
+int neg_phase_timers_json(const NegPhaseTimers* t, char* buffer, size_t max_len) {
+    if (!t || !buffer || max_len == 0) return -1;
+
+    size_t pos = 0;
+    NegPhaseStats step = neg_phase_stats(t, NEG_PHASE_COUNT);
+    if (append(buffer, max_len, &pos,
+               "{\"window\":%d,\"steps\":%llu,"
+               "\"step\":{\"last_ns\":%llu,\"mean_ns\":%llu,\"max_ns\":%llu},\"phases\":{",
+               NEG_PHASE_WINDOW, (unsigned long long)t->steps,
+               (unsigned long long)step.last_ns, (unsigned long long)step.mean_ns,
+               (unsigned long long)step.max_ns) != 0) {
+        return -1;
+    }
+
+    for (int p = 0; p < NEG_PHASE_COUNT; p++) {
+        NegPhaseStats s = neg_phase_stats(t, (NegPhase)p);
+        if (append(buffer, max_len, &pos,
+                   "%s\"%s\":{\"last_ns\":%llu,\"mean_ns\":%llu,\"max_ns\":%llu,\"calls\":%u}",
+                   p ? "," : "", k_phase_names[p],
+                   (unsigned long long)s.last_ns, (unsigned long long)s.mean_ns,
+                   (unsigned long long)s.max_ns, (unsigned)t->last_calls[p]) != 0) {
+            return -1;
+        }
+    }
+
+    if (append(buffer, max_len, &pos, "}}") != 0) return -1;
+    return (int)pos;
+}
@@ -0,0 +1,339 @@
+/*
+ * replay.c - Keyframe-Accelerated Deterministic Replay
+ *
+ * See replay.h for the seek contract. The index is the byte offset of
+ * every record plus the record numbers and steps of the keyframes;
+ * record step stamps never decrease along the log, so the keyframe for a
+ * step is a binary search away and the records to re-run follow it
+ * directly. A replay of a file keeps only the index and reads records
+ * on demand, one at a time, into a buffer the size of the largest read.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "include/replay.h"
+#include "include/mem_stats.h"
+#include "include/trace.h"
+#include "state.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+struct NegReplay {
+    const uint8_t* data;            /* Borrowed log bytes; NULL for a file */
+    FILE* file;
+    size_t file_pos;                /* Where the next fread() starts */
+    uint8_t* record;                /* Last record read from the file */
+    size_t record_capacity;
+    size_t len;                     /* Intact prefix only */
+    size_t* offsets;                /* Start of each record */
+    size_t count;
+    size_t* keyframes;              /* Record numbers of the KEYFRAME records */
+    uint64_t* keyframe_steps;
+    size_t keyframe_count;
+    uint64_t last_step;
+};
+
+static uint64_t get_u64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static uint32_t get_u32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; i--) v = (v << 8) | p[i];
+    return v;
+}
+
+/* fseek() to a size_t offset with long-sized steps */
+static int file_seek(FILE* f, size_t offset) {
+    if (fseek(f, 0, SEEK_SET) != 0) return -1;
+    while (offset > 0) {
+        long step = offset > (size_t)LONG_MAX ? LONG_MAX : (long)offset;
+        if (fseek(f, step, SEEK_CUR) != 0) return -1;
+        offset -= (size_t)step;
+    }
+    return 0;
+}
+
+/* ========================================================================
+ * INDEX
+ * ======================================================================== */
+
+static int index_record(NegReplay* replay, size_t at, uint32_t type, uint64_t step,
+                        size_t* capacity, size_t* keyframe_capacity) {
+    if (replay->count == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 1024;
+        size_t* grown = (size_t*)neg_mem_realloc(NEG_MEM_IO, replay->offsets,
+                                                 *capacity * sizeof(size_t));
+        if (!grown) return NEG_EVENT_NO_MEMORY;
+        replay->offsets = grown;
+    }
+    if (type == NEG_EVENT_KEYFRAME) {
+        if (replay->keyframe_count == *keyframe_capacity) {
+            *keyframe_capacity = *keyframe_capacity ? *keyframe_capacity * 2 : 64;
+            size_t* grown = (size_t*)neg_mem_realloc(NEG_MEM_IO, replay->keyframes,
+                                                     *keyframe_capacity * sizeof(size_t));
+            if (!grown) return NEG_EVENT_NO_MEMORY;
+            replay->keyframes = grown;
+            uint64_t* steps = (uint64_t*)neg_mem_realloc(NEG_MEM_IO, replay->keyframe_steps,
+                                                         *keyframe_capacity * sizeof(uint64_t));
+            if (!steps) return NEG_EVENT_NO_MEMORY;
+            replay->keyframe_steps = steps;
+        }
+        replay->keyframe_steps[replay->keyframe_count] = step;
+        replay->keyframes[replay->keyframe_count++] = replay->count;
+    }
+    replay->offsets[replay->count++] = at;
+    replay->last_step = step;
+    return NEG_EVENT_OK;
+}
+
+static int build_index(NegReplay* replay) {
+    size_t capacity = 0;
+    size_t keyframe_capacity = 0;
+    size_t offset = 0;
+    NegEventRecord rec;
+
+    for (;;) {
+        size_t at = offset;
+        if (neg_event_log_next(replay->data, replay->len, &offset, &rec) != 1) break;
+        int rc = index_record(replay, at, rec.type, rec.step, &capacity, &keyframe_capacity);
+        if (rc != NEG_EVENT_OK) return rc;
+    }
+    return NEG_EVENT_OK;
+}
+
+/* Headers only: payloads are skipped over, not read */
+static int build_file_index(NegReplay* replay) {
+    size_t capacity = 0;
+    size_t keyframe_capacity = 0;
+    size_t offset = 0;
+    uint8_t header[NEG_EVENT_HEADER_BYTES];
+
+    if (file_seek(replay->file, 0) != 0) return NEG_EVENT_IO_ERROR;
+    while (offset < replay->len) {
+        if (fread(header, sizeof(header), 1, replay->file) != 1) return NEG_EVENT_IO_ERROR;
+        uint32_t payload_len = get_u32(header + 32);
+        int rc = index_record(replay, offset, get_u32(header + 4), get_u64(header + 16),
+                              &capacity, &keyframe_capacity);
+        if (rc != NEG_EVENT_OK) return rc;
+
+        /* payload_len <= NEG_EVENT_MAX_PAYLOAD (verified), so this fits a long */
+        if (fseek(replay->file, (long)payload_len + NEG_EVENT_HASH_BYTES, SEEK_CUR) != 0) {
+            return NEG_EVENT_IO_ERROR;
+        }
+        offset += NEG_EVENT_RECORD_BYTES(payload_len);
+    }
+    replay->file_pos = offset;
+    return NEG_EVENT_OK;
+}
+
+NegReplay* neg_replay_open(const uint8_t* data, size_t len, const NegPoolConfig* pool,
+                           int* status) {
+    NegEventVerify v;
+    int st = neg_event_log_verify(data, len, pool, &v);
+    NegReplay* replay = NULL;
+
+    /* A torn tail is what a crash leaves; replay the records before it */
+    if (st == NEG_EVENT_TRUNCATED) st = NEG_EVENT_OK;
+    if (st != NEG_EVENT_OK) goto done;
+
+    st = NEG_EVENT_NO_MEMORY;
+    replay = (NegReplay*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegReplay));
+    if (!replay) goto done;
+    replay->data = data;
+    replay->len = v.valid_bytes;
+    st = build_index(replay);
+
+done:
+    if (status) *status = st;
+    if (st != NEG_EVENT_OK) {
+        neg_replay_close(replay);
+        return NULL;
+    }
+    return replay;
+}
+
+NegReplay* neg_replay_open_file(const char* path, const NegPoolConfig* pool, int* status) {
+    NegEventVerify v;
+    int st = neg_event_log_verify_file(path, pool, &v);
+    NegReplay* replay = NULL;
+
+    if (st == NEG_EVENT_TRUNCATED) st = NEG_EVENT_OK;
+    if (st != NEG_EVENT_OK) goto done;
+
+    st = NEG_EVENT_NO_MEMORY;
+    replay = (NegReplay*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegReplay));
+    if (!replay) goto done;
+    replay->len = v.valid_bytes;
+
+    st = NEG_EVENT_IO_ERROR;
+    replay->file = fopen(path, "rb");
+    if (!replay->file) goto done;
+    st = build_file_index(replay);
+
+done:
+    if (status) *status = st;
+    if (st != NEG_EVENT_OK) {
+        neg_replay_close(replay);
+        return NULL;
+    }
+    return replay;
+}
+
+void neg_replay_close(NegReplay* replay) {
+    if (!replay) return;
+    if (replay->file) fclose(replay->file);
+    neg_mem_free(replay->record);
+    neg_mem_free(replay->offsets);
+    neg_mem_free(replay->keyframes);
+    neg_mem_free(replay->keyframe_steps);
+    neg_mem_free(replay);
+}
+
+size_t neg_replay_keyframes(const NegReplay* replay) {
+    return replay ? replay->keyframe_count : 0;
+}
+
+uint64_t neg_replay_first_step(const NegReplay* replay) {
+    if (!replay || replay->keyframe_count == 0) return 0;
+    return replay->keyframe_steps[0];
+}
+
+/* Record index into *out; from a file it stays valid until the next read */
+static int read_record(NegReplay* replay, size_t index, NegEventRecord* out) {
+    size_t at = replay->offsets[index];
+    if (!replay->file) {
+        return neg_event_log_next(replay->data, replay->len, &at, out) == 1 ? NEG_EVENT_OK
+                                                                            : NEG_EVENT_CORRUPT;
+    }
+
+    size_t end = index + 1 < replay->count ? replay->offsets[index + 1] : replay->len;
+    size_t bytes = end - at;
+    if (bytes > replay->record_capacity) {
+        uint8_t* grown = (uint8_t*)neg_mem_realloc(NEG_MEM_IO, replay->record, bytes);
+        if (!grown) return NEG_EVENT_NO_MEMORY;
+        replay->record = grown;
+        replay->record_capacity = bytes;
+    }
+    if (replay->file_pos != at) {
+        replay->file_pos = (size_t)-1;
+        if (file_seek(replay->file, at) != 0) return NEG_EVENT_IO_ERROR;
+    }
+    if (fread(replay->record, bytes, 1, replay->file) != 1) {
+        replay->file_pos = (size_t)-1;
+        return NEG_EVENT_IO_ERROR;
+    }
+    replay->file_pos = end;
+
+    size_t offset = 0;
+    return neg_event_log_next(replay->record, bytes, &offset, out) == 1 ? NEG_EVENT_OK
+                                                                        : NEG_EVENT_CORRUPT;
+}
+
+uint64_t neg_replay_last_step(const NegReplay* replay) {
+    return replay ? replay->last_step : 0;
+}
+
+/* ========================================================================
+ * SEEK
+ * ======================================================================== */
+
+/* Last keyframe stamped at or before step, or keyframe_count if none */
+static size_t find_keyframe(const NegReplay* replay, uint64_t step) {
+    size_t lo = 0;
+    size_t hi = replay->keyframe_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (replay->keyframe_steps[mid] <= step) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo == 0 ? replay->keyframe_count : lo - 1;
+}
+
+static int restore_keyframe(void* sim, const NegEventRecord* rec) {
+    if (rec->payload_len < 8) return NEG_REPLAY_INCOMPATIBLE;
+    if (!state_reset_from_binary(sim, rec->payload + 8, rec->payload_len - 8)) {
+        return NEG_REPLAY_INCOMPATIBLE;
+    }
+
+    SimulationClock clock;
+    clock.step_count = rec->step;
+    clock.timestamp = rec->time_us;
+    clock.rng_state = get_u64(rec->payload);
+    state_set_clock(sim, &clock);
+    return NEG_EVENT_OK;
+}
+
+int neg_replay_seek(NegReplay* replay, void* sim, uint64_t step,
+                    NegReplayEventFn fn, void* ctx, NegReplaySeek* out) {
+    NegReplaySeek seek;
+    memset(&seek, 0, sizeof(seek));
+    seek.diverged_step = -1;
+
+    if (!replay || !sim) return NEG_REPLAY_INCOMPATIBLE;
+    if (replay->count == 0 || step > replay->last_step) return NEG_REPLAY_OUT_OF_RANGE;
+    size_t k = find_keyframe(replay, step);
+    if (k == replay->keyframe_count) return NEG_REPLAY_NO_KEYFRAME;
+
+    NEG_TRACE_SCOPE_BEGIN(trace_seek);
+    size_t index = replay->keyframes[k];
+    NegEventRecord rec;
+    int rc = read_record(replay, index, &rec);
+    if (rc == NEG_EVENT_OK) rc = restore_keyframe(sim, &rec);
+    seek.keyframe_step = replay->keyframe_steps[k];
+
+    uint8_t digest[NEG_EVENT_HASH_BYTES];
+    while (rc == NEG_EVENT_OK && ++index < replay->count) {
+        rc = read_record(replay, index, &rec);
+        if (rc != NEG_EVENT_OK || rec.step > step) break;
+        switch (rec.type) {
+            case NEG_EVENT_STEP: {
+                uint32_t dt_bits = get_u32(rec.payload);
+                float dt;
+                memcpy(&dt, &dt_bits, sizeof(dt));
+                int ok = state_step(sim, dt) ? 1 : 0;
+                seek.steps_replayed++;
+                if (ok != (int)get_u32(rec.payload + 4) || state_get_step_count(sim) != rec.step) {
+                    seek.diverged_step = (int64_t)rec.step;
+                    rc = NEG_REPLAY_DIVERGED;
+                }
+                break;
+            }
+            case NEG_EVENT_DIGEST:
+                rc = neg_event_state_digest(sim, digest);
+                if (rc != NEG_EVENT_OK) break;
+                if (memcmp(digest, rec.payload, sizeof(digest)) != 0) {
+                    seek.diverged_step = (int64_t)rec.step;
+                    rc = NEG_REPLAY_DIVERGED;
+                    break;
+                }
+                seek.digests_checked++;
+                break;
+            case NEG_EVENT_RESET:
+                /* The state loaded is only recorded by a keyframe after it */
+                rc = NEG_REPLAY_NO_KEYFRAME;
+                break;
+            case NEG_EVENT_KEYFRAME:
+                break;
+            default:
+                if (fn) fn(ctx, sim, &rec);
+                seek.events++;
+                break;
+        }
+    }
+
+    if (rc == NEG_EVENT_OK) rc = neg_event_state_digest(sim, seek.digest);
+    seek.step = state_get_step_count(sim);
+    NEG_TRACE_SCOPE_END(trace_seek, "io", "replay_seek", seek.steps_replayed);
+
+    if (out) *out = seek;
+    return rc;
+}
@@ -0,0 +1,259 @@
+/*
+ * rollback.c - In-Memory Rollback Ring of Recent States
+ *
+ * See rollback.h. Entries are a circular array, oldest at `first`; each
+ * owns one delta block laid out as
+ *
+ *   uint32_t index[tiles]      changed tile numbers, ascending
+ *   uint8_t  old[...]          their contents before the capture
+ *
+ * where every tile is NEG_ROLLBACK_TILE_BYTES except a short last one.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "include/rollback.h"
+#include "include/mem_stats.h"
+#include "include/trace.h"
+#include "state.h"
+#include <string.h>
+
+#define ROLLBACK_COMPARE_TILE 1024      /* Rollback tiles per pool tile (256 KB) */
+
+typedef struct {
+    SimulationClock clock;          /* Before the capture */
+    uint32_t tiles;
+    size_t bytes;                   /* Size of delta */
+    uint8_t* delta;
+} RollbackEntry;
+
+struct NegRollback {
+    uint8_t* shadow;                /* State as of the last capture */
+    size_t len;
+    size_t tile_count;
+    uint8_t* changed;               /* Per-tile flags from the compare pass */
+    SimulationClock clock;          /* Shadow's clock */
+
+    RollbackEntry* entries;
+    uint32_t capacity;
+    uint32_t first;
+    uint32_t count;
+    size_t bytes;
+    size_t budget;
+
+    NegPoolConfig pool;
+};
+
+static size_t tile_len(const NegRollback* ring, size_t tile) {
+    size_t start = tile * NEG_ROLLBACK_TILE_BYTES;
+    size_t rest = ring->len - start;
+    return rest < NEG_ROLLBACK_TILE_BYTES ? rest : NEG_ROLLBACK_TILE_BYTES;
+}
+
+/* ========================================================================
+ * LIFECYCLE
+ * ======================================================================== */
+
+NegRollback* neg_rollback_create(void* sim, uint32_t max_steps, size_t budget_bytes,
+                                 const NegPoolConfig* pool) {
+    if (!sim || max_steps == 0) return NULL;
+
+    size_t len;
+    const uint8_t* live = state_data(sim, &len);
+    NegRollback* ring = (NegRollback*)neg_mem_calloc(NEG_MEM_STATE, 1, sizeof(NegRollback));
+    if (!ring) return NULL;
+
+    ring->len = len;
+    ring->tile_count = (len + NEG_ROLLBACK_TILE_BYTES - 1) / NEG_ROLLBACK_TILE_BYTES;
+    ring->capacity = max_steps;
+    ring->budget = budget_bytes;
+    ring->shadow = (uint8_t*)neg_mem_malloc(NEG_MEM_STATE, len ? len : 1);
+    ring->changed = (uint8_t*)neg_mem_malloc(NEG_MEM_STATE, ring->tile_count ? ring->tile_count : 1);
+    ring->entries = (RollbackEntry*)neg_mem_calloc(NEG_MEM_STATE, max_steps, sizeof(RollbackEntry));
+    if (!ring->shadow || !ring->changed || !ring->entries) {
+        neg_rollback_destroy(ring);
+        return NULL;
+    }
+
+    memcpy(ring->shadow, live, len);
+    state_get_clock(sim, &ring->clock);
+    if (pool) {
+        ring->pool = *pool;
+    } else {
+        neg_pool_config_default(&ring->pool);
+    }
+    ring->pool.tile_size = 0;
+    return ring;
+}
+
+static RollbackEntry* entry_at(NegRollback* ring, uint32_t i) {
+    return &ring->entries[(ring->first + i) % ring->capacity];
+}
+
+static void drop_oldest(NegRollback* ring) {
+    RollbackEntry* e = entry_at(ring, 0);
+    ring->bytes -= e->bytes;
+    neg_mem_free(e->delta);
+    memset(e, 0, sizeof(*e));
+    ring->first = (ring->first + 1) % ring->capacity;
+    ring->count--;
+}
+
+void neg_rollback_destroy(NegRollback* ring) {
+    if (!ring) return;
+    while (ring->entries && ring->count > 0) drop_oldest(ring);
+    neg_mem_free(ring->entries);
+    neg_mem_free(ring->changed);
+    neg_mem_free(ring->shadow);
+    neg_mem_free(ring);
+}
+
+uint32_t neg_rollback_depth(const NegRollback* ring) {
+    return ring ? ring->count : 0;
+}
+
+size_t neg_rollback_bytes(const NegRollback* ring) {
+    return ring ? ring->bytes : 0;
+}
+
+/* ========================================================================
+ * CAPTURE
+ * ======================================================================== */
+
+typedef struct {
+    NegRollback* ring;
+    const uint8_t* live;
+} ComparePass;
+
+static void compare_tile(void* ctx, size_t begin, size_t end, int slot) {
+    ComparePass* pass = (ComparePass*)ctx;
+    NegRollback* ring = pass->ring;
+    (void)slot;
+    for (size_t t = begin; t < end; t++) {
+        size_t off = t * NEG_ROLLBACK_TILE_BYTES;
+        ring->changed[t] = memcmp(pass->live + off, ring->shadow + off, tile_len(ring, t)) != 0;
+    }
+}
+
+/* Flag the tiles where live differs from the shadow */
+static void compare_live(NegRollback* ring, const uint8_t* live) {
+    ComparePass pass = { ring, live };
+    neg_pool_run(&ring->pool, ring->tile_count, ROLLBACK_COMPARE_TILE, compare_tile, &pass);
+}
+
+int neg_rollback_capture(NegRollback* ring, void* sim) {
+    if (!ring || !sim) return NEG_ROLLBACK_OK;
+
+    NEG_TRACE_SCOPE_BEGIN(trace_capture);
+    const uint8_t* live = state_data(sim, NULL);
+    compare_live(ring, live);
+
+    uint32_t tiles = 0;
+    size_t old_bytes = 0;
+    for (size_t t = 0; t < ring->tile_count; t++) {
+        if (ring->changed[t]) {
+            tiles++;
+            old_bytes += tile_len(ring, t);
+        }
+    }
+
+    /* Undo record: previous tile contents, then bring the shadow up to date */
+    size_t bytes = tiles * sizeof(uint32_t) + old_bytes;
+    uint8_t* delta = bytes ? (uint8_t*)neg_mem_malloc(NEG_MEM_STATE, bytes) : NULL;
+    uint8_t* old = delta ? delta + tiles * sizeof(uint32_t) : NULL;
+    uint32_t n = 0;
+    for (size_t t = 0; t < ring->tile_count; t++) {
+        if (!ring->changed[t]) continue;
+        size_t off = t * NEG_ROLLBACK_TILE_BYTES;
+        size_t tlen = tile_len(ring, t);
+        if (delta) {
+            uint32_t index = (uint32_t)t;
+            memcpy(delta + n * sizeof(uint32_t), &index, sizeof(index));
+            memcpy(old, ring->shadow + off, tlen);
+            old += tlen;
+        }
+        memcpy(ring->shadow + off, live + off, tlen);
+        n++;
+    }
+
+    SimulationClock before = ring->clock;
+    state_get_clock(sim, &ring->clock);
+
+    int rc = NEG_ROLLBACK_OK;
+    if (bytes && !delta) {
+        while (ring->count > 0) drop_oldest(ring);
+        rc = NEG_ROLLBACK_NO_MEMORY;
+    } else {
+        if (ring->count == ring->capacity) drop_oldest(ring);
+        RollbackEntry* e = entry_at(ring, ring->count);
+        e->clock = before;
+        e->tiles = tiles;
+        e->bytes = bytes;
+        e->delta = delta;
+        ring->count++;
+        ring->bytes += bytes;
+        while (ring->budget && ring->bytes > ring->budget) drop_oldest(ring);
+    }
+
+    NEG_TRACE_SCOPE_END(trace_capture, "sim", "rollback_capture", tiles);
+    return rc;
+}
+
+/* ========================================================================
+ * RESTORE
+ * ======================================================================== */
+
+int neg_rollback_restore(NegRollback* ring, void* sim, uint32_t steps, uint64_t* tiles) {
+    if (tiles) *tiles = 0;
+    if (!ring || !sim || steps > ring->count) return NEG_ROLLBACK_TOO_FAR;
+
+    NEG_TRACE_SCOPE_BEGIN(trace_restore);
+    uint8_t* live = state_data(sim, NULL);
+    uint64_t copied = 0;
+    for (uint32_t s = 0; s < steps; s++) {
+        RollbackEntry* e = entry_at(ring, ring->count - 1);
+        const uint8_t* old = e->tiles ? e->delta + e->tiles * sizeof(uint32_t) : NULL;
+        for (uint32_t i = 0; i < e->tiles; i++) {
+            uint32_t t;
+            memcpy(&t, e->delta + i * sizeof(uint32_t), sizeof(t));
+            size_t off = (size_t)t * NEG_ROLLBACK_TILE_BYTES;
+            size_t tlen = tile_len(ring, t);
+            memcpy(live + off, old, tlen);
+            memcpy(ring->shadow + off, old, tlen);
+            old += tlen;
+        }
+        copied += e->tiles;
+        ring->clock = e->clock;
+
+        ring->bytes -= e->bytes;
+        neg_mem_free(e->delta);
+        memset(e, 0, sizeof(*e));
+        ring->count--;
+    }
+    state_set_clock(sim, &ring->clock);
+    NEG_TRACE_SCOPE_END(trace_restore, "sim", "rollback_restore", copied);
+
+    if (tiles) *tiles = copied;
+    return NEG_ROLLBACK_OK;
+}
+
+int neg_rollback_discard(NegRollback* ring, void* sim, uint64_t* tiles) {
+    if (tiles) *tiles = 0;
+    if (!ring || !sim) return NEG_ROLLBACK_OK;
+
+    uint8_t* live = state_data(sim, NULL);
+    compare_live(ring, live);
+    uint64_t copied = 0;
+    for (size_t t = 0; t < ring->tile_count; t++) {
+        if (!ring->changed[t]) continue;
+        size_t off = t * NEG_ROLLBACK_TILE_BYTES;
+        memcpy(live + off, ring->shadow + off, tile_len(ring, t));
+        copied++;
+    }
+    state_set_clock(sim, &ring->clock);
+
+    if (tiles) *tiles = copied;
+    return NEG_ROLLBACK_OK;
+}
@@ -4,6 +4,11 @@
  * Memory layout: Single contiguous block
  *   [SimulationInternal][poses array][scalar_fields array]
  *
+ * Blocks of a huge page or more are page-mapped (neg_mem_map) and first
+ * touched in huge-page tiles on the simulation's worker pool, so with
+ * "threads" > 1 and "pin_cpus" the field pages spread over the NUMA
+ * nodes the workers run on instead of all landing on the creator's.
+ *
  * Author: negentropic-core team
  * Version: 0.1.0
  * License: MIT OR GPL-3.0
@@ -13,10 +18,15 @@
 #include "include/state_versioning.h"
 #include "include/neg_error.h"
 #include "include/rng.h"
+#include "include/phase_timers.h"
+#include "include/trace.h"
+#include "include/mem_stats.h"
+#include "../../include/fixed_saturate.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdatomic.h>
 
 /* XXH3 for deterministic hashing (stub for now) */
 #define XXH_INLINE_ALL
@@ -54,6 +64,7 @@ typedef struct {
     /* Diagnostics */
     float total_energy;             /* System energy */
     float max_numerical_error;      /* Max error in last step */
+    NegPhaseTimers timers;          /* Per-phase step timers */
 
     /* Error tracking */
     char last_error[256];           /* Last error message */
@@ -62,6 +73,15 @@ typedef struct {
     /* Deterministic RNG */
     NegRNG rng;                     /* Deterministic random number generator */
 
+    /* Background stepping (neg_step_async), NULL until first used */
+    _Atomic(struct NegStepAsync*) async;
+
+    /* Hash-chained event log (neg_open_event_log), NULL when not logging */
+    struct NegEventLog* events;
+
+    /* Undo history (neg_enable_rollback), NULL when off */
+    struct NegRollback* rollback;
+
     /* Data follows this struct in memory:
      *   se3_pose_t poses[config.num_entities];
      *   float scalar_fields[config.num_scalar_fields];
@@ -72,6 +92,47 @@ typedef struct {
  * STATE CREATION & DESTRUCTION
  * ======================================================================== */
 
+/* First-touch stride: the smallest page the kernel may place */
+#define STATE_TOUCH_PAGE 4096
+
+typedef struct {
+    volatile uint8_t* base;
+    size_t size;
+} TouchPass;
+
+/* Write one byte per page of pages [begin, end) so this worker's node
+ * backs them (a huge page goes to whoever touches its first byte) */
+static void touch_tile(void* ctx, size_t begin, size_t end, int slot) {
+    const TouchPass* pass = (const TouchPass*)ctx;
+    (void)slot;
+    for (size_t p = begin; p < end; p++) {
+        size_t off = p * STATE_TOUCH_PAGE;
+        if (off < pass->size) pass->base[off] = 0;
+    }
+}
+
+static void* allocate_block(const SimulationConfig* cfg, size_t total_size) {
+    if (total_size < NEG_MEM_HUGE_PAGE) {
+        return neg_mem_calloc(NEG_MEM_STATE, 1, total_size);
+    }
+
+    void* memory = neg_mem_map(NEG_MEM_STATE, total_size);
+    if (!memory) return NULL;
+
+    /* Tiles of one huge page each, whatever the solver tile size is. The
+     * pool's static schedule gives slot s the s-th contiguous block of
+     * pages on every call, so state that a later pooled pass splits the
+     * same way stays on its worker's node. Solver grids allocated by the
+     * host are placed the same way by richards_lite_first_touch(). */
+    NegPoolConfig touch = cfg->pool;
+    touch.tile_size = 0;
+    TouchPass pass = { (volatile uint8_t*)memory, total_size };
+    neg_pool_run(&touch, (total_size + STATE_TOUCH_PAGE - 1) / STATE_TOUCH_PAGE,
+                 NEG_MEM_HUGE_PAGE / STATE_TOUCH_PAGE, touch_tile, &pass);
+    neg_mem_locality(memory, NULL);
+    return memory;
+}
+
 void* state_create(const SimulationConfig* cfg) {
     if (!cfg) return NULL;
     if (cfg->num_entities == 0) return NULL;
@@ -82,8 +143,8 @@ void* state_create(const SimulationConfig* cfg) {
     size_t scalar_fields_size = cfg->num_scalar_fields * sizeof(float);
     size_t total_size = base_size + poses_size + scalar_fields_size;
 
-    /* Allocate single contiguous block */
-    void* memory = calloc(1, total_size);
+    /* Allocate single contiguous block (zeroed) */
+    void* memory = allocate_block(cfg, total_size);
     if (!memory) return NULL;
 
     SimulationInternal* sim = (SimulationInternal*)memory;
@@ -98,6 +159,7 @@ void* state_create(const SimulationConfig* cfg) {
 
     /* Initialize error flags */
     neg_error_init(&sim->error_flags);
+    neg_phase_timers_init(&sim->timers);
 
     /* Initialize deterministic RNG with default seed */
     neg_rng_seed(&sim->rng, 0xDEADBEEFCAFEBABEULL);
@@ -112,14 +174,14 @@ void* state_create(const SimulationConfig* cfg) {
         se3_pose_identity(&poses[i]);
     }
 
-    /* Initialize scalar fields to zero (already done by calloc) */
+    /* Initialize scalar fields to zero (already done by calloc / mmap) */
 
     return (void*)sim;
 }
 
 void state_destroy(void* sim) {
     if (sim) {
-        free(sim);
+        neg_mem_free(sim);
     }
 }
 
@@ -128,6 +190,12 @@ void state_destroy(void* sim) {
  * ======================================================================== */
 
 bool state_get_view(void* sim, SimulationState* out_state) {
+    if (!state_get_view_unhashed(sim, out_state)) return false;
+    out_state->state_hash = state_hash(sim);
+    return true;
+}
+
+bool state_get_view_unhashed(void* sim, SimulationState* out_state) {
     if (!sim || !out_state) return false;
 
     SimulationInternal* internal = (SimulationInternal*)sim;
@@ -143,7 +211,7 @@ bool state_get_view(void* sim, SimulationState* out_state) {
     out_state->scalar_fields = (float*)(memory + internal->scalar_fields_offset);
 
     out_state->precision_mode = internal->config.precision_mode;
-    out_state->state_hash = state_hash(sim);
+    out_state->state_hash = 0;
     out_state->energy = internal->total_energy;
     out_state->max_error = internal->max_numerical_error;
     out_state->error_flags = internal->error_flags;
@@ -151,14 +219,45 @@ bool state_get_view(void* sim, SimulationState* out_state) {
     return true;
 }
 
+float* state_scalar_fields(void* sim, uint32_t* out_count) {
+    if (!sim) return NULL;
+
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    if (out_count) *out_count = internal->config.num_scalar_fields;
+    return (float*)((uint8_t*)sim + internal->scalar_fields_offset);
+}
+
 /* ========================================================================
  * SIMULATION STEPPING (Stub - to be implemented with integrators)
  * ======================================================================== */
 
+/**
+ * Fold the fixed-point sticky bits raised on this thread since the last
+ * step into the simulation's error flags. One branch per step; the
+ * arithmetic itself only ORs bits (see fixed_clamp64).
+ */
+static void merge_fixed_sticky(SimulationInternal* internal, uint32_t sticky) {
+    if (sticky == 0) return;
+
+    if (sticky & FIXED_STICKY_OVERFLOW) {
+        NEG_SET_ERROR(&internal->error_flags, overflow);
+    }
+    if (sticky & FIXED_STICKY_DIV_ZERO) {
+        NEG_SET_ERROR(&internal->error_flags, inf_detected);
+    }
+    internal->error_flags.last_error_step = (uint32_t)internal->step_count;
+}
+
 bool state_step(void* sim, float dt) {
     if (!sim) return false;
 
     SimulationInternal* internal = (SimulationInternal*)sim;
+    neg_phase_begin_step(&internal->timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_step);
+
+    /* Drop bits this thread raised outside the step (another simulation,
+     * a host-driven solver call) so only this step's clamps are merged */
+    fixed_sticky_take();
 
     /* Use config default if dt == 0 */
     if (dt == 0.0f) {
@@ -178,6 +277,8 @@ bool state_step(void* sim, float dt) {
      * For now, this is a stub that does nothing
      */
 
+    merge_fixed_sticky(internal, fixed_sticky_take());
+
     /* Update timestamp */
     internal->timestamp += (uint64_t)(dt * 1e6);  /* Convert to microseconds */
     internal->step_count++;
@@ -185,9 +286,82 @@ bool state_step(void* sim, float dt) {
     /* Stub: No actual physics yet */
     internal->max_numerical_error = 0.0f;
 
+    neg_phase_end_step(&internal->timers);
+    NEG_TRACE_SCOPE_END(trace_step, "sim", "step", internal->step_count);
     return true;
 }
 
+NegPhaseTimers* state_get_phase_timers(void* sim) {
+    if (!sim) return NULL;
+    return &((SimulationInternal*)sim)->timers;
+}
+
+const NegPoolConfig* state_get_pool_config(void* sim) {
+    if (!sim) return NULL;
+    return &((SimulationInternal*)sim)->config.pool;
+}
+
+struct NegStepAsync* state_get_async(void* sim) {
+    if (!sim) return NULL;
+    return atomic_load_explicit(&((SimulationInternal*)sim)->async, memory_order_acquire);
+}
+
+void state_set_async(void* sim, struct NegStepAsync* async) {
+    if (!sim) return;
+    atomic_store_explicit(&((SimulationInternal*)sim)->async, async, memory_order_release);
+}
+
+struct NegEventLog* state_get_event_log(void* sim) {
+    if (!sim) return NULL;
+    return ((SimulationInternal*)sim)->events;
+}
+
+void state_set_event_log(void* sim, struct NegEventLog* log) {
+    if (!sim) return;
+    ((SimulationInternal*)sim)->events = log;
+}
+
+uint64_t state_get_step_count(void* sim) {
+    if (!sim) return 0;
+    return ((SimulationInternal*)sim)->step_count;
+}
+
+void state_get_clock(void* sim, SimulationClock* out) {
+    if (!sim || !out) return;
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    out->step_count = internal->step_count;
+    out->timestamp = internal->timestamp;
+    out->rng_state = internal->rng.state;
+}
+
+void state_set_clock(void* sim, const SimulationClock* clock) {
+    if (!sim || !clock) return;
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    internal->step_count = clock->step_count;
+    internal->timestamp = clock->timestamp;
+    if (clock->rng_state != 0) internal->rng.state = clock->rng_state;
+}
+
+uint8_t* state_data(void* sim, size_t* out_len) {
+    if (!sim) return NULL;
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    if (out_len) {
+        *out_len = internal->config.num_entities * sizeof(se3_pose_t) +
+                   internal->config.num_scalar_fields * sizeof(float);
+    }
+    return (uint8_t*)sim + internal->poses_offset;
+}
+
+struct NegRollback* state_get_rollback(void* sim) {
+    if (!sim) return NULL;
+    return ((SimulationInternal*)sim)->rollback;
+}
+
+void state_set_rollback(void* sim, struct NegRollback* rollback) {
+    if (!sim) return;
+    ((SimulationInternal*)sim)->rollback = rollback;
+}
+
 /* ========================================================================
  * STATE SERIALIZATION
  * ======================================================================== */
@@ -218,7 +392,8 @@ size_t state_get_binary_size(void* sim) {
     return size;
 }
 
-size_t state_to_binary(void* sim, uint8_t* buffer, size_t max_len) {
+/* Untimed serializer shared by state_to_binary() and state_hash() */
+static size_t serialize_state(void* sim, uint8_t* buffer, size_t max_len) {
     if (!sim || !buffer) return 0;
 
     size_t required_size = state_get_binary_size(sim);
@@ -246,8 +421,10 @@ size_t state_to_binary(void* sim, uint8_t* buffer, size_t max_len) {
     memcpy(ptr, &timestamp_ms, sizeof(uint64_t));
     ptr += sizeof(uint64_t);
 
-    /* Reserve space for HASH (will compute later) */
+    /* Reserve space for HASH (will compute later); zeroed so the hash does
+     * not cover whatever the caller's buffer held */
     uint64_t* hash_ptr = (uint64_t*)ptr;
+    memset(ptr, 0, sizeof(uint64_t));
     ptr += sizeof(uint64_t);
 
     /* Reserve space for DATA_SIZE */
@@ -284,7 +461,19 @@ size_t state_to_binary(void* sim, uint8_t* buffer, size_t max_len) {
     return (size_t)(ptr - buffer);
 }
 
-bool state_reset_from_binary(void* sim, const uint8_t* buffer, size_t len) {
+size_t state_to_binary(void* sim, uint8_t* buffer, size_t max_len) {
+    if (!sim) return 0;
+
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    uint64_t t0 = neg_phase_start(&internal->timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_start);
+    size_t written = serialize_state(sim, buffer, max_len);
+    NEG_TRACE_SCOPE_END(trace_start, "io", "snapshot_save", written);
+    neg_phase_stop(&internal->timers, NEG_PHASE_SNAPSHOT, t0);
+    return written;
+}
+
+static bool restore_state(void* sim, const uint8_t* buffer, size_t len) {
     if (!sim || !buffer || len == 0) return false;
 
     SimulationInternal* internal = (SimulationInternal*)sim;
@@ -361,6 +550,18 @@ bool state_reset_from_binary(void* sim, const uint8_t* buffer, size_t len) {
     return true;
 }
 
+bool state_reset_from_binary(void* sim, const uint8_t* buffer, size_t len) {
+    if (!sim) return false;
+
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    uint64_t t0 = neg_phase_start(&internal->timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_start);
+    bool ok = restore_state(sim, buffer, len);
+    NEG_TRACE_SCOPE_END(trace_start, "io", "snapshot_restore", len);
+    neg_phase_stop(&internal->timers, NEG_PHASE_SNAPSHOT, t0);
+    return ok;
+}
+
 /* ========================================================================
  * HASHING
  * ======================================================================== */
@@ -368,23 +569,41 @@ bool state_reset_from_binary(void* sim, const uint8_t* buffer, size_t len) {
 uint64_t state_hash(void* sim) {
     if (!sim) return 0;
 
+    SimulationInternal* internal = (SimulationInternal*)sim;
+    uint64_t t0 = neg_phase_start(&internal->timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_start);
+
     /* Hash the binary representation for determinism */
+    uint64_t hash = 0;
     size_t size = state_get_binary_size(sim);
-    uint8_t* buffer = (uint8_t*)malloc(size);
-    if (!buffer) return 0;
-
-    size_t written = state_to_binary(sim, buffer, size);
-    if (written == 0) {
-        free(buffer);
-        return 0;
+    uint8_t* buffer = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, size);
+    if (buffer) {
+        size_t written = serialize_state(sim, buffer, size);
+        if (written != 0) {
+            hash = xxh3_hash(buffer, written);
+        }
+        neg_mem_free(buffer);
     }
 
-    uint64_t hash = xxh3_hash(buffer, written);
-    free(buffer);
-
+    NEG_TRACE_SCOPE_END(trace_start, "io", "hash", size);
+    neg_phase_stop(&internal->timers, NEG_PHASE_HASH, t0);
     return hash;
 }
 
+uint64_t state_hash_binary(const uint8_t* buffer, size_t len) {
+    if (!buffer || len == 0) return 0;
+    return xxh3_hash(buffer, len);
+}
+
+uint64_t state_binary_timestamp_ms(const uint8_t* buffer, size_t len) {
+    size_t offset = NEG_STATE_MAGIC_LEN + sizeof(uint32_t);
+    if (!buffer || len < offset + sizeof(uint64_t)) return 0;
+
+    uint64_t timestamp_ms;
+    memcpy(&timestamp_ms, buffer + offset, sizeof(uint64_t));
+    return timestamp_ms;
+}
+
 /* ========================================================================
  * ERROR FLAGS ACCESS
  * ======================================================================== */
@@ -23,6 +23,8 @@
 #include "include/neg_error.h"
 #include "include/rng.h"
 #include "include/se3_types.h"
+#include "include/phase_timers.h"
+#include "include/thread_pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -48,6 +50,7 @@ typedef struct {
     uint8_t enable_hydrology : 1;   /* Enable hydrology solver */
     uint8_t enable_soil : 1;        /* Enable soil moisture solver */
     uint8_t _reserved : 5;          /* Reserved flags */
+    NegPoolConfig pool;             /* "threads", "tile_size", "pin_cpus" */
 } SimulationConfig;
 
 /* ========================================================================
@@ -97,6 +100,8 @@ typedef struct {
  * Create a new simulation state from configuration.
  *
  * Allocates a single contiguous memory block and initializes all fields.
+ * Blocks of NEG_MEM_HUGE_PAGE or more are mapped for transparent huge
+ * pages and first-touched in parallel on cfg->pool (NUMA placement).
  *
  * @param cfg Configuration structure
  * @return Opaque simulation handle (NULL on failure)
@@ -122,6 +127,18 @@ void state_destroy(void* sim);
  */
 bool state_get_view(void* sim, SimulationState* out_state);
 
+/**
+ * Scalar field values in place, without the hash state_get_view() computes.
+ *
+ * The pointer stays valid (and at the same address) until state_destroy();
+ * state_reset_from_binary() overwrites the values in place.
+ *
+ * @param sim Opaque simulation handle
+ * @param out_count Number of values (optional)
+ * @return Pointer into simulation memory, or NULL if sim is NULL
+ */
+float* state_scalar_fields(void* sim, uint32_t* out_count);
+
 /**
  * Advance simulation by one timestep.
  *
@@ -154,6 +171,17 @@ bool state_reset_from_binary(void* sim, const uint8_t* buffer, size_t len);
  */
 uint64_t state_hash(void* sim);
 
+/**
+ * Hash of an already serialized state (state_to_binary() output).
+ *
+ * Equal to state_hash() of the simulation the buffer was taken from, so
+ * publishers that serialize anyway skip the second serialization.
+ */
+uint64_t state_hash_binary(const uint8_t* buffer, size_t len);
+
+/** Simulation time (milliseconds) stamped in a serialized state, 0 if too short */
+uint64_t state_binary_timestamp_ms(const uint8_t* buffer, size_t len);
+
 /**
  * Serialize state to binary format (platform-independent).
  *
@@ -181,6 +209,86 @@ size_t state_get_binary_size(void* sim);
  */
 bool state_get_error_flags(void* sim, NegErrorFlags* out_flags);
 
+/**
+ * Get the per-phase step timers of a simulation.
+ *
+ * state_step() opens and closes a step; hashing and snapshots are timed
+ * here. Solvers driven by the host take the pointer directly, e.g. as the
+ * diagnostics argument of richards_lite_step(), or wrap their own calls
+ * in neg_phase_start() / neg_phase_stop().
+ *
+ * @param sim Opaque simulation handle
+ * @return Timers owned by the simulation, or NULL
+ */
+NegPhaseTimers* state_get_phase_timers(void* sim);
+
+/**
+ * Get the worker pool configuration of a simulation.
+ *
+ * Like the timers, for solvers driven by the host: pass it to
+ * richards_lite_step_tiled() or neg_pool_run().
+ *
+ * @param sim Opaque simulation handle
+ * @return Configuration owned by the simulation, or NULL
+ */
+const NegPoolConfig* state_get_pool_config(void* sim);
+
+/**
+ * state_get_view() without the state hash (state_hash left 0), for
+ * callers that hash a serialized copy themselves.
+ */
+bool state_get_view_unhashed(void* sim, SimulationState* out_state);
+
+/**
+ * Background stepping context attached by neg_step_async(), or NULL.
+ *
+ * Set by the host thread before the first job; read from any thread
+ * (acquire), so readers that see a context see it fully initialized.
+ * state_destroy() does not free it: detach and destroy it first.
+ */
+struct NegStepAsync* state_get_async(void* sim);
+void state_set_async(void* sim, struct NegStepAsync* async);
+
+/**
+ * Event log the steps are recorded to (neg_open_event_log()), or NULL.
+ *
+ * Changed only with no async job queued; the async worker reads it
+ * while running jobs. state_destroy() does not close it.
+ */
+struct NegEventLog* state_get_event_log(void* sim);
+void state_set_event_log(void* sim, struct NegEventLog* log);
+
+/** Steps taken since creation */
+uint64_t state_get_step_count(void* sim);
+
+/**
+ * Runtime counters state_to_binary() does not carry (it stores the time
+ * in milliseconds only). A snapshot plus its clock restores a state that
+ * steps on bit-identically.
+ */
+typedef struct {
+    uint64_t step_count;
+    uint64_t timestamp;             /* Microseconds */
+    uint64_t rng_state;
+} SimulationClock;
+
+void state_get_clock(void* sim, SimulationClock* out);
+void state_set_clock(void* sim, const SimulationClock* clock);
+
+/**
+ * Poses and scalar fields as one contiguous byte range (what
+ * state_to_binary() serializes), for in-place snapshots.
+ */
+uint8_t* state_data(void* sim, size_t* out_len);
+
+/**
+ * Rollback ring attached by neg_enable_rollback(), or NULL. Same
+ * threading rules as state_get_event_log(); state_destroy() does not
+ * free it.
+ */
+struct NegRollback* state_get_rollback(void* sim);
+void state_set_rollback(void* sim, struct NegRollback* rollback);
+
 #ifdef __cplusplus
 }
 #endif
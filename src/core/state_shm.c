@@ -0,0 +1,307 @@
+/*
+ * state_shm.c - Shared-Memory State Publication (POSIX shm)
+ *
+ * See state_shm.h for the segment layout and the seqlock protocol.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "include/state_shm.h"
+#include "include/mem_stats.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+#define NEG_SHM_UNSUPPORTED 1
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Readers in other processes share these words with the writer */
+#if ATOMIC_LLONG_LOCK_FREE != 2 || ATOMIC_INT_LOCK_FREE != 2
+#error "state_shm needs lock-free 32- and 64-bit atomics"
+#endif
+
+#define SLOT_ALIGN  64
+#define NAME_MAX_LEN 255
+
+/* Attempts before neg_shm_read() gives up with NEG_SHM_RETRY */
+#define READ_ATTEMPTS 64
+
+typedef struct {
+    _Atomic uint64_t seq;           /* 2n: frame n complete; odd: being written */
+    _Atomic uint64_t size;
+    _Atomic uint64_t state_hash;
+    _Atomic uint64_t timestamp_ms;
+} ShmSlot;
+
+typedef struct {
+    _Atomic uint32_t magic;         /* Stored last: segment initialized */
+    uint32_t layout;
+    uint32_t header_size;
+    uint32_t writer_pid;
+    uint64_t capacity;              /* Bytes per slot (multiple of SLOT_ALIGN) */
+    _Atomic uint64_t latest;        /* Newest complete frame, 0: none */
+    uint64_t reserved0;
+    ShmSlot slots[2];
+    uint8_t reserved[24];
+} ShmHeader;
+
+_Static_assert(sizeof(ShmHeader) == NEG_SHM_HEADER_SIZE, "shm header must stay 128 bytes");
+
+struct NegShmWriter {
+    ShmHeader* header;
+    size_t map_size;
+    size_t capacity;
+    uint64_t pending;               /* Frame started by neg_shm_begin(), 0: none */
+    char name[NAME_MAX_LEN + 1];
+};
+
+struct NegShmReader {
+    const ShmHeader* header;
+    size_t map_size;
+    size_t capacity;
+};
+
+static uint8_t* slot_data(const ShmHeader* header, uint64_t frame) {
+    return (uint8_t*)header + NEG_SHM_HEADER_SIZE + (frame & 1) * header->capacity;
+}
+
+/** "/name": leading slash, no other slashes (portable shm_open names) */
+static int valid_name(const char* name) {
+    if (!name || name[0] != '/' || name[1] == '\0') return 0;
+    size_t len = strlen(name);
+    return len <= NAME_MAX_LEN && !strchr(name + 1, '/');
+}
+
+/* ========================================================================
+ * WRITER
+ * ======================================================================== */
+
+#ifndef NEG_SHM_UNSUPPORTED
+
+NegShmWriter* neg_shm_writer_create(const char* name, size_t capacity) {
+    if (!valid_name(name) || capacity == 0) return NULL;
+
+    size_t slot = (capacity + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+    size_t map_size = NEG_SHM_HEADER_SIZE + 2 * slot;
+
+    NegShmWriter* w = (NegShmWriter*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegShmWriter));
+    if (!w) return NULL;
+
+    /* Readers of a previous writer keep their mapping of the old object */
+    shm_unlink(name);
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        neg_mem_free(w);
+        return NULL;
+    }
+    void* map = MAP_FAILED;
+    if (ftruncate(fd, (off_t)map_size) == 0) {
+        map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED) {
+        shm_unlink(name);
+        neg_mem_free(w);
+        return NULL;
+    }
+
+    /* ftruncate zero-filled the segment: latest = 0, every slot seq = 0 */
+    ShmHeader* header = (ShmHeader*)map;
+    header->layout = NEG_SHM_LAYOUT;
+    header->header_size = NEG_SHM_HEADER_SIZE;
+    header->writer_pid = (uint32_t)getpid();
+    header->capacity = slot;
+    atomic_store_explicit(&header->magic, NEG_SHM_MAGIC, memory_order_release);
+
+    w->header = header;
+    w->map_size = map_size;
+    w->capacity = slot;
+    memcpy(w->name, name, strlen(name) + 1);
+    return w;
+}
+
+uint8_t* neg_shm_begin(NegShmWriter* writer) {
+    if (!writer) return NULL;
+
+    ShmHeader* header = writer->header;
+    uint64_t frame = atomic_load_explicit(&header->latest, memory_order_relaxed) + 1;
+    ShmSlot* slot = &header->slots[frame & 1];
+
+    /* Odd sequence before any byte of the slot changes */
+    atomic_store_explicit(&slot->seq, 2 * frame - 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    writer->pending = frame;
+    return slot_data(header, frame);
+}
+
+uint64_t neg_shm_commit(NegShmWriter* writer, size_t size, uint64_t state_hash,
+                        uint64_t timestamp_ms) {
+    if (!writer || !writer->pending) return 0;
+
+    uint64_t frame = writer->pending;
+    writer->pending = 0;
+    if (size > writer->capacity) return 0;  /* Slot stays odd; readers skip it */
+
+    ShmSlot* slot = &writer->header->slots[frame & 1];
+    atomic_store_explicit(&slot->size, size, memory_order_relaxed);
+    atomic_store_explicit(&slot->state_hash, state_hash, memory_order_relaxed);
+    atomic_store_explicit(&slot->timestamp_ms, timestamp_ms, memory_order_relaxed);
+    atomic_store_explicit(&slot->seq, 2 * frame, memory_order_release);
+    atomic_store_explicit(&writer->header->latest, frame, memory_order_release);
+    return frame;
+}
+
+size_t neg_shm_writer_capacity(const NegShmWriter* writer) {
+    return writer ? writer->capacity : 0;
+}
+
+void neg_shm_writer_destroy(NegShmWriter* writer, int unlink_segment) {
+    if (!writer) return;
+    munmap((void*)writer->header, writer->map_size);
+    if (unlink_segment) shm_unlink(writer->name);
+    neg_mem_free(writer);
+}
+
+/* ========================================================================
+ * READER
+ * ======================================================================== */
+
+NegShmReader* neg_shm_reader_open(const char* name) {
+    if (!valid_name(name)) return NULL;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    void* map = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= NEG_SHM_HEADER_SIZE) {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    const ShmHeader* header = (const ShmHeader*)map;
+    size_t map_size = (size_t)st.st_size;
+    if (atomic_load_explicit((_Atomic uint32_t*)&header->magic, memory_order_acquire) !=
+            NEG_SHM_MAGIC ||
+        header->layout != NEG_SHM_LAYOUT || header->header_size != NEG_SHM_HEADER_SIZE ||
+        header->capacity == 0 ||
+        header->capacity > (map_size - NEG_SHM_HEADER_SIZE) / 2) {
+        munmap(map, map_size);
+        return NULL;
+    }
+
+    NegShmReader* r = (NegShmReader*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegShmReader));
+    if (!r) {
+        munmap(map, map_size);
+        return NULL;
+    }
+    r->header = header;
+    r->map_size = map_size;
+    r->capacity = (size_t)header->capacity;
+    return r;
+}
+
+void neg_shm_reader_close(NegShmReader* reader) {
+    if (!reader) return;
+    munmap((void*)reader->header, reader->map_size);
+    neg_mem_free(reader);
+}
+
+#else /* NEG_SHM_UNSUPPORTED */
+
+NegShmWriter* neg_shm_writer_create(const char* name, size_t capacity) {
+    (void)name;
+    (void)capacity;
+    return NULL;
+}
+
+uint8_t* neg_shm_begin(NegShmWriter* writer) {
+    (void)writer;
+    return NULL;
+}
+
+uint64_t neg_shm_commit(NegShmWriter* writer, size_t size, uint64_t state_hash,
+                        uint64_t timestamp_ms) {
+    (void)writer;
+    (void)size;
+    (void)state_hash;
+    (void)timestamp_ms;
+    return 0;
+}
+
+size_t neg_shm_writer_capacity(const NegShmWriter* writer) {
+    (void)writer;
+    return 0;
+}
+
+void neg_shm_writer_destroy(NegShmWriter* writer, int unlink_segment) {
+    (void)writer;
+    (void)unlink_segment;
+}
+
+NegShmReader* neg_shm_reader_open(const char* name) {
+    (void)name;
+    return NULL;
+}
+
+void neg_shm_reader_close(NegShmReader* reader) {
+    (void)reader;
+}
+
+#endif /* NEG_SHM_UNSUPPORTED */
+
+uint64_t neg_shm_latest(const NegShmReader* reader) {
+    if (!reader) return 0;
+    return atomic_load_explicit((_Atomic uint64_t*)&reader->header->latest,
+                                memory_order_acquire);
+}
+
+size_t neg_shm_reader_capacity(const NegShmReader* reader) {
+    return reader ? reader->capacity : 0;
+}
+
+int64_t neg_shm_read(NegShmReader* reader, void* buffer, size_t max_len, NegShmFrame* frame) {
+    if (!reader || (!buffer && max_len > 0)) return NEG_SHM_ERROR;
+
+    ShmHeader* header = (ShmHeader*)reader->header;
+    for (int attempt = 0; attempt < READ_ATTEMPTS; attempt++) {
+        uint64_t latest = atomic_load_explicit(&header->latest, memory_order_acquire);
+        if (latest == 0) return NEG_SHM_EMPTY;
+
+        ShmSlot* slot = &header->slots[latest & 1];
+        uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq != 2 * latest) continue;  /* Already being reused: newer frame out */
+
+        uint64_t size = atomic_load_explicit(&slot->size, memory_order_relaxed);
+        uint64_t state_hash = atomic_load_explicit(&slot->state_hash, memory_order_relaxed);
+        uint64_t timestamp_ms = atomic_load_explicit(&slot->timestamp_ms, memory_order_relaxed);
+        int fits = size <= max_len && size <= reader->capacity;
+        if (fits) memcpy(buffer, slot_data(header, latest), (size_t)size);
+
+        /* The copy must complete before the sequence is checked again */
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) continue;
+
+        if (size > reader->capacity) return NEG_SHM_ERROR;
+        if (!fits) return NEG_SHM_TOO_SMALL;
+        if (frame) {
+            frame->frame = latest;
+            frame->size = size;
+            frame->state_hash = state_hash;
+            frame->timestamp_ms = timestamp_ms;
+        }
+        return (int64_t)size;
+    }
+    return NEG_SHM_RETRY;
+}
@@ -0,0 +1,326 @@
+/*
+ * step_async.c - Background Stepping with a Double-Buffered Published State
+ *
+ * See step_async.h for the ticket and publication contract.
+ *
+ * Locks: `lock` guards the job queue and ticket counters, `front_lock`
+ * only the front buffer index and its descriptor (with the timer and
+ * error flag snapshot). The worker never holds
+ * both, and never holds either while stepping or serializing.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "include/step_async.h"
+#include "include/event_log.h"
+#include "include/rollback.h"
+#include "include/mem_stats.h"
+#include "include/trace.h"
+#include "state.h"
+#include <string.h>
+
+#if defined(_WIN32) || (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+#define NEG_ASYNC_NO_THREADS 1
+#else
+#include <pthread.h>
+#endif
+
+typedef struct {
+    int64_t ticket;
+    float dt;
+    uint32_t n;
+} AsyncJob;
+
+struct NegStepAsync {
+    void* sim;
+
+    /* Job queue (lock) */
+    AsyncJob queue[NEG_ASYNC_QUEUE];
+    uint32_t head;
+    uint32_t count;
+    int64_t issued;                 /* Last ticket handed out */
+    int64_t completed;              /* Every ticket <= this is complete */
+    int64_t failed_first;           /* Tickets of the most recent failure, */
+    int64_t failed_last;            /* 0..0 if none */
+    int stop;
+
+    /* Published state (front_lock) */
+    uint8_t* buffers[2];
+    size_t capacity;
+    int front;
+    NegAsyncFrame frame;            /* Describes buffers[front] */
+
+#ifndef NEG_ASYNC_NO_THREADS
+    pthread_mutex_t lock;
+    pthread_cond_t work;            /* Queue not empty, or stop */
+    pthread_cond_t done;            /* completed advanced */
+    pthread_mutex_t front_lock;
+    pthread_t thread;
+#endif
+};
+
+#ifdef NEG_ASYNC_NO_THREADS
+#define LOCK(m)   ((void)0)
+#define UNLOCK(m) ((void)0)
+#else
+#define LOCK(m)   pthread_mutex_lock(m)
+#define UNLOCK(m) pthread_mutex_unlock(m)
+#endif
+
+/* ========================================================================
+ * PUBLICATION
+ * ======================================================================== */
+
+/* Serialize into the back buffer, then swap it to the front */
+static void publish(NegStepAsync* async) {
+    int back = 1 - async->front;    /* publish() never runs concurrently with itself */
+    size_t written = state_to_binary(async->sim, async->buffers[back], async->capacity);
+    if (written == 0) return;       /* Keep the previous frame */
+
+    SimulationState view;
+    state_get_view_unhashed(async->sim, &view);
+    uint64_t hash = state_hash_binary(async->buffers[back], written);
+    uint64_t step_count = state_get_step_count(async->sim);
+    uint32_t rollback_depth = neg_rollback_depth(state_get_rollback(async->sim));
+
+    /* Fill the frame in place rather than staging the ~5 KB of timers
+     * and copying them twice; readers wait at most for this memcpy */
+    LOCK(&async->front_lock);
+    async->front = back;
+    async->frame.size = written;
+    async->frame.hash = hash;
+    async->frame.timestamp = view.timestamp;
+    async->frame.num_entities = view.num_entities;
+    async->frame.num_scalar_values = view.num_scalar_values;
+    async->frame.step_count = step_count;
+    async->frame.rollback_depth = rollback_depth;
+    async->frame.energy = view.energy;
+    async->frame.max_error = view.max_error;
+    async->frame.error_flags = view.error_flags;
+    async->frame.timers = *state_get_phase_timers(async->sim);
+    UNLOCK(&async->front_lock);
+}
+
+void step_async_republish(NegStepAsync* async) {
+    if (async) publish(async);
+}
+
+size_t step_async_read(NegStepAsync* async, uint8_t* buffer, size_t max_len, uint64_t* hash) {
+    if (!async || !buffer) return 0;
+
+    LOCK(&async->front_lock);
+    size_t size = async->frame.size;
+    if (size <= max_len) {
+        memcpy(buffer, async->buffers[async->front], size);
+        if (hash) *hash = async->frame.hash;
+    } else {
+        size = 0;
+    }
+    UNLOCK(&async->front_lock);
+    return size;
+}
+
+void step_async_frame(NegStepAsync* async, NegAsyncFrame* out) {
+    if (!async || !out) return;
+
+    LOCK(&async->front_lock);
+    *out = async->frame;
+    UNLOCK(&async->front_lock);
+}
+
+/* ========================================================================
+ * WORKER
+ * ======================================================================== */
+
+/* Run one job and publish its result; false if a step failed */
+static int run_job(NegStepAsync* async, const AsyncJob* job) {
+    NEG_TRACE_SCOPE_BEGIN(trace_job);
+    NegEventLog* events = state_get_event_log(async->sim);
+    NegRollback* rollback = state_get_rollback(async->sim);
+    int ok = 1;
+    for (uint32_t i = 0; i < job->n; i++) {
+        ok = state_step(async->sim, job->dt);
+        if (events) neg_event_log_record_step(events, async->sim, job->dt, ok);
+        if (rollback) neg_rollback_capture(rollback, async->sim);
+        if (!ok) break;
+    }
+    publish(async);
+    NEG_TRACE_SCOPE_END(trace_job, "sim", "async_job", job->n);
+    return ok;
+}
+
+/* Mark a job complete (lock held); a failure also fails the queued jobs */
+static void complete_job(NegStepAsync* async, int64_t ticket, int ok) {
+    async->completed = ticket;
+    if (!ok) {
+        async->failed_first = ticket;
+        async->failed_last = ticket + async->count;
+        async->completed = async->failed_last;
+        async->count = 0;
+    }
+}
+
+#ifndef NEG_ASYNC_NO_THREADS
+static void* worker_main(void* arg) {
+    NegStepAsync* async = (NegStepAsync*)arg;
+
+    pthread_mutex_lock(&async->lock);
+    for (;;) {
+        while (async->count == 0 && !async->stop) {
+            pthread_cond_wait(&async->work, &async->lock);
+        }
+        if (async->count == 0) break;   /* Stopped and drained */
+
+        AsyncJob job = async->queue[async->head];
+        async->head = (async->head + 1) % NEG_ASYNC_QUEUE;
+        async->count--;
+        pthread_mutex_unlock(&async->lock);
+
+        int ok = run_job(async, &job);
+
+        pthread_mutex_lock(&async->lock);
+        complete_job(async, job.ticket, ok);
+        pthread_cond_broadcast(&async->done);
+    }
+    pthread_mutex_unlock(&async->lock);
+    return NULL;
+}
+#endif
+
+/* ========================================================================
+ * LIFECYCLE
+ * ======================================================================== */
+
+NegStepAsync* step_async_create(void* sim) {
+    if (!sim) return NULL;
+
+    NegStepAsync* async = (NegStepAsync*)neg_mem_calloc(NEG_MEM_IO, 1, sizeof(NegStepAsync));
+    if (!async) return NULL;
+
+    async->sim = sim;
+    async->capacity = state_get_binary_size(sim);
+    async->buffers[0] = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, async->capacity);
+    async->buffers[1] = (uint8_t*)neg_mem_malloc(NEG_MEM_IO, async->capacity);
+    if (!async->buffers[0] || !async->buffers[1]) {
+        neg_mem_free(async->buffers[0]);
+        neg_mem_free(async->buffers[1]);
+        neg_mem_free(async);
+        return NULL;
+    }
+
+#ifndef NEG_ASYNC_NO_THREADS
+    pthread_mutex_init(&async->lock, NULL);
+    pthread_mutex_init(&async->front_lock, NULL);
+    pthread_cond_init(&async->work, NULL);
+    pthread_cond_init(&async->done, NULL);
+#endif
+
+    publish(async);
+
+#ifndef NEG_ASYNC_NO_THREADS
+    if (pthread_create(&async->thread, NULL, worker_main, async) != 0) {
+        pthread_cond_destroy(&async->done);
+        pthread_cond_destroy(&async->work);
+        pthread_mutex_destroy(&async->front_lock);
+        pthread_mutex_destroy(&async->lock);
+        neg_mem_free(async->buffers[0]);
+        neg_mem_free(async->buffers[1]);
+        neg_mem_free(async);
+        return NULL;
+    }
+#endif
+
+    return async;
+}
+
+void step_async_destroy(NegStepAsync* async) {
+    if (!async) return;
+
+#ifndef NEG_ASYNC_NO_THREADS
+    pthread_mutex_lock(&async->lock);
+    async->stop = 1;
+    pthread_cond_signal(&async->work);
+    pthread_mutex_unlock(&async->lock);
+    pthread_join(async->thread, NULL);
+
+    pthread_cond_destroy(&async->done);
+    pthread_cond_destroy(&async->work);
+    pthread_mutex_destroy(&async->front_lock);
+    pthread_mutex_destroy(&async->lock);
+#endif
+
+    neg_mem_free(async->buffers[0]);
+    neg_mem_free(async->buffers[1]);
+    neg_mem_free(async);
+}
+
+/* ========================================================================
+ * JOBS
+ * ======================================================================== */
+
+int64_t step_async_submit(NegStepAsync* async, float dt, uint32_t n) {
+    if (!async) return NEG_ASYNC_BAD_TICKET;
+
+#ifdef NEG_ASYNC_NO_THREADS
+    AsyncJob job = { ++async->issued, dt, n };
+    complete_job(async, job.ticket, run_job(async, &job));
+    return job.ticket;
+#else
+    pthread_mutex_lock(&async->lock);
+    if (async->count == NEG_ASYNC_QUEUE) {
+        pthread_mutex_unlock(&async->lock);
+        return NEG_ASYNC_QUEUE_FULL;
+    }
+
+    AsyncJob* job = &async->queue[(async->head + async->count) % NEG_ASYNC_QUEUE];
+    job->ticket = ++async->issued;
+    job->dt = dt;
+    job->n = n;
+    async->count++;
+    int64_t ticket = job->ticket;
+
+    pthread_cond_signal(&async->work);
+    pthread_mutex_unlock(&async->lock);
+    return ticket;
+#endif
+}
+
+/* Status of a ticket (lock held) */
+static int ticket_status(const NegStepAsync* async, int64_t ticket) {
+    if (ticket < 0 || ticket > async->issued) return NEG_ASYNC_BAD_TICKET;
+    if (ticket > async->completed) return NEG_ASYNC_PENDING;
+    if (ticket >= async->failed_first && ticket <= async->failed_last && ticket != 0) {
+        return NEG_ASYNC_FAILED;
+    }
+    return NEG_ASYNC_DONE;
+}
+
+int step_async_poll(NegStepAsync* async, int64_t ticket) {
+    if (!async) return NEG_ASYNC_BAD_TICKET;
+
+    LOCK(&async->lock);
+    if (ticket == 0) ticket = async->issued;
+    int status = ticket_status(async, ticket);
+    UNLOCK(&async->lock);
+    return status;
+}
+
+int step_async_wait(NegStepAsync* async, int64_t ticket) {
+    if (!async) return NEG_ASYNC_BAD_TICKET;
+
+    LOCK(&async->lock);
+    if (ticket == 0) ticket = async->issued;
+    int status = ticket_status(async, ticket);
+#ifndef NEG_ASYNC_NO_THREADS
+    while (status == NEG_ASYNC_PENDING) {
+        pthread_cond_wait(&async->done, &async->lock);
+        status = ticket_status(async, ticket);
+    }
+#endif
+    UNLOCK(&async->lock);
+    return status;
+}
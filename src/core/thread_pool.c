@@ -0,0 +1,269 @@
+/*
+ * thread_pool.c - Process-Wide Worker Pool with Static Tiling
+ *
+ * See thread_pool.h for the tiling and scheduling contract.
+ *
+ * Jobs live on their caller's stack in a list guarded by g_lock. A job's
+ * tiles are split into one contiguous block per slot, and a block is
+ * claimed with one atomic fetch_or on the job's slot mask; the lock is
+ * only taken to join or leave a job.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _GNU_SOURCE     /* pthread_setaffinity_np, CPU_SET */
+
+#include "include/thread_pool.h"
+#include "../../include/fixed_saturate.h"
+#include <stdatomic.h>
+
+#if defined(_WIN32) || (defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__))
+#define NEG_POOL_NO_THREADS 1
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+void neg_pool_config_default(NegPoolConfig* cfg) {
+    if (!cfg) return;
+    cfg->threads = 1;
+    cfg->tile_size = 0;
+    cfg->pin_cpus = 0;
+}
+
+static int online_cpus(void) {
+#if defined(NEG_POOL_NO_THREADS) || !defined(_SC_NPROCESSORS_ONLN)
+    return 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+int neg_pool_slots(const NegPoolConfig* cfg) {
+#ifdef NEG_POOL_NO_THREADS
+    (void)cfg;
+    return 1;
+#else
+    if (!cfg) return 1;
+    int threads = cfg->threads == 0 ? online_cpus() : (int)cfg->threads;
+    return threads > NEG_POOL_MAX_THREADS ? NEG_POOL_MAX_THREADS : threads;
+#endif
+}
+
+typedef struct PoolJob {
+    NegPoolTileFn fn;
+    void* ctx;
+    size_t count;
+    size_t tile;
+    size_t tiles;
+    _Atomic uint64_t claimed;       /* Bit s: slot s's block taken */
+    _Atomic uint32_t sticky;        /* Workers' fixed-point sticky bits */
+    int limit;                      /* Slots (participants allowed) */
+    int joined;                     /* Participants so far (g_lock) */
+    int active;                     /* Participants still working (g_lock) */
+    struct PoolJob* link;
+} PoolJob;
+
+_Static_assert(NEG_POOL_MAX_THREADS <= 64, "slot mask is one uint64_t");
+
+static int claim_slot(PoolJob* job, int slot) {
+    uint64_t bit = (uint64_t)1 << slot;
+    return (atomic_fetch_or_explicit(&job->claimed, bit, memory_order_relaxed) & bit) == 0;
+}
+
+/* Block of slot: tiles [slot * tiles / limit, (slot + 1) * tiles / limit) */
+static void run_slot(PoolJob* job, int slot) {
+    size_t first = job->tiles * (size_t)slot / (size_t)job->limit;
+    size_t last = job->tiles * (size_t)(slot + 1) / (size_t)job->limit;
+    for (size_t k = first; k < last; k++) {
+        size_t begin = k * job->tile;
+        size_t end = begin + job->tile < job->count ? begin + job->tile : job->count;
+        job->fn(job->ctx, begin, end, slot);
+    }
+}
+
+#ifdef NEG_POOL_NO_THREADS
+
+void neg_pool_run(const NegPoolConfig* cfg, size_t count, size_t default_tile,
+                  NegPoolTileFn fn, void* ctx) {
+    if (!fn || count == 0) return;
+    size_t tile = (cfg && cfg->tile_size) ? cfg->tile_size : default_tile;
+    if (tile == 0) tile = 1;
+    for (size_t begin = 0; begin < count; begin += tile) {
+        fn(ctx, begin, begin + tile < count ? begin + tile : count, 0);
+    }
+}
+
+int neg_pool_workers(void) {
+    return 0;
+}
+
+void neg_pool_shutdown(void) {
+}
+
+#else
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_work = PTHREAD_COND_INITIALIZER;   /* Job posted, or stop */
+static pthread_cond_t g_done = PTHREAD_COND_INITIALIZER;   /* A participant left */
+static pthread_t g_threads[NEG_POOL_MAX_THREADS];
+static int g_workers;
+static int g_stop;
+static int g_pin;                   /* Set once a job asks for pinned workers */
+static PoolJob* g_jobs;
+
+/* Worker w on CPU (w + 1) mod CPUs, leaving CPU 0 to the first caller */
+static void pin_self(int worker) {
+#if defined(__linux__) && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET((worker + 1) % online_cpus(), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)worker;
+#endif
+}
+
+/* Job whose block for this worker's slot is still open, fewest participants first (g_lock held) */
+static PoolJob* pick_job(int slot) {
+    PoolJob* best = NULL;
+    for (PoolJob* job = g_jobs; job; job = job->link) {
+        if (slot >= job->limit) continue;
+        uint64_t claimed = atomic_load_explicit(&job->claimed, memory_order_relaxed);
+        if (claimed & ((uint64_t)1 << slot)) continue;
+        if (!best || job->joined < best->joined) best = job;
+    }
+    return best;
+}
+
+static void* worker_main(void* arg) {
+    int worker = (int)(intptr_t)arg;
+    int pinned = 0;
+
+    pthread_mutex_lock(&g_lock);
+    for (;;) {
+        if (g_pin && !pinned) {
+            pinned = 1;
+            pin_self(worker);
+        }
+
+        /* Worker w always runs slot w + 1; the caller has slot 0 */
+        PoolJob* job = pick_job(worker + 1);
+        if (!job) {
+            if (g_stop) break;
+            pthread_cond_wait(&g_work, &g_lock);
+            continue;
+        }
+
+        job->joined++;
+        job->active++;
+        pthread_mutex_unlock(&g_lock);
+
+        if (claim_slot(job, worker + 1)) run_slot(job, worker + 1);
+        uint32_t sticky = fixed_sticky_take();
+        if (sticky) atomic_fetch_or_explicit(&job->sticky, sticky, memory_order_relaxed);
+
+        pthread_mutex_lock(&g_lock);
+        if (--job->active == 0) pthread_cond_broadcast(&g_done);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return NULL;
+}
+
+/* Grow the pool to n workers (g_lock held) */
+static void ensure_workers(int n) {
+    if (n > NEG_POOL_MAX_THREADS - 1) n = NEG_POOL_MAX_THREADS - 1;
+    while (g_workers < n) {
+        if (pthread_create(&g_threads[g_workers], NULL, worker_main,
+                           (void*)(intptr_t)g_workers) != 0) {
+            break;  /* Fewer helpers; the caller still finishes the job */
+        }
+        g_workers++;
+    }
+}
+
+void neg_pool_run(const NegPoolConfig* cfg, size_t count, size_t default_tile,
+                  NegPoolTileFn fn, void* ctx) {
+    if (!fn || count == 0) return;
+
+    PoolJob job;
+    job.fn = fn;
+    job.ctx = ctx;
+    job.count = count;
+    job.tile = (cfg && cfg->tile_size) ? cfg->tile_size : default_tile;
+    if (job.tile == 0) job.tile = 1;
+    job.tiles = (count + job.tile - 1) / job.tile;
+    atomic_init(&job.claimed, 1);
+    atomic_init(&job.sticky, 0);
+    job.limit = neg_pool_slots(cfg);
+    if ((size_t)job.limit > job.tiles) job.limit = (int)job.tiles;
+    job.joined = 1;
+    job.active = 1;
+
+    if (job.limit <= 1) {
+        run_slot(&job, 0);
+        return;
+    }
+
+    pthread_mutex_lock(&g_lock);
+    if (cfg->pin_cpus) g_pin = 1;
+    ensure_workers(job.limit - 1);
+    job.link = g_jobs;
+    g_jobs = &job;
+    pthread_cond_broadcast(&g_work);
+    pthread_mutex_unlock(&g_lock);
+
+    /* Own block, then any block whose worker is busy elsewhere */
+    run_slot(&job, 0);
+    for (int slot = 1; slot < job.limit; slot++) {
+        if (claim_slot(&job, slot)) run_slot(&job, slot);
+    }
+
+    /* Unlink first so no worker joins a job that is about to go away */
+    pthread_mutex_lock(&g_lock);
+    for (PoolJob** p = &g_jobs; *p; p = &(*p)->link) {
+        if (*p == &job) {
+            *p = job.link;
+            break;
+        }
+    }
+    job.active--;
+    while (job.active > 0) {
+        pthread_cond_wait(&g_done, &g_lock);
+    }
+    pthread_mutex_unlock(&g_lock);
+
+    /* Workers left under g_lock, so their bits are visible here */
+    fixed_sticky_raise(atomic_load_explicit(&job.sticky, memory_order_relaxed));
+}
+
+int neg_pool_workers(void) {
+    pthread_mutex_lock(&g_lock);
+    int n = g_workers;
+    pthread_mutex_unlock(&g_lock);
+    return n;
+}
+
+void neg_pool_shutdown(void) {
+    pthread_mutex_lock(&g_lock);
+    int n = g_workers;
+    g_stop = 1;
+    pthread_cond_broadcast(&g_work);
+    pthread_mutex_unlock(&g_lock);
+
+    for (int w = 0; w < n; w++) {
+        pthread_join(g_threads[w], NULL);
+    }
+
+    pthread_mutex_lock(&g_lock);
+    g_workers = 0;
+    g_stop = 0;
+    g_pin = 0;
+    pthread_mutex_unlock(&g_lock);
+}
+
+#endif /* NEG_POOL_NO_THREADS */
@@ -0,0 +1,271 @@
+/*
+ * trace.c - Step Tracing (Chrome trace-event / Perfetto JSON)
+ *
+ * One ring per thread, registered on the thread's first event and never
+ * freed (a trace outlives the threads it describes). Each ring has a
+ * single writer; the dumper reads it seqlock-style: snapshot the head,
+ * copy the events, re-read the head and drop whatever the writer may
+ * have overwritten in between.
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "include/trace.h"
+#include "include/platform.h"
+#include "include/mem_stats.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if NEG_TRACE
+
+#include <stdatomic.h>
+
+#if (NEG_TRACE_RING_EVENTS & (NEG_TRACE_RING_EVENTS - 1)) != 0
+#error "NEG_TRACE_RING_EVENTS must be a power of two"
+#endif
+
+/* Worst-case JSON bytes per event (long names, 20-digit args) */
+#define TRACE_EVENT_JSON_MAX 192
+
+typedef struct {
+    const char* cat;
+    const char* name;
+    uint64_t ts;            /* Start, ns */
+    uint64_t dur;           /* Duration, ns (complete events) */
+    int64_t arg;
+    int instant;
+} TraceEvent;
+
+typedef struct {
+    _Atomic uint64_t head;  /* Events ever written; published with release */
+    _Atomic uint64_t floor; /* Events below this index were cleared */
+    uint32_t tid;
+    TraceEvent events[NEG_TRACE_RING_EVENTS];
+} TraceRing;
+
+static _Atomic(TraceRing*) g_rings[NEG_TRACE_MAX_THREADS];
+static _Atomic uint32_t g_ring_count = 0;
+static _Atomic uint64_t g_epoch = 0;
+
+/* NULL until registered; tls_untraced marks threads beyond the limit */
+static NEG_THREAD_LOCAL TraceRing* tls_ring = NULL;
+static NEG_THREAD_LOCAL int tls_untraced = 0;
+
+static TraceRing* ring_for_thread(uint64_t first_ts) {
+    if (tls_ring || tls_untraced) return tls_ring;
+
+    uint32_t idx = atomic_fetch_add(&g_ring_count, 1);
+    TraceRing* ring = NULL;
+    if (idx < NEG_TRACE_MAX_THREADS) {
+        ring = (TraceRing*)neg_mem_calloc(NEG_MEM_DIAGNOSTICS, 1, sizeof(TraceRing));
+    }
+    if (!ring) {
+        tls_untraced = 1;
+        return NULL;
+    }
+
+    ring->tid = idx + 1;
+    uint64_t zero = 0;
+    atomic_compare_exchange_strong(&g_epoch, &zero, first_ts);
+    atomic_store_explicit(&g_rings[idx], ring, memory_order_release);
+    tls_ring = ring;
+    return ring;
+}
+
+static void record(const char* cat, const char* name, uint64_t ts, uint64_t dur,
+                   int64_t arg, int instant) {
+    TraceRing* ring = ring_for_thread(ts);
+    if (!ring) return;
+
+    uint64_t h = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    TraceEvent* e = &ring->events[h & (NEG_TRACE_RING_EVENTS - 1)];
+    e->cat = cat;
+    e->name = name;
+    e->ts = ts;
+    e->dur = dur;
+    e->arg = arg;
+    e->instant = instant;
+    atomic_store_explicit(&ring->head, h + 1, memory_order_release);
+}
+
+uint64_t neg_trace_now(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void neg_trace_complete(const char* cat, const char* name, uint64_t start, int64_t arg) {
+    uint64_t now = neg_trace_now();
+    record(cat, name, start, now - start, arg, 0);
+}
+
+void neg_trace_instant(const char* cat, const char* name, int64_t arg) {
+    record(cat, name, neg_trace_now(), 0, arg, 1);
+}
+
+/* ========================================================================
+ * DUMP
+ * ======================================================================== */
+
+static uint32_t ring_count(void) {
+    uint32_t n = atomic_load(&g_ring_count);
+    return n < NEG_TRACE_MAX_THREADS ? n : NEG_TRACE_MAX_THREADS;
+}
+
+/** First index still held by a ring whose head is h */
+static uint64_t ring_oldest(TraceRing* ring, uint64_t h) {
+    uint64_t floor = atomic_load_explicit(&ring->floor, memory_order_relaxed);
+    uint64_t oldest = h > NEG_TRACE_RING_EVENTS ? h - NEG_TRACE_RING_EVENTS : 0;
+    return floor > oldest ? floor : oldest;
+}
+
+size_t neg_trace_json_size(void) {
+    size_t events = 0;
+    uint32_t n = ring_count();
+    for (uint32_t i = 0; i < n; i++) {
+        TraceRing* ring = atomic_load_explicit(&g_rings[i], memory_order_acquire);
+        if (!ring) continue;
+        uint64_t h = atomic_load_explicit(&ring->head, memory_order_acquire);
+        events += (size_t)(h - ring_oldest(ring, h)) + 1;  /* +1: thread_name */
+    }
+    return 128 + events * TRACE_EVENT_JSON_MAX;
+}
+
+/* snprintf at *pos; returns -1 once the buffer is exhausted */
+static int append(char* buffer, size_t max_len, size_t* pos, const char* fmt, ...) {
+    if (*pos >= max_len) return -1;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buffer + *pos, max_len - *pos, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= max_len - *pos) return -1;
+    *pos += (size_t)n;
+    return 0;
+}
+
+/** Append one ring's events; returns -1 if the buffer is too small */
+static int dump_ring(TraceRing* ring, TraceEvent* scratch, uint64_t epoch,
+                     char* buffer, size_t max_len, size_t* pos, int* first) {
+    uint64_t h = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint64_t start = ring_oldest(ring, h);
+    for (uint64_t i = start; i < h; i++) {
+        scratch[i - start] = ring->events[i & (NEG_TRACE_RING_EVENTS - 1)];
+    }
+
+    /* The writer may have lapped the oldest slots while we copied; the
+     * copy must complete before head is read again */
+    atomic_thread_fence(memory_order_acquire);
+    uint64_t h2 = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint64_t safe = h2 >= NEG_TRACE_RING_EVENTS ? h2 - NEG_TRACE_RING_EVENTS + 1 : 0;
+    uint64_t skip = safe > start ? safe - start : 0;
+
+    if (append(buffer, max_len, pos,
+               "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+               "\"args\":{\"name\":\"neg-thread-%u\"}}",
+               *first ? "" : ",\n", ring->tid, ring->tid) != 0) {
+        return -1;
+    }
+    *first = 0;
+
+    for (uint64_t i = skip; i < h - start; i++) {
+        const TraceEvent* e = &scratch[i];
+        double ts_us = ((double)(int64_t)(e->ts - epoch)) / 1000.0;
+        int rc;
+        if (e->instant) {
+            rc = append(buffer, max_len, pos,
+                        ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,"
+                        "\"pid\":1,\"tid\":%u,\"args\":{\"n\":%lld}}",
+                        e->name, e->cat, ts_us, ring->tid, (long long)e->arg);
+        } else {
+            rc = append(buffer, max_len, pos,
+                        ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                        "\"pid\":1,\"tid\":%u,\"args\":{\"n\":%lld}}",
+                        e->name, e->cat, ts_us, (double)e->dur / 1000.0, ring->tid,
+                        (long long)e->arg);
+        }
+        if (rc != 0) return -1;
+    }
+    return 0;
+}
+
+int neg_trace_json(char* buffer, size_t max_len) {
+    if (!buffer || max_len == 0) return -1;
+
+    TraceEvent* scratch = (TraceEvent*)neg_mem_malloc(NEG_MEM_DIAGNOSTICS,
+                                                      sizeof(TraceEvent) * NEG_TRACE_RING_EVENTS);
+    if (!scratch) return -1;
+
+    size_t pos = 0;
+    int first = 1;
+    int rc = append(buffer, max_len, &pos, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    uint64_t epoch = atomic_load(&g_epoch);
+
+    uint32_t n = ring_count();
+    for (uint32_t i = 0; i < n && rc == 0; i++) {
+        TraceRing* ring = atomic_load_explicit(&g_rings[i], memory_order_acquire);
+        if (ring) {
+            rc = dump_ring(ring, scratch, epoch, buffer, max_len, &pos, &first);
+        }
+    }
+    neg_mem_free(scratch);
+
+    if (rc != 0 || append(buffer, max_len, &pos, "\n]}\n") != 0) return -1;
+    return (int)pos;
+}
+
+void neg_trace_clear(void) {
+    uint32_t n = ring_count();
+    for (uint32_t i = 0; i < n; i++) {
+        TraceRing* ring = atomic_load_explicit(&g_rings[i], memory_order_acquire);
+        if (ring) {
+            atomic_store(&ring->floor, atomic_load(&ring->head));
+        }
+    }
+}
+
+#else /* !NEG_TRACE */
+
+uint64_t neg_trace_now(void) {
+    return 0;
+}
+
+void neg_trace_complete(const char* cat, const char* name, uint64_t start, int64_t arg) {
+    (void)cat;
+    (void)name;
+    (void)start;
+    (void)arg;
+}
+
+void neg_trace_instant(const char* cat, const char* name, int64_t arg) {
+    (void)cat;
+    (void)name;
+    (void)arg;
+}
+
+static const char k_empty_trace[] = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[]}\n";
+
+size_t neg_trace_json_size(void) {
+    return sizeof(k_empty_trace);
+}
+
+int neg_trace_json(char* buffer, size_t max_len) {
+    if (!buffer || max_len < sizeof(k_empty_trace)) return -1;
+    memcpy(buffer, k_empty_trace, sizeof(k_empty_trace));
+    return (int)(sizeof(k_empty_trace) - 1);
+}
+
+void neg_trace_clear(void) {
+}
+
+#endif /* NEG_TRACE */
@@ -7,7 +7,13 @@
  * This is a SKELETON IMPLEMENTATION providing only:
  *   - Root node allocation
  *   - Basic active cell list management
- *   - Memory budget tracking
+ *   - Memory budget enforcement
+ *
+ * Memory: every node, container and active-index array is allocated
+ * through mem_stats (NEG_MEM_OCTREE), and tree->memory_used is the bytes
+ * actually held. An activation that would grow the index array past
+ * memory_budget grows it only as far as the budget allows, and fails once
+ * no room is left.
  *
  * Full traversal, query, and GPU mapping are NOT implemented per
  * the Genesis v3.0 constraint: "Do not implement full sparse octree
@@ -20,6 +26,7 @@
  */
 
 #include "sparse_octree.h"
+#include "../core/include/mem_stats.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -31,7 +38,7 @@
  * Allocate a single octree node with zero-initialized fields.
  */
 static OctreeNode* alloc_node(void) {
-    OctreeNode* node = (OctreeNode*)calloc(1, sizeof(OctreeNode));
+    OctreeNode* node = (OctreeNode*)neg_mem_calloc(NEG_MEM_OCTREE, 1, sizeof(OctreeNode));
     return node;
 }
 
@@ -86,8 +93,13 @@ Octree* octree_create(int nx, int ny, size_t budget_bytes) {
         return NULL;
     }
 
+    /* Container and root must fit the budget themselves */
+    if (sizeof(Octree) + sizeof(OctreeNode) > budget_bytes) {
+        return NULL;
+    }
+
     /* Allocate octree container */
-    Octree* tree = (Octree*)calloc(1, sizeof(Octree));
+    Octree* tree = (Octree*)neg_mem_calloc(NEG_MEM_OCTREE, 1, sizeof(Octree));
     if (!tree) {
         return NULL;
     }
@@ -95,7 +107,7 @@ Octree* octree_create(int nx, int ny, size_t budget_bytes) {
     /* Allocate root node */
     tree->root = octree_alloc_root(nx, ny, budget_bytes);
     if (!tree->root) {
-        free(tree);
+        neg_mem_free(tree);
         return NULL;
     }
 
@@ -134,12 +146,12 @@ void octree_free_node(OctreeNode* node) {
 
     /* Free active indices array */
     if (node->active_indices) {
-        free(node->active_indices);
+        neg_mem_free(node->active_indices);
         node->active_indices = NULL;
     }
 
     /* Free the node itself */
-    free(node);
+    neg_mem_free(node);
 }
 
 void octree_destroy(Octree* tree) {
@@ -152,7 +164,7 @@ void octree_destroy(Octree* tree) {
     tree->root = NULL;
 
     /* Free the container */
-    free(tree);
+    neg_mem_free(tree);
 }
 
 /* ========================================================================
@@ -160,9 +172,9 @@ void octree_destroy(Octree* tree) {
  * ======================================================================== */
 
 /**
- * Grow the active indices array if needed.
+ * Grow the active indices array if needed, within the tree's budget.
  */
-static int ensure_active_capacity(OctreeNode* node, uint32_t needed) {
+static int ensure_active_capacity(Octree* tree, OctreeNode* node, uint32_t needed) {
     if (node->active_capacity >= needed) {
         return 0;  /* Already have enough space */
     }
@@ -172,8 +184,19 @@ static int ensure_active_capacity(OctreeNode* node, uint32_t needed) {
     if (new_capacity < 16) new_capacity = 16;
     if (new_capacity < needed) new_capacity = needed;
 
+    /* Clamp the growth to what the budget still allows */
+    size_t held = node->active_capacity * sizeof(uint32_t);
+    size_t room = tree->memory_budget - tree->memory_used + held;
+    if ((size_t)new_capacity * sizeof(uint32_t) > room) {
+        new_capacity = (uint32_t)(room / sizeof(uint32_t));
+    }
+    if (new_capacity < needed) {
+        return -1;  /* Would exceed budget */
+    }
+
     /* Reallocate */
-    uint32_t* new_indices = (uint32_t*)realloc(
+    uint32_t* new_indices = (uint32_t*)neg_mem_realloc(
+        NEG_MEM_OCTREE,
         node->active_indices,
         new_capacity * sizeof(uint32_t)
     );
@@ -181,6 +204,7 @@ static int ensure_active_capacity(OctreeNode* node, uint32_t needed) {
         return -1;  /* Allocation failed */
     }
 
+    tree->memory_used = tree->memory_used - held + new_capacity * sizeof(uint32_t);
     node->active_indices = new_indices;
     node->active_capacity = new_capacity;
 
@@ -209,15 +233,9 @@ int octree_activate_cell(Octree* tree, int i, int j) {
         }
     }
 
-    /* Check memory budget */
-    size_t needed_memory = tree->memory_used + sizeof(uint32_t);
-    if (needed_memory > tree->memory_budget) {
-        return -1;  /* Would exceed budget */
-    }
-
-    /* Ensure capacity */
-    if (ensure_active_capacity(node, node->active_count + 1) != 0) {
-        return -1;  /* Allocation failed */
+    /* Ensure capacity (fails if the budget is exhausted) */
+    if (ensure_active_capacity(tree, node, node->active_count + 1) != 0) {
+        return -1;  /* Over budget or allocation failed */
     }
 
     /* Add to active list */
@@ -226,7 +244,6 @@ int octree_activate_cell(Octree* tree, int i, int j) {
 
     /* Update statistics */
     tree->total_active++;
-    tree->memory_used = needed_memory;
 
     return 0;
 }
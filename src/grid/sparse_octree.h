@@ -109,8 +109,8 @@ typedef struct Octree {
     int nx, ny;
 
     /* Memory management */
-    size_t memory_budget;       /* Maximum allocation in bytes */
-    size_t memory_used;         /* Current allocation in bytes */
+    size_t memory_budget;       /* Maximum allocation in bytes (enforced) */
+    size_t memory_used;         /* Bytes held: container, nodes, index arrays */
 
     /* Statistics */
     uint32_t total_nodes;       /* Total allocated nodes */
@@ -142,8 +142,9 @@ OctreeNode* octree_alloc_root(int nx, int ny, size_t budget_bytes);
  *
  * @param nx Grid width in cells
  * @param ny Grid height in cells
- * @param budget_bytes Maximum memory allocation
- * @return Pointer to new Octree, or NULL on failure
+ * @param budget_bytes Maximum memory allocation; activations that would
+ *                     exceed it fail
+ * @return Pointer to new Octree, or NULL on failure (or budget too small)
  */
 Octree* octree_create(int nx, int ny, size_t budget_bytes);
 
@@ -174,7 +175,7 @@ void octree_destroy(Octree* tree);
  * @param tree Octree container
  * @param i X index
  * @param j Y index
- * @return 0 on success, -1 on failure
+ * @return 0 on success, -1 on failure (out of bounds, over budget)
  */
 int octree_activate_cell(Octree* tree, int i, int j);
 
@@ -218,7 +219,7 @@ static inline void octree_coords_from_index(int nx, uint32_t idx, int* i, int* j
 }
 
 /**
- * Get estimated memory usage for an octree.
+ * Bytes held by an octree (container, nodes, active-index arrays).
  */
 size_t octree_memory_usage(const Octree* tree);
 
@@ -86,6 +86,9 @@
  */
 
 #include "atmosphere_biotic.h"
+#include "atmosphere_biotic_internal.h"
+#include "../core/include/trace.h"
+#include "../core/include/mem_stats.h"
 #include <math.h>
 #include <string.h>
 
@@ -93,41 +96,16 @@
  * LOOKUP TABLE FOR SATURATION VAPOR PRESSURE
  * ======================================================================== */
 
-#define LUT_SIZE 256
-#define T_MIN 243.0f   /* -30°C in Kelvin */
-#define T_MAX 333.0f   /* +60°C in Kelvin */
-#define T_RANGE (T_MAX - T_MIN)
-
-/* Pre-computed e_s(T) table (initialized by biotic_pump_init) */
-static float g_e_s_lut[LUT_SIZE];
-static int g_lut_initialized = 0;
-
-/**
- * August-Roche-Magnus formula for saturation vapor pressure.
- *
- * e_s(T) = 611.2 * exp(17.67 * (T - 273.15) / (T - 29.65))  [Pa]
- *
- * Valid for 243 K < T < 333 K (accurate to ~0.1% vs full Clausius-Clapeyron).
- *
- * Reference: Alduchov & Eskridge (1996), improved Magnus formula
+/*
+ * Pre-computed e_s(T) table (static const g_e_s_lut[E_S_LUT_SIZE]).
+ * Emitted by tools/generate_luts.c from biotic_e_s_exact(), so it lives
+ * in read-only memory and is identical on every target.
  */
-static float compute_e_s_exact(float T_kelvin) {
-    const float T_celsius = T_kelvin - 273.15f;
-    const float numerator = 17.67f * T_celsius;
-    const float denominator = T_celsius + 243.5f;
-    return 611.2f * expf(numerator / denominator);
-}
+#include "atmosphere_biotic_luts.h"
 
 void biotic_pump_init(void) {
-    if (g_lut_initialized) return;
-
-    /* Fill lookup table */
-    for (int i = 0; i < LUT_SIZE; i++) {
-        float T = T_MIN + (T_RANGE * i) / (LUT_SIZE - 1);
-        g_e_s_lut[i] = compute_e_s_exact(T);
-    }
-
-    g_lut_initialized = 1;
+    /* Tables are static const; only their footprint is recorded */
+    neg_mem_register_static(NEG_MEM_LUT, "biotic_e_s", sizeof(g_e_s_lut));
 }
 
 float biotic_pump_saturation_vapor_pressure(float T_kelvin) {
@@ -137,10 +115,10 @@ float biotic_pump_saturation_vapor_pressure(float T_kelvin) {
 
     /* Linear interpolation in LUT */
     float t_norm = (T_kelvin - T_MIN) / T_RANGE;
-    float index_f = t_norm * (LUT_SIZE - 1);
+    float index_f = t_norm * (E_S_LUT_SIZE - 1);
     int i0 = (int)index_f;
     int i1 = i0 + 1;
-    if (i1 >= LUT_SIZE) i1 = LUT_SIZE - 1;
+    if (i1 >= E_S_LUT_SIZE) i1 = E_S_LUT_SIZE - 1;
 
     float frac = index_f - i0;
     return g_e_s_lut[i0] * (1.0f - frac) + g_e_s_lut[i1] * frac;
@@ -237,6 +215,8 @@ void biotic_pump_step(
         return;
     }
 
+    NEG_TRACE_SCOPE_BEGIN(trace_start);
+
     /* Pre-compute common factors */
     const float dt_rho = dt / params->rho;
     const float rho_f = params->rho * params->f;
@@ -389,6 +369,8 @@ void biotic_pump_step(
         v_wind[i] = v_t / drag_factor;
 
     } /* End main loop */
+
+    NEG_TRACE_SCOPE_END(trace_start, "atm", "biotic_pump", grid_size);
 }
 
 /* ========================================================================
@@ -173,11 +173,10 @@ typedef struct {
 /**
  * Initialize the Biotic Pump solver.
  *
- * Pre-computes lookup tables for temperature-dependent vapor pressure
- * (Clausius-Clapeyron relation) to avoid expensive exp() calls in the
- * main solver loop.
- *
- * This function must be called once before using biotic_pump_step().
+ * The temperature-dependent vapor pressure table (Clausius-Clapeyron
+ * relation) is emitted at build time by tools/generate_luts.c as a
+ * static const array, so there is no startup work left to do. Kept for
+ * API compatibility; calling it is harmless.
  *
  * Performance: Grok optimization - 256-entry LUT reduces per-cell cost
  * from ~100ns to ~5ns for e_s(T) evaluation.
@@ -272,7 +271,7 @@ float biotic_pump_compute_phi_aero(float LAI, float H_c);
 /**
  * Compute saturation vapor pressure e_s(T) via Clausius-Clapeyron.
  *
- * Uses lookup table initialized by biotic_pump_init().
+ * Uses the static lookup table in atmosphere_biotic_luts.h.
  *
  * Approximation (August-Roche-Magnus):
  *   e_s(T) = 611.2 * exp(17.67 * (T - 273.15) / (T - 29.65))  [Pa]
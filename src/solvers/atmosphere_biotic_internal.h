@@ -0,0 +1,65 @@
+/*
+ * atmosphere_biotic_internal.h - Biotic Pump Internal Implementation
+ *
+ * Saturation vapor pressure table layout and the exact e_s(T) formula it
+ * is built from.
+ *
+ * This header is NOT part of the public API. It is shared by:
+ *   - atmosphere_biotic.c (table lookups)
+ *   - tools/generate_luts.c (emits atmosphere_biotic_luts.h at build time)
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0 (ATMv1)
+ * License: MIT OR GPL-3.0
+ */
+
+#ifndef ATMOSPHERE_BIOTIC_INTERNAL_H
+#define ATMOSPHERE_BIOTIC_INTERNAL_H
+
+#include <math.h>
+
+/* ========================================================================
+ * LOOKUP TABLE CONFIGURATION
+ * ======================================================================== */
+
+#define E_S_LUT_SIZE 256
+#define T_MIN 243.0f   /* -30°C in Kelvin */
+#define T_MAX 333.0f   /* +60°C in Kelvin */
+#define T_RANGE (T_MAX - T_MIN)
+
+/* ========================================================================
+ * SATURATION VAPOR PRESSURE (Exact, for LUT generation)
+ * ======================================================================== */
+
+/**
+ * August-Roche-Magnus formula for saturation vapor pressure.
+ *
+ * e_s(T) = 611.2 * exp(17.67 * (T - 273.15) / (T - 29.65))  [Pa]
+ *
+ * Valid for 243 K < T < 333 K (accurate to ~0.1% vs full Clausius-Clapeyron).
+ *
+ * Reference: Alduchov & Eskridge (1996), improved Magnus formula
+ */
+static inline float biotic_e_s_exact(float T_kelvin) {
+    const float T_celsius = T_kelvin - 273.15f;
+    const float numerator = 17.67f * T_celsius;
+    const float denominator = T_celsius + 243.5f;
+    return 611.2f * expf(numerator / denominator);
+}
+
+/**
+ * Fill an e_s(T) table over [T_MIN, T_MAX].
+ *
+ * The static table in atmosphere_biotic_luts.h is the output of this
+ * function on the generator host.
+ *
+ * @param lut Output table (E_S_LUT_SIZE entries)
+ */
+static inline void biotic_e_s_lut_build(float* lut) {
+    for (int i = 0; i < E_S_LUT_SIZE; i++) {
+        float T = T_MIN + (T_RANGE * i) / (E_S_LUT_SIZE - 1);
+        lut[i] = biotic_e_s_exact(T);
+    }
+}
+
+#endif /* ATMOSPHERE_BIOTIC_INTERNAL_H */
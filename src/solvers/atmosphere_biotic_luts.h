@@ -0,0 +1,74 @@
+/* Generated by tools/generate_luts.c - DO NOT EDIT MANUALLY */
+/* This file contains the LUT data and should be included in atmosphere_biotic.c */
+#ifndef ATMOSPHERE_BIOTIC_LUTS_H
+#define ATMOSPHERE_BIOTIC_LUTS_H
+
+/* Saturation vapor pressure e_s(T) [Pa], T = 243 K .. 333 K */
+static const float g_e_s_lut[E_S_LUT_SIZE] = {
+    5.03174515e+01f, 5.20215569e+01f, 5.37775726e+01f, 5.55866776e+01f,
+    5.74504166e+01f, 5.93702965e+01f, 6.13476334e+01f, 6.33840523e+01f,
+    6.54811554e+01f, 6.76403809e+01f, 6.98635330e+01f, 7.21520615e+01f,
+    7.45077515e+01f, 7.69324799e+01f, 7.94277649e+01f, 8.19955521e+01f,
+    8.46377716e+01f, 8.73560944e+01f, 9.01525726e+01f, 9.30292969e+01f,
+    9.59880219e+01f, 9.90309448e+01f, 1.02160286e+02f, 1.05377899e+02f,
+    1.08686172e+02f, 1.12087402e+02f, 1.15583656e+02f, 1.19177505e+02f,
+    1.22871048e+02f, 1.26666847e+02f, 1.30567581e+02f, 1.34575363e+02f,
+    1.38693039e+02f, 1.42923355e+02f, 1.47268661e+02f, 1.51731857e+02f,
+    1.56315948e+02f, 1.61023590e+02f, 1.65857483e+02f, 1.70820755e+02f,
+    1.75916489e+02f, 1.81147705e+02f, 1.86517593e+02f, 1.92029816e+02f,
+    1.97686707e+02f, 2.03491989e+02f, 2.09449173e+02f, 2.15561630e+02f,
+    2.21832886e+02f, 2.28267151e+02f, 2.34866943e+02f, 2.41636520e+02f,
+    2.48579742e+02f, 2.55700378e+02f, 2.63003082e+02f, 2.70490601e+02f,
+    2.78167633e+02f, 2.86038330e+02f, 2.94106995e+02f, 3.02377899e+02f,
+    3.10856171e+02f, 3.19544861e+02f, 3.28449188e+02f, 3.37573883e+02f,
+    3.46923615e+02f, 3.56503235e+02f, 3.66318481e+02f, 3.76372559e+02f,
+    3.86671509e+02f, 3.97220428e+02f, 4.08024536e+02f, 4.19090240e+02f,
+    4.30420959e+02f, 4.42023193e+02f, 4.53902557e+02f, 4.66064850e+02f,
+    4.78515839e+02f, 4.91262573e+02f, 5.04308807e+02f, 5.17661865e+02f,
+    5.31327881e+02f, 5.45313171e+02f, 5.59624268e+02f, 5.74268982e+02f,
+    5.89251282e+02f, 6.04579407e+02f, 6.20260010e+02f, 6.36300293e+02f,
+    6.52708618e+02f, 6.69489441e+02f, 6.86651611e+02f, 7.04202332e+02f,
+    7.22149414e+02f, 7.40500305e+02f, 7.59264709e+02f, 7.78447205e+02f,
+    7.98057495e+02f, 8.18103760e+02f, 8.38594360e+02f, 8.59537659e+02f,
+    8.80944214e+02f, 9.02819092e+02f, 9.25172791e+02f, 9.48014526e+02f,
+    9.71353149e+02f, 9.95200317e+02f, 1.01956122e+03f, 1.04444739e+03f,
+    1.06986853e+03f, 1.09583472e+03f, 1.12235559e+03f, 1.14944385e+03f,
+    1.17710510e+03f, 1.20535217e+03f, 1.23419568e+03f, 1.26364636e+03f,
+    1.29371497e+03f, 1.32441541e+03f, 1.35575366e+03f, 1.38774377e+03f,
+    1.42039709e+03f, 1.45372571e+03f, 1.48774414e+03f, 1.52245898e+03f,
+    1.55788513e+03f, 1.59403516e+03f, 1.63092151e+03f, 1.66855713e+03f,
+    1.70695825e+03f, 1.74613123e+03f, 1.78609290e+03f, 1.82685706e+03f,
+    1.86843665e+03f, 1.91084595e+03f, 1.95410303e+03f, 1.99821460e+03f,
+    2.04319861e+03f, 2.08907007e+03f, 2.13584326e+03f, 2.18353760e+03f,
+    2.23216089e+03f, 2.28173169e+03f, 2.33226660e+03f, 2.38378101e+03f,
+    2.43629053e+03f, 2.48981665e+03f, 2.54436694e+03f, 2.59996191e+03f,
+    2.65661963e+03f, 2.71435669e+03f, 2.77318994e+03f, 2.83314307e+03f,
+    2.89422363e+03f, 2.95645386e+03f, 3.01985327e+03f, 3.08444019e+03f,
+    3.15023853e+03f, 3.21725610e+03f, 3.28551807e+03f, 3.35504370e+03f,
+    3.42585327e+03f, 3.49796655e+03f, 3.57140942e+03f, 3.64619043e+03f,
+    3.72233691e+03f, 3.79986914e+03f, 3.87880957e+03f, 3.95917798e+03f,
+    4.04100464e+03f, 4.12429688e+03f, 4.20908350e+03f, 4.29538818e+03f,
+    4.38323389e+03f, 4.47265137e+03f, 4.56364648e+03f, 4.65625342e+03f,
+    4.75049463e+03f, 4.84639502e+03f, 4.94397803e+03f, 5.04327979e+03f,
+    5.14430566e+03f, 5.24708984e+03f, 5.35165771e+03f, 5.45803711e+03f,
+    5.56625244e+03f, 5.67634131e+03f, 5.78830957e+03f, 5.90219678e+03f,
+    6.01802881e+03f, 6.13583252e+03f, 6.25564746e+03f, 6.37748145e+03f,
+    6.50137402e+03f, 6.62735352e+03f, 6.75544727e+03f, 6.88570117e+03f,
+    7.01810645e+03f, 7.15274512e+03f, 7.28960400e+03f, 7.42873486e+03f,
+    7.57016406e+03f, 7.71392529e+03f, 7.86006250e+03f, 8.00858203e+03f,
+    8.15953271e+03f, 8.31294238e+03f, 8.46884668e+03f, 8.62729590e+03f,
+    8.78829395e+03f, 8.95188574e+03f, 9.11811426e+03f, 9.28701074e+03f,
+    9.45862500e+03f, 9.63294629e+03f, 9.81007422e+03f, 9.99000098e+03f,
+    1.01727754e+04f, 1.03584385e+04f, 1.05470215e+04f, 1.07385879e+04f,
+    1.09331387e+04f, 1.11307295e+04f, 1.13314014e+04f, 1.15351924e+04f,
+    1.17421621e+04f, 1.19523105e+04f, 1.21657061e+04f, 1.23823799e+04f,
+    1.26023809e+04f, 1.28257646e+04f, 1.30525225e+04f, 1.32827734e+04f,
+    1.35164971e+04f, 1.37537578e+04f, 1.39946074e+04f, 1.42390879e+04f,
+    1.44872617e+04f, 1.47391279e+04f, 1.49947666e+04f, 1.52542158e+04f,
+    1.55175215e+04f, 1.57847559e+04f, 1.60559219e+04f, 1.63310928e+04f,
+    1.66103125e+04f, 1.68936270e+04f, 1.71811230e+04f, 1.74727656e+04f,
+    1.77687090e+04f, 1.80689258e+04f, 1.83734961e+04f, 1.86824648e+04f,
+    1.89959004e+04f, 1.93138652e+04f, 1.96363652e+04f, 1.99634805e+04f
+};
+
+#endif /* ATMOSPHERE_BIOTIC_LUTS_H */
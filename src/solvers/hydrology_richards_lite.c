@@ -91,7 +91,8 @@
  *   The coupling is one-way per timestep: REGv1 runs every ~128 hydrology
  *   steps, updates Cell state, then HYD reads the modified values.
  *
- * Thread Safety: Pure function, stateless except for static LUTs
+ * Thread Safety: Pure function, stateless except for static const LUTs;
+ *                all scratch lives on the stack
  *
  * Author: negentropic-core team
  * Version: 0.1.0 (HYD-RLv1)
@@ -100,11 +101,23 @@
 
 #include "hydrology_richards_lite.h"
 #include "hydrology_richards_lite_internal.h"
+#include "../../include/barrier_field.h"
+#include "../core/include/phase_timers.h"
+#include "../core/include/trace.h"
+#include "../core/include/mem_stats.h"
+#include "../core/include/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
 
+/* Stack scratch limits: column depth and surface row length. Both
+ * passes keep their scratch on the stack, so steps of different grids
+ * may run concurrently. */
+#define RL_MAX_NZ            256
+#define RL_MAX_SURFACE_ROW   1024    /* Two rows of heads: 8 KB */
+#define RL_VERTICAL_TILE     64      /* Default columns per pool tile */
+
 /* ========================================================================
  * GENESIS v3.0 BARRIER POTENTIAL HELPERS (Float Version)
  *
@@ -134,47 +147,30 @@ static inline float barrier_gradient_lower_f(float x, float x_min) {
 }
 
 /**
- * Compute barrier gradient for upper bound constraint (float version).
- * Returns positive value when x is near x_max (repulsive force downward).
- */
-static inline float barrier_gradient_upper_f(float x, float x_max) {
-    float dx = x_max - x + BARRIER_EPS_F;
-    if (dx <= 0.0f) {
-        /* Deep violation: return large repulsive gradient */
-        return 1e6f;
-    }
-    /* grad = kappa / dx^2 (positive to push down) */
-    float inv_dx_sq = 1.0f / (dx * dx);
-    return BARRIER_STRENGTH_F * inv_dx_sq;
-}
-
-/**
- * Compute combined barrier gradient for bounded state (float version).
- * Adds gradients from both lower and upper bounds.
+ * Bounded barrier parameters for θ in [θ_r, porosity_eff], evaluated per
+ * column by barrier_field_bounded_f() (same kappa / eps / violation as above).
  */
-static inline float barrier_gradient_bounded_f(float x, float x_min, float x_max) {
-    float grad_lower = barrier_gradient_lower_f(x, x_min);
-    float grad_upper = barrier_gradient_upper_f(x, x_max);
-    return grad_lower + grad_upper;
-}
+static const BarrierFieldParamsF g_theta_barrier = {
+    BARRIER_STRENGTH_F, BARRIER_EPS_F, 1e6f
+};
 
 /* ========================================================================
  * GLOBAL LOOKUP TABLE STORAGE
  * ======================================================================== */
 
-VanGenuchtenLUT g_vG_lut_default;
-int g_lut_initialized = 0;
+/* const VanGenuchtenLUT g_vG_lut_default (generated by tools/generate_luts.c) */
+#include "hydrology_richards_lite_luts.h"
 
 /* ========================================================================
- * INITIALIZATION (LUT Generation)
+ * INITIALIZATION
  * ======================================================================== */
 
 /**
  * Initialize Richards-Lite solver.
  *
- * Pre-computes lookup tables for van Genuchten retention and Mualem
- * conductivity curves. This function must be called once before using
- * richards_lite_step().
+ * The van Genuchten retention and Mualem conductivity tables are static
+ * const data, so this only reports the default soil once. Kept for API
+ * compatibility; richards_lite_step() does not depend on it.
  *
  * Default soil parameters (sandy loam, representative for Loess Plateau):
  *   - K_s = 5e-6 m/s (18 mm/hr, moderate infiltration)
@@ -183,67 +179,17 @@ int g_lut_initialized = 0;
  *   - θ_s = 0.40
  *   - θ_r = 0.05
  *
- * Users can modify g_vG_lut_default after init() for custom soil types.
+ * Custom soil types build their own table with vG_lut_build().
  */
 void richards_lite_init(void) {
-    if (g_lut_initialized) {
-        return;  /* Already initialized */
-    }
+    static int reported = 0;
 
-    /* Set default soil parameters (sandy loam) */
-    g_vG_lut_default.alpha = 2.0f;          /* [1/m] */
-    g_vG_lut_default.n = 1.5f;              /* [-] */
-    g_vG_lut_default.m = 1.0f - 1.0f / g_vG_lut_default.n;  /* m = 1 - 1/n */
-    g_vG_lut_default.theta_s = 0.40f;       /* [-] */
-    g_vG_lut_default.theta_r = 0.05f;       /* [-] */
-    g_vG_lut_default.K_s = 5.0e-6f;         /* [m/s] = 18 mm/hr */
-
-    /* Set table bounds */
-    g_vG_lut_default.psi_min = PSI_MIN;
-    g_vG_lut_default.psi_max = PSI_MAX;
-    g_vG_lut_default.theta_min = THETA_MIN;
-    g_vG_lut_default.theta_max = THETA_MAX;
-
-    /* Build θ(ψ) table */
-    for (int i = 0; i < LUT_SIZE; i++) {
-        float t = (float)i / (LUT_SIZE - 1);
-        float psi = PSI_MIN + t * PSI_RANGE;
-        g_vG_lut_default.theta_of_psi[i] = vG_theta_exact(
-            psi,
-            g_vG_lut_default.alpha,
-            g_vG_lut_default.n,
-            g_vG_lut_default.theta_s,
-            g_vG_lut_default.theta_r
-        );
-    }
+    neg_mem_register_static(NEG_MEM_LUT, "richards_lite_vG_default", sizeof(g_vG_lut_default));
 
-    /* Build K(θ) table */
-    for (int i = 0; i < LUT_SIZE; i++) {
-        float t = (float)i / (LUT_SIZE - 1);
-        float theta = THETA_MIN + t * THETA_RANGE;
-        g_vG_lut_default.K_of_theta[i] = vG_K_exact(
-            theta,
-            g_vG_lut_default.K_s,
-            g_vG_lut_default.theta_s,
-            g_vG_lut_default.theta_r,
-            g_vG_lut_default.m
-        );
-    }
-
-    /* Build dθ/dψ table (specific moisture capacity) */
-    for (int i = 0; i < LUT_SIZE; i++) {
-        float t = (float)i / (LUT_SIZE - 1);
-        float psi = PSI_MIN + t * PSI_RANGE;
-        g_vG_lut_default.C_of_psi[i] = vG_capacity_exact(
-            psi,
-            g_vG_lut_default.alpha,
-            g_vG_lut_default.n,
-            g_vG_lut_default.theta_s,
-            g_vG_lut_default.theta_r
-        );
+    if (reported) {
+        return;  /* Already initialized */
     }
-
-    g_lut_initialized = 1;
+    reported = 1;
 
     printf("[HYD-RLv1] Richards-Lite solver initialized\n");
     printf("  Default soil: sandy loam (Loess Plateau representative)\n");
@@ -288,12 +234,28 @@ static void solve_vertical_implicit(
     const VanGenuchtenLUT* lut,
     int use_free_drainage
 ) {
-    /* Allocate tridiagonal system arrays */
-    static float a[256];  /* Lower diagonal */
-    static float b[256];  /* Main diagonal */
-    static float c[256];  /* Upper diagonal */
-    static float d[256];  /* Right-hand side */
-    static float theta_new[256];  /* Solution */
+    /* Tridiagonal system arrays (on the stack: columns are solved
+     * concurrently by richards_lite_step_tiled(), 9 KB per column) */
+    float a[RL_MAX_NZ];  /* Lower diagonal */
+    float b[RL_MAX_NZ];  /* Main diagonal */
+    float c[RL_MAX_NZ];  /* Upper diagonal */
+    float d[RL_MAX_NZ];  /* Right-hand side */
+    float theta_new[RL_MAX_NZ];  /* Solution */
+    float theta_lo[RL_MAX_NZ];   /* Barrier bounds / gradient (one field pass) */
+    float theta_hi[RL_MAX_NZ];
+    float theta_cur[RL_MAX_NZ];
+    float barrier_grad[RL_MAX_NZ];
+
+    if (nz < 1 || nz > RL_MAX_NZ) return;
+
+    /* GENESIS v3.0: Barrier gradients for the whole column in one SIMD pass */
+    for (int k = 0; k < nz; k++) {
+        theta_cur[k] = column[k].theta;
+        theta_lo[k] = column[k].theta_r;
+        theta_hi[k] = column[k].porosity_eff;
+    }
+    barrier_field_bounded_f(theta_cur, theta_lo, theta_hi, nz, &g_theta_barrier,
+                            NULL, barrier_grad);
 
     /* Single Newton-Raphson step (Grok optimization: replaces Picard iteration)
      * For small timesteps and well-conditioned problems, a single linearized solve
@@ -364,11 +326,8 @@ static void solve_vertical_implicit(
         /* GENESIS v3.0: Add barrier gradient contribution to RHS
          * This replaces hard clamps with smooth energetic penalties.
          * The barrier gradient is scaled by dt to match implicit scheme. */
-        float theta_min_k = column[k].theta_r;
-        float theta_max_k = column[k].porosity_eff;
-        float barrier_grad = barrier_gradient_bounded_f(theta_k, theta_min_k, theta_max_k);
         /* Scale barrier contribution: larger when near bounds */
-        float barrier_contrib = dt * barrier_grad * 0.01f;  /* Damped contribution */
+        float barrier_contrib = dt * barrier_grad[k] * 0.01f;  /* Damped contribution */
         d[k] += barrier_contrib;
     }
 
@@ -399,6 +358,11 @@ static void solve_vertical_implicit(
  * HORIZONTAL EXPLICIT PASS (Surface Flow)
  * ======================================================================== */
 
+/** Total surface head η_s = h + z of a surface cell */
+static inline float surface_head(const Cell* cell) {
+    return cell->h_surface + cell->z;
+}
+
 /**
  * Solve 2D surface water flow using explicit diffusion.
  *
@@ -411,19 +375,29 @@ static void solve_vertical_implicit(
  *
  * CFL stability: dt < 0.5 * dx² / (2 * K_r)
  *
- * @param cells [IN/OUT] 2D array of Cells (surface layer only)
+ * Works in place on the top layer of the grid. New heads of a row are
+ * written back only after the next row has read the old ones, so the
+ * update stays a Jacobi step with two rows of stack scratch.
+ *
+ * @param cells [IN/OUT] Grid; surface cell k is cells[k * stride]
+ * @param stride Cells between consecutive surface cells (nz)
  * @param params Solver parameters
- * @param nx Number of cells in x
+ * @param nx Number of cells in x (at most RL_MAX_SURFACE_ROW)
  * @param ny Number of cells in y
  * @param dt Timestep [s] (parent timestep, will be sub-stepped)
  */
 static void solve_horizontal_explicit(
     Cell* cells,
+    size_t stride,
     const RichardsLiteParams* params,
     int nx,
     int ny,
     float dt
 ) {
+    float h_rows[2][RL_MAX_SURFACE_ROW];  /* New heads of rows j - 1 and j */
+
+    if (nx < 1 || nx > RL_MAX_SURFACE_ROW || ny < 1) return;
+
     /* Sub-stepping for CFL stability */
     float K_r = params->K_r;
     float dx = cells[0].dx;  /* Assume uniform grid */
@@ -431,57 +405,64 @@ static void solve_horizontal_explicit(
 
     int n_substeps = (int)(dt / dt_cfl) + 1;
     float dt_sub = dt / n_substeps;
-
-    /* Temporary storage for surface water update */
-    static float h_new[256 * 256];  /* Max 256x256 grid */
+    neg_counter_add(NEG_COUNTER_CFL_SUBSTEPS, (uint64_t)n_substeps);
 
     for (int substep = 0; substep < n_substeps; substep++) {
-        /* Compute ∇²η_s for each cell */
         for (int j = 0; j < ny; j++) {
+            float* h_new = h_rows[j & 1];
+
+            /* Compute ∇²η_s for each cell of row j */
             for (int i = 0; i < nx; i++) {
-                int idx = j * nx + i;
-                Cell* cell = &cells[idx];
+                size_t idx = (size_t)(j * nx + i);
+                const Cell* cell = &cells[idx * stride];
 
                 /* Check connectivity threshold */
                 float C_zeta = connectivity_function(cell->zeta, cell->zeta_c, cell->a_c);
                 if (C_zeta < 0.1f) {
                     /* Below threshold, skip surface flow */
-                    h_new[idx] = cell->h_surface;
+                    h_new[i] = cell->h_surface;
                     continue;
                 }
 
                 /* Total surface head η_s = h + z */
-                float eta_s = cell->h_surface + cell->z;
+                float eta_s = surface_head(cell);
 
                 /* Neighboring heads (with boundary handling) */
-                float eta_w = (i > 0) ? (cells[idx-1].h_surface + cells[idx-1].z) : eta_s;
-                float eta_e = (i < nx-1) ? (cells[idx+1].h_surface + cells[idx+1].z) : eta_s;
-                float eta_s_n = (j > 0) ? (cells[idx-nx].h_surface + cells[idx-nx].z) : eta_s;
-                float eta_n = (j < ny-1) ? (cells[idx+nx].h_surface + cells[idx+nx].z) : eta_s;
+                size_t row = (size_t)nx * stride;
+                float eta_w = (i > 0) ? surface_head(cell - stride) : eta_s;
+                float eta_e = (i < nx-1) ? surface_head(cell + stride) : eta_s;
+                float eta_s_n = (j > 0) ? surface_head(cell - row) : eta_s;
+                float eta_n = (j < ny-1) ? surface_head(cell + row) : eta_s;
 
                 /* Laplacian ∇²η_s ≈ (η_w + η_e + η_s + η_n - 4*η_s) / dx² */
                 float laplacian = (eta_w + eta_e + eta_s_n + eta_n - 4.0f * eta_s) / (dx * dx);
 
                 /* Explicit update: dh/dt = K_r * C(ζ) * ∇²η_s */
-                h_new[idx] = cell->h_surface + dt_sub * K_r * C_zeta * laplacian;
+                h_new[i] = cell->h_surface + dt_sub * K_r * C_zeta * laplacian;
 
                 /* GENESIS v3.0: Add barrier gradient for non-negativity constraint.
                  * This provides smooth approach to h=0 instead of hard clamp. */
-                float h_barrier = barrier_gradient_lower_f(h_new[idx], 0.0f);
-                h_new[idx] += dt_sub * h_barrier * 0.001f;  /* Damped barrier contribution */
+                float h_barrier = barrier_gradient_lower_f(h_new[i], 0.0f);
+                h_new[i] += dt_sub * h_barrier * 0.001f;  /* Damped barrier contribution */
 
                 /* Safety backstop: ensure physically valid state */
-                if (h_new[idx] < 0.0f) h_new[idx] = 0.0f;
+                if (h_new[i] < 0.0f) h_new[i] = 0.0f;
             }
-        }
 
-        /* Copy updated values */
-        for (int j = 0; j < ny; j++) {
-            for (int i = 0; i < nx; i++) {
-                int idx = j * nx + i;
-                cells[idx].h_surface = h_new[idx];
+            /* Row j has read row j - 1's old heads: publish row j - 1 */
+            if (j > 0) {
+                const float* h_prev = h_rows[(j - 1) & 1];
+                for (int i = 0; i < nx; i++) {
+                    cells[((size_t)((j - 1) * nx + i)) * stride].h_surface = h_prev[i];
+                }
             }
         }
+
+        /* Publish the last row */
+        const float* h_last = h_rows[(ny - 1) & 1];
+        for (int i = 0; i < nx; i++) {
+            cells[((size_t)((ny - 1) * nx + i)) * stride].h_surface = h_last[i];
+        }
     }
 }
 
@@ -489,6 +470,44 @@ static void solve_horizontal_explicit(
  * MAIN SOLVER STEP
  * ======================================================================== */
 
+typedef struct {
+    Cell* cells;
+    const RichardsLiteParams* params;
+    size_t nz;
+    float dt;
+    float rainfall;
+} VerticalPass;
+
+/* Columns [begin, end) of the vertical pass; each tile owns its columns */
+static void vertical_tile(void* ctx, size_t begin, size_t end, int slot) {
+    const VerticalPass* pass = (const VerticalPass*)ctx;
+    (void)slot;
+    for (size_t col = begin; col < end; col++) {
+        solve_vertical_implicit(&pass->cells[col * pass->nz], (int)pass->nz, pass->dt,
+                                pass->rainfall, &g_vG_lut_default,
+                                pass->params->use_free_drainage);
+    }
+}
+
+/* Zero columns [begin, end) from the slot that will solve them */
+static void first_touch_tile(void* ctx, size_t begin, size_t end, int slot) {
+    const VerticalPass* pass = (const VerticalPass*)ctx;
+    (void)slot;
+    memset(&pass->cells[begin * pass->nz], 0, (end - begin) * pass->nz * sizeof(Cell));
+}
+
+void richards_lite_first_touch(
+    Cell* cells,
+    size_t nx,
+    size_t ny,
+    size_t nz,
+    const NegPoolConfig* pool
+) {
+    if (!cells || nz == 0) return;
+    VerticalPass pass = { cells, NULL, nz, 0.0f, 0.0f };
+    neg_pool_run(pool, nx * ny, RL_VERTICAL_TILE, first_touch_tile, &pass);
+}
+
 /**
  * Advance hydrological state by one timestep.
  *
@@ -504,13 +523,21 @@ void richards_lite_step(
     float rainfall,
     void* diagnostics
 ) {
-    /* Silence unused parameter warning (reserved for future mass balance tracking) */
-    (void)diagnostics;
+    richards_lite_step_tiled(cells, params, nx, ny, nz, dt, rainfall, diagnostics, NULL);
+}
 
-    if (!g_lut_initialized) {
-        fprintf(stderr, "ERROR: richards_lite_init() must be called first!\n");
-        return;
-    }
+void richards_lite_step_tiled(
+    Cell* cells,
+    const RichardsLiteParams* params,
+    size_t nx,
+    size_t ny,
+    size_t nz,
+    float dt,
+    float rainfall,
+    void* diagnostics,
+    const NegPoolConfig* pool
+) {
+    NegPhaseTimers* timers = (NegPhaseTimers*)diagnostics;
 
     /* Step 1: Update surface depression storage and connectivity */
     for (size_t j = 0; j < ny; j++) {
@@ -525,38 +552,20 @@ void richards_lite_step(
     }
 
     /* Step 2: Vertical implicit pass (column-wise) */
-    for (size_t j = 0; j < ny; j++) {
-        for (size_t i = 0; i < nx; i++) {
-            int idx_base = (j * nx + i) * nz;
-            Cell* column = &cells[idx_base];
-
-            solve_vertical_implicit(column, nz, dt, rainfall, &g_vG_lut_default,
-                                   params->use_free_drainage);
-        }
-    }
-
-    /* Step 3: Horizontal explicit pass (surface flow, conditional) */
-    /* Extract surface layer (top of each column) */
-    static Cell surface_cells[256 * 256];  /* Max 256x256 */
-    for (size_t j = 0; j < ny; j++) {
-        for (size_t i = 0; i < nx; i++) {
-            int idx_surface_global = (j * nx + i) * nz;
-            int idx_surface_local = j * nx + i;
-            surface_cells[idx_surface_local] = cells[idx_surface_global];
-        }
-    }
-
-    solve_horizontal_explicit(surface_cells, params, nx, ny, dt);
-
-    /* Copy updated surface water back */
-    for (size_t j = 0; j < ny; j++) {
-        for (size_t i = 0; i < nx; i++) {
-            int idx_surface_global = (j * nx + i) * nz;
-            int idx_surface_local = j * nx + i;
-            cells[idx_surface_global].h_surface = surface_cells[idx_surface_local].h_surface;
-            cells[idx_surface_global].zeta = surface_cells[idx_surface_local].zeta;
-        }
-    }
+    uint64_t t_vertical = neg_phase_start(timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_vertical);
+    VerticalPass pass = { cells, params, nz, dt, rainfall };
+    neg_pool_run(pool, nx * ny, RL_VERTICAL_TILE, vertical_tile, &pass);
+    neg_phase_stop(timers, NEG_PHASE_VERTICAL_SOLVE, t_vertical);
+    NEG_TRACE_SCOPE_END(trace_vertical, "hyd", "vertical_solve", nx * ny);
+
+    /* Step 3: Horizontal explicit pass (surface flow, conditional),
+     * in place on the top layer of each column */
+    uint64_t t_surface = neg_phase_start(timers);
+    NEG_TRACE_SCOPE_BEGIN(trace_surface);
+    solve_horizontal_explicit(cells, nz, params, (int)nx, (int)ny, dt);
+    neg_phase_stop(timers, NEG_PHASE_SURFACE_FLOW, t_surface);
+    NEG_TRACE_SCOPE_END(trace_surface, "hyd", "surface_flow", nx * ny);
 
     /* Step 4: Apply evaporation sink */
     for (size_t j = 0; j < ny; j++) {
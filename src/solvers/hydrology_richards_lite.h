@@ -78,6 +78,7 @@
 
 #include <stddef.h>
 #include <stdint.h>  /* For int32_t (fixed_t) */
+#include "../core/include/thread_pool.h"
 
 /* ========================================================================
  * CORE DATA STRUCTURES
@@ -367,12 +368,13 @@ typedef enum {
 /**
  * Initialize the Richards-Lite solver.
  *
- * Pre-computes lookup tables for:
+ * The lookup tables are emitted at build time by tools/generate_luts.c
+ * as static const data:
  *   - θ(ψ) van Genuchten retention curve (256 entries)
  *   - K(θ) Mualem conductivity curve (256 entries)
  *   - dθ/dψ specific moisture capacity (256 entries, for Picard iteration)
  *
- * This function must be called once before using richards_lite_step().
+ * Only prints the default soil parameters; kept for API compatibility.
  *
  * Performance: Grok optimization - 256-entry LUTs reduce per-cell cost
  * from ~200ns to ~15ns for θ(ψ) and K(θ) evaluations (similar to ATMv1's
@@ -422,10 +424,15 @@ void richards_lite_init(void);
  * @param nz            Number of vertical layers
  * @param dt            Timestep [s]
  * @param rainfall      Rainfall rate [m/s] (spatially uniform for now)
- * @param diagnostics   [OUT] Optional diagnostics struct (can be NULL)
+ * @param diagnostics   [OUT] Optional NegPhaseTimers* (src/core/include/
+ *                      phase_timers.h) charged with the vertical solve and
+ *                      surface flow phases; NULL disables timing
+ *
+ * Limits: nz <= 256 (deeper columns are left untouched) and nx <= 1024
+ *         (wider grids skip surface flow).
  *
  * Thread Safety: Pure function, can be called concurrently with different
- *                Cell arrays.
+ *                Cell arrays; all scratch lives on the caller's stack.
  *
  * Performance: Target ~15-20 ns/cell on modern x86-64 with optimized LUTs
  *              (comparable to ATMv1's ~10 ns/cell for simpler physics)
@@ -438,7 +445,51 @@ void richards_lite_step(
     size_t nz,
     float dt,
     float rainfall,
-    void* diagnostics  /* Reserved for future mass balance tracking */
+    void* diagnostics  /* NegPhaseTimers*, or NULL */
+);
+
+/**
+ * richards_lite_step() with the vertical column pass spread over the
+ * process-wide worker pool (src/core/include/thread_pool.h).
+ *
+ * Columns are independent, so the result is bit-identical to
+ * richards_lite_step() for any pool configuration. The surface-flow pass
+ * stays serial. Default tile: 64 columns.
+ *
+ * @param pool Threads / tile size, e.g. state_get_pool_config(sim)
+ *             (NULL: serial, same as richards_lite_step())
+ */
+void richards_lite_step_tiled(
+    Cell* cells,
+    const RichardsLiteParams* params,
+    size_t nx,
+    size_t ny,
+    size_t nz,
+    float dt,
+    float rainfall,
+    void* diagnostics,
+    const NegPoolConfig* pool
+);
+
+/**
+ * Zero a freshly mapped grid with the tiling richards_lite_step_tiled()
+ * uses, so each column's pages are first touched - and on NUMA hosts
+ * placed - by the worker that later solves that column.
+ *
+ * Call once after allocating the grid (e.g. neg_mem_map(), which leaves
+ * pages untouched) and before filling it in; pass the same pool
+ * configuration and grid dimensions as the solver steps.
+ *
+ * @param cells Grid of nx * ny * nz cells (column-major, nz per column)
+ * @param pool  Configuration later passed to richards_lite_step_tiled()
+ *              (NULL: serial, a plain memset)
+ */
+void richards_lite_first_touch(
+    Cell* cells,
+    size_t nx,
+    size_t ny,
+    size_t nz,
+    const NegPoolConfig* pool
 );
 
 /**
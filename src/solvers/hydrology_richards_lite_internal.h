@@ -78,15 +78,23 @@ typedef struct {
  * GLOBAL LOOKUP TABLE STORAGE
  * ======================================================================== */
 
+/* Default soil parameters (sandy loam, Loess Plateau representative) */
+#define VG_DEFAULT_ALPHA    2.0f        /* [1/m] */
+#define VG_DEFAULT_N        1.5f        /* [-] */
+#define VG_DEFAULT_THETA_S  0.40f       /* [-] */
+#define VG_DEFAULT_THETA_R  0.05f       /* [-] */
+#define VG_DEFAULT_K_S      5.0e-6f     /* [m/s] = 18 mm/hr */
+
 /**
  * Global LUT storage.
  *
- * Initialized once by richards_lite_init() and reused for all cells.
- * For simplicity, we use a single "default" soil type; future versions
- * can support multiple soil types via an array of LUTs.
+ * Emitted at build time by tools/generate_luts.c (vG_lut_build() with the
+ * VG_DEFAULT_* soil) into hydrology_richards_lite_luts.h, so it lives in
+ * read-only memory and is identical on every target. Custom soil types
+ * build their own table with vG_lut_build(); future versions can support
+ * multiple soil types via an array of LUTs.
  */
-extern VanGenuchtenLUT g_vG_lut_default;
-extern int g_lut_initialized;
+extern const VanGenuchtenLUT g_vG_lut_default;
 
 /* ========================================================================
  * VAN GENUCHTEN FUNCTIONS (Exact, for LUT generation)
@@ -190,6 +198,62 @@ static inline float vG_capacity_exact(
            powf(alpha * abs_psi, n - 1.0f) / denom;
 }
 
+/**
+ * Build θ(ψ), K(θ) and dθ/dψ tables for one soil type.
+ *
+ * Each table samples LUT_SIZE evenly spaced points over the fixed
+ * PSI/THETA ranges with the exact van Genuchten-Mualem functions above.
+ *
+ * @param lut Output table
+ * @param alpha Air entry parameter [1/m]
+ * @param n Pore size distribution [-]
+ * @param theta_s Saturated water content [-]
+ * @param theta_r Residual water content [-]
+ * @param K_s Saturated conductivity [m/s]
+ */
+static inline void vG_lut_build(
+    VanGenuchtenLUT* lut,
+    float alpha,
+    float n,
+    float theta_s,
+    float theta_r,
+    float K_s
+) {
+    lut->alpha = alpha;
+    lut->n = n;
+    lut->m = 1.0f - 1.0f / n;  /* m = 1 - 1/n */
+    lut->theta_s = theta_s;
+    lut->theta_r = theta_r;
+    lut->K_s = K_s;
+
+    /* Table bounds */
+    lut->psi_min = PSI_MIN;
+    lut->psi_max = PSI_MAX;
+    lut->theta_min = THETA_MIN;
+    lut->theta_max = THETA_MAX;
+
+    /* θ(ψ) */
+    for (int i = 0; i < LUT_SIZE; i++) {
+        float t = (float)i / (LUT_SIZE - 1);
+        float psi = PSI_MIN + t * PSI_RANGE;
+        lut->theta_of_psi[i] = vG_theta_exact(psi, alpha, n, theta_s, theta_r);
+    }
+
+    /* K(θ) */
+    for (int i = 0; i < LUT_SIZE; i++) {
+        float t = (float)i / (LUT_SIZE - 1);
+        float theta = THETA_MIN + t * THETA_RANGE;
+        lut->K_of_theta[i] = vG_K_exact(theta, K_s, theta_s, theta_r, lut->m);
+    }
+
+    /* dθ/dψ (specific moisture capacity) */
+    for (int i = 0; i < LUT_SIZE; i++) {
+        float t = (float)i / (LUT_SIZE - 1);
+        float psi = PSI_MIN + t * PSI_RANGE;
+        lut->C_of_psi[i] = vG_capacity_exact(psi, alpha, n, theta_s, theta_r);
+    }
+}
+
 /* ========================================================================
  * LOOKUP TABLE INTERPOLATION (Fast)
  * ======================================================================== */
@@ -290,9 +354,12 @@ static inline void thomas_algorithm(
     float* x,
     int n
 ) {
-    /* Temporary arrays for modified coefficients */
-    static float c_prime[256];  /* Assume max 256 vertical layers */
-    static float d_prime[256];
+    /* Modified coefficients (on the stack: columns may be solved
+     * concurrently; assume max 256 vertical layers) */
+    float c_prime[256];
+    float d_prime[256];
+
+    if (n < 1 || n > 256) return;
 
     /* Forward sweep */
     c_prime[0] = c[0] / b[0];
@@ -0,0 +1,225 @@
+/* Generated by tools/generate_luts.c - DO NOT EDIT MANUALLY */
+/* This file contains the LUT data and should be included in hydrology_richards_lite.c */
+#ifndef HYDROLOGY_RICHARDS_LITE_LUTS_H
+#define HYDROLOGY_RICHARDS_LITE_LUTS_H
+
+/* Default soil (sandy loam): vG_lut_build(VG_DEFAULT_*) */
+const VanGenuchtenLUT g_vG_lut_default = {
+    .alpha = 2.00000000e+00f,
+    .n = 1.50000000e+00f,
+    .m = 3.33333313e-01f,
+    .theta_s = 4.00000006e-01f,
+    .theta_r = 5.00000007e-02f,
+    .K_s = 4.99999987e-06f,
+
+    /* θ(ψ) */
+    .theta_of_psi = {
+        5.07826246e-02f, 5.07841632e-02f, 5.07857129e-02f, 5.07872701e-02f,
+        5.07888347e-02f, 5.07904105e-02f, 5.07919975e-02f, 5.07935919e-02f,
+        5.07951975e-02f, 5.07968143e-02f, 5.07984385e-02f, 5.08000702e-02f,
+        5.08017167e-02f, 5.08033708e-02f, 5.08050360e-02f, 5.08067124e-02f,
+        5.08083962e-02f, 5.08100949e-02f, 5.08118011e-02f, 5.08135185e-02f,
+        5.08152470e-02f, 5.08169867e-02f, 5.08187413e-02f, 5.08205034e-02f,
+        5.08222766e-02f, 5.08240610e-02f, 5.08258604e-02f, 5.08276671e-02f,
+        5.08294888e-02f, 5.08313216e-02f, 5.08331694e-02f, 5.08350246e-02f,
+        5.08368947e-02f, 5.08387797e-02f, 5.08406721e-02f, 5.08425832e-02f,
+        5.08445054e-02f, 5.08464389e-02f, 5.08483872e-02f, 5.08503467e-02f,
+        5.08523248e-02f, 5.08543141e-02f, 5.08563146e-02f, 5.08583337e-02f,
+        5.08603640e-02f, 5.08624092e-02f, 5.08644730e-02f, 5.08665480e-02f,
+        5.08686379e-02f, 5.08707426e-02f, 5.08728661e-02f, 5.08750007e-02f,
+        5.08771539e-02f, 5.08793220e-02f, 5.08815050e-02f, 5.08837067e-02f,
+        5.08859269e-02f, 5.08881584e-02f, 5.08904122e-02f, 5.08926809e-02f,
+        5.08949645e-02f, 5.08972704e-02f, 5.08995913e-02f, 5.09019308e-02f,
+        5.09042889e-02f, 5.09066656e-02f, 5.09090610e-02f, 5.09114750e-02f,
+        5.09139076e-02f, 5.09163626e-02f, 5.09188361e-02f, 5.09213284e-02f,
+        5.09238429e-02f, 5.09263761e-02f, 5.09289317e-02f, 5.09315096e-02f,
+        5.09341098e-02f, 5.09367287e-02f, 5.09393699e-02f, 5.09420373e-02f,
+        5.09447232e-02f, 5.09474352e-02f, 5.09501696e-02f, 5.09529263e-02f,
+        5.09557091e-02f, 5.09585142e-02f, 5.09613454e-02f, 5.09642027e-02f,
+        5.09670861e-02f, 5.09699956e-02f, 5.09729311e-02f, 5.09758927e-02f,
+        5.09788804e-02f, 5.09818979e-02f, 5.09849414e-02f, 5.09880148e-02f,
+        5.09911180e-02f, 5.09942472e-02f, 5.09974100e-02f, 5.10006025e-02f,
+        5.10038249e-02f, 5.10070771e-02f, 5.10103628e-02f, 5.10136820e-02f,
+        5.10170348e-02f, 5.10204174e-02f, 5.10238372e-02f, 5.10272905e-02f,
+        5.10307774e-02f, 5.10343015e-02f, 5.10378629e-02f, 5.10414578e-02f,
+        5.10450937e-02f, 5.10487668e-02f, 5.10524809e-02f, 5.10562323e-02f,
+        5.10600246e-02f, 5.10638580e-02f, 5.10677360e-02f, 5.10716513e-02f,
+        5.10756150e-02f, 5.10796197e-02f, 5.10836728e-02f, 5.10877706e-02f,
+        5.10919131e-02f, 5.10961041e-02f, 5.11003435e-02f, 5.11046350e-02f,
+        5.11089750e-02f, 5.11133671e-02f, 5.11178114e-02f, 5.11223115e-02f,
+        5.11268638e-02f, 5.11314720e-02f, 5.11361361e-02f, 5.11408597e-02f,
+        5.11456467e-02f, 5.11504896e-02f, 5.11553958e-02f, 5.11603653e-02f,
+        5.11653982e-02f, 5.11704981e-02f, 5.11756688e-02f, 5.11809029e-02f,
+        5.11862114e-02f, 5.11915907e-02f, 5.11970446e-02f, 5.12025729e-02f,
+        5.12081794e-02f, 5.12138642e-02f, 5.12196310e-02f, 5.12254834e-02f,
+        5.12314178e-02f, 5.12374379e-02f, 5.12435474e-02f, 5.12497500e-02f,
+        5.12560457e-02f, 5.12624383e-02f, 5.12689315e-02f, 5.12755215e-02f,
+        5.12822159e-02f, 5.12890182e-02f, 5.12959324e-02f, 5.13029546e-02f,
+        5.13100959e-02f, 5.13173528e-02f, 5.13247326e-02f, 5.13322391e-02f,
+        5.13398722e-02f, 5.13476431e-02f, 5.13555445e-02f, 5.13635911e-02f,
+        5.13717793e-02f, 5.13801202e-02f, 5.13886139e-02f, 5.13972640e-02f,
+        5.14060780e-02f, 5.14150634e-02f, 5.14242239e-02f, 5.14335632e-02f,
+        5.14430888e-02f, 5.14528044e-02f, 5.14627211e-02f, 5.14728464e-02f,
+        5.14831804e-02f, 5.14937378e-02f, 5.15045226e-02f, 5.15155457e-02f,
+        5.15268147e-02f, 5.15383370e-02f, 5.15501238e-02f, 5.15621901e-02f,
+        5.15745394e-02f, 5.15871868e-02f, 5.16001433e-02f, 5.16134202e-02f,
+        5.16270362e-02f, 5.16410023e-02f, 5.16553372e-02f, 5.16700484e-02f,
+        5.16851656e-02f, 5.17006963e-02f, 5.17166667e-02f, 5.17330915e-02f,
+        5.17500006e-02f, 5.17674163e-02f, 5.17853573e-02f, 5.18038608e-02f,
+        5.18229492e-02f, 5.18426560e-02f, 5.18630184e-02f, 5.18840700e-02f,
+        5.19058518e-02f, 5.19284084e-02f, 5.19517809e-02f, 5.19760288e-02f,
+        5.20012043e-02f, 5.20273633e-02f, 5.20545766e-02f, 5.20829186e-02f,
+        5.21124639e-02f, 5.21433055e-02f, 5.21755368e-02f, 5.22092693e-02f,
+        5.22446185e-02f, 5.22817224e-02f, 5.23207299e-02f, 5.23618087e-02f,
+        5.24051450e-02f, 5.24509624e-02f, 5.24995029e-02f, 5.25510423e-02f,
+        5.26059084e-02f, 5.26644774e-02f, 5.27271777e-02f, 5.27945273e-02f,
+        5.28671257e-02f, 5.29456921e-02f, 5.30310906e-02f, 5.31243756e-02f,
+        5.32268435e-02f, 5.33400998e-02f, 5.34661822e-02f, 5.36077172e-02f,
+        5.37681393e-02f, 5.39520569e-02f, 5.41658327e-02f, 5.44185303e-02f,
+        5.47236055e-02f, 5.51020838e-02f, 5.55890501e-02f, 5.62487431e-02f,
+        5.72154224e-02f, 5.88370301e-02f, 6.24973252e-02f, 4.00000006e-01f
+    },
+
+    /* K(θ) */
+    .K_of_theta = {
+        4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f,
+        4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f,
+        4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f,
+        4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f, 4.99999992e-18f,
+        4.99999992e-18f, 4.99999992e-18f, 1.21857073e-21f, 1.20939105e-19f,
+        2.43548835e-18f, 1.91692142e-17f, 8.95409911e-17f, 3.12733220e-16f,
+        8.91073049e-16f, 2.20225813e-15f, 4.86239433e-15f, 9.85886296e-15f,
+        1.86441726e-14f, 3.33099942e-14f, 5.67245768e-14f, 9.28194289e-14f,
+        1.46698449e-13f, 2.24989637e-13f, 3.36022171e-13f, 4.90268091e-13f,
+        7.00784645e-13f, 9.83258505e-13f, 1.35673157e-12f, 1.84374824e-12f,
+        2.47144579e-12f, 3.27125523e-12f, 4.28009928e-12f, 5.54121939e-12f,
+        7.10372950e-12f, 9.02430734e-12f, 1.13682206e-11f, 1.42084747e-11f,
+        1.76288845e-11f, 2.17232499e-11f, 2.65967994e-11f, 3.23681776e-11f,
+        3.91687412e-11f, 4.71430603e-11f, 5.64564541e-11f, 6.72864264e-11f,
+        7.98330915e-11f, 9.43116141e-11f, 1.10965272e-10f, 1.30052857e-10f,
+        1.51863203e-10f, 1.76709342e-10f, 2.04931974e-10f, 2.36907327e-10f,
+        2.73031570e-10f, 3.13749943e-10f, 3.59530461e-10f, 4.10885659e-10f,
+        4.68377226e-10f, 5.32598077e-10f, 6.04190087e-10f, 6.83848256e-10f,
+        7.72325204e-10f, 8.70410966e-10f, 9.78976233e-10f, 1.09893439e-09f,
+        1.23128274e-09f, 1.37706579e-09f, 1.53743762e-09f, 1.71358983e-09f,
+        1.90682692e-09f, 2.11852114e-09f, 2.35015274e-09f, 2.60329891e-09f,
+        2.87963631e-09f, 3.18093751e-09f, 3.50911900e-09f, 3.86620735e-09f,
+        4.25435109e-09f, 4.67586103e-09f, 5.13315657e-09f, 5.62884983e-09f,
+        6.16569462e-09f, 6.74664280e-09f, 7.37476391e-09f, 8.05342637e-09f,
+        8.78611495e-09f, 9.57655910e-09f, 1.04287690e-08f, 1.13469234e-08f,
+        1.23355086e-08f, 1.33993012e-08f, 1.45433470e-08f, 1.57730113e-08f,
+        1.70939636e-08f, 1.85123579e-08f, 2.00345571e-08f, 2.16673719e-08f,
+        2.34182291e-08f, 2.52947405e-08f, 2.73052017e-08f, 2.94583220e-08f,
+        3.17634985e-08f, 3.42306699e-08f, 3.68702686e-08f, 3.96938340e-08f,
+        4.27132889e-08f, 4.59413911e-08f, 4.93919039e-08f, 5.30795816e-08f,
+        5.70199568e-08f, 6.12299260e-08f, 6.57272636e-08f, 7.05314278e-08f,
+        7.56628893e-08f, 8.11439378e-08f, 8.69981278e-08f, 9.32515576e-08f,
+        9.99314196e-08f, 1.07067848e-07f, 1.14692760e-07f, 1.22841115e-07f,
+        1.31550379e-07f, 1.40861857e-07f, 1.50819787e-07f, 1.61472585e-07f,
+        1.72872959e-07f, 1.85079088e-07f, 1.98153913e-07f, 2.12167308e-07f,
+        2.27195244e-07f, 2.43322972e-07f, 2.60643873e-07f, 2.79262252e-07f,
+        2.99293845e-07f, 3.20869134e-07f, 3.44133980e-07f, 3.69253769e-07f,
+        3.96415118e-07f, 4.25832212e-07f, 4.57750758e-07f, 4.92454376e-07f,
+        5.30271564e-07f, 5.71591329e-07f, 6.16872626e-07f, 6.66663936e-07f,
+        7.21631466e-07f, 7.82593588e-07f, 8.50571610e-07f, 9.26864118e-07f,
+        1.01316220e-06f, 1.11173108e-06f, 1.22570384e-06f, 1.35961386e-06f,
+        1.52041514e-06f, 1.71967940e-06f, 1.97913232e-06f, 2.34899380e-06f,
+        3.01504497e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f,
+        4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f, 4.99999987e-06f
+    },
+
+    /* dθ/dψ */
+    .C_of_psi = {
+        3.91312405e-09f, 3.93625577e-09f, 3.95961619e-09f, 3.98320887e-09f,
+        4.00703648e-09f, 4.03110256e-09f, 4.05541067e-09f, 4.07996481e-09f,
+        4.10476675e-09f, 4.12982137e-09f, 4.15513179e-09f, 4.18070156e-09f,
+        4.20653512e-09f, 4.23263513e-09f, 4.25900648e-09f, 4.28565361e-09f,
+        4.31257829e-09f, 4.33978720e-09f, 4.36728342e-09f, 4.39507097e-09f,
+        4.42315473e-09f, 4.45153825e-09f, 4.48022686e-09f, 4.50922499e-09f,
+        4.53853710e-09f, 4.56816940e-09f, 4.59812366e-09f, 4.62840832e-09f,
+        4.65902561e-09f, 4.68998262e-09f, 4.72128381e-09f, 4.75293449e-09f,
+        4.78494133e-09f, 4.81730789e-09f, 4.85004215e-09f, 4.88314811e-09f,
+        4.91663243e-09f, 4.95050134e-09f, 4.98476060e-09f, 5.01941777e-09f,
+        5.05447684e-09f, 5.08994669e-09f, 5.12583309e-09f, 5.16214449e-09f,
+        5.19888577e-09f, 5.23606447e-09f, 5.27368904e-09f, 5.31176569e-09f,
+        5.35030376e-09f, 5.38930900e-09f, 5.42879075e-09f, 5.46875745e-09f,
+        5.50921708e-09f, 5.55017721e-09f, 5.59164803e-09f, 5.63363711e-09f,
+        5.67615466e-09f, 5.71920999e-09f, 5.76281289e-09f, 5.80697312e-09f,
+        5.85169913e-09f, 5.89700289e-09f, 5.94289373e-09f, 5.98938188e-09f,
+        6.03648109e-09f, 6.08419937e-09f, 6.13255136e-09f, 6.18154639e-09f,
+        6.23119778e-09f, 6.28151620e-09f, 6.33251629e-09f, 6.38420961e-09f,
+        6.43661124e-09f, 6.48973320e-09f, 6.54358923e-09f, 6.59819444e-09f,
+        6.65356437e-09f, 6.70971190e-09f, 6.76665435e-09f, 6.82440637e-09f,
+        6.88298485e-09f, 6.94240532e-09f, 7.00268732e-09f, 7.06384595e-09f,
+        7.12589943e-09f, 7.18886817e-09f, 7.25276905e-09f, 7.31762162e-09f,
+        7.38344763e-09f, 7.45026574e-09f, 7.51809726e-09f, 7.58696572e-09f,
+        7.65689112e-09f, 7.72789832e-09f, 7.80000864e-09f, 7.87324783e-09f,
+        7.94763988e-09f, 8.02321232e-09f, 8.09998912e-09f, 8.17799783e-09f,
+        8.25726776e-09f, 8.33782554e-09f, 8.41970227e-09f, 8.50292814e-09f,
+        8.58753335e-09f, 8.67355254e-09f, 8.76101769e-09f, 8.84996076e-09f,
+        8.94041907e-09f, 9.03242992e-09f, 9.12602882e-09f, 9.22125754e-09f,
+        9.31815336e-09f, 9.41675715e-09f, 9.51711243e-09f, 9.61926450e-09f,
+        9.72325420e-09f, 9.82913306e-09f, 9.93694815e-09f, 1.00467474e-08f,
+        1.01585851e-08f, 1.02725117e-08f, 1.03885851e-08f, 1.05068585e-08f,
+        1.06273967e-08f, 1.07502567e-08f, 1.08755023e-08f, 1.10031966e-08f,
+        1.11334124e-08f, 1.12662155e-08f, 1.14016805e-08f, 1.15398819e-08f,
+        1.16808980e-08f, 1.18248122e-08f, 1.19717010e-08f, 1.21216575e-08f,
+        1.22747714e-08f, 1.24311379e-08f, 1.25908510e-08f, 1.27540130e-08f,
+        1.29207329e-08f, 1.30911149e-08f, 1.32652733e-08f, 1.34433300e-08f,
+        1.36254039e-08f, 1.38116265e-08f, 1.40021319e-08f, 1.41970533e-08f,
+        1.43965453e-08f, 1.46007482e-08f, 1.48098254e-08f, 1.50239394e-08f,
+        1.52432644e-08f, 1.54679825e-08f, 1.56982711e-08f, 1.59343330e-08f,
+        1.61763722e-08f, 1.64245968e-08f, 1.66792375e-08f, 1.69405343e-08f,
+        1.72087145e-08f, 1.74840515e-08f, 1.77668120e-08f, 1.80572730e-08f,
+        1.83557312e-08f, 1.86625080e-08f, 1.89779321e-08f, 1.93023340e-08f,
+        1.96360865e-08f, 1.99795736e-08f, 2.03331911e-08f, 2.06973638e-08f,
+        2.10725339e-08f, 2.14591793e-08f, 2.18577938e-08f, 2.22689049e-08f,
+        2.26930670e-08f, 2.31308679e-08f, 2.35829294e-08f, 2.40499052e-08f,
+        2.45325040e-08f, 2.50314613e-08f, 2.55475605e-08f, 2.60816559e-08f,
+        2.66346127e-08f, 2.72073848e-08f, 2.78009900e-08f, 2.84164923e-08f,
+        2.90550499e-08f, 2.97178850e-08f, 3.04063121e-08f, 3.11217363e-08f,
+        3.18656603e-08f, 3.26397043e-08f, 3.34455983e-08f, 3.42852076e-08f,
+        3.51605678e-08f, 3.60737999e-08f, 3.70272595e-08f, 3.80234759e-08f,
+        3.90651778e-08f, 4.01553315e-08f, 4.12971417e-08f, 4.24941149e-08f,
+        4.37500454e-08f, 4.50690791e-08f, 4.64557601e-08f, 4.79150302e-08f,
+        4.94523391e-08f, 5.10736875e-08f, 5.27855484e-08f, 5.45952439e-08f,
+        5.65107605e-08f, 5.85409623e-08f, 6.06957045e-08f, 6.29859684e-08f,
+        6.54239614e-08f, 6.80233967e-08f, 7.07996364e-08f, 7.37700177e-08f,
+        7.69540520e-08f, 8.03739226e-08f, 8.40548893e-08f, 8.80255868e-08f,
+        9.23190484e-08f, 9.69732312e-08f, 1.02032082e-07f, 1.07546597e-07f,
+        1.13576370e-07f, 1.20191444e-07f, 1.27474578e-07f, 1.35524132e-07f,
+        1.44458042e-07f, 1.54418501e-07f, 1.65578655e-07f, 1.78150970e-07f,
+        1.92399256e-07f, 2.08653191e-07f, 2.27331839e-07f, 2.48973748e-07f,
+        2.74281518e-07f, 3.04187438e-07f, 3.39952464e-07f, 3.83319701e-07f,
+        4.36760985e-07f, 5.03886383e-07f, 5.90158379e-07f, 7.04201511e-07f,
+        8.60368289e-07f, 1.08419158e-06f, 1.42520514e-06f, 1.99178021e-06f,
+        3.06653374e-06f, 5.63352660e-06f, 1.59333904e-05f, 0.00000000e+00f
+    },
+
+    .psi_min = -1.00000000e+05f,
+    .psi_max = 0.00000000e+00f,
+    .theta_min = 9.99999978e-03f,
+    .theta_max = 6.00000024e-01f
+};
+
+#endif /* HYDROLOGY_RICHARDS_LITE_LUTS_H */
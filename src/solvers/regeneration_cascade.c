@@ -17,6 +17,7 @@
 #include "regeneration_microbial.h"  /* REGv2 integration */
 #include "hydrology_richards_lite.h"
 #include "hydrology_richards_lite_internal.h"
+#include "../core/include/trace.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -348,6 +349,9 @@ void regeneration_cascade_step(
      * For simplicity in v1.0, we assume case (a): each cell has a single theta value.
      */
 
+    /* One REG cadence tick (the caller runs REG every ~128 HYD steps) */
+    NEG_TRACE_SCOPE_BEGIN(trace_start);
+
     for (size_t i = 0; i < grid_size; i++) {
         Cell* c = &grid[i];
 
@@ -362,6 +366,8 @@ void regeneration_cascade_step(
         /* Execute single-cell step */
         regeneration_cascade_step_single_cell(c, theta_avg, params, dt_years);
     }
+
+    NEG_TRACE_SCOPE_END(trace_start, "reg", "cascade_tick", grid_size);
 }
 
 /* ========================================================================
@@ -0,0 +1,309 @@
+/*
+ * barrier_field_test.c - Unit Tests for Field-Level Barrier Kernels
+ *
+ * Tests for:
+ *   1. barrier_field_bounded_fixed() bit-identical to the scalar
+ *      barriers.h functions, including sticky overflow bits
+ *   2. barrier_field_bounded_f() matches the scalar float expressions
+ *   3. Tails, NULL outputs, violated bounds
+ *   4. Throughput vs per-cell calls (informational)
+ *
+ * Compile with:
+ *   gcc -o barrier_field_test barrier_field_test.c \
+ *       ../src/core/math/barrier_field.c ../src/core/math/fixed_math.c \
+ *       -lm -std=c99
+ *
+ * Author: negentropic-core team
+ * Version: 0.4.0-alpha-genesis
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../include/barrier_field.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define N_FIELD 100003  /* Odd: exercises the scalar tail */
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 271828u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static float lcg_unit(void) {
+    return (float)(lcg_next() >> 8) / 16777216.0f;
+}
+
+static fixed_t fx[N_FIELD], fx_lo[N_FIELD], fx_hi[N_FIELD];
+static fixed_t fx_val[N_FIELD], fx_grad[N_FIELD];
+static float f[N_FIELD], f_lo[N_FIELD], f_hi[N_FIELD];
+static float f_val[N_FIELD], f_grad[N_FIELD];
+
+static const BarrierFieldParamsF k_params = { 8.0f, 1e-6f, 1e6f };
+
+/**
+ * Absolute tolerance for a float result whose two sides have magnitudes
+ * side_lo and side_hi. The sides cancel in the gradient, so the error is
+ * relative to |side_lo| + |side_hi|, not to the sum. Near a bound dx is
+ * itself a cancellation, and -ffast-math (Release) may reassociate
+ * x_max - x + eps or use a refined reciprocal estimate, so also allow a few
+ * ulp of the operands over dx.
+ */
+static double float_tol(float x, float lo, float hi, int power) {
+    double dx_lo = (double)x - lo + k_params.eps;
+    double dx_hi = (double)hi - x + k_params.eps;
+    if (dx_lo <= 0.0 || dx_hi <= 0.0) {
+        return 2.0 * k_params.violation;
+    }
+    double side_lo = k_params.kappa / pow(dx_lo, power);
+    double side_hi = k_params.kappa / pow(dx_hi, power);
+    double ulp = 8.0 * FLT_EPSILON * (fabs(x) + fabs(lo) + fabs(hi));
+    return (side_lo + side_hi) * (4e-6 + power * ulp / fmin(dx_lo, dx_hi));
+}
+
+/**
+ * Q16.16 fields mixing interior cells, cells within a few LSB of a bound
+ * (gradient saturates), violated bounds and extreme values (dx saturates).
+ */
+static void fill_fixed(void) {
+    for (int i = 0; i < N_FIELD; i++) {
+        uint32_t r = lcg_next();
+        fixed_t lo = (fixed_t)(lcg_next() % (8 * FRACUNIT)) - 4 * FRACUNIT;
+        fixed_t hi = lo + (fixed_t)(lcg_next() % (16 * FRACUNIT));
+        fixed_t x;
+        switch (r % 6) {
+            case 0: x = lo + (fixed_t)(lcg_next() % 256); break;          /* near lower */
+            case 1: x = hi - (fixed_t)(lcg_next() % 256); break;          /* near upper */
+            case 2: x = lo - (fixed_t)(lcg_next() % FRACUNIT); break;     /* violated */
+            case 3: x = (r & 64) ? INT32_MAX : INT32_MIN;                 /* extreme */
+                    lo = (r & 128) ? INT32_MIN : lo; break;
+            default: x = lo + (fixed_t)((int64_t)(hi - lo) * (lcg_next() >> 16) >> 16); break;
+        }
+        fx[i] = x;
+        fx_lo[i] = lo;
+        fx_hi[i] = hi;
+    }
+}
+
+/** θ-like float fields: porosity bounds, some cells at or past them */
+static void fill_float(void) {
+    for (int i = 0; i < N_FIELD; i++) {
+        float lo = 0.02f + 0.08f * lcg_unit();
+        float hi = 0.35f + 0.15f * lcg_unit();
+        float t = lcg_unit();
+        float x = lo + (hi - lo) * t;
+        if (i % 17 == 0) x = lo - 0.01f * lcg_unit();
+        if (i % 19 == 0) x = hi;
+        if (i % 23 == 0) x = lo + 1e-5f;
+        f[i] = x;
+        f_lo[i] = lo;
+        f_hi[i] = hi;
+    }
+}
+
+/* ========================================================================
+ * TEST 1: Q16.16 Bit-Exactness
+ * ======================================================================== */
+
+void test_fixed_exact(void) {
+    printf("\n[TEST 1] Q16.16 Field vs Scalar barriers.h (%d float lanes)\n", barrier_field_lanes());
+    int grad_ok = 1, val_ok = 1;
+
+    (void)fixed_sticky_take();
+    barrier_field_bounded_fixed(fx, fx_lo, fx_hi, N_FIELD, fx_val, fx_grad);
+    uint32_t field_bits = fixed_sticky_take();
+
+    for (int i = 0; i < N_FIELD; i++) {
+        if (fx_grad[i] != fixed_barrier_gradient_bounded(fx[i], fx_lo[i], fx_hi[i])) {
+            if (grad_ok) printf("    grad mismatch at x=%d [%d, %d]\n", fx[i], fx_lo[i], fx_hi[i]);
+            grad_ok = 0;
+        }
+        if (fx_val[i] != fixed_barrier_potential_bounded(fx[i], fx_lo[i], fx_hi[i])) {
+            if (val_ok) printf("    value mismatch at x=%d [%d, %d]\n", fx[i], fx_lo[i], fx_hi[i]);
+            val_ok = 0;
+        }
+    }
+    uint32_t scalar_bits = fixed_sticky_take();
+
+    TEST_ASSERT(grad_ok, "Gradients bit-identical to fixed_barrier_gradient_bounded");
+    TEST_ASSERT(val_ok, "Potentials bit-identical to fixed_barrier_potential_bounded");
+    TEST_ASSERT(field_bits == scalar_bits && field_bits == FIXED_STICKY_OVERFLOW,
+                "Same sticky bits as the scalar calls");
+
+    /* Interior-only field raises nothing */
+    fixed_t x[8], lo[8], hi[8], g[8];
+    for (int i = 0; i < 8; i++) {
+        lo[i] = 0;
+        hi[i] = 4 * FRACUNIT;
+        x[i] = FRACUNIT + i * (FRACUNIT / 4);
+    }
+    barrier_field_bounded_fixed(x, lo, hi, 8, NULL, g);
+    int ok = fixed_sticky_take() == 0;
+    for (int i = 0; i < 8; i++) {
+        ok &= g[i] == fixed_barrier_gradient_bounded(x[i], lo[i], hi[i]);
+    }
+    TEST_ASSERT(ok && fixed_sticky_take() == 0, "Interior cells: exact, no overflow raised");
+}
+
+/* ========================================================================
+ * TEST 2: Float Path
+ * ======================================================================== */
+
+void test_float(void) {
+    printf("\n[TEST 2] Float Field vs Scalar Expressions\n");
+    double max_rel = 0.0;
+    int tol_ok = 1, viol_ok = 1;
+
+    barrier_field_bounded_f(f, f_lo, f_hi, N_FIELD, &k_params, f_val, f_grad);
+
+    for (int i = 0; i < N_FIELD; i++) {
+        float g = barrier_gradient_bounded_f(f[i], f_lo[i], f_hi[i], &k_params);
+        float u = barrier_potential_bounded_f(f[i], f_lo[i], f_hi[i], &k_params);
+        double eg = fabs((double)f_grad[i] - g);
+        double eu = fabs((double)f_val[i] - u);
+        if (eg > float_tol(f[i], f_lo[i], f_hi[i], 2) ||
+            eu > float_tol(f[i], f_lo[i], f_hi[i], 1)) tol_ok = 0;
+        if (eu / u > max_rel) max_rel = eu / u;
+        if (f[i] < f_lo[i] && !(f_grad[i] <= -k_params.violation + 1e5f)) viol_ok = 0;
+    }
+
+    printf("    Max relative potential difference: %.2e\n", max_rel);
+    TEST_ASSERT(tol_ok, "Matches scalar expressions (within FP contraction / reassociation)");
+    TEST_ASSERT(viol_ok, "Violated lower bound returns -violation");
+}
+
+/* ========================================================================
+ * TEST 3: Tails and Optional Outputs
+ * ======================================================================== */
+
+void test_tails(void) {
+    printf("\n[TEST 3] Tails and NULL Outputs\n");
+    int ok = 1;
+
+    for (int n = 0; n <= 19 && ok; n++) {
+        for (int off = 0; off < 3 && ok; off++) {
+            fixed_t g[32], u[32];
+            float gf[32];
+            memset(g, 0x5A, sizeof(g));
+            barrier_field_bounded_fixed(fx + off, fx_lo + off, fx_hi + off, n, u, g);
+            barrier_field_bounded_f(f + off, f_lo + off, f_hi + off, n, &k_params, NULL, gf);
+            for (int i = 0; i < n; i++) {
+                ok &= g[i] == fixed_barrier_gradient_bounded(fx[off + i], fx_lo[off + i], fx_hi[off + i]);
+                ok &= u[i] == fixed_barrier_potential_bounded(fx[off + i], fx_lo[off + i], fx_hi[off + i]);
+                float g_ref = barrier_gradient_bounded_f(f[off + i], f_lo[off + i],
+                                                         f_hi[off + i], &k_params);
+                ok &= fabs((double)gf[i] - g_ref) <=
+                      float_tol(f[off + i], f_lo[off + i], f_hi[off + i], 2);
+            }
+            ok &= g[n] == 0x5A5A5A5A;  /* no write past n */
+        }
+    }
+    (void)fixed_sticky_take();
+    TEST_ASSERT(ok, "n = 0..19, unaligned, exact and no overrun");
+
+    fixed_t g_only[64], g_both[64], u_only[64], u_both[64];
+    barrier_field_bounded_fixed(fx, fx_lo, fx_hi, 64, NULL, g_only);
+    barrier_field_bounded_fixed(fx, fx_lo, fx_hi, 64, u_only, NULL);
+    barrier_field_bounded_fixed(fx, fx_lo, fx_hi, 64, u_both, g_both);
+    (void)fixed_sticky_take();
+    TEST_ASSERT(memcmp(g_only, g_both, sizeof(g_only)) == 0 &&
+                memcmp(u_only, u_both, sizeof(u_only)) == 0,
+                "value / grad independently optional");
+}
+
+/* ========================================================================
+ * TEST 4: Throughput (informational)
+ * ======================================================================== */
+
+void test_throughput(void) {
+    printf("\n[TEST 4] Throughput (informational)\n");
+    const int reps = 20;
+    volatile float sink = 0.0f;
+
+    clock_t t0 = clock();
+    for (int r = 0; r < reps; r++) {
+        for (int i = 0; i < N_FIELD; i++) {
+            f_grad[i] = barrier_gradient_bounded_f(f[i], f_lo[i], f_hi[i], &k_params);
+        }
+        sink += f_grad[r];
+    }
+    clock_t t1 = clock();
+    for (int r = 0; r < reps; r++) {
+        barrier_field_bounded_f(f, f_lo, f_hi, N_FIELD, &k_params, NULL, f_grad);
+        sink += f_grad[r];
+    }
+    clock_t t2 = clock();
+    for (int r = 0; r < reps; r++) {
+        for (int i = 0; i < N_FIELD; i++) {
+            fx_grad[i] = fixed_barrier_gradient_bounded(fx[i], fx_lo[i], fx_hi[i]);
+        }
+        sink += (float)fx_grad[r];
+    }
+    clock_t t3 = clock();
+    for (int r = 0; r < reps; r++) {
+        barrier_field_bounded_fixed(fx, fx_lo, fx_hi, N_FIELD, NULL, fx_grad);
+        sink += (float)fx_grad[r];
+    }
+    clock_t t4 = clock();
+    (void)fixed_sticky_take();
+
+    double scale = 1e9 / CLOCKS_PER_SEC / ((double)reps * N_FIELD);
+    printf("    float  per-cell: %.2f ns/cell, field: %.2f ns/cell\n",
+           (t1 - t0) * scale, (t2 - t1) * scale);
+    printf("    Q16.16 per-cell: %.2f ns/cell, field: %.2f ns/cell\n",
+           (t3 - t2) * scale, (t4 - t3) * scale);
+    (void)sink;
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("FIELD-LEVEL BARRIER KERNELS - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    fill_fixed();
+    fill_float();
+
+    test_fixed_exact();
+    test_float();
+    test_tails();
+    test_throughput();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
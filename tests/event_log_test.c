@@ -0,0 +1,559 @@
+/*
+ * event_log_test.c - Unit Tests for the Hash-Chained Event Log
+ *
+ * Tests:
+ *   1. Append, iterate and chain links (in memory)
+ *   2. Parallel verification agrees for any thread count and tile size
+ *   3. Tampering: edited payload / link, dropped record, truncated tail
+ *   4. Log files: reopen continues the chain, damaged files are refused,
+ *      a failed write stops further appends
+ *   5. Simulation records: steps, digests and resets match a replay
+ *   6. Verification throughput on a long chain, in memory and streamed
+ *      from a file
+ *
+ * Compile with:
+ *   gcc -o event_log_test event_log_test.c ../src/core/event_log.c \
+ *       ../src/core/replay.c ../src/core/rollback.c \
+ *       ../src/core/thread_pool.c ../src/core/step_async.c \
+ *       ../src/core/state_shm.c ../src/core/openmetrics.c \
+ *       ../src/core/mem_stats.c ../src/core/phase_timers.c \
+ *       ../src/core/trace.c ../src/core/state.c \
+ *       ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/barrier_field.c \
+ *       ../src/api/negentropic.c ../src/solvers/hydrology_richards_lite.c \
+ *       ../embedded/sha256.c ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "../src/core/include/event_log.h"
+#include "../src/core/include/mem_stats.h"
+#include "../src/core/state.h"
+#include "../src/api/negentropic.h"
+#include "../embedded/sha256.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define CONFIG "{\"num_entities\": 16, \"num_scalar_fields\": 256}"
+#define DT 0.01f
+
+static char g_path[64];
+
+/* Log of n records with payloads of varying length (0..40 bytes) */
+static NegEventLog* build_log(int n) {
+    NegEventLog* log = neg_event_log_create();
+    uint8_t payload[64];
+    for (int i = 0; i < n; i++) {
+        uint32_t len = (uint32_t)(i % 41);
+        for (uint32_t j = 0; j < len; j++) payload[j] = (uint8_t)(i * 7 + j);
+        neg_event_log_append(log, NEG_EVENT_HOST + (uint32_t)(i % 3), (uint64_t)i / 2,
+                             (uint64_t)i * 1000, payload, len);
+    }
+    return log;
+}
+
+/* Byte offset of record index in a log */
+static size_t record_offset(const uint8_t* data, size_t len, uint64_t index) {
+    size_t offset = 0;
+    for (uint64_t i = 0; i < index; i++) neg_event_log_next(data, len, &offset, NULL);
+    return offset;
+}
+
+static int write_file(const char* path, const uint8_t* data, size_t len) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return 0;
+    int ok = len == 0 || fwrite(data, len, 1, f) == 1;
+    fclose(f);
+    return ok;
+}
+
+/* ========================================================================
+ * TEST 1: APPEND AND ITERATE
+ * ======================================================================== */
+
+static void test_append(void) {
+    printf("\n[TEST 1] Append, iterate and chain links\n");
+
+    uint8_t zeros[NEG_EVENT_HASH_BYTES] = { 0 };
+    uint8_t head[NEG_EVENT_HASH_BYTES];
+    NegEventLog* log = neg_event_log_create();
+    neg_event_log_head(log, head);
+    TEST_ASSERT(log && neg_event_log_count(log) == 0 && memcmp(head, zeros, sizeof(head)) == 0,
+                "Empty log: no records, zero head");
+
+    TEST_ASSERT(neg_event_log_append(log, NEG_EVENT_INTERVENTION, 3, 30000, "abc", 3) == NEG_EVENT_OK &&
+                neg_event_log_append(log, NEG_EVENT_PARAMETER, 4, 40000, NULL, 0) == NEG_EVENT_OK,
+                "Records appended");
+    TEST_ASSERT(neg_event_log_append(log, NEG_EVENT_HOST, 0, 0, NULL, 5) == NEG_EVENT_CORRUPT,
+                "Payload length without payload rejected");
+
+    size_t len;
+    const uint8_t* data = neg_event_log_data(log, &len);
+    TEST_ASSERT(len == NEG_EVENT_RECORD_BYTES(3) + NEG_EVENT_RECORD_BYTES(0),
+                "Record sizes follow the layout");
+    TEST_ASSERT(memcmp(data, NEG_EVENT_MAGIC, 4) == 0, "Records start with the magic");
+
+    NegEventRecord a, b;
+    size_t offset = 0;
+    int r1 = neg_event_log_next(data, len, &offset, &a);
+    int r2 = neg_event_log_next(data, len, &offset, &b);
+    int r3 = neg_event_log_next(data, len, &offset, NULL);
+    TEST_ASSERT(r1 == 1 && r2 == 1 && r3 == 0 && offset == len, "Iteration visits both records");
+    TEST_ASSERT(a.type == NEG_EVENT_INTERVENTION && a.seq == 0 && a.step == 3 &&
+                a.time_us == 30000 && a.payload_len == 3 && memcmp(a.payload, "abc", 3) == 0,
+                "Fields round-trip");
+    TEST_ASSERT(memcmp(a.prev_hash, zeros, sizeof(zeros)) == 0 &&
+                memcmp(b.prev_hash, a.hash, NEG_EVENT_HASH_BYTES) == 0 && b.seq == 1,
+                "Each record links to the one before it");
+
+    uint8_t expected[NEG_EVENT_HASH_BYTES];
+    sha256(data, NEG_EVENT_HEADER_BYTES + 3, expected);
+    neg_event_log_head(log, head);
+    TEST_ASSERT(memcmp(a.hash, expected, sizeof(expected)) == 0 &&
+                memcmp(head, b.hash, sizeof(head)) == 0,
+                "Hash covers header and payload; head is the last hash");
+
+    NegEventVerify v;
+    TEST_ASSERT(neg_event_log_verify(data, len, NULL, &v) == NEG_EVENT_OK &&
+                v.records == 2 && v.first_bad == -1 && v.valid_bytes == len,
+                "Serial verification accepts the log");
+    TEST_ASSERT(neg_event_log_verify(NULL, 0, NULL, &v) == NEG_EVENT_OK && v.records == 0,
+                "Empty log verifies");
+
+    neg_event_log_close(log);
+}
+
+/* ========================================================================
+ * TEST 2: PARALLEL VERIFICATION
+ * ======================================================================== */
+
+static void test_parallel(void) {
+    printf("\n[TEST 2] Verification is independent of threads and tiles\n");
+
+    NegEventLog* log = build_log(5000);
+    size_t len;
+    const uint8_t* data = neg_event_log_data(log, &len);
+    uint8_t head[NEG_EVENT_HASH_BYTES];
+    neg_event_log_head(log, head);
+
+    static const uint32_t threads[] = { 1, 2, 4 };
+    static const uint32_t tiles[] = { 0, 1, 15, 16, 17, 333, 10000 };
+    int ok = 1;
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        for (size_t s = 0; s < sizeof(tiles) / sizeof(tiles[0]); s++) {
+            NegPoolConfig cfg;
+            neg_pool_config_default(&cfg);
+            cfg.threads = threads[t];
+            cfg.tile_size = tiles[s];
+            NegEventVerify v;
+            if (neg_event_log_verify(data, len, &cfg, &v) != NEG_EVENT_OK || v.records != 5000 ||
+                v.valid_bytes != len || memcmp(v.head, head, sizeof(head)) != 0) {
+                ok = 0;
+            }
+        }
+    }
+    TEST_ASSERT(ok, "3 thread counts x 7 tile sizes verify 5000 records");
+
+    /* Damage record 3210: every configuration names it */
+    uint8_t* copy = (uint8_t*)malloc(len);
+    memcpy(copy, data, len);
+    size_t at = record_offset(copy, len, 3210);
+    copy[at + 20] ^= 1;
+    ok = 1;
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        for (size_t s = 0; s < sizeof(tiles) / sizeof(tiles[0]); s++) {
+            NegPoolConfig cfg;
+            neg_pool_config_default(&cfg);
+            cfg.threads = threads[t];
+            cfg.tile_size = tiles[s];
+            NegEventVerify v;
+            if (neg_event_log_verify(copy, len, &cfg, &v) != NEG_EVENT_CORRUPT ||
+                v.first_bad != 3210 || v.records != 3210 || v.valid_bytes != at) {
+                ok = 0;
+            }
+        }
+    }
+    TEST_ASSERT(ok, "Every configuration reports the same first bad record");
+
+    free(copy);
+    neg_event_log_close(log);
+}
+
+/* ========================================================================
+ * TEST 3: TAMPERING
+ * ======================================================================== */
+
+static void test_tamper(void) {
+    printf("\n[TEST 3] Tampering breaks the chain at the right record\n");
+
+    NegEventLog* log = build_log(100);
+    size_t len;
+    const uint8_t* data = neg_event_log_data(log, &len);
+    uint8_t* copy = (uint8_t*)malloc(len);
+    NegPoolConfig cfg;
+    neg_pool_config_default(&cfg);
+    cfg.threads = 4;
+    cfg.tile_size = 8;
+    NegEventVerify v;
+
+    /* Payload edit */
+    memcpy(copy, data, len);
+    size_t at = record_offset(copy, len, 40);
+    copy[at + NEG_EVENT_HEADER_BYTES] ^= 0x80;
+    TEST_ASSERT(neg_event_log_verify(copy, len, &cfg, &v) == NEG_EVENT_CORRUPT && v.first_bad == 40,
+                "Edited payload: record 40");
+
+    /* Re-hashed edit: record 40 is self-consistent, record 41's link breaks */
+    uint32_t plen = (uint32_t)(40 % 41);
+    sha256(copy + at, NEG_EVENT_HEADER_BYTES + plen, copy + at + NEG_EVENT_HEADER_BYTES + plen);
+    TEST_ASSERT(neg_event_log_verify(copy, len, &cfg, &v) == NEG_EVENT_CORRUPT && v.first_bad == 41,
+                "Edited and re-hashed payload: link from record 41");
+
+    /* Dropped record */
+    memcpy(copy, data, len);
+    size_t start = record_offset(copy, len, 70);
+    size_t end = record_offset(copy, len, 71);
+    memmove(copy + start, copy + end, len - end);
+    TEST_ASSERT(neg_event_log_verify(copy, len - (end - start), &cfg, &v) == NEG_EVENT_CORRUPT &&
+                v.first_bad == 70 && v.records == 70,
+                "Dropped record: sequence breaks at 70");
+
+    /* Type change */
+    memcpy(copy, data, len);
+    copy[record_offset(copy, len, 0) + 4] ^= 1;
+    TEST_ASSERT(neg_event_log_verify(copy, len, &cfg, &v) == NEG_EVENT_CORRUPT && v.first_bad == 0 &&
+                v.records == 0 && v.valid_bytes == 0,
+                "Edited header of record 0");
+
+    /* Truncated tail */
+    memcpy(copy, data, len);
+    size_t last = record_offset(copy, len, 99);
+    TEST_ASSERT(neg_event_log_verify(copy, len - 5, &cfg, &v) == NEG_EVENT_TRUNCATED &&
+                v.first_bad == 99 && v.valid_bytes == last,
+                "Torn last record: truncated, 99 intact");
+    TEST_ASSERT(neg_event_log_verify(copy, last + 2, &cfg, &v) == NEG_EVENT_TRUNCATED && v.records == 99,
+                "Torn magic: truncated");
+
+    /* Garbage length */
+    copy[at + 32] = 0xFF;
+    copy[at + 35] = 0xFF;
+    TEST_ASSERT(neg_event_log_verify(copy, len, &cfg, &v) == NEG_EVENT_CORRUPT && v.first_bad == 40,
+                "Impossible payload length: record 40");
+
+    free(copy);
+    neg_event_log_close(log);
+}
+
+/* ========================================================================
+ * TEST 4: LOG FILES
+ * ======================================================================== */
+
+static void test_files(void) {
+    printf("\n[TEST 4] Log files\n");
+
+    remove(g_path);
+    int status;
+    NegEventLog* log = neg_event_log_open(g_path, NULL, &status);
+    TEST_ASSERT(log && status == NEG_EVENT_OK, "New file opened");
+    for (int i = 0; i < 10; i++) neg_event_log_append(log, NEG_EVENT_HOST, (uint64_t)i, 0, &i, sizeof(i));
+    size_t n;
+    TEST_ASSERT(neg_event_log_data(log, &n) == NULL && n == 0, "File logs expose no bytes");
+    uint8_t head[NEG_EVENT_HASH_BYTES];
+    neg_event_log_head(log, head);
+    neg_event_log_close(log);
+
+    log = neg_event_log_open(g_path, NULL, &status);
+    uint8_t reopened[NEG_EVENT_HASH_BYTES];
+    neg_event_log_head(log, reopened);
+    TEST_ASSERT(log && neg_event_log_count(log) == 10 && memcmp(head, reopened, sizeof(head)) == 0,
+                "Reopen resumes count and head");
+    for (int i = 10; i < 15; i++) neg_event_log_append(log, NEG_EVENT_HOST, (uint64_t)i, 0, &i, sizeof(i));
+    neg_event_log_close(log);
+
+    NegEventVerify v;
+    TEST_ASSERT(neg_event_log_verify_file(g_path, NULL, &v) == NEG_EVENT_OK && v.records == 15,
+                "Chain continues across sessions");
+    TEST_ASSERT(neg_verify_event_log(g_path, 2) == 15, "neg_verify_event_log() counts records");
+
+    /* Damage the file: refused for append, reported by the API */
+    size_t len;
+    uint8_t* data = neg_event_log_load(g_path, &len, &status);
+    data[record_offset(data, len, 12) + NEG_EVENT_HEADER_BYTES] ^= 1;
+    write_file(g_path, data, len);
+    neg_mem_free(data);
+
+    log = neg_event_log_open(g_path, NULL, &status);
+    TEST_ASSERT(!log && status == NEG_EVENT_CORRUPT, "Damaged file not appended to");
+    TEST_ASSERT(neg_verify_event_log(g_path, 1) == NEG_ERROR_INVALID_STATE &&
+                strstr(neg_get_last_error(), "record 12") != NULL,
+                "API names the first bad record");
+    TEST_ASSERT(neg_verify_event_log("/nonexistent/dir/log.nevt", 1) == NEG_ERROR_INVALID_CONFIG,
+                "Unreadable file rejected");
+
+    /* A write cut short by the file size limit: torn tail, log latched */
+    remove(g_path);
+    log = neg_event_log_open(g_path, NULL, &status);
+    for (int i = 0; i < 5; i++) neg_event_log_append(log, NEG_EVENT_HOST, (uint64_t)i, 0, &i, sizeof(i));
+    neg_event_log_flush(log);
+    struct rlimit saved, limited;
+    getrlimit(RLIMIT_FSIZE, &saved);
+    limited = saved;
+    limited.rlim_cur = 5 * NEG_EVENT_RECORD_BYTES(sizeof(int)) + 100;
+    signal(SIGXFSZ, SIG_IGN);
+    setrlimit(RLIMIT_FSIZE, &limited);
+    static uint8_t big[8192];
+    int rc = neg_event_log_append(log, NEG_EVENT_HOST, 5, 0, big, sizeof(big));
+    if (rc == NEG_EVENT_OK) rc = neg_event_log_flush(log);
+    setrlimit(RLIMIT_FSIZE, &saved);
+    TEST_ASSERT(rc == NEG_EVENT_IO_ERROR, "Short write reported");
+    int five = 5;
+    TEST_ASSERT(neg_event_log_append(log, NEG_EVENT_HOST, 5, 0, &five, sizeof(five)) == NEG_EVENT_IO_ERROR &&
+                neg_event_log_flush(log) == NEG_EVENT_IO_ERROR,
+                "Nothing appended after a failed write");
+    neg_event_log_close(log);
+    TEST_ASSERT(neg_event_log_verify_file(g_path, NULL, &v) == NEG_EVENT_TRUNCATED && v.records == 5,
+                "File holds the intact records and one torn tail");
+
+    remove(g_path);
+}
+
+/* ========================================================================
+ * TEST 5: SIMULATION RECORDS
+ * ======================================================================== */
+
+static void test_simulation(void) {
+    printf("\n[TEST 5] Steps, digests and resets\n");
+
+    remove(g_path);
+    void* sim = neg_create(CONFIG);
+    size_t size = neg_get_state_binary_size(sim);
+    uint8_t* initial = (uint8_t*)malloc(size);
+    neg_get_state_binary(sim, initial, size);
+
+    TEST_ASSERT(neg_log_event(sim, NEG_EVENT_INTERVENTION, "x", 1) == NEG_ERROR_INVALID_STATE,
+                "Host events need an open log");
+    TEST_ASSERT(neg_open_event_log(sim, g_path, 4, 0) == NEG_SUCCESS, "Log opened on the simulation");
+    TEST_ASSERT(neg_log_event(sim, NEG_EVENT_STEP, NULL, 0) == NEG_ERROR_INVALID_CONFIG &&
+                neg_log_event(sim, NEG_EVENT_DIGEST, NULL, 0) == NEG_ERROR_INVALID_CONFIG,
+                "Simulation record types reserved");
+
+    neg_step(sim, DT);
+    neg_step_n(sim, DT, 5);
+    float rain = 2.5f;
+    neg_log_event(sim, NEG_EVENT_PARAMETER, &rain, sizeof(rain));
+    neg_step_async(sim, 0.0f, 6);
+    neg_wait(sim, 0);
+    neg_reset_from_binary(sim, initial, size);
+    neg_log_event(sim, NEG_EVENT_HOST + 1, NULL, 0);
+    TEST_ASSERT(neg_close_event_log(sim) == NEG_SUCCESS, "Log closed");
+    neg_step(sim, DT);                  /* Not recorded */
+
+    size_t len;
+    int status;
+    uint8_t* data = neg_event_log_load(g_path, &len, &status);
+    int steps = 0, digests = 0, params = 0, resets = 0, hosts = 0, ordered = 1;
+    int digests_match = 1;
+    uint64_t last_step = 0;
+
+    /* Replay the STEP records on a twin and compare every digest */
+    void* twin = neg_create(CONFIG);
+    NegEventRecord rec;
+    size_t offset = 0;
+    while (neg_event_log_next(data, len, &offset, &rec) == 1) {
+        if (rec.type != NEG_EVENT_RESET && rec.step < last_step) ordered = 0;
+        last_step = rec.step;
+        switch (rec.type) {
+            case NEG_EVENT_STEP: {
+                float dt;
+                memcpy(&dt, rec.payload, sizeof(dt));
+                neg_step(twin, dt);
+                steps++;
+                break;
+            }
+            case NEG_EVENT_DIGEST: {
+                uint8_t digest[NEG_EVENT_HASH_BYTES];
+                neg_event_state_digest(twin, digest);
+                if (rec.step % 4 != 0 || memcmp(digest, rec.payload, sizeof(digest)) != 0) {
+                    digests_match = 0;
+                }
+                digests++;
+                break;
+            }
+            case NEG_EVENT_PARAMETER:
+                params += rec.payload_len == sizeof(float) && rec.step == 6;
+                break;
+            case NEG_EVENT_RESET: {
+                uint8_t digest[NEG_EVENT_HASH_BYTES];
+                sha256(initial, size, digest);
+                resets += memcmp(digest, rec.payload, sizeof(digest)) == 0;
+                break;
+            }
+            default:
+                hosts += rec.type == NEG_EVENT_HOST + 1;
+                break;
+        }
+    }
+    TEST_ASSERT(steps == 12 && params == 1 && resets == 1 && hosts == 1,
+                "Sync, batched and async steps, host events and the reset recorded");
+    TEST_ASSERT(digests == 3 && digests_match, "Digests every 4 steps match a replay");
+    TEST_ASSERT(ordered, "Step stamps never go backwards before the reset");
+    TEST_ASSERT(neg_verify_event_log(g_path, 0) == 18, "Simulation log verifies");
+
+    /* Reopening continues the chain */
+    TEST_ASSERT(neg_open_event_log(sim, g_path, 0, 0) == NEG_SUCCESS, "Simulation log reopened");
+    neg_step(sim, DT);
+    neg_destroy(sim);
+    TEST_ASSERT(neg_verify_event_log(g_path, 1) == 19, "neg_destroy() closes the log");
+
+    neg_mem_free(data);
+    neg_destroy(twin);
+    free(initial);
+    remove(g_path);
+}
+
+/* ========================================================================
+ * TEST 6: THROUGHPUT
+ * ======================================================================== */
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void test_throughput(void) {
+    printf("\n[TEST 6] Verification throughput\n");
+
+    enum { RECORDS = 200000 };
+    NegEventLog* log = neg_event_log_create();
+    uint8_t payload[8] = { 0 };
+    for (uint32_t i = 0; i < RECORDS; i++) {
+        memcpy(payload, &i, sizeof(i));
+        neg_event_log_append(log, NEG_EVENT_STEP, i, (uint64_t)i * 10000, payload, sizeof(payload));
+    }
+    size_t len;
+    const uint8_t* data = neg_event_log_data(log, &len);
+
+    NegPoolConfig cfg;
+    neg_pool_config_default(&cfg);
+    cfg.threads = 0;
+    NegEventVerify v;
+    double t0 = now_sec();
+    int status = neg_event_log_verify(data, len, &cfg, &v);
+    double elapsed = now_sec() - t0;
+    printf("  %d records (%.1f MB) in %.3f s: %.0f records/s, %.1f MB/s (%d threads)\n",
+           RECORDS, (double)len / 1e6, elapsed, RECORDS / elapsed,
+           (double)len / 1e6 / elapsed, neg_pool_slots(&cfg));
+    TEST_ASSERT(status == NEG_EVENT_OK && v.records == RECORDS, "Long chain verifies");
+    neg_event_log_close(log);
+
+    /* File spanning many segments, with one record larger than a segment */
+    enum { BIG = 20 * 1024 * 1024 };
+    uint8_t* big = (uint8_t*)malloc(BIG);
+    for (uint32_t i = 0; i < BIG; i++) big[i] = (uint8_t)(i * 31u);
+    log = neg_event_log_create();
+    for (uint32_t i = 0; i < RECORDS; i++) {
+        memcpy(payload, &i, sizeof(i));
+        neg_event_log_append(log, NEG_EVENT_STEP, i, 0, payload, sizeof(payload));
+        if (i == RECORDS / 2) neg_event_log_append(log, NEG_EVENT_KEYFRAME, i, 0, big, BIG);
+    }
+    data = neg_event_log_data(log, &len);
+    write_file(g_path, data, len);
+    uint8_t head[NEG_EVENT_HASH_BYTES];
+    neg_event_log_head(log, head);
+
+    t0 = now_sec();
+    status = neg_event_log_verify_file(g_path, &cfg, &v);
+    elapsed = now_sec() - t0;
+    printf("  %.1f MB file streamed in %.3f s: %.1f MB/s\n",
+           (double)len / 1e6, elapsed, (double)len / 1e6 / elapsed);
+    TEST_ASSERT(status == NEG_EVENT_OK && v.records == RECORDS + 1 && v.valid_bytes == len &&
+                memcmp(v.head, head, sizeof(head)) == 0,
+                "File verified segment by segment, oversized record included");
+
+    uint8_t* copy = (uint8_t*)malloc(len);
+    size_t big_at = record_offset(data, len, RECORDS / 2 + 1);
+    memcpy(copy, data, len);
+    copy[big_at + NEG_EVENT_HEADER_BYTES + BIG / 2] ^= 1;
+    write_file(g_path, copy, len);
+    TEST_ASSERT(neg_event_log_verify_file(g_path, &cfg, &v) == NEG_EVENT_CORRUPT &&
+                v.first_bad == RECORDS / 2 + 1 && v.valid_bytes == big_at,
+                "Damage inside the oversized record found");
+
+    memcpy(copy, data, len);
+    size_t late = record_offset(data, len, RECORDS - 1000);
+    copy[late + NEG_EVENT_HEADER_BYTES] ^= 1;
+    write_file(g_path, copy, len);
+    TEST_ASSERT(neg_event_log_verify_file(g_path, &cfg, &v) == NEG_EVENT_CORRUPT &&
+                v.first_bad == RECORDS - 1000 && v.valid_bytes == late,
+                "Damage in a later segment found at the right record");
+
+    write_file(g_path, data, big_at + BIG / 2);
+    TEST_ASSERT(neg_event_log_verify_file(g_path, &cfg, &v) == NEG_EVENT_TRUNCATED &&
+                v.records == RECORDS / 2 + 1 && v.valid_bytes == big_at,
+                "Log cut inside the oversized record is a torn tail");
+
+    remove(g_path);
+    free(copy);
+    free(big);
+    neg_event_log_close(log);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("HASH-CHAINED EVENT LOG - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    snprintf(g_path, sizeof(g_path), "/tmp/neg_event_log_test_%ld.nevt", (long)getpid());
+
+    test_append();
+    test_parallel();
+    test_tamper();
+    test_files();
+    test_simulation();
+    test_throughput();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
@@ -0,0 +1,262 @@
+/*
+ * fixed_math_batch_test.c - Unit Tests for Batch Fixed-Point Math Kernels
+ *
+ * Tests for:
+ *   1. fixed_*_n() bit-identical to the scalar functions (edge values,
+ *      random magnitudes, every tail length, in-place)
+ *   2. Accuracy of the integer-only scalar functions vs libm
+ *   3. Throughput of batch vs per-element calls (informational)
+ *
+ * Compile with:
+ *   gcc -o fixed_math_batch_test fixed_math_batch_test.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/fixed_math_batch.c \
+ *       -lm -std=c99
+ *
+ * Author: ClaudeCode (batch fixed-point math)
+ * Version: 1.0
+ */
+
+#include "../src/core/math/fixed_math.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define N_RANDOM 200000
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 161803u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+/** Random value with a random magnitude (1 LSB .. INT32_MAX, either sign) */
+static fixed_t random_fixed(void) {
+    uint32_t r = lcg_next();
+    int32_t v = (int32_t)(lcg_next() >> (1 + (r % 31)));
+    return (r & 0x80000000u) ? -v : v;
+}
+
+static const fixed_t edge_values[] = {
+    0, 1, 2, 3, -1, 255, 256, FRACUNIT - 1, FRACUNIT, FRACUNIT + 1, 2 * FRACUNIT,
+    RECIPROCAL_NORM_LO - 1, RECIPROCAL_NORM_LO, RECIPROCAL_NORM_HI - 1, RECIPROCAL_NORM_HI,
+    SQRT_NORM_LO - 1, SQRT_NORM_LO, SQRT_NORM_HI - 1, SQRT_NORM_HI,
+    SQRT_MAX_VAL, 0x10000000, 0x40000000, INT32_MAX - 1, INT32_MAX,
+    -FRACUNIT, -2 * FRACUNIT, -RECIPROCAL_NORM_HI, INT32_MIN + 1, INT32_MIN
+};
+#define N_EDGE ((int)(sizeof(edge_values) / sizeof(edge_values[0])))
+
+static fixed_t inputs[N_RANDOM];
+static fixed_t batch_out[N_RANDOM];
+
+typedef void (*batch_fn)(const fixed_t*, fixed_t*, int);
+typedef fixed_t (*scalar_fn)(fixed_t);
+
+static int matches_scalar(batch_fn batch, scalar_fn scalar, const fixed_t* x, int n) {
+    batch(x, batch_out, n);
+    for (int i = 0; i < n; i++) {
+        if (batch_out[i] != scalar(x[i])) {
+            printf("    mismatch at x=%d: batch %d, scalar %d\n",
+                   (int)x[i], (int)batch_out[i], (int)scalar(x[i]));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ========================================================================
+ * TEST 1: Bit-Exactness vs Scalar
+ * ======================================================================== */
+
+static void check_bit_exact(const char* name, batch_fn batch, scalar_fn scalar) {
+    char msg[128];
+    int ok = 1;
+
+    /* Edge values in every lane position */
+    for (int shift = 0; shift < N_EDGE && ok; shift++) {
+        fixed_t rotated[N_EDGE];
+        for (int i = 0; i < N_EDGE; i++) {
+            rotated[i] = edge_values[(i + shift) % N_EDGE];
+        }
+        ok = matches_scalar(batch, scalar, rotated, N_EDGE);
+    }
+    snprintf(msg, sizeof(msg), "%s: edge values bit-identical in every lane", name);
+    TEST_ASSERT(ok, msg);
+
+    ok = matches_scalar(batch, scalar, inputs, N_RANDOM);
+    snprintf(msg, sizeof(msg), "%s: %d random magnitudes bit-identical", name, N_RANDOM);
+    TEST_ASSERT(ok, msg);
+
+    /* Every tail length and misalignment */
+    for (int n = 0; n <= 19 && ok; n++) {
+        for (int off = 0; off < 3 && ok; off++) {
+            ok = matches_scalar(batch, scalar, inputs + off, n);
+        }
+    }
+    snprintf(msg, sizeof(msg), "%s: tails n = 0..19, unaligned", name);
+    TEST_ASSERT(ok, msg);
+
+    /* In place */
+    fixed_t buf[37], ref[37];
+    for (int i = 0; i < 37; i++) {
+        buf[i] = inputs[1000 + i];
+        ref[i] = scalar(buf[i]);
+    }
+    batch(buf, buf, 37);
+    snprintf(msg, sizeof(msg), "%s: in-place (out == x)", name);
+    TEST_ASSERT(memcmp(buf, ref, sizeof(buf)) == 0, msg);
+}
+
+void test_bit_exact(void) {
+    printf("\n[TEST 1] Batch vs Scalar Bit-Exactness (%d lanes)\n", fixed_math_batch_lanes());
+
+    check_bit_exact("fixed_reciprocal_n", fixed_reciprocal_n, fixed_reciprocal);
+    check_bit_exact("fixed_sqrt_n", fixed_sqrt_n, fixed_sqrt);
+    check_bit_exact("fixed_inv_sqrt_n", fixed_inv_sqrt_n, fixed_inv_sqrt);
+
+    fixed_t b[N_RANDOM / 4];
+    int ok = 1;
+    for (int i = 0; i < N_RANDOM / 4; i++) {
+        b[i] = (i % 97 == 0) ? 0 : inputs[N_RANDOM / 2 + i];
+    }
+    fixed_div_safe_n(inputs, b, batch_out, N_RANDOM / 4);
+    for (int i = 0; i < N_RANDOM / 4; i++) {
+        if (batch_out[i] != fixed_div_safe(inputs[i], b[i])) {
+            ok = 0;
+        }
+    }
+    TEST_ASSERT(ok, "fixed_div_safe_n: matches fixed_div_safe (incl. b = 0)");
+}
+
+/* ========================================================================
+ * TEST 2: Accuracy (integer-only scalar functions)
+ * ======================================================================== */
+
+void test_accuracy(void) {
+    printf("\n[TEST 2] Accuracy vs libm\n");
+    double recip_lsb = 0.0, inv_lsb = 0.0, sqrt_rel = 0.0, inv_rel_small = 0.0;
+    int sqrt_ok = 1;
+
+    /* ~45k points, geometric spacing over the whole positive range */
+    for (int64_t v = 1; v <= INT32_MAX; v += (v >> 12) + 1) {
+        double x = (double)v / FRACUNIT;
+        double s = sqrt(x);
+        double e;
+
+        e = fabs(fixed_sqrt((fixed_t)v) - FRACUNIT * s);
+        if (e > 1.0 + 2e-5 * FRACUNIT * s) sqrt_ok = 0;
+        if (v >= FRACUNIT && e / (FRACUNIT * s) > sqrt_rel) sqrt_rel = e / (FRACUNIT * s);
+
+        e = fabs(fixed_inv_sqrt((fixed_t)v) - FRACUNIT / s);
+        if (v >= FRACUNIT) {
+            if (e > inv_lsb) inv_lsb = e;
+            e = fabs(fixed_reciprocal((fixed_t)v) - FRACUNIT / x);
+            if (e > recip_lsb) recip_lsb = e;
+        } else if (e / (FRACUNIT / s) > inv_rel_small) {
+            inv_rel_small = e / (FRACUNIT / s);
+        }
+    }
+
+    printf("    reciprocal (x >= 1): max %.2f LSB\n", recip_lsb);
+    printf("    sqrt (x >= 1):       max %.2e relative\n", sqrt_rel);
+    printf("    inv_sqrt (x >= 1):   max %.2f LSB\n", inv_lsb);
+    printf("    inv_sqrt (x < 1):    max %.2e relative\n", inv_rel_small);
+    TEST_ASSERT(recip_lsb < 2.0, "Reciprocal within 2 LSB for x >= 1.0");
+    TEST_ASSERT(sqrt_ok, "Sqrt within 1 LSB + 2e-5 relative error");
+    TEST_ASSERT(inv_lsb < 2.0, "Inverse sqrt within 2 LSB for x >= 1.0");
+    TEST_ASSERT(inv_rel_small < 2e-5, "Inverse sqrt below 2e-5 relative error for x < 1.0");
+
+    TEST_ASSERT(fixed_sqrt(4 * FRACUNIT) == 2 * FRACUNIT &&
+                fixed_inv_sqrt(4 * FRACUNIT) == FRACUNIT / 2 &&
+                fixed_reciprocal(4 * FRACUNIT) == FRACUNIT / 4 &&
+                fixed_inv_sqrt(1) == 256 * FRACUNIT,
+                "Exact at powers of two (incl. 1/sqrt(1 LSB) = 256.0)");
+    TEST_ASSERT(fixed_sqrt(0) == 0 && fixed_sqrt(-FRACUNIT) == 0 &&
+                fixed_inv_sqrt(0) == 0 && fixed_reciprocal(0) == 0,
+                "Zero / negative guards");
+}
+
+/* ========================================================================
+ * TEST 3: Throughput (informational)
+ * ======================================================================== */
+
+void test_throughput(void) {
+    printf("\n[TEST 3] Throughput (informational)\n");
+    const int reps = 50;
+    volatile fixed_t sink = 0;
+
+    for (int i = 0; i < N_RANDOM; i++) {
+        inputs[i] = (fixed_t)(lcg_next() >> (1 + lcg_next() % 24));  /* positive, mixed scale */
+    }
+
+    clock_t t0 = clock();
+    for (int r = 0; r < reps; r++) {
+        for (int i = 0; i < N_RANDOM; i++) {
+            batch_out[i] = fixed_inv_sqrt(inputs[i]);
+        }
+        sink += batch_out[r];
+    }
+    clock_t t1 = clock();
+    for (int r = 0; r < reps; r++) {
+        fixed_inv_sqrt_n(inputs, batch_out, N_RANDOM);
+        sink += batch_out[r];
+    }
+    clock_t t2 = clock();
+
+    double per_scalar = (double)(t1 - t0) / CLOCKS_PER_SEC / ((double)reps * N_RANDOM) * 1e9;
+    double per_batch = (double)(t2 - t1) / CLOCKS_PER_SEC / ((double)reps * N_RANDOM) * 1e9;
+    printf("    fixed_inv_sqrt:   %.2f ns/element\n", per_scalar);
+    printf("    fixed_inv_sqrt_n: %.2f ns/element (%.1fx)\n", per_batch,
+           per_batch > 0.0 ? per_scalar / per_batch : 0.0);
+    (void)sink;
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("BATCH FIXED-POINT MATH KERNELS - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    for (int i = 0; i < N_RANDOM; i++) {
+        inputs[i] = random_fixed();
+    }
+
+    test_bit_exact();
+    test_accuracy();
+    test_throughput();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
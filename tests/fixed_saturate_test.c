@@ -0,0 +1,212 @@
+/*
+ * fixed_saturate_test.c - Unit Tests for Saturating Fixed-Point Arithmetic
+ *
+ * Tests for:
+ *   1. fixed_{add,sub,mul,div}_sat() match clamped 64-bit reference math
+ *   2. Sticky bits: raised only on saturation / division by zero,
+ *      accumulate until taken, local accumulators via fixed_clamp64()
+ *   3. state_step() merges only the sticky bits raised during the step
+ *
+ * Compile with:
+ *   gcc -o fixed_saturate_test fixed_saturate_test.c \
+ *       ../src/core/state.c ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/mem_stats.c ../src/core/thread_pool.c \
+ *       ../src/core/phase_timers.c ../src/core/math/fixed_math.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I../embedded -pthread -lm -std=c99
+ *
+ * Author: ClaudeCode (saturating fixed-point)
+ * Version: 1.0
+ */
+
+#include "../src/core/state.h"
+#include "../include/fixed_saturate.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define N_RANDOM 200000
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 314159u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+/** Random value with a random magnitude, either sign */
+static int32_t random_fixed(void) {
+    uint32_t r = lcg_next();
+    int32_t v = (int32_t)(lcg_next() >> (1 + (r % 31)));
+    return (r & 0x80000000u) ? -v : v;
+}
+
+/* Branchy reference: clamp and report */
+static int32_t ref_clamp(int64_t r, int* clamped) {
+    *clamped = (r > INT32_MAX || r < INT32_MIN);
+    if (r > INT32_MAX) return INT32_MAX;
+    if (r < INT32_MIN) return INT32_MIN;
+    return (int32_t)r;
+}
+
+/* Same contract as fixed_div_safe() */
+static int32_t ref_div(int32_t a, int32_t b, int* clamped) {
+    if (b == 0) {
+        *clamped = 0;
+        return (a >= 0) ? INT32_MAX : INT32_MIN;
+    }
+    return ref_clamp((((int64_t)a) << 16) / b, clamped);
+}
+
+/* ========================================================================
+ * TEST 1: Results vs Reference
+ * ======================================================================== */
+
+void test_results(void) {
+    printf("\n[TEST 1] Saturating Ops vs Clamped 64-bit Reference\n");
+    int add_ok = 1, sub_ok = 1, mul_ok = 1, div_ok = 1, flag_ok = 1;
+
+    for (int i = 0; i < N_RANDOM; i++) {
+        int32_t a = random_fixed();
+        int32_t b = (i % 101 == 0) ? 0 : random_fixed();
+        int clamped;
+        uint32_t bits;
+
+        (void)fixed_sticky_take();
+        if (fixed_add_sat(a, b) != ref_clamp((int64_t)a + b, &clamped)) add_ok = 0;
+        bits = fixed_sticky_take();
+        if (bits != (clamped ? FIXED_STICKY_OVERFLOW : 0u)) flag_ok = 0;
+
+        if (fixed_sub_sat(a, b) != ref_clamp((int64_t)a - b, &clamped)) sub_ok = 0;
+        bits = fixed_sticky_take();
+        if (bits != (clamped ? FIXED_STICKY_OVERFLOW : 0u)) flag_ok = 0;
+
+        if (fixed_mul_sat(a, b) != ref_clamp(((int64_t)a * b) >> 16, &clamped)) mul_ok = 0;
+        bits = fixed_sticky_take();
+        if (bits != (clamped ? FIXED_STICKY_OVERFLOW : 0u)) flag_ok = 0;
+
+        if (fixed_div_sat(a, b) != ref_div(a, b, &clamped)) div_ok = 0;
+        bits = fixed_sticky_take();
+        if (bits != ((clamped ? FIXED_STICKY_OVERFLOW : 0u) |
+                     (b == 0 ? FIXED_STICKY_DIV_ZERO : 0u))) flag_ok = 0;
+    }
+
+    TEST_ASSERT(add_ok, "fixed_add_sat matches clamped a + b");
+    TEST_ASSERT(sub_ok, "fixed_sub_sat matches clamped a - b");
+    TEST_ASSERT(mul_ok, "fixed_mul_sat matches clamped (a * b) >> 16");
+    TEST_ASSERT(div_ok, "fixed_div_sat matches fixed_div_safe contract (incl. b = 0)");
+    TEST_ASSERT(flag_ok, "Sticky bits raised exactly when clamped / dividing by zero");
+
+    (void)fixed_sticky_take();
+    TEST_ASSERT(fixed_add_sat(INT32_MAX, 1) == INT32_MAX &&
+                fixed_sub_sat(INT32_MIN, 1) == INT32_MIN &&
+                fixed_mul_sat(INT32_MIN, INT32_MIN) == INT32_MAX &&
+                fixed_mul_sat(INT32_MAX, -2 * 65536) == INT32_MIN &&
+                fixed_div_sat(INT32_MIN, -1) == INT32_MAX &&
+                fixed_div_sat(-65536, 0) == INT32_MIN,
+                "Edge cases clamp toward the correct sign");
+    (void)fixed_sticky_take();
+}
+
+/* ========================================================================
+ * TEST 2: Sticky Accumulation
+ * ======================================================================== */
+
+void test_sticky(void) {
+    printf("\n[TEST 2] Sticky Accumulation\n");
+
+    (void)fixed_sticky_take();
+    int32_t acc = 0;
+    for (int i = 0; i < 1000; i++) {
+        acc = fixed_add_sat(acc, 1000 * 65536);
+    }
+    TEST_ASSERT(acc == INT32_MAX, "Running sum saturates instead of wrapping");
+    (void)fixed_div_sat(65536, 0);
+    (void)fixed_add_sat(1, 1);
+    TEST_ASSERT(fixed_sticky_take() == (FIXED_STICKY_OVERFLOW | FIXED_STICKY_DIV_ZERO),
+                "Bits persist across later in-range ops");
+    TEST_ASSERT(fixed_sticky_take() == 0, "fixed_sticky_take clears the accumulator");
+
+    uint32_t local = 0;
+    int32_t y = fixed_clamp64((int64_t)INT32_MAX + 5, &local);
+    TEST_ASSERT(y == INT32_MAX && local == FIXED_STICKY_OVERFLOW && fixed_sticky_take() == 0,
+                "Local accumulator leaves thread bits untouched");
+    fixed_sticky_raise(local);
+    TEST_ASSERT(fixed_sticky_take() == FIXED_STICKY_OVERFLOW, "fixed_sticky_raise publishes");
+}
+
+/* ========================================================================
+ * TEST 3: Step-Scoped Merge into NegErrorFlags
+ * ======================================================================== */
+
+void test_merge(void) {
+    printf("\n[TEST 3] state_step() Scopes Sticky Bits to the Step\n");
+
+    SimulationConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.num_entities = 4;
+    cfg.dt = 0.01f;
+    void* sim = state_create(&cfg);
+    NegErrorFlags flags;
+
+    (void)fixed_sticky_take();
+    state_step(sim, 0.0f);
+    state_get_error_flags(sim, &flags);
+    TEST_ASSERT(flags.total_errors == 0 && !flags.overflow, "Clean step leaves flags clear");
+
+    /* Clamps raised between steps (host-driven solver calls, another
+     * simulation on this thread) belong to no step */
+    (void)fixed_mul_sat(30000 * 65536, 30000 * 65536);
+    (void)fixed_div_sat(65536, 0);
+    state_step(sim, 0.0f);
+    state_get_error_flags(sim, &flags);
+    TEST_ASSERT(!flags.overflow && !flags.inf_detected && flags.total_errors == 0,
+                "Bits raised before the step are not merged into it");
+    TEST_ASSERT(fixed_sticky_take() == 0, "Accumulator consumed by the step");
+
+    state_destroy(sim);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("SATURATING FIXED-POINT ARITHMETIC - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_results();
+    test_sticky();
+    test_merge();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
@@ -0,0 +1,363 @@
+/*
+ * lambda_engine_test.c - Unit Tests for λ-Estimation and DLT Records
+ *
+ * Tests for:
+ *   1. SHA-256 against FIPS 180-4 test vectors
+ *   2. Multi-buffer SHA-256 vs scalar (mixed lengths, partial groups)
+ *   3. Fixed-point return error vs double-precision reference
+ *   4. Golden-section λ search on a trajectory with known optimum
+ *   5. Batch engine: T-BSP cells → DLT records → publish sink
+ *   6. Single-core throughput (cells/s)
+ *
+ * Compile with:
+ *   gcc -o lambda_engine_test lambda_engine_test.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       ../embedded/t_bsp.c ../embedded/sha256.c \
+ *       ../embedded/lambda_estimator.c ../embedded/record_lambda.c \
+ *       ../embedded/lambda_engine.c -I../embedded -lm -std=c99
+ *
+ * Author: ClaudeCode (DLT engine)
+ * Version: 1.0
+ */
+
+#include "../embedded/se3_edge.h"
+#include "../embedded/t_bsp.h"
+#include "../embedded/sha256.h"
+#include "../embedded/lambda_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static t_bsp_t g_bsp;
+static dlt_record_t g_records[MAX_CELLS];
+
+static uint32_t lcg_state = 2024u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static void hex_digest(const uint8_t d[32], char out[65]) {
+    for (int i = 0; i < 32; i++) {
+        sprintf(out + 2 * i, "%02x", d[i]);
+    }
+}
+
+/**
+ * Random planar pose increment: heading 0-360°, step up to ±50 m.
+ */
+static void random_pose(se3_pose_t* pose, uint32_t mmsi, uint32_t t) {
+    fixed_t heading = (fixed_t)(lcg_next() % (uint32_t)FIXED_360_DEG);
+    fixed_t east = (fixed_t)(lcg_next() % (100u << FRACBITS)) - INT_TO_FIXED(50);
+    fixed_t north = (fixed_t)(lcg_next() % (100u << FRACBITS)) - INT_TO_FIXED(50);
+    se3_pose_from_gps(east, north, 0, heading, t, mmsi, pose);
+}
+
+/**
+ * Double-precision reference of compute_return_error (planar poses).
+ */
+static double reference_return_error(const se3_pose_t* poses, int n, double lambda) {
+    double theta = 0.0, px = 0.0, py = 0.0, pz = 0.0;
+
+    for (int i = 0; i < n; i++) {
+        double yaw = atan2(FIXED_TO_FLOAT(poses[i].rotation[3]),
+                           FIXED_TO_FLOAT(poses[i].rotation[0]));
+        double x = lambda * FIXED_TO_FLOAT(poses[i].translation[0]);
+        double y = lambda * FIXED_TO_FLOAT(poses[i].translation[1]);
+        px += cos(theta) * x - sin(theta) * y;
+        py += sin(theta) * x + cos(theta) * y;
+        pz += lambda * FIXED_TO_FLOAT(poses[i].translation[2]);
+        theta += lambda * yaw;
+    }
+
+    double qx = cos(theta) * px - sin(theta) * py + px;
+    double qy = sin(theta) * px + cos(theta) * py + py;
+    double rot = 2.0 * sqrt(fmax(0.0, 1.0 - cos(2.0 * theta)));
+    return rot + sqrt(qx * qx + qy * qy + 4.0 * pz * pz);
+}
+
+/* ========================================================================
+ * TEST: SHA-256 vectors
+ * ======================================================================== */
+
+void test_sha256_vectors(void) {
+    printf("\n[TEST] SHA-256 FIPS 180-4 Vectors\n");
+
+    uint8_t d[32];
+    char hex[65];
+
+    sha256("", 0, d);
+    hex_digest(d, hex);
+    TEST_ASSERT(strcmp(hex, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855") == 0,
+                "SHA-256(\"\")");
+
+    sha256("abc", 3, d);
+    hex_digest(d, hex);
+    TEST_ASSERT(strcmp(hex, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad") == 0,
+                "SHA-256(\"abc\")");
+
+    const char* m448 = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    sha256(m448, strlen(m448), d);
+    hex_digest(d, hex);
+    TEST_ASSERT(strcmp(hex, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1") == 0,
+                "SHA-256(448-bit message, two padding blocks)");
+
+    /* Streaming in odd-sized chunks must match one-shot */
+    sha256_ctx_t ctx;
+    uint8_t d2[32];
+    sha256_init(&ctx);
+    for (size_t off = 0; off < strlen(m448); off += 7) {
+        size_t len = strlen(m448) - off < 7 ? strlen(m448) - off : 7;
+        sha256_update(&ctx, m448 + off, len);
+    }
+    sha256_final(&ctx, d2);
+    TEST_ASSERT(memcmp(d, d2, 32) == 0, "Streaming update matches one-shot");
+}
+
+/* ========================================================================
+ * TEST: Multi-buffer SHA-256
+ * ======================================================================== */
+
+void test_sha256_multi(void) {
+    printf("\n[TEST] Multi-Buffer SHA-256 (%d lanes)\n", sha256_multi_lanes());
+
+    enum { N = 21 };
+    static uint8_t data[N][300];
+    const uint8_t* msgs[N];
+    size_t lens[N];
+    uint8_t multi[N][32];
+
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < 300; j++) {
+            data[i][j] = (uint8_t)lcg_next();
+        }
+        msgs[i] = data[i];
+        /* Mix of boundary lengths: 0, 55, 56, 63, 64, 119, ... */
+        lens[i] = (size_t)((i * 55 + (i & 1) * 9) % 300);
+    }
+
+    sha256_multi(msgs, lens, N, multi);
+
+    int mismatches = 0;
+    for (int i = 0; i < N; i++) {
+        uint8_t single[32];
+        sha256(msgs[i], lens[i], single);
+        if (memcmp(single, multi[i], 32) != 0) {
+            mismatches++;
+        }
+    }
+    TEST_ASSERT(mismatches == 0, "21 mixed-length digests match scalar path");
+}
+
+/* ========================================================================
+ * TEST: Return error accuracy
+ * ======================================================================== */
+
+void test_return_error_accuracy(void) {
+    printf("\n[TEST] Fixed-Point Return Error vs Double Reference\n");
+
+    se3_pose_t poses[128];
+    for (int i = 0; i < 128; i++) {
+        random_pose(&poses[i], 1u, (uint32_t)i);
+    }
+
+    double worst = 0.0;
+    const double lambdas[] = { 0.1, 0.5, 0.618, 1.0, 1.5, 2.0 };
+    for (int k = 0; k < 6; k++) {
+        double ref = reference_return_error(poses, 128, lambdas[k]);
+        double got = FIXED_TO_FLOAT(compute_return_error(poses, 128, FLOAT_TO_FIXED((float)lambdas[k])));
+        double rel = fabs(got - ref) / (ref > 1.0 ? ref : 1.0);
+        if (rel > worst) {
+            worst = rel;
+        }
+    }
+    printf("    Worst relative error: %.2e\n", worst);
+    TEST_ASSERT(worst < 5e-3, "Return error within 0.5% of double reference");
+
+    /* Closed square (4 × 100 m legs, 90° turns): G = I at λ = 1 */
+    se3_pose_t square[4];
+    for (int i = 0; i < 4; i++) {
+        square[i].translation[0] = INT_TO_FIXED(100);
+        square[i].translation[1] = 0;
+        square[i].translation[2] = 0;
+        rotation_from_yaw(0x40000000u, square[i].rotation);
+    }
+    fixed_t err = compute_return_error(square, 4, FRACUNIT);
+    TEST_ASSERT(err < FLOAT_TO_FIXED(0.05f), "Closed square returns to identity at λ = 1");
+}
+
+/* ========================================================================
+ * TEST: λ search
+ * ======================================================================== */
+
+void test_lambda_search(void) {
+    printf("\n[TEST] Golden-Section λ Search\n");
+
+    /* Single 144° turn: doubled scaled yaw 288°·λ = 360° → λ* = 1.25 */
+    se3_pose_t pose;
+    se3_pose_identity(&pose);
+    rotation_from_yaw((uint32_t)(144.0 / 360.0 * 4294967296.0), pose.rotation);
+
+    fixed_t lambda = fast_lambda_estimate(&pose, 1, LAMBDA_EPSILON, 24);
+    printf("    λ* = %.4f (expected 1.25)\n", FIXED_TO_FLOAT(lambda));
+    TEST_ASSERT(fabs(FIXED_TO_FLOAT(lambda) - 1.25) < 0.01, "Recovers known optimum");
+
+    fixed_t err;
+    fixed_t published = lambda_estimate_with_error(&pose, 1, LAMBDA_EPSILON, LAMBDA_MAX_ITER, &err);
+    TEST_ASSERT(published >= LAMBDA_MIN && published <= LAMBDA_MAX, "Published λ within bracket");
+    TEST_ASSERT(err < FLOAT_TO_FIXED(0.1f), "Return error small at optimum");
+
+    TEST_ASSERT(fast_lambda_estimate(NULL, 0, LAMBDA_EPSILON, LAMBDA_MAX_ITER) == FRACUNIT,
+                "Empty trajectory → λ = 1");
+    TEST_ASSERT(adjust_lambda(FLOAT_TO_FIXED(3.0f), 0) == LAMBDA_MAX, "adjust_lambda clamps to bracket");
+    TEST_ASSERT(adjust_lambda(LAMBDA_MIN, (fixed_t)0x7FFFFFFF) == FRACUNIT,
+                "adjust_lambda falls back to λ = 1 on saturated error");
+}
+
+/* ========================================================================
+ * TEST: Batch engine
+ * ======================================================================== */
+
+static int g_sink_count = 0;
+static bool counting_sink(const dlt_record_t* record, void* user) {
+    (void)record;
+    (*(int*)user)++;
+    return true;
+}
+
+void test_batch_engine(void) {
+    printf("\n[TEST] Batch Engine: Cells → DLT Records\n");
+
+    t_bsp_init(&g_bsp, 0, 0);
+    for (int c = 0; c < 10; c++) {
+        uint16_t cell_id = (uint16_t)(c << 8);
+        int count = (c < 7) ? MAX_POSES_PER_CELL : 20;  /* 7 full, 3 partial */
+        for (int i = 0; i < count; i++) {
+            se3_pose_t pose;
+            random_pose(&pose, 366000000u + (uint32_t)c, 1700000000u + (uint32_t)i * 10);
+            t_bsp_insert_pose(&g_bsp, cell_id, &pose);
+        }
+    }
+
+    lambda_segment_t segs[MAX_CELLS];
+    int queued = lambda_engine_collect_cells(&g_bsp, 1.0f, segs, MAX_CELLS);
+    TEST_ASSERT(queued == 7, "Only full cells queued");
+
+    int produced = lambda_engine_process(segs, queued, NULL, g_records);
+    TEST_ASSERT(produced == 7, "One record per queued cell");
+
+    int hash_ok = 1, fields_ok = 1;
+    for (int i = 0; i < produced; i++) {
+        uint8_t hash[32];
+        compute_trajectory_hash(segs[i].poses, segs[i].n, hash);
+        if (memcmp(hash, g_records[i].trajectory_hash, 32) != 0) {
+            hash_ok = 0;
+        }
+        if (strcmp(g_records[i].dataset, LAMBDA_ENGINE_DATASET) != 0 ||
+            g_records[i].cell_id != segs[i].cell_id ||
+            g_records[i].mmsi != segs[i].poses[0].mmsi ||
+            g_records[i].timestamp != segs[i].poses[segs[i].n - 1].timestamp ||
+            g_records[i].lambda_optimal < LAMBDA_MIN ||
+            g_records[i].lambda_optimal > LAMBDA_MAX) {
+            fields_ok = 0;
+        }
+    }
+    TEST_ASSERT(hash_ok, "Multi-buffer hashes match compute_trajectory_hash");
+    TEST_ASSERT(fields_ok, "Record fields populated from segments");
+
+    TEST_ASSERT(!publish_lambda_record(&g_records[0]), "Publish fails without sink");
+    dlt_set_publish_sink(counting_sink, &g_sink_count);
+    int published = lambda_engine_publish(segs, queued, g_records);
+    TEST_ASSERT(published == 7 && g_sink_count == 7, "All records reach publish sink");
+    dlt_set_publish_sink(NULL, NULL);
+}
+
+/* ========================================================================
+ * TEST: Throughput
+ * ======================================================================== */
+
+void test_throughput(void) {
+    printf("\n[TEST] Single-Core Throughput\n");
+
+    t_bsp_init(&g_bsp, 0, 0);
+    for (int c = 0; c < MAX_CELLS; c++) {
+        for (int i = 0; i < MAX_POSES_PER_CELL; i++) {
+            se3_pose_t pose;
+            random_pose(&pose, (uint32_t)c, (uint32_t)i);
+            t_bsp_insert_pose(&g_bsp, (uint16_t)c, &pose);
+        }
+    }
+
+    lambda_segment_t segs[MAX_CELLS];
+    int queued = lambda_engine_collect_cells(&g_bsp, 1.0f, segs, MAX_CELLS);
+
+    const int rounds = 20;
+    clock_t start = clock();
+    for (int r = 0; r < rounds; r++) {
+        lambda_engine_process(segs, queued, NULL, g_records);
+    }
+    double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+    double cells_per_s = secs > 0 ? (rounds * queued) / secs : 0;
+
+    printf("    %d cells × %d poses: %.1f µs/cell, %.0f cells/s\n",
+           queued, MAX_POSES_PER_CELL, secs * 1e6 / (rounds * queued), cells_per_s);
+
+    /* Global AIS feed: ~30k reports/s → ~250 full cells/s */
+    TEST_ASSERT(secs == 0 || cells_per_s > 250.0, "Keeps up with full AIS feed on one core");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("λ-ESTIMATION ENGINE - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+    printf("Fixed-point double-and-scale λ + multi-buffer SHA-256 DLT records\n");
+
+    se3_init_tables();
+
+    test_sha256_vectors();
+    test_sha256_multi();
+    test_return_error_accuracy();
+    test_lambda_search();
+    test_batch_engine();
+    test_throughput();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
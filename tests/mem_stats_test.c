@@ -0,0 +1,333 @@
+/*
+ * mem_stats_test.c - Unit Tests for Memory Accounting
+ *
+ * Tests for:
+ *   1. Heap counters: current / peak / allocs / frees through malloc,
+ *      calloc, realloc and free
+ *   2. Static registration is idempotent; richards_lite_init() registers
+ *      its scratch and LUT
+ *   3. state_create() / state_hash() are charged to state / io
+ *   4. Octree memory_used matches the bytes held and the budget is
+ *      enforced (activate/deactivate cycles do not leak budget)
+ *   5. neg_get_memory_report() JSON, and rejects short buffers
+ *   6. Page-mapped blocks: zeroed, huge-page aligned, accounted as
+ *      mapped, NUMA placement recorded; large states are mapped
+ *
+ * Compile with:
+ *   gcc -o mem_stats_test mem_stats_test.c ../src/core/mem_stats.c \
+ *       ../src/core/phase_timers.c ../src/core/trace.c ../src/core/state.c \
+ *       ../src/core/neg_error.c ../src/core/rng.c ../src/core/math/fixed_math.c \
+ *       ../src/core/math/barrier_field.c ../src/core/state_shm.c ../src/core/openmetrics.c \
+ *       ../src/core/step_async.c ../src/api/negentropic.c \
+ *       ../src/solvers/hydrology_richards_lite.c ../src/core/thread_pool.c \
+ *       ../src/grid/sparse_octree.c \
+ *       ../src/core/event_log.c ../src/core/replay.c ../src/core/rollback.c \
+ *       ../embedded/sha256.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -std=c99
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../src/core/include/mem_stats.h"
+#include "../src/core/state.h"
+#include "../src/api/negentropic.h"
+#include "../src/solvers/hydrology_richards_lite_internal.h"
+#include "../src/grid/sparse_octree.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+static NegMemStats stats(NegMemSubsystem sub) {
+    NegMemReport r;
+    neg_mem_report(&r);
+    return r.subsystems[sub];
+}
+
+/* ========================================================================
+ * TEST 1: HEAP COUNTERS
+ * ======================================================================== */
+
+static void test_heap(void) {
+    printf("\n[TEST 1] Heap counters\n");
+
+    NegMemStats before = stats(NEG_MEM_SOLVER);
+    char* a = (char*)neg_mem_malloc(NEG_MEM_SOLVER, 1000);
+    double* b = (double*)neg_mem_calloc(NEG_MEM_SOLVER, 100, sizeof(double));
+    NegMemStats s = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(a && b && s.current_bytes - before.current_bytes == 1800 &&
+                s.allocs - before.allocs == 2, "malloc + calloc charged");
+    TEST_ASSERT(b[0] == 0.0 && b[99] == 0.0 && ((size_t)b % sizeof(double)) == 0,
+                "calloc zeroed and aligned");
+
+    memset(a, 7, 1000);
+    a = (char*)neg_mem_realloc(NEG_MEM_IO, a, 4000);
+    s = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(a && a[999] == 7 && s.current_bytes - before.current_bytes == 4800 &&
+                s.allocs - before.allocs == 2 && stats(NEG_MEM_IO).current_bytes == 0,
+                "realloc resizes in place of the owner, not a new block");
+
+    neg_mem_free(a);
+    neg_mem_free(b);
+    neg_mem_free(NULL);
+    s = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(s.current_bytes == before.current_bytes &&
+                s.allocs - s.frees == before.allocs - before.frees, "All blocks returned");
+    TEST_ASSERT(s.peak_bytes >= before.current_bytes + 4800, "Peak kept after free");
+}
+
+/* ========================================================================
+ * TEST 2: STATIC STORAGE
+ * ======================================================================== */
+
+static void test_static(void) {
+    printf("\n[TEST 2] Static registration\n");
+
+    NegMemStats lut0 = stats(NEG_MEM_LUT);
+    NegMemStats solver0 = stats(NEG_MEM_SOLVER);
+    richards_lite_init();
+    richards_lite_init();
+    NegMemStats lut1 = stats(NEG_MEM_LUT);
+    NegMemStats solver1 = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(lut1.static_bytes - lut0.static_bytes == sizeof(g_vG_lut_default),
+                "vG LUT registered once");
+    TEST_ASSERT(solver1.static_bytes == solver0.static_bytes,
+                "Richards scratch on the stack: no static solver bytes");
+
+    neg_mem_register_static(NEG_MEM_INTEGRATOR, "test_pool", 512);
+    neg_mem_register_static(NEG_MEM_INTEGRATOR, "test_pool", 512);
+    TEST_ASSERT(stats(NEG_MEM_INTEGRATOR).static_bytes == 512, "Same name counted once");
+}
+
+/* ========================================================================
+ * TEST 3: SIMULATION STATE
+ * ======================================================================== */
+
+static void test_state(void) {
+    printf("\n[TEST 3] State and hash scratch\n");
+
+    NegMemStats before = stats(NEG_MEM_STATE);
+    SimulationConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.num_entities = 64;
+    cfg.num_scalar_fields = 4096;
+    cfg.dt = 0.016f;
+    void* sim = state_create(&cfg);
+
+    NegMemStats s = stats(NEG_MEM_STATE);
+    TEST_ASSERT(sim && s.allocs - before.allocs == 1 &&
+                s.current_bytes - before.current_bytes > 4096 * sizeof(float),
+                "state_create() is one block charged to state");
+
+    (void)state_hash(sim);
+    NegMemStats io = stats(NEG_MEM_IO);
+    TEST_ASSERT(io.current_bytes == 0 && io.peak_bytes >= state_get_binary_size(sim),
+                "Hash scratch charged to io and released");
+
+    state_destroy(sim);
+    TEST_ASSERT(stats(NEG_MEM_STATE).current_bytes == before.current_bytes,
+                "state_destroy() returns the block");
+}
+
+/* ========================================================================
+ * TEST 4: OCTREE BUDGET
+ * ======================================================================== */
+
+static void test_octree(void) {
+    printf("\n[TEST 4] Octree budget\n");
+
+    size_t budget = sizeof(Octree) + sizeof(OctreeNode) + 100 * sizeof(uint32_t);
+    Octree* tree = octree_create(64, 64, budget);
+    TEST_ASSERT(tree && stats(NEG_MEM_OCTREE).current_bytes == octree_memory_usage(tree),
+                "memory_used is the bytes held");
+
+    int activated = 0;
+    for (int i = 0; i < 64 * 64; i++) {
+        if (octree_activate_cell(tree, i % 64, i / 64) != 0) break;
+        activated++;
+    }
+    TEST_ASSERT(activated == 100 && octree_memory_usage(tree) <= budget,
+                "Activation stops at the budget");
+    TEST_ASSERT(stats(NEG_MEM_OCTREE).current_bytes == octree_memory_usage(tree),
+                "Index growth tracked exactly");
+
+    int cycles_ok = 1;
+    for (int k = 0; k < 1000; k++) {
+        cycles_ok &= octree_deactivate_cell(tree, 0, 0) == 0 &&
+                     octree_activate_cell(tree, 0, 0) == 0;
+    }
+    TEST_ASSERT(cycles_ok, "Activate/deactivate cycles do not consume budget");
+
+    TEST_ASSERT(octree_create(64, 64, sizeof(Octree)) == NULL, "Budget below the root rejected");
+
+    octree_destroy(tree);
+    TEST_ASSERT(stats(NEG_MEM_OCTREE).current_bytes == 0, "octree_destroy() frees everything");
+}
+
+/* ========================================================================
+ * TEST 5: neg_get_memory_report()
+ * ======================================================================== */
+
+static void test_report(void) {
+    printf("\n[TEST 5] neg_get_memory_report() JSON\n");
+
+    void* sim = neg_create("{\"num_entities\": 16, \"num_scalar_fields\": 256}");
+    char buffer[2048];
+    int n = neg_get_memory_report(buffer, sizeof(buffer));
+    TEST_ASSERT(n > 0 && (size_t)n == strlen(buffer), "Report written");
+    TEST_ASSERT(strncmp(buffer, "{\"current_bytes\":", 17) == 0 &&
+                strstr(buffer, "\"subsystems\":{\"state\":{") != NULL &&
+                strstr(buffer, "\"diagnostics\":{") != NULL, "Totals and all subsystems");
+    TEST_ASSERT(strstr(buffer, "\"frees\":") && strstr(buffer, ",\"mapped_bytes\":") &&
+                strstr(buffer, ",\"numa_nodes\":[") && strstr(buffer, "],\"subsystems\":{"),
+                "Mapped bytes and NUMA placement reported");
+    TEST_ASSERT(buffer[n - 1] == '}' && buffer[n - 2] == '}' && buffer[n - 3] == '}',
+                "Object closed");
+
+    char small[64];
+    TEST_ASSERT(neg_get_memory_report(small, sizeof(small)) == NEG_ERROR_BUFFER_TOO_SMALL,
+                "Short buffer rejected");
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 6: PAGE-MAPPED BLOCKS
+ * ======================================================================== */
+
+static uint64_t node_total(void) {
+    NegMemReport r;
+    neg_mem_report(&r);
+    uint64_t sum = 0;
+    for (int n = 0; n < NEG_MEM_MAX_NODES; n++) sum += r.node_bytes[n];
+    return sum;
+}
+
+static void test_mapped(void) {
+    printf("\n[TEST 6] Page-mapped blocks\n");
+
+    const size_t size = 3 * NEG_MEM_HUGE_PAGE + 123;
+    NegMemStats before = stats(NEG_MEM_SOLVER);
+    uint64_t nodes_before = node_total();
+
+    uint8_t* p = (uint8_t*)neg_mem_map(NEG_MEM_SOLVER, size);
+    NegMemStats s = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(p && p[0] == 0 && p[size / 2] == 0 && p[size - 1] == 0, "Mapped block zeroed");
+    TEST_ASSERT(s.current_bytes - before.current_bytes == size &&
+                s.mapped_bytes - before.mapped_bytes == size && s.allocs - before.allocs == 1,
+                "Charged as live and mapped bytes");
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    TEST_ASSERT(((uintptr_t)p & (NEG_MEM_HUGE_PAGE - 1)) < 4096,
+                "Mapping starts on a huge page boundary");
+#endif
+    TEST_ASSERT(neg_mem_realloc(NEG_MEM_SOLVER, p, 16) == NULL && p[0] == 0,
+                "Mapped blocks are not resized");
+
+    memset(p, 0x5A, size);
+    uint64_t nodes[NEG_MEM_MAX_NODES];
+    int seen = neg_mem_locality(p, nodes);
+    uint64_t resident = 0;
+    for (int n = 0; n < NEG_MEM_MAX_NODES; n++) resident += nodes[n];
+    if (seen > 0) {
+        printf("    %d node(s), %llu bytes resident\n", seen, (unsigned long long)resident);
+        TEST_ASSERT(resident >= size && node_total() - nodes_before == resident,
+                    "Every written page placed and reported");
+    } else {
+        printf("    NUMA placement not available on this host\n");
+        TEST_ASSERT(resident == 0 && node_total() == nodes_before, "Nothing reported");
+    }
+    neg_mem_locality(p, NULL);
+    TEST_ASSERT(node_total() - nodes_before == resident, "Re-recording replaces, not adds");
+
+    void* heap = neg_mem_malloc(NEG_MEM_SOLVER, 64);
+    TEST_ASSERT(neg_mem_locality(heap, nodes) == 0 && nodes[0] == 0 &&
+                neg_mem_locality(NULL, NULL) == 0, "Heap blocks have no recorded placement");
+    neg_mem_free(heap);
+
+    uint8_t* small = (uint8_t*)neg_mem_map(NEG_MEM_SOLVER, 100);
+    TEST_ASSERT(small && small[99] == 0, "Small mappings work");
+    neg_mem_free(small);
+
+    neg_mem_free(p);
+    s = stats(NEG_MEM_SOLVER);
+    TEST_ASSERT(s.current_bytes == before.current_bytes &&
+                s.mapped_bytes == before.mapped_bytes && node_total() == nodes_before,
+                "Free releases bytes and placement");
+
+    /* A large state is mapped and first touched on the pool */
+    NegMemStats state0 = stats(NEG_MEM_STATE);
+    SimulationConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.num_entities = 64;
+    cfg.num_scalar_fields = 1u << 20;   /* 4 MB of fields */
+    cfg.dt = 0.016f;
+    neg_pool_config_default(&cfg.pool);
+    cfg.pool.threads = 4;
+    void* sim = state_create(&cfg);
+
+    SimulationState view;
+    int zero = sim && state_get_view(sim, &view);
+    for (uint32_t i = 0; zero && i < cfg.num_scalar_fields; i += 4097) {
+        zero = view.scalar_fields[i] == 0.0f;
+    }
+    TEST_ASSERT(zero && view.scalar_fields[cfg.num_scalar_fields - 1] == 0.0f,
+                "Large state created with zeroed fields");
+    s = stats(NEG_MEM_STATE);
+    TEST_ASSERT(s.mapped_bytes - state0.mapped_bytes > (4u << 20) &&
+                s.allocs - state0.allocs == 1, "Large state is one mapped block");
+    TEST_ASSERT(seen <= 0 || node_total() - nodes_before >= (4u << 20),
+                "Its placement is recorded");
+
+    state_destroy(sim);
+    s = stats(NEG_MEM_STATE);
+    TEST_ASSERT(s.mapped_bytes == state0.mapped_bytes && node_total() == nodes_before,
+                "state_destroy() unmaps it");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("MEMORY ACCOUNTING - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_heap();
+    test_static();
+    test_state();
+    test_octree();
+    test_report();
+    test_mapped();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
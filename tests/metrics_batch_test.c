@@ -0,0 +1,306 @@
+/*
+ * metrics_batch_test.c - Unit Tests for Batched SE(3) Metrics
+ *
+ * Tests for:
+ *   1. λ, ε, evaluation count and cascade levels match the Python
+ *      reference (compute_regenerative_metrics, values recorded from
+ *      NumPy 2 / scipy 1.17)
+ *   2. Matrix and rotation-vector inputs of the same poses agree
+ *   3. Bounds and SE3Pose assertions fail with the same values
+ *   4. Empty trajectories: λ search runs, cascade reports EMPTY
+ *   5. Results are identical for any worker count
+ *   6. Invalid arguments are rejected
+ *
+ * Compile with:
+ *   gcc -o metrics_batch_test metrics_batch_test.c ../src/core/metrics_batch.c \
+ *       ../src/core/thread_pool.c ../src/core/math/fixed_math.c \
+ *       ../src/core/mem_stats.c ../src/core/rng.c -lm -pthread -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../src/core/include/metrics_batch.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+static int rel_close(double a, double b, double rtol) {
+    return fabs(a - b) <= rtol * fabs(b);
+}
+
+/* Three near-quarter turns about z: interior optimum λ ≈ π/3 */
+static const double k_rotvec_poses[3 * 6] = {
+    0.05, 0.0,  1.0,  0.02,  0.01, 0.0,
+    0.0,  0.05, 1.0, -0.01,  0.02, 0.0,
+    0.0,  0.0,  1.0,  0.0,  -0.02, 0.01,
+};
+
+static int run(const double* poses, const int64_t* offsets, size_t count, NegPoseFormat format,
+               const NegMetricsOptions* opt, NegMetricsResult* results, int workers) {
+    return neg_metrics_batch(poses, offsets, count, format, opt, results, workers);
+}
+
+/* ========================================================================
+ * TEST 1: PYTHON REFERENCE
+ * ======================================================================== */
+
+static void test_reference(void) {
+    printf("\n[TEST 1] Python reference values\n");
+
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    int64_t offsets[2] = { 0, 3 };
+    NegMetricsResult r;
+
+    TEST_ASSERT(run(k_rotvec_poses, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1) == 0,
+                "batch runs");
+    TEST_ASSERT(r.status == NEG_METRICS_OK && r.success, "converged");
+    TEST_ASSERT(fabs(r.optimal_lambda - 1.0468383983750287) <= 1e-12, "λ matches");
+    TEST_ASSERT(rel_close(r.return_error, 0.02172025504021235, 1e-12), "ε matches");
+    TEST_ASSERT(r.nfev == 18, "same number of cost evaluations as scipy");
+    TEST_ASSERT(r.resonance == -1, "no natural resonance");
+    TEST_ASSERT(rel_close(r.confidence, 0.9787414853204046, 1e-12), "confidence matches");
+
+    TEST_ASSERT(rel_close(r.verifications[NEG_VERIFY_TOPOLOGICAL], 0.02172025504021235, 1e-12),
+                "topological level matches");
+    TEST_ASSERT(rel_close(r.verifications[NEG_VERIFY_ENERGETIC], 1.0711182373613832, 1e-12),
+                "energetic level matches");
+    TEST_ASSERT(rel_close(r.verifications[NEG_VERIFY_TEMPORAL], 0.050868016480334566, 1e-12),
+                "temporal level matches");
+    TEST_ASSERT(r.verifications[NEG_VERIFY_SPATIAL] == 1.0, "spatial level is 1");
+    TEST_ASSERT(r.verifications[NEG_VERIFY_STOCHASTIC] >= 0.0 &&
+                r.verifications[NEG_VERIFY_STOCHASTIC] <= 1.0, "stochastic level in [0, 1]");
+    TEST_ASSERT(r.verification_score > 0.0 && r.verification_score <= 1.0, "score in (0, 1]");
+
+    /* Lower-bound optimum, translation-dominated */
+    static const double poses[2 * 6] = {
+        0.1, 0.0, 0.0, 0.05, 0.0,  0.0,
+        0.0, 0.1, 0.0, 0.0,  0.05, 0.0,
+    };
+    int64_t off2[2] = { 0, 2 };
+    run(poses, off2, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(fabs(r.optimal_lambda - 0.10000366481123776) <= 1e-12 &&
+                rel_close(r.return_error, 0.05414270302526045, 1e-12) && r.nfev == 27,
+                "λ at the lower bound matches");
+}
+
+/* ========================================================================
+ * TEST 2: MATRIX INPUT
+ * ======================================================================== */
+
+static void test_matrix_input(void) {
+    printf("\n[TEST 2] Matrix and rotation-vector inputs agree\n");
+
+    /* 90° about z, 90° about x, as exact matrices */
+    static const double matrices[2 * 12] = {
+        0, -1, 0,  1, 0, 0,  0, 0, 1,   0.01, 0.0, 0.0,
+        1, 0, 0,   0, 0, -1, 0, 1, 0,   0.0, 0.02, 0.0,
+    };
+    const double h = 1.5707963267948966;
+    const double rotvecs[2 * 6] = {
+        0, 0, h,  0.01, 0.0, 0.0,
+        h, 0, 0,  0.0, 0.02, 0.0,
+    };
+    int64_t offsets[2] = { 0, 2 };
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    opt.verification = 0;
+
+    NegMetricsResult a, b;
+    run(matrices, offsets, 1, NEG_POSE_MATRIX, &opt, &a, 1);
+    run(rotvecs, offsets, 1, NEG_POSE_ROTVEC, &opt, &b, 1);
+    TEST_ASSERT(a.status == NEG_METRICS_OK && b.status == NEG_METRICS_OK, "both succeed");
+    TEST_ASSERT(fabs(a.optimal_lambda - b.optimal_lambda) <= 1e-9, "same λ");
+    TEST_ASSERT(fabs(a.return_error - b.return_error) <= 1e-9, "same ε");
+    TEST_ASSERT(a.verification_score == 0.0, "score is 0 with the cascade disabled");
+}
+
+/* ========================================================================
+ * TEST 3: FAILURES
+ * ======================================================================== */
+
+static void test_failures(void) {
+    printf("\n[TEST 3] Bounds and rotation assertions\n");
+
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    int64_t offsets[2] = { 0, 1 };
+    NegMetricsResult r;
+
+    /* Only the λ search, never scaling up: |t| = r_max is allowed */
+    double far[6] = { 0.0, 0.0, 0.0, 0.6, 0.8, 0.0 };
+    opt.lambda_hi = 1.0;
+    opt.resonance = 0;
+    opt.verification = 0;
+    run(far, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_OK, "|t| = 1.0 is within r_max");
+    neg_metrics_options_default(&opt);
+    far[4] = 0.9;
+    run(far, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_OUT_OF_BOUNDS &&
+                fabs(r.fail_value - sqrt(0.36 + 0.81)) < 1e-15, "input norm reported");
+
+    /* Fine at λ <= 2, but silver ratio (2.414) scales it past r_max */
+    double mid[6] = { 0.0, 0.0, 0.1, 0.45, 0.0, 0.0 };
+    run(mid, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_OUT_OF_BOUNDS &&
+                fabs(r.fail_value - 0.45 * (1 + sqrt(2.0))) < 1e-12,
+                "resonance scan fails like the Python path");
+    opt.resonance = 0;
+    run(mid, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_OK, "passes without resonance detection");
+    opt.resonance = 1;
+    opt.bounded = 0;
+    run(mid, offsets, 1, NEG_POSE_ROTVEC, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_OK, "passes unbounded");
+    opt.bounded = 1;
+
+    double scaled[12] = { 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0 };
+    run(scaled, offsets, 1, NEG_POSE_MATRIX, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_BAD_DETERMINANT && r.fail_value == 2.0,
+                "determinant 2 rejected");
+    double sheared[12] = { 1, 0.1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0 };
+    run(sheared, offsets, 1, NEG_POSE_MATRIX, &opt, &r, 1);
+    TEST_ASSERT(r.status == NEG_METRICS_NOT_ORTHOGONAL, "shear rejected");
+}
+
+/* ========================================================================
+ * TEST 4: EMPTY TRAJECTORIES
+ * ======================================================================== */
+
+static void test_empty(void) {
+    printf("\n[TEST 4] Empty trajectories\n");
+
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    int64_t offsets[3] = { 0, 0, 3 };
+    NegMetricsResult r[2];
+
+    TEST_ASSERT(run(k_rotvec_poses, offsets, 2, NEG_POSE_ROTVEC, &opt, r, 1) == 0,
+                "batch with an empty trajectory runs");
+    TEST_ASSERT(r[0].status == NEG_METRICS_EMPTY, "cascade reports EMPTY");
+    TEST_ASSERT(r[1].status == NEG_METRICS_OK, "next trajectory unaffected");
+
+    opt.verification = 0;
+    run(k_rotvec_poses, offsets, 2, NEG_POSE_ROTVEC, &opt, r, 1);
+    TEST_ASSERT(r[0].status == NEG_METRICS_OK && r[0].return_error == 0.0,
+                "ε = 0 without the cascade");
+}
+
+/* ========================================================================
+ * TEST 5: WORKER INVARIANCE
+ * ======================================================================== */
+
+static void test_workers(void) {
+    printf("\n[TEST 5] Worker-count invariance\n");
+
+    enum { COUNT = 200 };
+    int64_t offsets[COUNT + 1];
+    offsets[0] = 0;
+    for (int i = 0; i < COUNT; i++) offsets[i + 1] = offsets[i] + 1 + i % 9;
+
+    size_t n = (size_t)offsets[COUNT];
+    double* poses = malloc(n * 6 * sizeof(double));
+    NegMetricsResult* one = malloc(COUNT * sizeof(NegMetricsResult));
+    NegMetricsResult* four = malloc(COUNT * sizeof(NegMetricsResult));
+    uint32_t s = 12345;
+    for (size_t i = 0; i < n * 6; i++) {
+        s = s * 1664525u + 1013904223u;
+        double u = (double)(s >> 8) / 16777216.0 - 0.5;
+        poses[i] = (i % 6 < 3) ? u : 0.05 * u;
+    }
+
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    opt.seed = 7;
+    run(poses, offsets, COUNT, NEG_POSE_TIMESERIES, &opt, one, 1);
+    run(poses, offsets, COUNT, NEG_POSE_TIMESERIES, &opt, four, 4);
+    TEST_ASSERT(memcmp(one, four, COUNT * sizeof(NegMetricsResult)) == 0,
+                "1 and 4 workers give identical results");
+
+    opt.seed = 8;
+    run(poses, offsets, COUNT, NEG_POSE_TIMESERIES, &opt, four, 0);
+    int same_lambda = 1;
+    for (int i = 0; i < COUNT; i++) {
+        same_lambda &= one[i].optimal_lambda == four[i].optimal_lambda;
+    }
+    TEST_ASSERT(same_lambda, "seed only affects the stochastic level");
+
+    free(poses);
+    free(one);
+    free(four);
+}
+
+/* ========================================================================
+ * TEST 6: ARGUMENTS
+ * ======================================================================== */
+
+static void test_arguments(void) {
+    printf("\n[TEST 6] Argument validation\n");
+
+    NegMetricsOptions opt;
+    neg_metrics_options_default(&opt);
+    NegMetricsResult r[2];
+    int64_t decreasing[3] = { 0, 3, 2 };
+    int64_t offsets[2] = { 0, 3 };
+
+    TEST_ASSERT(run(k_rotvec_poses, decreasing, 2, NEG_POSE_ROTVEC, &opt, r, 1) == -1,
+                "decreasing offsets rejected");
+    TEST_ASSERT(run(k_rotvec_poses, offsets, 1, (NegPoseFormat)7, &opt, r, 1) == -1,
+                "unknown format rejected");
+    opt.lambda_lo = 3.0;
+    TEST_ASSERT(run(k_rotvec_poses, offsets, 1, NEG_POSE_ROTVEC, &opt, r, 1) == -1,
+                "inverted λ bounds rejected");
+    opt.lambda_lo = 0.1;
+    TEST_ASSERT(run(NULL, offsets, 0, NEG_POSE_ROTVEC, &opt, NULL, 0) == 0,
+                "empty batch is a no-op");
+    TEST_ASSERT(strcmp(neg_metrics_resonance_name(0), "golden_ratio") == 0 &&
+                neg_metrics_resonance_name(NEG_RESONANCE_COUNT) == NULL,
+                "resonance names");
+}
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("BATCHED SE(3) METRICS - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_reference();
+    test_matrix_input();
+    test_failures();
+    test_empty();
+    test_workers();
+    test_arguments();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
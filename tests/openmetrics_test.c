@@ -0,0 +1,254 @@
+/*
+ * openmetrics_test.c - Unit Tests for the OpenMetrics Exposition
+ *
+ * Tests for:
+ *   1. Phase histograms: bucket placement, steps without a phase are not
+ *      observed, cumulative buckets / count / sum in the text
+ *   2. Event counters: richards_lite_step() counts its CFL substeps,
+ *      unknown counters are ignored
+ *   3. neg_get_metrics_text(): families, memory and error flags, "# EOF"
+ *   4. Worst case fits NEG_OPENMETRICS_MAX_SIZE; short buffers rejected
+ *
+ * Compile with:
+ *   gcc -o openmetrics_test openmetrics_test.c ../src/core/openmetrics.c \
+ *       ../src/core/phase_timers.c ../src/core/mem_stats.c ../src/core/trace.c \
+ *       ../src/core/state.c ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/state_shm.c ../src/core/math/fixed_math.c \
+ *       ../src/core/math/barrier_field.c ../src/core/step_async.c \
+ *       ../src/api/negentropic.c ../src/solvers/hydrology_richards_lite.c \
+ *       ../src/core/thread_pool.c \
+ *       ../src/core/event_log.c ../src/core/replay.c ../src/core/rollback.c \
+ *       ../embedded/sha256.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c99
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../src/core/include/openmetrics.h"
+#include "../src/api/negentropic.h"
+#include "../src/solvers/hydrology_richards_lite.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+static char text[NEG_OPENMETRICS_MAX_SIZE];
+
+/* ========================================================================
+ * TEST 1: PHASE HISTOGRAMS
+ * ======================================================================== */
+
+static void test_histograms(void) {
+    printf("\n[TEST 1] Phase histograms\n");
+
+    NegPhaseTimers t;
+    neg_phase_timers_init(&t);
+    NegErrorFlags flags;
+    neg_error_init(&flags);
+
+    /* ATM: 5 us, 30 us, 2 ms; REG only in the first step */
+    const uint64_t atm[3] = { 5000, 30000, 2000000 };
+    for (int i = 0; i < 3; i++) {
+        t.current[NEG_PHASE_ATMOSPHERE] = atm[i];
+        t.current_calls[NEG_PHASE_ATMOSPHERE] = 1;
+        if (i == 0) {
+            t.current[NEG_PHASE_REGENERATION] = 200000000;
+            t.current_calls[NEG_PHASE_REGENERATION] = 1;
+        }
+        neg_phase_end_step(&t);
+    }
+
+    TEST_ASSERT(t.hist[NEG_PHASE_ATMOSPHERE][0] == 1 && t.hist[NEG_PHASE_ATMOSPHERE][2] == 1 &&
+                t.hist[NEG_PHASE_ATMOSPHERE][7] == 1, "ATM observations in 10 us, 50 us, 2.5 ms");
+    TEST_ASSERT(t.hist_count[NEG_PHASE_ATMOSPHERE] == 3 &&
+                t.hist_sum_ns[NEG_PHASE_ATMOSPHERE] == 2035000, "ATM count and sum");
+    TEST_ASSERT(t.hist_count[NEG_PHASE_REGENERATION] == 1 &&
+                t.hist[NEG_PHASE_REGENERATION][NEG_PHASE_HIST_BUCKETS - 1] == 1,
+                "REG observed once, beyond 100 ms lands in +Inf");
+    TEST_ASSERT(t.hist_count[NEG_PHASE_HASH] == 0 && t.hist_count[NEG_PHASE_COUNT] == 3,
+                "Phases that did not run are not observed; every step is");
+    TEST_ASSERT(neg_phase_hist_bound_ns(0) == 10000 &&
+                neg_phase_hist_bound_ns(NEG_PHASE_HIST_BUCKETS - 1) == UINT64_MAX,
+                "Bucket bounds 10 us .. +Inf");
+
+    int n = neg_openmetrics_text(&t, &flags, text, sizeof(text));
+    TEST_ASSERT(n > 0 && (size_t)n == strlen(text), "Exposition rendered");
+    TEST_ASSERT(strstr(text, "negentropic_phase_seconds_bucket{phase=\"atmosphere\",le=\"0.00001\"} 1\n") &&
+                strstr(text, "negentropic_phase_seconds_bucket{phase=\"atmosphere\",le=\"0.001\"} 2\n") &&
+                strstr(text, "negentropic_phase_seconds_bucket{phase=\"atmosphere\",le=\"+Inf\"} 3\n"),
+                "Buckets are cumulative with decimal le labels");
+    TEST_ASSERT(strstr(text, "negentropic_phase_seconds_count{phase=\"atmosphere\"} 3\n") &&
+                strstr(text, "negentropic_phase_seconds_sum{phase=\"atmosphere\"} 0.002035000\n"),
+                "Count and sum (seconds) per phase");
+    TEST_ASSERT(strstr(text, "negentropic_step_seconds_count 3\n") &&
+                strstr(text, "negentropic_steps_total 3\n"), "Step histogram and counter");
+}
+
+/* ========================================================================
+ * TEST 2: EVENT COUNTERS
+ * ======================================================================== */
+
+static void init_cell(Cell* cell) {
+    memset(cell, 0, sizeof(*cell));
+    cell->theta = 0.12f;
+    cell->psi = -10.0f;
+    cell->K_s = 5.0e-6f;
+    cell->alpha_vG = 1.5f;
+    cell->n_vG = 1.4f;
+    cell->theta_s = 0.45f;
+    cell->theta_r = 0.05f;
+    cell->M_K_zz = 1.0f;
+    cell->M_K_xx = 1.0f;
+    cell->kappa_evap = 1.0f;
+    cell->zeta_c = 0.005f;
+    cell->a_c = 0.5f;
+    cell->dz = 0.2f;
+    cell->dx = 10.0f;
+}
+
+static void test_counters(void) {
+    printf("\n[TEST 2] Event counters\n");
+
+    enum { NX = 8, NY = 8, NZ = 4 };
+    Cell* cells = (Cell*)malloc(sizeof(Cell) * NX * NY * NZ);
+    for (int i = 0; i < NX * NY * NZ; i++) init_cell(&cells[i]);
+
+    RichardsLiteParams params;
+    memset(&params, 0, sizeof(params));
+    params.K_r = 1.0e-4f;
+    params.E_bare_ref = 5.0e-7f;
+    params.dt_max = 3600.0f;
+    params.CFL_factor = 0.5f;
+    params.use_free_drainage = 1;
+    richards_lite_init();
+
+    /* dt_cfl = CFL * dx^2 / (2 K_r) = 250000 s: one substep per 600 s step */
+    uint64_t before = neg_counter_get(NEG_COUNTER_CFL_SUBSTEPS);
+    for (int step = 0; step < 3; step++) {
+        richards_lite_step(cells, &params, NX, NY, NZ, 600.0f, 1.0e-7f, NULL);
+    }
+    TEST_ASSERT(neg_counter_get(NEG_COUNTER_CFL_SUBSTEPS) - before == 3,
+                "richards_lite_step() counts its CFL substeps");
+
+    params.K_r = 1.0f;  /* dt_cfl = 25 s: 600 s needs 25 substeps */
+    before = neg_counter_get(NEG_COUNTER_CFL_SUBSTEPS);
+    richards_lite_step(cells, &params, NX, NY, NZ, 600.0f, 1.0e-7f, NULL);
+    TEST_ASSERT(neg_counter_get(NEG_COUNTER_CFL_SUBSTEPS) - before == 25,
+                "Substeps follow the CFL limit");
+
+    uint64_t esc = neg_counter_get(NEG_COUNTER_LOD_ESCALATIONS);
+    neg_counter_add(NEG_COUNTER_LOD_ESCALATIONS, 2);
+    neg_counter_add(NEG_COUNTER_COUNT, 5);
+    TEST_ASSERT(neg_counter_get(NEG_COUNTER_LOD_ESCALATIONS) - esc == 2 &&
+                neg_counter_get(NEG_COUNTER_COUNT) == 0, "Unknown counter ignored");
+    TEST_ASSERT(strcmp(neg_counter_name(NEG_COUNTER_CFL_SUBSTEPS), "cfl_substeps") == 0,
+                "Counter names");
+
+    free(cells);
+}
+
+/* ========================================================================
+ * TEST 3: neg_get_metrics_text()
+ * ======================================================================== */
+
+static void test_api(void) {
+    printf("\n[TEST 3] neg_get_metrics_text()\n");
+
+    void* sim = neg_create("{\"num_entities\": 16, \"num_scalar_fields\": 256}");
+    for (int i = 0; i < 5; i++) neg_step(sim, 0.016f);
+
+    int n = neg_get_metrics_text(sim, text, sizeof(text));
+    TEST_ASSERT(n > 0 && strstr(text, "negentropic_steps_total 5\n") != NULL,
+                "Steps of this simulation");
+    TEST_ASSERT(strstr(text, "# TYPE negentropic_steps counter\n") &&
+                strstr(text, "# TYPE negentropic_phase_seconds histogram\n# UNIT negentropic_phase_seconds seconds\n") &&
+                strstr(text, "# TYPE negentropic_cfl_substeps counter\n") &&
+                strstr(text, "negentropic_lod_escalations_total "),
+                "Counter and histogram families declared");
+
+    const char* state_mem = strstr(text, "negentropic_memory_bytes{subsystem=\"state\"} ");
+    unsigned long long state_bytes = 0;
+    if (state_mem) sscanf(strchr(state_mem, '}') + 1, "%llu", &state_bytes);
+    TEST_ASSERT(state_bytes > 0 &&
+                strstr(text, "negentropic_memory_allocs_total{subsystem=\"diagnostics\"} "),
+                "Memory by subsystem (state is live)");
+    TEST_ASSERT(strstr(text, "negentropic_errors_total 0\n") &&
+                strstr(text, "negentropic_error_flag{flag=\"overflow\"} 0\n") &&
+                strstr(text, "negentropic_error_flag{flag=\"invalid_state\"} 0\n"),
+                "Error counter and flags");
+    TEST_ASSERT(n >= 6 && strcmp(text + n - 6, "# EOF\n") == 0, "Terminated by # EOF");
+
+    TEST_ASSERT(neg_get_metrics_text(NULL, text, sizeof(text)) == NEG_ERROR_NULL_HANDLE &&
+                neg_get_metrics_text(sim, NULL, sizeof(text)) == NEG_ERROR_INVALID_STATE &&
+                neg_get_metrics_text(sim, text, 256) == NEG_ERROR_BUFFER_TOO_SMALL,
+                "NULL handle, NULL buffer and short buffer rejected");
+
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 4: SIZE BOUND
+ * ======================================================================== */
+
+static void test_size_bound(void) {
+    printf("\n[TEST 4] Size bound\n");
+
+    NegPhaseTimers t;
+    memset(&t, 0xFF, sizeof(t));  /* Every counter at its widest */
+    NegErrorFlags flags;
+    memset(&flags, 0xFF, sizeof(flags));
+
+    int n = neg_openmetrics_text(&t, &flags, text, sizeof(text));
+    printf("    worst case %d bytes (limit %d)\n", n, NEG_OPENMETRICS_MAX_SIZE);
+    TEST_ASSERT(n > 0 && n < NEG_OPENMETRICS_MAX_SIZE, "Worst case fits NEG_OPENMETRICS_MAX_SIZE");
+    TEST_ASSERT(neg_openmetrics_text(&t, &flags, text, (size_t)n) == -1 &&
+                neg_openmetrics_text(&t, &flags, text, (size_t)n + 1) == n,
+                "Exact fit accepted, one byte short rejected");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("OPENMETRICS EXPOSITION - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_histograms();
+    test_counters();
+    test_api();
+    test_size_bound();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
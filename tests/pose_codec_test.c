@@ -0,0 +1,411 @@
+/*
+ * pose_codec_test.c - Unit Tests for Delta-Compressed Pose Storage
+ *
+ * Tests for:
+ *   1. Yaw index recovery over the full fine angle range
+ *   2. Lossless round trip of a steady AIS cruise trajectory
+ *   3. Compression ratio (bytes per pose vs 56-byte raw pose)
+ *   4. MMSI keyframes and raw-rotation escapes
+ *   5. Interleaved vessels: per-vessel predictors, ratio, slot eviction
+ *   6. Extreme translation/timestamp jumps (int32 wraparound)
+ *   7. Stream capacity and truncated-record handling
+ *   8. T-BSP cells in compressed mode (T_BSP_COMPRESSED_POSES)
+ *   9. λ engine records from compressed cells match the raw poses
+ *
+ * Compile with:
+ *   gcc -DT_BSP_COMPRESSED_POSES -o pose_codec_test pose_codec_test.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       ../embedded/pose_codec.c ../embedded/t_bsp.c \
+ *       ../embedded/sha256.c ../embedded/lambda_estimator.c \
+ *       ../embedded/record_lambda.c ../embedded/lambda_engine.c \
+ *       -I../embedded -lm -std=c99
+ *
+ * Author: ClaudeCode (pose compression)
+ * Version: 1.0
+ */
+
+#include "../embedded/se3_edge.h"
+#include "../embedded/pose_codec.h"
+#include "../embedded/t_bsp.h"
+#include "../embedded/lambda_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+/* Large objects kept static (ESP32-style, avoids stack pressure) */
+static pose_stream_t g_stream;
+static se3_pose_t g_poses[1200];
+static se3_pose_t g_tracks[6][200];
+static t_bsp_t g_bsp;
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 12345u;
+static int32_t lcg_noise(int32_t amplitude) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (int32_t)((lcg_state >> 8) % (uint32_t)(2 * amplitude + 1)) - amplitude;
+}
+
+/**
+ * Build steady cruise trajectory: ~6 m/s, slow turn, 10 s AIS interval,
+ * with centimetre-scale position jitter and occasional late reports.
+ */
+static void make_cruise(se3_pose_t* poses, int n, uint32_t mmsi) {
+    fixed_t east = -INT_TO_FIXED(4000);
+    fixed_t north = INT_TO_FIXED(2500);
+    fixed_t heading = INT_TO_FIXED(45);
+    uint32_t t = 1700000000u;
+
+    for (int i = 0; i < n; i++) {
+        se3_pose_from_gps(east, north, 0, heading, t, mmsi, &poses[i]);
+
+        east += INT_TO_FIXED(42) + lcg_noise(600);
+        north += INT_TO_FIXED(42) + lcg_noise(600);
+        if (i % 8 == 0) {
+            heading += FRACUNIT / 4;
+        }
+        t += (i % 50 == 49) ? 11 : 10;
+    }
+}
+
+static bool poses_equal(const se3_pose_t* a, const se3_pose_t* b) {
+    return memcmp(a, b, sizeof(se3_pose_t)) == 0;
+}
+
+/**
+ * Encode n poses and decode them back, counting mismatches.
+ */
+static int roundtrip(const se3_pose_t* poses, int n) {
+    pose_stream_reset(&g_stream);
+    for (int i = 0; i < n; i++) {
+        if (!pose_stream_append(&g_stream, &poses[i])) {
+            return -1;
+        }
+    }
+
+    pose_reader_t reader;
+    pose_reader_init(&reader, &g_stream);
+
+    int mismatches = 0;
+    se3_pose_t decoded;
+    for (int i = 0; i < n; i++) {
+        if (!pose_reader_next(&reader, &decoded) || !poses_equal(&decoded, &poses[i])) {
+            mismatches++;
+        }
+    }
+    if (pose_reader_next(&reader, &decoded)) {
+        mismatches++;  /* Reader must stop at stream end */
+    }
+    return mismatches;
+}
+
+/* ========================================================================
+ * TEST: Yaw index recovery
+ * ======================================================================== */
+
+void test_yaw_index_recovery(void) {
+    printf("\n[TEST] Yaw Index Recovery\n");
+
+    int failures = 0;
+    for (uint32_t i = 0; i < NUM_FINE_ANGLES; i++) {
+        fixed_t R[9], R2[9];
+        uint32_t idx;
+        rotation_from_yaw(i << (32 - ANGLE_BITS), R);
+
+        if (!pose_yaw_index(R, &idx)) {
+            failures++;
+            continue;
+        }
+        rotation_from_yaw(idx << (32 - ANGLE_BITS), R2);
+        if (memcmp(R, R2, sizeof(R)) != 0) {
+            failures++;
+        }
+    }
+    TEST_ASSERT(failures == 0, "All 8192 LUT yaw rotations recovered exactly");
+
+    fixed_t R[9];
+    uint32_t idx;
+    rotation_from_yaw(0x20000000u, R);
+    R[2] = 1;  /* Tiny pitch component */
+    TEST_ASSERT(!pose_yaw_index(R, &idx), "Non-yaw rotation rejected");
+}
+
+/* ========================================================================
+ * TEST: Cruise round trip and compression ratio
+ * ======================================================================== */
+
+void test_cruise_roundtrip(void) {
+    printf("\n[TEST] Steady Cruise Round Trip\n");
+
+    const int n = 1000;
+    make_cruise(g_poses, n, 366123456u);
+
+    TEST_ASSERT(roundtrip(g_poses, n) == 0, "1000 poses decode bit-identical");
+
+    float bytes_per_pose = (float)g_stream.used / (float)n;
+    float ratio = (float)sizeof(se3_pose_t) / bytes_per_pose;
+    printf("    %u bytes for %d poses: %.2f bytes/pose, %.1fx vs raw\n",
+           g_stream.used, n, bytes_per_pose, ratio);
+    TEST_ASSERT(ratio >= 5.0f, "Compression ratio >= 5x for steady cruise");
+}
+
+/* ========================================================================
+ * TEST: MMSI keyframes and raw rotation escapes
+ * ======================================================================== */
+
+void test_keyframes_and_escapes(void) {
+    printf("\n[TEST] MMSI Keyframes and Raw Rotation Escapes\n");
+
+    make_cruise(g_poses, 60, 111111111u);
+    make_cruise(g_poses + 20, 20, 222222222u);   /* Interleaved vessel */
+
+    /* Arbitrary (non-yaw) rotation in the middle of a track */
+    for (int k = 0; k < 9; k++) {
+        g_poses[40].rotation[k] = (fixed_t)(k * 7919 - 30000);
+    }
+
+    TEST_ASSERT(roundtrip(g_poses, 60) == 0, "Mixed MMSI + raw rotation decode bit-identical");
+
+    pose_reader_t reader;
+    se3_pose_t decoded;
+    pose_reader_init(&reader, &g_stream);
+    int mmsi_ok = 1;
+    for (int i = 0; i < 60 && pose_reader_next(&reader, &decoded); i++) {
+        uint32_t expected = (i >= 20 && i < 40) ? 222222222u : 111111111u;
+        if (decoded.mmsi != expected) {
+            mmsi_ok = 0;
+        }
+    }
+    TEST_ASSERT(mmsi_ok, "MMSI restored per pose from keyframes");
+}
+
+/* ========================================================================
+ * TEST: Interleaved vessels
+ * ======================================================================== */
+
+/**
+ * Round-robin merge of the first k tracks in g_tracks, as a cell sees
+ * reports from several vessels sailing through it at once.
+ */
+static int interleave(int k, int per_vessel) {
+    int n = 0;
+    for (int i = 0; i < per_vessel; i++) {
+        for (int v = 0; v < k; v++) {
+            g_poses[n++] = g_tracks[v][i];
+        }
+    }
+    return n;
+}
+
+void test_interleaved_vessels(void) {
+    printf("\n[TEST] Interleaved Vessels\n");
+
+    for (int v = 0; v < 6; v++) {
+        make_cruise(g_tracks[v], 200, 366000001u + (uint32_t)v * 1111u);
+    }
+
+    int n = interleave(3, 200);
+    TEST_ASSERT(roundtrip(g_poses, n) == 0, "3 interleaved vessels decode bit-identical");
+
+    float bytes_per_pose = (float)g_stream.used / (float)n;
+    float ratio = (float)sizeof(se3_pose_t) / bytes_per_pose;
+    printf("    %u bytes for %d poses: %.2f bytes/pose, %.1fx vs raw\n",
+           g_stream.used, n, bytes_per_pose, ratio);
+    TEST_ASSERT(ratio >= 5.0f, "Compression ratio >= 5x for 3 interleaved vessels");
+
+    /* More vessels than slots: LRU eviction re-keys, still lossless */
+    n = interleave(6, 30);
+    TEST_ASSERT(roundtrip(g_poses, n) == 0,
+                "6 vessels over 4 predictor slots decode bit-identical");
+}
+
+/* ========================================================================
+ * TEST: Extreme values
+ * ======================================================================== */
+
+void test_extreme_values(void) {
+    printf("\n[TEST] Extreme Translation/Timestamp Jumps\n");
+
+    const int32_t extremes[] = { INT32_MIN, INT32_MAX, 0, -1, INT32_MIN, 1, INT32_MAX };
+    const int n = (int)(sizeof(extremes) / sizeof(extremes[0]));
+
+    for (int i = 0; i < n; i++) {
+        se3_pose_from_gps(extremes[i], extremes[n - 1 - i], extremes[(i + 3) % n],
+                          INT_TO_FIXED(i * 97 % 360), (uint32_t)extremes[i], 42u, &g_poses[i]);
+    }
+    TEST_ASSERT(roundtrip(g_poses, n) == 0, "int32 extremes survive wraparound deltas");
+}
+
+/* ========================================================================
+ * TEST: Capacity and truncation
+ * ======================================================================== */
+
+void test_capacity(void) {
+    printf("\n[TEST] Stream Capacity and Truncation\n");
+
+    se3_pose_t pose;
+    int accepted = 0;
+    pose_stream_reset(&g_stream);
+    for (int i = 0; i < 10000; i++) {
+        /* Random-walk worst case: every record is a large residual */
+        se3_pose_from_gps(lcg_noise(0x3FFFFFFF), lcg_noise(0x3FFFFFFF), 0,
+                          0, (uint32_t)lcg_noise(0x3FFFFFFF), 7u, &pose);
+        if (!pose_stream_append(&g_stream, &pose)) {
+            break;
+        }
+        accepted++;
+    }
+    TEST_ASSERT(accepted > 0 && accepted < 10000, "Append refused once stream is full");
+    TEST_ASSERT(g_stream.used <= POSE_STREAM_BYTES, "Stream never exceeds capacity");
+    TEST_ASSERT(!pose_stream_has_room(&g_stream), "has_room reports full stream");
+
+    /* Truncate last record: decoder must stop cleanly, not overrun */
+    g_stream.used = (uint16_t)(g_stream.used - 1);
+    pose_reader_t reader;
+    pose_reader_init(&reader, &g_stream);
+    int decoded = 0;
+    while (pose_reader_next(&reader, &pose)) {
+        decoded++;
+    }
+    TEST_ASSERT(decoded == accepted - 1, "Truncated record rejected by decoder");
+}
+
+/* ========================================================================
+ * TEST: T-BSP compressed cells
+ * ======================================================================== */
+
+void test_t_bsp_compressed(void) {
+    printf("\n[TEST] T-BSP Compressed Cells\n");
+
+    const int n = 900;
+    make_cruise(g_poses, n, 366999999u);
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(47.6f), FLOAT_TO_FIXED(-122.3f));
+
+    uint16_t cell_id = t_bsp_latlon_to_cell(&g_bsp, FLOAT_TO_FIXED(47.6f), FLOAT_TO_FIXED(-122.3f));
+    bool ok = true;
+    for (int i = 0; i < n; i++) {
+        ok = ok && t_bsp_insert_pose(&g_bsp, cell_id, &g_poses[i]);
+    }
+    t_bsp_cell_t* cell = t_bsp_get_cell(&g_bsp, cell_id);
+
+    TEST_ASSERT(ok && cell != NULL, "Poses inserted into compressed cell");
+    TEST_ASSERT(cell->pose_count == n, "Cell holds >5x MAX_POSES_PER_CELL poses");
+    printf("    %d poses in %u bytes (raw capacity: %d poses)\n",
+           cell->pose_count, cell->stream.used, MAX_POSES_PER_CELL);
+
+    pose_reader_t reader;
+    se3_pose_t decoded;
+    int mismatches = 0;
+    t_bsp_cell_reader(cell, &reader);
+    for (int i = 0; i < n; i++) {
+        if (!pose_reader_next(&reader, &decoded) || !poses_equal(&decoded, &g_poses[i])) {
+            mismatches++;
+        }
+    }
+    TEST_ASSERT(mismatches == 0, "Streaming cell decode bit-identical");
+    TEST_ASSERT(t_bsp_cell_near_full(cell, 0.5f), "near_full tracks encoded bytes");
+
+    t_bsp_reset_cell(&g_bsp, cell_id);
+    TEST_ASSERT(t_bsp_get_active_count(&g_bsp) == 0, "Reset releases compressed cell");
+}
+
+/* ========================================================================
+ * TEST: λ engine over compressed cells
+ * ======================================================================== */
+
+void test_lambda_engine_compressed(void) {
+    printf("\n[TEST] λ Engine over Compressed Cells\n");
+
+    const int n = 900;
+    make_cruise(g_poses, n, 366999999u);
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(47.6f), FLOAT_TO_FIXED(-122.3f));
+
+    uint16_t cell_id = t_bsp_latlon_to_cell(&g_bsp, FLOAT_TO_FIXED(47.6f), FLOAT_TO_FIXED(-122.3f));
+    for (int i = 0; i < n; i++) {
+        t_bsp_insert_pose(&g_bsp, cell_id, &g_poses[i]);
+    }
+
+    lambda_segment_t segs[MAX_CELLS];
+    dlt_record_t records[MAX_CELLS];
+    int queued = lambda_engine_collect_cells(&g_bsp, 0.5f, segs, MAX_CELLS);
+    TEST_ASSERT(queued == 1 && segs[0].poses == NULL && segs[0].n == n,
+                "collect_cells queues the compressed cell itself");
+
+    int produced = lambda_engine_process(segs, queued, NULL, records);
+    TEST_ASSERT(produced == 1, "One record per compressed cell");
+
+    /* Same poses stored raw: identical hash, λ and error */
+    uint8_t hash[32];
+    fixed_t error;
+    fixed_t lambda = lambda_estimate_with_error(g_poses, n, LAMBDA_EPSILON, LAMBDA_MAX_ITER, &error);
+    compute_trajectory_hash(g_poses, n, hash);
+    TEST_ASSERT(memcmp(hash, records[0].trajectory_hash, 32) == 0, "Streamed hash matches raw poses");
+    TEST_ASSERT(records[0].lambda_optimal == lambda && records[0].return_error == error,
+                "Streamed λ and return error match raw poses");
+    TEST_ASSERT(records[0].mmsi == g_poses[0].mmsi &&
+                records[0].timestamp == g_poses[n - 1].timestamp &&
+                records[0].cell_id == cell_id,
+                "MMSI, timestamp and cell from the stream");
+
+    /* Mixed batch: raw pose array next to a compressed cell */
+    lambda_segment_t mixed[2] = { segs[0], { g_poses, NULL, 100, 7, 0 } };
+    produced = lambda_engine_process(mixed, 2, NULL, records);
+    compute_trajectory_hash(g_poses, 100, hash);
+    TEST_ASSERT(produced == 2 && records[1].cell_id == 7 &&
+                memcmp(hash, records[1].trajectory_hash, 32) == 0,
+                "Pose-array segments still use the multi-buffer hash");
+
+    t_bsp_reset_cell(&g_bsp, cell_id);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("POSE CODEC - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+    printf("Delta-compressed T-BSP trajectories (%d-byte stream, raw pose %d bytes)\n",
+           POSE_STREAM_BYTES, (int)sizeof(se3_pose_t));
+
+    se3_init_tables();
+
+    test_yaw_index_recovery();
+    test_cruise_roundtrip();
+    test_keyframes_and_escapes();
+    test_interleaved_vessels();
+    test_extreme_values();
+    test_capacity();
+    test_t_bsp_compressed();
+    test_lambda_engine_compressed();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
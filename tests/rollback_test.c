@@ -0,0 +1,446 @@
+/*
+ * rollback_test.c - Unit Tests for the In-Memory Rollback Ring
+ *
+ * Tests:
+ *   1. Rolling back n captures restores state and clock exactly
+ *   2. Only changed tiles are stored and copied back
+ *   3. Capture count and byte budget bound the history
+ *   4. The compare pass gives the same deltas for any thread count
+ *   5. Public API: steps, async jobs, resets; refusals
+ *   6. Rollback cost follows the changed data, not the state size
+ *
+ * Compile with:
+ *   gcc -o rollback_test rollback_test.c ../src/core/rollback.c \
+ *       ../src/core/replay.c ../src/core/event_log.c \
+ *       ../src/core/thread_pool.c ../src/core/step_async.c \
+ *       ../src/core/state_shm.c ../src/core/openmetrics.c \
+ *       ../src/core/mem_stats.c ../src/core/phase_timers.c \
+ *       ../src/core/trace.c ../src/core/state.c \
+ *       ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/barrier_field.c \
+ *       ../src/api/negentropic.c ../src/solvers/hydrology_richards_lite.c \
+ *       ../embedded/sha256.c ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "../src/core/include/rollback.h"
+#include "../src/core/state.h"
+#include "../src/api/negentropic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define CONFIG "{\"num_entities\": 16, \"num_scalar_fields\": 4096}"
+#define HISTORY 20
+
+/* Data and clock after each capture */
+typedef struct {
+    uint8_t* data[HISTORY + 1];
+    SimulationClock clocks[HISTORY + 1];
+    size_t len;
+} History;
+
+static void remember(History* h, void* sim, int i) {
+    const uint8_t* data = state_data(sim, &h->len);
+    if (!h->data[i]) h->data[i] = (uint8_t*)malloc(h->len);
+    memcpy(h->data[i], data, h->len);
+    state_get_clock(sim, &h->clocks[i]);
+}
+
+static int matches(const History* h, void* sim, int i) {
+    SimulationClock clock;
+    state_get_clock(sim, &clock);
+    return memcmp(state_data(sim, NULL), h->data[i], h->len) == 0 &&
+           clock.step_count == h->clocks[i].step_count &&
+           clock.timestamp == h->clocks[i].timestamp;
+}
+
+static void forget(History* h) {
+    for (int i = 0; i <= HISTORY; i++) free(h->data[i]);
+    memset(h, 0, sizeof(*h));
+}
+
+/* Step i: write fields i * 97 and i * 97 + 1 (one or two tiles), then step */
+static void host_step(void* sim, int i) {
+    uint32_t count;
+    float* fields = state_scalar_fields(sim, &count);
+    fields[(i * 97) % count] += 1.0f + (float)i;
+    fields[(i * 97 + 1) % count] -= 0.5f;
+    state_step(sim, 0.0f);
+}
+
+/* ========================================================================
+ * TEST 1: EXACT RESTORE
+ * ======================================================================== */
+
+static void test_restore(void) {
+    printf("\n[TEST 1] Rolling back restores state and clock\n");
+
+    void* sim = neg_create(CONFIG);
+    NegRollback* ring = neg_rollback_create(sim, HISTORY, 0, NULL);
+    History h;
+    memset(&h, 0, sizeof(h));
+    remember(&h, sim, 0);
+    for (int i = 1; i <= HISTORY; i++) {
+        host_step(sim, i);
+        neg_rollback_capture(ring, sim);
+        remember(&h, sim, i);
+    }
+    TEST_ASSERT(ring && neg_rollback_depth(ring) == HISTORY, "Every capture held");
+
+    int ok = neg_rollback_restore(ring, sim, 3, NULL) == NEG_ROLLBACK_OK && matches(&h, sim, 17);
+    TEST_ASSERT(ok && neg_rollback_depth(ring) == HISTORY - 3, "3 steps back: state 17");
+    ok = neg_rollback_restore(ring, sim, 0, NULL) == NEG_ROLLBACK_OK && matches(&h, sim, 17);
+    TEST_ASSERT(ok, "0 steps: unchanged");
+    ok = neg_rollback_restore(ring, sim, 17, NULL) == NEG_ROLLBACK_OK && matches(&h, sim, 0);
+    TEST_ASSERT(ok && neg_rollback_depth(ring) == 0 && neg_rollback_bytes(ring) == 0,
+                "All the way back: initial state, history empty");
+    TEST_ASSERT(neg_rollback_restore(ring, sim, 1, NULL) == NEG_ROLLBACK_TOO_FAR && matches(&h, sim, 0),
+                "Past the oldest capture refused, state untouched");
+
+    /* A new branch from the restored state */
+    for (int i = 1; i <= 5; i++) {
+        host_step(sim, 100 + i);
+        neg_rollback_capture(ring, sim);
+    }
+    ok = neg_rollback_restore(ring, sim, 5, NULL) == NEG_ROLLBACK_OK && matches(&h, sim, 0);
+    TEST_ASSERT(ok, "Branch after a rollback undoes cleanly");
+
+    /* Unchanged data still records the clock */
+    state_step(sim, 0.0f);
+    neg_rollback_capture(ring, sim);
+    TEST_ASSERT(neg_rollback_bytes(ring) == 0 && neg_rollback_depth(ring) == 1,
+                "Step without data changes: clock-only entry");
+    neg_rollback_restore(ring, sim, 1, NULL);
+    TEST_ASSERT(matches(&h, sim, 0), "Clock-only entry restores the clock");
+
+    neg_rollback_destroy(ring);
+    neg_destroy(sim);
+    forget(&h);
+}
+
+/* ========================================================================
+ * TEST 2: DELTAS
+ * ======================================================================== */
+
+static void test_deltas(void) {
+    printf("\n[TEST 2] Only changed tiles are stored\n");
+
+    void* sim = neg_create(CONFIG);
+    size_t len;
+    state_data(sim, &len);
+    NegRollback* ring = neg_rollback_create(sim, 64, 0, NULL);
+
+    uint32_t count;
+    float* fields = state_scalar_fields(sim, &count);
+    fields[0] = 1.0f;                   /* One tile */
+    neg_rollback_capture(ring, sim);
+    size_t one = neg_rollback_bytes(ring);
+    TEST_ASSERT(one == NEG_ROLLBACK_TILE_BYTES + sizeof(uint32_t), "One field: one tile held");
+
+    fields[count - 1] = 2.0f;           /* Short last tile */
+    neg_rollback_capture(ring, sim);
+    size_t tail = neg_rollback_bytes(ring) - one;
+    size_t short_tile = len % NEG_ROLLBACK_TILE_BYTES ? len % NEG_ROLLBACK_TILE_BYTES
+                                                      : NEG_ROLLBACK_TILE_BYTES;
+    TEST_ASSERT(tail == short_tile + sizeof(uint32_t), "Last tile stored at its real length");
+
+    for (uint32_t i = 0; i < count; i++) fields[i] = (float)i;
+    neg_rollback_capture(ring, sim);
+    TEST_ASSERT(neg_rollback_bytes(ring) > count * sizeof(float), "Rewrite of every field: every field tile held");
+
+    uint64_t tiles;
+    neg_rollback_restore(ring, sim, 2, &tiles);
+    TEST_ASSERT(tiles == (count * sizeof(float) + NEG_ROLLBACK_TILE_BYTES - 1) / NEG_ROLLBACK_TILE_BYTES + 1 ||
+                tiles == (count * sizeof(float)) / NEG_ROLLBACK_TILE_BYTES + 2,
+                "Restore copies exactly the tiles the captures held");
+    neg_rollback_restore(ring, sim, 1, &tiles);
+    TEST_ASSERT(tiles == 1 && fields[0] == 0.0f && fields[count - 1] == 0.0f,
+                "Single-tile restore copies one tile");
+
+    neg_rollback_destroy(ring);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 3: BOUNDS
+ * ======================================================================== */
+
+static void test_bounds(void) {
+    printf("\n[TEST 3] Capture count and byte budget\n");
+
+    void* sim = neg_create(CONFIG);
+    NegRollback* ring = neg_rollback_create(sim, 5, 0, NULL);
+    History h;
+    memset(&h, 0, sizeof(h));
+    for (int i = 1; i <= 12; i++) {
+        host_step(sim, i);
+        neg_rollback_capture(ring, sim);
+        remember(&h, sim, i);
+    }
+    TEST_ASSERT(neg_rollback_depth(ring) == 5, "Depth capped at K");
+    TEST_ASSERT(neg_rollback_restore(ring, sim, 6, NULL) == NEG_ROLLBACK_TOO_FAR,
+                "Dropped captures cannot be reached");
+    TEST_ASSERT(neg_rollback_restore(ring, sim, 5, NULL) == NEG_ROLLBACK_OK && matches(&h, sim, 7),
+                "Oldest kept capture still restores");
+    neg_rollback_destroy(ring);
+
+    /* Each step changes one or two tiles: budget for about three entries */
+    size_t entry = 2 * (NEG_ROLLBACK_TILE_BYTES + sizeof(uint32_t));
+    ring = neg_rollback_create(sim, 100, 3 * entry, NULL);
+    int within = 1;
+    for (int i = 1; i <= 20; i++) {
+        host_step(sim, i);
+        neg_rollback_capture(ring, sim);
+        if (neg_rollback_bytes(ring) > 3 * entry) within = 0;
+    }
+    TEST_ASSERT(within && neg_rollback_depth(ring) >= 3 && neg_rollback_depth(ring) < 10,
+                "Budget respected after every capture; oldest dropped first");
+
+    uint32_t count;
+    float* fields = state_scalar_fields(sim, &count);
+    for (uint32_t i = 0; i < count; i++) fields[i] += 1.0f;
+    neg_rollback_capture(ring, sim);
+    TEST_ASSERT(neg_rollback_depth(ring) == 0 && neg_rollback_bytes(ring) == 0,
+                "Delta over the budget empties the history");
+    host_step(sim, 1);
+    neg_rollback_capture(ring, sim);
+    TEST_ASSERT(neg_rollback_depth(ring) == 1, "History restarts from the new base");
+
+    TEST_ASSERT(neg_rollback_create(sim, 0, 0, NULL) == NULL, "K = 0 rejected");
+
+    neg_rollback_destroy(ring);
+    neg_destroy(sim);
+    forget(&h);
+}
+
+/* ========================================================================
+ * TEST 4: PARALLEL COMPARE
+ * ======================================================================== */
+
+static void test_parallel(void) {
+    printf("\n[TEST 4] Compare pass is independent of threads\n");
+
+    const char* config = "{\"num_entities\": 16, \"num_scalar_fields\": 1000000}";
+    void* sims[2] = { neg_create(config), neg_create(config) };
+    NegPoolConfig pools[2];
+    neg_pool_config_default(&pools[0]);
+    neg_pool_config_default(&pools[1]);
+    pools[1].threads = 4;
+    pools[1].tile_size = 7;             /* Ignored: compare tiles are fixed */
+    NegRollback* rings[2];
+    uint64_t start = state_hash(sims[0]);
+
+    for (int k = 0; k < 2; k++) {
+        rings[k] = neg_rollback_create(sims[k], 16, 0, &pools[k]);
+        uint32_t count;
+        float* fields = state_scalar_fields(sims[k], &count);
+        for (int i = 1; i <= 10; i++) {
+            for (int j = 0; j < 50 * i; j++) fields[((uint32_t)j * 7919u * (uint32_t)i) % count] += 1.0f;
+            state_step(sims[k], 0.0f);
+            neg_rollback_capture(rings[k], sims[k]);
+        }
+    }
+    int same = neg_rollback_bytes(rings[0]) == neg_rollback_bytes(rings[1]) &&
+           neg_rollback_bytes(rings[0]) > 0;
+    TEST_ASSERT(same, "Same deltas with 1 and 4 threads");
+
+    uint64_t tiles[2];
+    for (int k = 0; k < 2; k++) neg_rollback_restore(rings[k], sims[k], 10, &tiles[k]);
+    TEST_ASSERT(tiles[0] == tiles[1] && tiles[0] > 0, "Same tiles copied back");
+    TEST_ASSERT(state_hash(sims[0]) == start && state_hash(sims[1]) == start,
+                "Both restore the initial state");
+
+    for (int k = 0; k < 2; k++) {
+        neg_rollback_destroy(rings[k]);
+        neg_destroy(sims[k]);
+    }
+}
+
+/* ========================================================================
+ * TEST 5: PUBLIC API
+ * ======================================================================== */
+
+static void test_api(void) {
+    printf("\n[TEST 5] Public API\n");
+
+    void* sim = neg_create(CONFIG);
+    TEST_ASSERT(neg_rollback(sim, 1) == NEG_ERROR_INVALID_STATE && neg_get_rollback_depth(sim) == 0,
+                "Rollback off by default");
+    TEST_ASSERT(neg_enable_rollback(sim, 32, 1 << 20) == NEG_SUCCESS, "Rollback enabled");
+
+    uint64_t h0 = neg_get_state_hash(sim);
+    uint32_t count;
+    float* fields = state_scalar_fields(sim, &count);
+    fields[10] = 5.0f;
+    neg_step(sim, 0.0f);
+    uint64_t h1 = neg_get_state_hash(sim);
+    fields[2000] = -3.0f;               /* "Intervention" applied before the step */
+    neg_step_n(sim, 0.0f, 3);
+    uint64_t h4 = neg_get_state_hash(sim);
+    TEST_ASSERT(neg_get_rollback_depth(sim) == 4, "Each step captured");
+
+    neg_step_async(sim, 0.0f, 5);
+    neg_wait(sim, 0);
+    TEST_ASSERT(neg_get_rollback_depth(sim) == 9, "Async steps captured");
+
+    /* Poses fit, scalar fields do not: rejected after the poses were copied */
+    void* other = neg_create("{\"num_entities\": 16, \"num_scalar_fields\": 8}");
+    size_t other_len;
+    uint8_t* other_data = state_data(other, &other_len);
+    memset(other_data, 0xAB, other_len - 8 * sizeof(float));
+    size_t other_size = neg_get_state_binary_size(other);
+    uint8_t* mismatched = (uint8_t*)malloc(other_size);
+    neg_get_state_binary(other, mismatched, other_size);
+    neg_destroy(other);
+    uint64_t h9 = neg_get_state_hash(sim);
+    TEST_ASSERT(neg_reset_from_binary(sim, mismatched, other_size) == NEG_ERROR_INVALID_STATE &&
+                neg_get_state_hash(sim) == h9 && neg_get_rollback_depth(sim) == 9,
+                "Failed reset leaves state and history as they were");
+    free(mismatched);
+
+    size_t size = neg_get_state_binary_size(sim);
+    uint8_t* blank = (uint8_t*)calloc(1, size);
+    void* zero = neg_create(CONFIG);
+    neg_get_state_binary(zero, blank, size);
+    neg_destroy(zero);
+    neg_reset_from_binary(sim, blank, size);
+    TEST_ASSERT(neg_get_rollback_depth(sim) == 10 && state_scalar_fields(sim, &count)[10] == 0.0f,
+                "Reset captured");
+
+    TEST_ASSERT(neg_rollback(sim, 1) == NEG_SUCCESS && state_scalar_fields(sim, &count)[10] == 5.0f,
+                "Rollback undoes the reset");
+    TEST_ASSERT(neg_rollback(sim, 5) == NEG_SUCCESS && neg_get_state_hash(sim) == h4,
+                "Rollback undoes the async job");
+    TEST_ASSERT(neg_rollback(sim, 3) == NEG_SUCCESS && neg_get_state_hash(sim) == h1,
+                "Rollback undoes the intervention with its steps");
+    TEST_ASSERT(neg_rollback(sim, 2) == NEG_ERROR_INVALID_CONFIG && neg_get_state_hash(sim) == h1,
+                "Too far refused");
+    TEST_ASSERT(neg_rollback(sim, 1) == NEG_SUCCESS && neg_get_state_hash(sim) == h0,
+                "Back to the start");
+
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/neg_rollback_test_%ld.nevt", (long)getpid());
+    remove(path);
+    neg_step(sim, 0.0f);
+    neg_open_event_log(sim, path, 0, 0);
+    TEST_ASSERT(neg_rollback(sim, 1) == NEG_ERROR_INVALID_STATE, "Refused while an event log is open");
+    neg_close_event_log(sim);
+    remove(path);
+
+    TEST_ASSERT(neg_enable_rollback(sim, 0, 0) == NEG_SUCCESS && neg_get_rollback_depth(sim) == 0,
+                "Rollback turned off");
+    TEST_ASSERT(neg_enable_rollback(sim, 4, 0) == NEG_SUCCESS, "Re-enabled; freed by neg_destroy()");
+
+    free(blank);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 6: COST
+ * ======================================================================== */
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void test_cost(void) {
+    printf("\n[TEST 6] Rollback cost follows the changed data\n");
+
+    enum { FIELDS = 4 * 1024 * 1024, STEPS = 64 };
+    char config[128];
+    snprintf(config, sizeof(config), "{\"num_entities\": 16, \"num_scalar_fields\": %d}", FIELDS);
+    void* sim = neg_create(config);
+    NegRollback* ring = neg_rollback_create(sim, STEPS, 0, NULL);
+
+    uint32_t count;
+    float* fields = state_scalar_fields(sim, &count);
+    double capture = 0.0;
+    for (int i = 0; i < STEPS; i++) {
+        fields[(uint32_t)i * 65537u % count] += 1.0f;
+        state_step(sim, 0.0f);
+        double t0 = now_sec();
+        neg_rollback_capture(ring, sim);
+        capture += now_sec() - t0;
+    }
+
+    uint64_t tiles;
+    double t0 = now_sec();
+    neg_rollback_restore(ring, sim, STEPS, &tiles);
+    double restore = now_sec() - t0;
+
+    size_t len;
+    uint8_t* copy = (uint8_t*)malloc(FIELDS * sizeof(float));
+    const uint8_t* data = state_data(sim, &len);
+    t0 = now_sec();
+    memcpy(copy, data, FIELDS * sizeof(float));
+    double full = now_sec() - t0;
+
+    printf("  %.1f MB state: capture %.3f ms/step, restore of %d steps %.3f ms "
+           "(%llu tiles), full copy %.3f ms\n",
+           (double)len / 1e6, capture / STEPS * 1e3, STEPS, restore * 1e3,
+           (unsigned long long)tiles, full * 1e3);
+    TEST_ASSERT(tiles == STEPS, "One tile copied back per step");
+    TEST_ASSERT(neg_rollback_depth(ring) == 0 && fields[0] == 0.0f, "History consumed, state restored");
+
+    free(copy);
+    neg_rollback_destroy(ring);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("ROLLBACK RING - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_restore();
+    test_deltas();
+    test_bounds();
+    test_parallel();
+    test_api();
+    test_cost();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
@@ -0,0 +1,346 @@
+/*
+ * se3_batch_test.c - Unit Tests for SIMD Batch SE(3) Math
+ *
+ * Tests for:
+ *   1. rotation_mul_n() bit-identical to rotation_mul()
+ *   2. mat3_mul_vec3_n() bit-identical to mat3_mul_vec3()
+ *   3. vec3_sub_n() bit-identical to vec3_sub()
+ *   4. Ragged batch sizes (SIMD body + scalar tail) and in-place output
+ *   5. AoS ↔ SoA pose transposition
+ *   6. Throughput vs per-pose scalar calls
+ *
+ * Compile with (any of -mavx2 / -msse4.1 / default to select a path):
+ *   gcc -o se3_batch_test se3_batch_test.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c ../embedded/se3_batch.c \
+ *       -I../embedded -lm -std=c99
+ *
+ * Author: ClaudeCode (batch SE(3) math)
+ * Version: 1.0
+ */
+
+#include "../embedded/se3_edge.h"
+#include "../embedded/se3_batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define BATCH_N  4096
+
+/* Large objects kept static (avoids stack pressure) */
+static fixed_t g_a[9 * BATCH_N], g_b[9 * BATCH_N], g_c[9 * BATCH_N];
+static fixed_t g_ref[9 * BATCH_N];
+static se3_pose_t g_poses[BATCH_N];
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 777u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+/**
+ * Random operand with a mix of magnitudes: rotation-range values,
+ * large translations and the ±2^30 extremes (sum of three products
+ * stays inside int64, as for the scalar path).
+ */
+static fixed_t rand_operand(void) {
+    uint32_t r = lcg_next();
+    switch (r & 3u) {
+        case 0:  return (fixed_t)((int32_t)(lcg_next() % (2u * FRACUNIT + 1u)) - FRACUNIT);
+        case 1:  return (fixed_t)((int32_t)(lcg_next() >> 2) - (1 << 29));
+        case 2:  return (r & 4u) ? (1 << 30) - 1 : -(1 << 30);
+        default: return (fixed_t)((int32_t)(lcg_next() % 2001u) - 1000);
+    }
+}
+
+static void fill_random(fixed_t* buf, int count) {
+    for (int i = 0; i < count; i++) {
+        buf[i] = rand_operand();
+    }
+}
+
+static double now_sec(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+/* Scalar reference over the whole batch (per-pose API) */
+static void reference_rotation_mul(const mat3_soa_t* A, const mat3_soa_t* B, fixed_t* out, int n) {
+    for (int i = 0; i < n; i++) {
+        fixed_t a[9], b[9], c[9];
+        for (int k = 0; k < 9; k++) {
+            a[k] = A->m[k][i];
+            b[k] = B->m[k][i];
+        }
+        rotation_mul(a, b, c);
+        for (int k = 0; k < 9; k++) {
+            out[k * BATCH_N + i] = c[k];
+        }
+    }
+}
+
+static void reference_mat3_mul_vec3(const mat3_soa_t* R, const vec3_soa_t* v, fixed_t* out, int n) {
+    for (int i = 0; i < n; i++) {
+        fixed_t r[9], x[3], y[3];
+        for (int k = 0; k < 9; k++) r[k] = R->m[k][i];
+        for (int k = 0; k < 3; k++) x[k] = v->v[k][i];
+        mat3_mul_vec3(r, x, y);
+        for (int k = 0; k < 3; k++) out[k * BATCH_N + i] = y[k];
+    }
+}
+
+static int planes_equal(const fixed_t* a, const fixed_t* b, int planes, int n) {
+    for (int k = 0; k < planes; k++) {
+        if (memcmp(a + k * BATCH_N, b + k * BATCH_N, (size_t)n * sizeof(fixed_t)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ========================================================================
+ * TEST 1: rotation_mul_n
+ * ======================================================================== */
+
+void test_rotation_mul_n(void) {
+    printf("\n[TEST 1] rotation_mul_n vs rotation_mul\n");
+    mat3_soa_t A, B, C;
+
+    mat3_soa_bind(&A, g_a, BATCH_N);
+    mat3_soa_bind(&B, g_b, BATCH_N);
+    mat3_soa_bind(&C, g_c, BATCH_N);
+    fill_random(g_a, 9 * BATCH_N);
+    fill_random(g_b, 9 * BATCH_N);
+
+    rotation_mul_n(&A, &B, &C, BATCH_N);
+    reference_rotation_mul(&A, &B, g_ref, BATCH_N);
+    TEST_ASSERT(planes_equal(g_c, g_ref, 9, BATCH_N), "4096 random products bit-identical");
+
+    /* Real rotations: yaw compositions */
+    for (int i = 0; i < BATCH_N; i++) {
+        fixed_t ra[9], rb[9];
+        rotation_from_yaw(lcg_next(), ra);
+        rotation_from_yaw(lcg_next(), rb);
+        for (int k = 0; k < 9; k++) {
+            A.m[k][i] = ra[k];
+            B.m[k][i] = rb[k];
+        }
+    }
+    rotation_mul_n(&A, &B, &C, BATCH_N);
+    reference_rotation_mul(&A, &B, g_ref, BATCH_N);
+    TEST_ASSERT(planes_equal(g_c, g_ref, 9, BATCH_N), "Yaw rotation compositions bit-identical");
+
+    /* In place: A = A * B */
+    reference_rotation_mul(&A, &B, g_ref, BATCH_N);
+    rotation_mul_n(&A, &B, &A, BATCH_N);
+    TEST_ASSERT(planes_equal(g_a, g_ref, 9, BATCH_N), "In-place output (C aliases A)");
+}
+
+/* ========================================================================
+ * TEST 2: mat3_mul_vec3_n
+ * ======================================================================== */
+
+void test_mat3_mul_vec3_n(void) {
+    printf("\n[TEST 2] mat3_mul_vec3_n vs mat3_mul_vec3\n");
+    mat3_soa_t R;
+    vec3_soa_t v, out;
+
+    mat3_soa_bind(&R, g_a, BATCH_N);
+    vec3_soa_bind(&v, g_b, BATCH_N);
+    vec3_soa_bind(&out, g_c, BATCH_N);
+    fill_random(g_a, 9 * BATCH_N);
+    fill_random(g_b, 3 * BATCH_N);
+
+    mat3_mul_vec3_n(&R, &v, &out, BATCH_N);
+    reference_mat3_mul_vec3(&R, &v, g_ref, BATCH_N);
+    TEST_ASSERT(planes_equal(g_c, g_ref, 3, BATCH_N), "4096 random transforms bit-identical");
+
+    mat3_mul_vec3_n(&R, &v, &v, BATCH_N);
+    TEST_ASSERT(planes_equal(g_b, g_ref, 3, BATCH_N), "In-place output (out aliases v)");
+}
+
+/* ========================================================================
+ * TEST 3: vec3_sub_n
+ * ======================================================================== */
+
+void test_vec3_sub_n(void) {
+    printf("\n[TEST 3] vec3_sub_n vs vec3_sub\n");
+    vec3_soa_t a, b, out;
+    int ok = 1;
+
+    vec3_soa_bind(&a, g_a, BATCH_N);
+    vec3_soa_bind(&b, g_b, BATCH_N);
+    vec3_soa_bind(&out, g_c, BATCH_N);
+    fill_random(g_a, 3 * BATCH_N);
+    fill_random(g_b, 3 * BATCH_N);
+
+    vec3_sub_n(&a, &b, &out, BATCH_N);
+    for (int i = 0; i < BATCH_N; i++) {
+        fixed_t x[3] = { a.v[0][i], a.v[1][i], a.v[2][i] };
+        fixed_t y[3] = { b.v[0][i], b.v[1][i], b.v[2][i] };
+        fixed_t d[3];
+        vec3_sub(x, y, d);
+        for (int k = 0; k < 3; k++) {
+            if (d[k] != out.v[k][i]) ok = 0;
+        }
+    }
+    TEST_ASSERT(ok, "4096 differences bit-identical");
+}
+
+/* ========================================================================
+ * TEST 4: Ragged Batch Sizes
+ * ======================================================================== */
+
+void test_ragged(void) {
+    printf("\n[TEST 4] Ragged Batch Sizes (SIMD body + scalar tail)\n");
+    mat3_soa_t A, B, C;
+    int ok = 1, untouched = 1;
+
+    mat3_soa_bind(&A, g_a, BATCH_N);
+    mat3_soa_bind(&B, g_b, BATCH_N);
+    mat3_soa_bind(&C, g_c, BATCH_N);
+    fill_random(g_a, 9 * BATCH_N);
+    fill_random(g_b, 9 * BATCH_N);
+    reference_rotation_mul(&A, &B, g_ref, BATCH_N);
+
+    for (int n = 0; n <= 37; n++) {
+        for (int k = 0; k < 9; k++) {
+            C.m[k][n] = 0x5A5A5A5A;   /* Sentinel just past the batch */
+        }
+        rotation_mul_n(&A, &B, &C, n);
+        if (!planes_equal(g_c, g_ref, 9, n)) ok = 0;
+        for (int k = 0; k < 9; k++) {
+            if (C.m[k][n] != 0x5A5A5A5A) untouched = 0;
+        }
+    }
+    TEST_ASSERT(ok, "n = 0..37 bit-identical");
+    TEST_ASSERT(untouched, "No writes past n");
+}
+
+/* ========================================================================
+ * TEST 5: AoS ↔ SoA
+ * ======================================================================== */
+
+void test_transpose(void) {
+    printf("\n[TEST 5] Pose Transposition\n");
+    static se3_pose_t copy[BATCH_N];
+    mat3_soa_t R;
+    vec3_soa_t t;
+
+    mat3_soa_bind(&R, g_a, BATCH_N);
+    vec3_soa_bind(&t, g_b, BATCH_N);
+
+    for (int i = 0; i < BATCH_N; i++) {
+        se3_pose_from_gps((fixed_t)(lcg_next() >> 4), (fixed_t)(lcg_next() >> 4), 0,
+                          (fixed_t)(lcg_next() % (360u << 16)), 1700000000u + (uint32_t)i,
+                          366000000u + (uint32_t)(i & 7), &g_poses[i]);
+    }
+    memcpy(copy, g_poses, sizeof(copy));
+
+    se3_poses_to_soa(g_poses, BATCH_N, &R, &t);
+    TEST_ASSERT(R.m[4][17] == g_poses[17].rotation[4] && t.v[2][99] == g_poses[99].translation[2],
+                "Planes hold pose elements");
+
+    memset(g_poses, 0, sizeof(g_poses));
+    for (int i = 0; i < BATCH_N; i++) {
+        g_poses[i].timestamp = copy[i].timestamp;
+        g_poses[i].mmsi = copy[i].mmsi;
+    }
+    se3_poses_from_soa(&R, &t, BATCH_N, g_poses);
+    TEST_ASSERT(memcmp(copy, g_poses, sizeof(copy)) == 0, "Round trip restores poses exactly");
+}
+
+/* ========================================================================
+ * TEST 6: Throughput
+ * ======================================================================== */
+
+void test_throughput(void) {
+    printf("\n[TEST 6] Throughput (%d lanes)\n", se3_batch_lanes());
+    mat3_soa_t A, B, C;
+    const int reps = 200;
+    double t0, t_scalar, t_batch;
+    volatile fixed_t sink = 0;
+
+    mat3_soa_bind(&A, g_a, BATCH_N);
+    mat3_soa_bind(&B, g_b, BATCH_N);
+    mat3_soa_bind(&C, g_c, BATCH_N);
+    for (int i = 0; i < BATCH_N; i++) {
+        fixed_t ra[9], rb[9];
+        rotation_from_yaw(lcg_next(), ra);
+        rotation_from_yaw(lcg_next(), rb);
+        for (int k = 0; k < 9; k++) {
+            A.m[k][i] = ra[k];
+            B.m[k][i] = rb[k];
+        }
+    }
+
+    t0 = now_sec();
+    for (int r = 0; r < reps; r++) {
+        reference_rotation_mul(&A, &B, g_ref, BATCH_N);
+        sink += g_ref[r];
+    }
+    t_scalar = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int r = 0; r < reps; r++) {
+        rotation_mul_n(&A, &B, &C, BATCH_N);
+        sink += g_c[r];
+    }
+    t_batch = now_sec() - t0;
+    (void)sink;
+
+    printf("    rotation_mul (per pose): %.2f ns/matrix\n", t_scalar * 1e9 / (reps * BATCH_N));
+    printf("    rotation_mul_n (batch):  %.2f ns/matrix (%.1fx)\n",
+           t_batch * 1e9 / (reps * BATCH_N), t_scalar / t_batch);
+    TEST_ASSERT(t_batch > 0.0, "Batch timing recorded");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("SE(3) BATCH MATH - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+    printf("SIMD lanes: %d\n", se3_batch_lanes());
+
+    se3_init_tables();
+
+    test_rotation_mul_n();
+    test_mat3_mul_vec3_n();
+    test_vec3_sub_n();
+    test_ragged();
+    test_transpose();
+    test_throughput();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
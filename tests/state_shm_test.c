@@ -0,0 +1,343 @@
+/*
+ * state_shm_test.c - Unit Tests for Shared-Memory State Publication
+ *
+ * Tests for:
+ *   1. Segment lifecycle: name validation, EMPTY before the first frame,
+ *      capacity rounding, unknown segments
+ *   2. neg_publish_state(): frame bytes equal neg_get_state_binary(), the
+ *      frame hash equals neg_get_state_hash(), frame numbers advance
+ *   3. TOO_SMALL reader buffers and oversized commits (nothing published)
+ *   4. Concurrent readers (threads) never see a torn frame while the
+ *      writer publishes continuously
+ *   5. A reader in a forked process sees the writer's frames
+ *
+ * Compile with:
+ *   gcc -o state_shm_test state_shm_test.c ../src/core/state_shm.c ../src/core/openmetrics.c \
+ *       ../src/core/mem_stats.c ../src/core/phase_timers.c ../src/core/trace.c \
+ *       ../src/core/state.c ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/barrier_field.c \
+ *       ../src/core/step_async.c ../src/api/negentropic.c \
+ *       ../src/solvers/hydrology_richards_lite.c ../src/core/thread_pool.c \
+ *       ../src/core/event_log.c ../src/core/replay.c ../src/core/rollback.c \
+ *       ../embedded/sha256.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "../src/core/include/state_shm.h"
+#include "../src/api/negentropic.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define PATTERN_BYTES 4096
+#define PATTERN_FRAMES 20000
+#define READER_THREADS 3
+#define READS_MIN 1000
+
+static char seg_name[64];
+
+/* Frame f: a size word, then every 64-bit word equal to f */
+static size_t pattern_size(uint64_t f) {
+    return 64 + (size_t)(f * 24 % (PATTERN_BYTES - 64)) / 8 * 8;
+}
+
+static int pattern_ok(const uint8_t* buf, int64_t n, const NegShmFrame* fr) {
+    if (n <= 0 || (uint64_t)n != fr->size || (size_t)n != pattern_size(fr->frame)) return 0;
+    for (int64_t off = 0; off < n; off += 8) {
+        uint64_t w;
+        memcpy(&w, buf + off, sizeof(w));
+        if (w != fr->frame) return 0;
+    }
+    return fr->state_hash == ~fr->frame && fr->timestamp_ms == fr->frame * 10;
+}
+
+static void publish_pattern(NegShmWriter* w, uint64_t f) {
+    uint8_t* slot = neg_shm_begin(w);
+    size_t size = pattern_size(f);
+    for (size_t off = 0; off < size; off += 8) memcpy(slot + off, &f, sizeof(f));
+    neg_shm_commit(w, size, ~f, f * 10);
+}
+
+/* ========================================================================
+ * TEST 1: SEGMENT LIFECYCLE
+ * ======================================================================== */
+
+static void test_lifecycle(void) {
+    printf("\n[TEST 1] Segment lifecycle\n");
+
+    TEST_ASSERT(!neg_shm_writer_create("no-slash", 64) &&
+                !neg_shm_writer_create("/a/b", 64) &&
+                !neg_shm_writer_create("/", 64) &&
+                !neg_shm_writer_create(seg_name, 0), "Invalid names and capacity rejected");
+
+    NegShmWriter* w = neg_shm_writer_create(seg_name, 100);
+    TEST_ASSERT(w && neg_shm_writer_capacity(w) == 128, "Capacity rounded up to 64 bytes");
+
+    NegShmReader* r = neg_shm_reader_open(seg_name);
+    uint8_t buf[128];
+    NegShmFrame fr;
+    TEST_ASSERT(r && neg_shm_reader_capacity(r) == 128 && neg_shm_latest(r) == 0,
+                "Reader maps the segment, no frame yet");
+    TEST_ASSERT(neg_shm_read(r, buf, sizeof(buf), &fr) == NEG_SHM_EMPTY,
+                "Read before the first publish is EMPTY");
+    TEST_ASSERT(neg_shm_read(NULL, buf, sizeof(buf), &fr) == NEG_SHM_ERROR &&
+                neg_shm_read(r, NULL, sizeof(buf), &fr) == NEG_SHM_ERROR,
+                "NULL reader / buffer rejected");
+
+    neg_shm_reader_close(r);
+    neg_shm_writer_destroy(w, 1);
+    TEST_ASSERT(neg_shm_reader_open(seg_name) == NULL, "Unlinked segment cannot be opened");
+    TEST_ASSERT(neg_shm_reader_open("/neg-shm-test-missing") == NULL,
+                "Missing segment cannot be opened");
+}
+
+/* ========================================================================
+ * TEST 2: PUBLISH SIMULATION STATE
+ * ======================================================================== */
+
+static void test_publish_state(void) {
+    printf("\n[TEST 2] neg_publish_state\n");
+
+    void* sim = neg_create("{\"num_entities\": 16, \"num_scalar_fields\": 256}");
+    size_t size = neg_get_state_binary_size(sim);
+    NegShmWriter* w = neg_shm_writer_create(seg_name, size);
+    NegShmReader* r = neg_shm_reader_open(seg_name);
+    uint8_t* expected = (uint8_t*)malloc(size);
+    uint8_t* got = (uint8_t*)malloc(size);
+    TEST_ASSERT(sim && w && r && expected && got, "Simulation, writer and reader created");
+
+    int ok = 1;
+    for (int i = 0; i < 5; i++) {
+        neg_step(sim, 0.016f);
+        int64_t frame = neg_publish_state(sim, w);
+        NegShmFrame fr;
+        int64_t n = neg_shm_read(r, got, size, &fr);
+        int written = neg_get_state_binary(sim, expected, size);
+        ok &= frame == i + 1 && n == written && fr.frame == (uint64_t)frame &&
+              memcmp(got, expected, size) == 0 && fr.state_hash == neg_get_state_hash(sim);
+    }
+    TEST_ASSERT(ok, "Frames match neg_get_state_binary() and neg_get_state_hash()");
+    TEST_ASSERT(neg_shm_latest(r) == 5, "Frame counter advances per publish");
+
+    TEST_ASSERT(neg_publish_state(NULL, w) == NEG_ERROR_NULL_HANDLE &&
+                neg_publish_state(sim, NULL) == NEG_ERROR_INVALID_STATE,
+                "NULL simulation / writer rejected");
+
+    neg_shm_reader_close(r);
+    neg_shm_writer_destroy(w, 1);
+
+    w = neg_shm_writer_create(seg_name, 64);
+    TEST_ASSERT(neg_publish_state(sim, w) == NEG_ERROR_BUFFER_TOO_SMALL,
+                "State larger than the segment rejected");
+    neg_shm_writer_destroy(w, 1);
+
+    free(expected);
+    free(got);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 3: SHORT BUFFERS AND OVERSIZED COMMITS
+ * ======================================================================== */
+
+static void test_sizes(void) {
+    printf("\n[TEST 3] Short buffers and oversized commits\n");
+
+    NegShmWriter* w = neg_shm_writer_create(seg_name, PATTERN_BYTES);
+    NegShmReader* r = neg_shm_reader_open(seg_name);
+    uint8_t buf[PATTERN_BYTES];
+    NegShmFrame fr;
+
+    publish_pattern(w, 1);
+    TEST_ASSERT(neg_shm_read(r, buf, 8, &fr) == NEG_SHM_TOO_SMALL,
+                "Short buffer reports TOO_SMALL");
+
+    neg_shm_begin(w);
+    TEST_ASSERT(neg_shm_commit(w, PATTERN_BYTES + 1, 0, 0) == 0,
+                "Commit beyond capacity refused");
+    TEST_ASSERT(neg_shm_commit(w, 8, 0, 0) == 0, "Commit without begin refused");
+
+    int64_t n = neg_shm_read(r, buf, sizeof(buf), &fr);
+    TEST_ASSERT(fr.frame == 1 && pattern_ok(buf, n, &fr),
+                "Readers keep the last complete frame");
+
+    publish_pattern(w, 2);
+    n = neg_shm_read(r, buf, sizeof(buf), &fr);
+    TEST_ASSERT(fr.frame == 2 && pattern_ok(buf, n, &fr), "Next publish continues at frame 2");
+
+    neg_shm_reader_close(r);
+    neg_shm_writer_destroy(w, 1);
+}
+
+/* ========================================================================
+ * TEST 4: CONCURRENT READERS
+ * ======================================================================== */
+
+static atomic_int writer_done;
+static atomic_int readers_ready;
+static atomic_long reads_total;
+
+typedef struct {
+    long reads;
+    long torn;
+    long backwards;
+} ReaderStats;
+
+static void* reader_main(void* arg) {
+    ReaderStats* st = (ReaderStats*)arg;
+    NegShmReader* r = neg_shm_reader_open(seg_name);
+    uint8_t* buf = (uint8_t*)malloc(PATTERN_BYTES);
+    uint64_t last = 0;
+    atomic_fetch_add(&readers_ready, 1);
+
+    while (r && buf && !atomic_load(&writer_done)) {
+        NegShmFrame fr;
+        int64_t n = neg_shm_read(r, buf, PATTERN_BYTES, &fr);
+        if (n == NEG_SHM_EMPTY || n == NEG_SHM_RETRY) continue;
+        st->reads++;
+        atomic_fetch_add(&reads_total, 1);
+        if (!pattern_ok(buf, n, &fr)) st->torn++;
+        if (fr.frame < last) st->backwards++;
+        last = fr.frame;
+    }
+
+    free(buf);
+    neg_shm_reader_close(r);
+    return NULL;
+}
+
+static void test_concurrent(void) {
+    printf("\n[TEST 4] Concurrent readers\n");
+
+    NegShmWriter* w = neg_shm_writer_create(seg_name, PATTERN_BYTES);
+    pthread_t threads[READER_THREADS];
+    ReaderStats st[READER_THREADS];
+    memset(st, 0, sizeof(st));
+    atomic_store(&writer_done, 0);
+    atomic_store(&readers_ready, 0);
+    atomic_store(&reads_total, 0);
+
+    for (int i = 0; i < READER_THREADS; i++) {
+        pthread_create(&threads[i], NULL, reader_main, &st[i]);
+    }
+    while (atomic_load(&readers_ready) < READER_THREADS) sched_yield();
+    /* Keep publishing until the readers got their turn (single-CPU hosts) */
+    for (uint64_t f = 1; f <= PATTERN_FRAMES ||
+                         (atomic_load(&reads_total) < READS_MIN && f <= 100 * PATTERN_FRAMES); f++) {
+        publish_pattern(w, f);
+        if (f % 64 == 0) sched_yield();
+    }
+    atomic_store(&writer_done, 1);
+
+    long reads = 0, torn = 0, backwards = 0;
+    for (int i = 0; i < READER_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        reads += st[i].reads;
+        torn += st[i].torn;
+        backwards += st[i].backwards;
+    }
+    printf("    %ld reads across %d readers\n", reads, READER_THREADS);
+
+    TEST_ASSERT(reads > 0, "Readers completed reads during publishing");
+    TEST_ASSERT(torn == 0, "No torn frames");
+    TEST_ASSERT(backwards == 0, "Frame numbers never go backwards");
+
+    neg_shm_writer_destroy(w, 1);
+}
+
+/* ========================================================================
+ * TEST 5: READER IN ANOTHER PROCESS
+ * ======================================================================== */
+
+static void test_fork(void) {
+    printf("\n[TEST 5] Reader in another process\n");
+
+    NegShmWriter* w = neg_shm_writer_create(seg_name, PATTERN_BYTES);
+    publish_pattern(w, 1);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        /* Child: follow the writer until frame 2000, checking every copy */
+        NegShmReader* r = neg_shm_reader_open(seg_name);
+        uint8_t buf[PATTERN_BYTES];
+        int bad = r == NULL;
+        uint64_t last = 0;
+        while (!bad && last < 2000) {
+            NegShmFrame fr;
+            int64_t n = neg_shm_read(r, buf, sizeof(buf), &fr);
+            if (n == NEG_SHM_RETRY) continue;
+            bad = !pattern_ok(buf, n, &fr) || fr.frame < last;
+            last = fr.frame;
+        }
+        neg_shm_reader_close(r);
+        _exit(bad ? 1 : 0);
+    }
+
+    for (uint64_t f = 2; f <= 2000; f++) publish_pattern(w, f);
+    int status = -1;
+    if (pid > 0) waitpid(pid, &status, 0);
+    TEST_ASSERT(pid > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0,
+                "Forked reader saw only complete frames up to the last one");
+
+    neg_shm_writer_destroy(w, 1);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("SHARED-MEMORY STATE PUBLICATION - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    snprintf(seg_name, sizeof(seg_name), "/neg-shm-test-%ld", (long)getpid());
+
+    test_lifecycle();
+    test_publish_state();
+    test_sizes();
+    test_concurrent();
+    test_fork();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
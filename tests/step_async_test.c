@@ -0,0 +1,428 @@
+/*
+ * step_async_test.c - Unit Tests for Background Stepping
+ *
+ * Tests:
+ *   1. Async jobs reproduce synchronous stepping bit for bit
+ *   2. Ticket polling, waiting and error codes
+ *   3. Readers on other threads only see completed jobs, diagnostics
+ *      and metrics included
+ *   4. Synchronous calls after async jobs (step, reset, diagnostics)
+ *   5. Bounded queue
+ *   6. neg_destroy() with jobs queued
+ *
+ * Compile with:
+ *   gcc -o step_async_test step_async_test.c ../src/core/step_async.c \
+ *       ../src/core/state_shm.c ../src/core/openmetrics.c ../src/core/mem_stats.c \
+ *       ../src/core/phase_timers.c ../src/core/trace.c ../src/core/state.c \
+ *       ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/barrier_field.c \
+ *       ../src/api/negentropic.c ../src/solvers/hydrology_richards_lite.c \
+ *       ../src/core/thread_pool.c \
+ *       ../src/core/event_log.c ../src/core/replay.c ../src/core/rollback.c \
+ *       ../embedded/sha256.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "../src/api/negentropic.h"
+#include "../src/core/include/mem_stats.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define CONFIG "{\"num_entities\": 16, \"num_scalar_fields\": 256}"
+#define DT 0.016f
+#define JOB_STEPS 500
+#define JOBS 40
+#define READER_THREADS 3
+
+/* Reference run: state after each of JOBS synchronous jobs (index 0: initial) */
+static size_t state_size;
+static uint8_t* ref_binary[JOBS + 1];
+static uint64_t ref_hash[JOBS + 1];
+
+static void build_reference(void) {
+    void* sim = neg_create(CONFIG);
+    state_size = neg_get_state_binary_size(sim);
+    for (int j = 0; j <= JOBS; j++) {
+        if (j > 0) neg_step_n(sim, DT, JOB_STEPS);
+        ref_binary[j] = (uint8_t*)malloc(state_size);
+        neg_get_state_binary(sim, ref_binary[j], state_size);
+        ref_hash[j] = neg_get_state_hash(sim);
+    }
+    neg_destroy(sim);
+}
+
+/* Reference job whose state equals buf, -1 if none */
+static int match_reference(const uint8_t* buf, size_t len) {
+    if (len != state_size) return -1;
+    for (int j = 0; j <= JOBS; j++) {
+        if (memcmp(buf, ref_binary[j], len) == 0) return j;
+    }
+    return -1;
+}
+
+/* ========================================================================
+ * TEST 1: DETERMINISM
+ * ======================================================================== */
+
+static void test_determinism(void) {
+    printf("\n[TEST 1] Async jobs match synchronous stepping\n");
+
+    void* sim = neg_create(CONFIG);
+    uint8_t* buf = (uint8_t*)malloc(state_size);
+
+    int64_t t1 = neg_step_async(sim, DT, JOB_STEPS);
+    int64_t t2 = neg_step_async(sim, DT, JOB_STEPS);
+    TEST_ASSERT(t1 == 1 && t2 == 2, "Tickets numbered 1, 2, ... in submission order");
+    TEST_ASSERT(neg_wait(sim, t2) == NEG_SUCCESS, "Wait on the last ticket succeeds");
+
+    int n = neg_get_state_binary(sim, buf, state_size);
+    TEST_ASSERT(n == (int)state_size && match_reference(buf, (size_t)n) == 2,
+                "Published binary equals two synchronous jobs");
+    TEST_ASSERT(neg_get_state_hash(sim) == ref_hash[2], "Published hash equals the reference");
+
+    int ok = 1;
+    for (int j = 3; j <= JOBS; j++) {
+        ok &= neg_step_async(sim, DT, JOB_STEPS) == j;
+    }
+    TEST_ASSERT(ok && neg_wait(sim, 0) == NEG_SUCCESS, "Remaining jobs queued, wait(0) drains");
+    TEST_ASSERT(neg_get_state_hash(sim) == ref_hash[JOBS], "Hash after all jobs matches");
+
+    free(buf);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 2: TICKETS
+ * ======================================================================== */
+
+static void test_tickets(void) {
+    printf("\n[TEST 2] Polling, waiting and error codes\n");
+
+    void* sim = neg_create(CONFIG);
+    TEST_ASSERT(neg_poll(sim, 0) == 1 && neg_wait(sim, 0) == NEG_SUCCESS,
+                "Ticket 0 complete before any job");
+    TEST_ASSERT(neg_poll(sim, 1) == NEG_ERROR_INVALID_STATE &&
+                neg_wait(sim, 1) == NEG_ERROR_INVALID_STATE,
+                "Ticket never issued rejected (no worker yet)");
+
+    int64_t t = neg_step_async(sim, DT, JOB_STEPS);
+    int polled = neg_poll(sim, t);
+    TEST_ASSERT(polled == 0 || polled == 1, "Poll right after submit is pending or done");
+    TEST_ASSERT(neg_wait(sim, t) == NEG_SUCCESS && neg_poll(sim, t) == 1 &&
+                neg_poll(sim, 0) == 1, "Poll reports done after wait");
+    TEST_ASSERT(neg_poll(sim, t + 1) == NEG_ERROR_INVALID_STATE &&
+                neg_wait(sim, -1) == NEG_ERROR_INVALID_STATE,
+                "Unissued and negative tickets rejected");
+
+    TEST_ASSERT(neg_step_async(sim, DT, -1) == NEG_ERROR_INVALID_CONFIG,
+                "Negative step count rejected");
+    int64_t t0 = neg_step_async(sim, DT, 0);
+    TEST_ASSERT(t0 == t + 1 && neg_wait(sim, t0) == NEG_SUCCESS &&
+                neg_get_state_hash(sim) == ref_hash[1], "Zero-step job completes, state unchanged");
+
+    TEST_ASSERT(neg_step_async(NULL, DT, 1) == NEG_ERROR_NULL_HANDLE &&
+                neg_poll(NULL, 0) == NEG_ERROR_NULL_HANDLE &&
+                neg_wait(NULL, 0) == NEG_ERROR_NULL_HANDLE, "NULL simulation rejected");
+
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 3: CONCURRENT READERS
+ * ======================================================================== */
+
+static atomic_int jobs_done;
+static atomic_int readers_ready;
+
+typedef struct {
+    void* sim;
+    int reads;
+    int torn;                       /* State matching no completed job */
+    int mismatched;                 /* JSON hash not the one of its timestamp */
+    int regressed;                  /* Older job than a previous read */
+    int diag_mismatched;            /* Diagnostics timers not of their timestamp's job */
+    int failed;                     /* Metrics / flags / rollback depth unreadable */
+} ReaderResult;
+
+/* Job whose timestamp (microseconds) is ts, -1 if none */
+static int job_at(unsigned long long ts) {
+    for (int i = 0; i <= JOBS; i++) {
+        uint64_t ref_ts = 0;
+        memcpy(&ref_ts, ref_binary[i] + 12, sizeof(ref_ts));
+        if (ref_ts * 1000 == ts) return i;
+    }
+    return -1;
+}
+
+static void* reader_main(void* arg) {
+    ReaderResult* res = (ReaderResult*)arg;
+    uint8_t* buf = (uint8_t*)malloc(state_size);
+    char* metrics = (char*)malloc(32768);
+    char json[256];
+    char diag[4096];
+    int last = 0;
+
+    atomic_fetch_add(&readers_ready, 1);
+    while (!atomic_load(&jobs_done) || res->reads < 100) {
+        int n = neg_get_state_binary(res->sim, buf, state_size);
+        int j = n > 0 ? match_reference(buf, (size_t)n) : -1;
+        if (j < 0) {
+            res->torn++;
+        } else {
+            res->regressed += j < last;
+            last = j;
+        }
+
+        /* JSON reads one published frame: timestamp and hash must agree */
+        unsigned long long ts = 0, hash = 0;
+        if (neg_get_state_json(res->sim, json, sizeof(json)) > 0 &&
+            sscanf(json, "{\"timestamp\":%llu", &ts) == 1) {
+            const char* h = strstr(json, "\"hash\":\"0x");
+            if (h) sscanf(h + 10, "%llx", &hash);
+        }
+        int k = job_at(ts);
+        res->mismatched += k < 0 || ref_hash[k] != hash;
+
+        /* Diagnostics come from the published frame without waiting for
+         * the worker: the step count must be the one of its timestamp */
+        unsigned long long steps = 0;
+        ts = 0;
+        if (neg_get_diagnostics(res->sim, diag, sizeof(diag)) > 0) {
+            const char* t = strstr(diag, "\"timestamp\":");
+            const char* s = strstr(diag, "\"steps\":");
+            if (t) sscanf(t + 12, "%llu", &ts);
+            if (s) sscanf(s + 8, "%llu", &steps);
+        }
+        k = job_at(ts);
+        res->diag_mismatched += k < 0 || steps != (unsigned long long)k * JOB_STEPS;
+        res->failed += neg_get_metrics_text(res->sim, metrics, 32768) <= 0 ||
+                       neg_get_error_flags(res->sim).total_errors != 0 ||
+                       neg_get_rollback_depth(res->sim) != 0;
+
+        res->reads++;
+        if (res->reads % 16 == 0) sched_yield();
+    }
+
+    free(metrics);
+    free(buf);
+    return NULL;
+}
+
+static void test_concurrent(void) {
+    printf("\n[TEST 3] Readers on other threads see completed jobs only\n");
+
+    void* sim = neg_create(CONFIG);
+    neg_step_async(sim, DT, 0);     /* Attach the worker before readers start */
+    neg_wait(sim, 0);
+
+    pthread_t threads[READER_THREADS];
+    ReaderResult results[READER_THREADS];
+    atomic_store(&jobs_done, 0);
+    atomic_store(&readers_ready, 0);
+    for (int i = 0; i < READER_THREADS; i++) {
+        memset(&results[i], 0, sizeof(results[i]));
+        results[i].sim = sim;
+        pthread_create(&threads[i], NULL, reader_main, &results[i]);
+    }
+    while (atomic_load(&readers_ready) < READER_THREADS) sched_yield();
+
+    int ok = 1;
+    for (int j = 1; j <= JOBS; j++) {
+        ok &= neg_step_async(sim, DT, JOB_STEPS) > 0;
+        if (j % 4 == 0) {
+            ok &= neg_wait(sim, 0) == NEG_SUCCESS;
+            sched_yield();
+        }
+    }
+    ok &= neg_wait(sim, 0) == NEG_SUCCESS;
+    atomic_store(&jobs_done, 1);
+
+    int reads = 0, torn = 0, mismatched = 0, regressed = 0, diag_mismatched = 0, failed = 0;
+    for (int i = 0; i < READER_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        reads += results[i].reads;
+        torn += results[i].torn;
+        mismatched += results[i].mismatched;
+        regressed += results[i].regressed;
+        diag_mismatched += results[i].diag_mismatched;
+        failed += results[i].failed;
+    }
+    printf("    %d reads across %d threads\n", reads, READER_THREADS);
+
+    TEST_ASSERT(ok, "All jobs submitted and completed");
+    TEST_ASSERT(torn == 0, "Every binary read equals the state after a completed job");
+    TEST_ASSERT(mismatched == 0, "JSON timestamp and hash come from the same job");
+    TEST_ASSERT(regressed == 0, "Each reader sees jobs in order");
+    TEST_ASSERT(diag_mismatched == 0, "Diagnostics timers and timestamp come from the same job");
+    TEST_ASSERT(failed == 0, "Metrics, error flags and rollback depth readable from any thread");
+    TEST_ASSERT(neg_get_state_hash(sim) == ref_hash[JOBS], "Final hash matches the reference");
+
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 4: SYNCHRONOUS CALLS AFTER ASYNC JOBS
+ * ======================================================================== */
+
+static void test_mixed(void) {
+    printf("\n[TEST 4] Synchronous calls after async jobs\n");
+
+    void* sim = neg_create(CONFIG);
+    uint8_t* buf = (uint8_t*)malloc(state_size);
+    char diag[4096];
+
+    neg_step_async(sim, DT, JOB_STEPS);
+    TEST_ASSERT(neg_step_n(sim, DT, JOB_STEPS) == NEG_SUCCESS &&
+                neg_get_state_hash(sim) == ref_hash[2],
+                "neg_step_n() runs after the queued job and republishes");
+
+    int ok = 1;
+    for (int i = 0; i < JOB_STEPS; i++) ok &= neg_step(sim, DT) == NEG_SUCCESS;
+    TEST_ASSERT(ok && neg_get_state_hash(sim) == ref_hash[3], "neg_step() republishes");
+
+    TEST_ASSERT(neg_reset_from_binary(sim, ref_binary[1], state_size) == NEG_SUCCESS &&
+                neg_get_state_hash(sim) == ref_hash[1],
+                "neg_reset_from_binary() republishes");
+    int n = neg_get_state_binary(sim, buf, state_size);
+    TEST_ASSERT(n == (int)state_size && memcmp(buf, ref_binary[1], state_size) == 0,
+                "Published binary equals the restored state");
+
+    neg_step_async(sim, DT, JOB_STEPS);
+    uint32_t count = 0;
+    const float* fields = neg_get_scalar_fields(sim, &count);
+    TEST_ASSERT(fields && count == 256 && neg_poll(sim, 0) == 1,
+                "neg_get_scalar_fields() waits for queued jobs");
+    TEST_ASSERT(neg_get_diagnostics(sim, diag, sizeof(diag)) > 0 &&
+                neg_get_error_flags(sim).total_errors == 0,
+                "Diagnostics and error flags readable");
+    TEST_ASSERT(neg_get_state_binary(sim, buf, 8) == NEG_ERROR_BUFFER_TOO_SMALL,
+                "Short buffer rejected");
+
+    free(buf);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 5: BOUNDED QUEUE
+ * ======================================================================== */
+
+static void test_queue_full(void) {
+    printf("\n[TEST 5] Bounded queue\n");
+
+    void* sim = neg_create(CONFIG);
+    int64_t last = 0;
+    int accepted = 0;
+    int rc = 0;
+    for (int i = 0; i < 200; i++) {
+        int64_t t = neg_step_async(sim, DT, 2000);
+        if (t < 0) {
+            rc = (int)t;
+            break;
+        }
+        last = t;
+        accepted++;
+    }
+    printf("    %d jobs accepted\n", accepted);
+
+    TEST_ASSERT(rc == NEG_ERROR_INVALID_STATE && neg_get_last_error() &&
+                strstr(neg_get_last_error(), "queue full"),
+                "Submitting past the queue limit fails with INVALID_STATE");
+    TEST_ASSERT(accepted >= 64 && last == accepted, "Tickets issued up to the limit");
+    TEST_ASSERT(neg_wait(sim, 0) == NEG_SUCCESS && neg_step_async(sim, DT, 1) == last + 1,
+                "Queue accepts jobs again after draining");
+    neg_wait(sim, 0);
+
+    void* ref = neg_create(CONFIG);
+    for (int i = 0; i < accepted; i++) neg_step_n(ref, DT, 2000);
+    neg_step(ref, DT);
+    TEST_ASSERT(neg_get_state_hash(sim) == neg_get_state_hash(ref),
+                "Every accepted job ran exactly once");
+
+    neg_destroy(ref);
+    neg_destroy(sim);
+}
+
+/* ========================================================================
+ * TEST 6: DESTROY WITH JOBS QUEUED
+ * ======================================================================== */
+
+static void test_destroy(void) {
+    printf("\n[TEST 6] neg_destroy() with jobs queued\n");
+
+    NegMemReport before, after;
+    neg_mem_report(&before);
+
+    void* sim = neg_create(CONFIG);
+    for (int i = 0; i < 8; i++) neg_step_async(sim, DT, JOB_STEPS);
+    neg_destroy(sim);
+    neg_destroy(NULL);
+
+    neg_mem_report(&after);
+    TEST_ASSERT(after.subsystems[NEG_MEM_IO].current_bytes ==
+                before.subsystems[NEG_MEM_IO].current_bytes &&
+                after.subsystems[NEG_MEM_STATE].current_bytes ==
+                before.subsystems[NEG_MEM_STATE].current_bytes,
+                "Worker joined, buffers and state freed");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("BACKGROUND STEPPING - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    build_reference();
+
+    test_determinism();
+    test_tickets();
+    test_concurrent();
+    test_mixed();
+    test_queue_full();
+    test_destroy();
+
+    for (int j = 0; j <= JOBS; j++) free(ref_binary[j]);
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
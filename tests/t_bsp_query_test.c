@@ -0,0 +1,377 @@
+/*
+ * t_bsp_query_test.c - Unit Tests for Spatial Vessel Queries
+ *
+ * Tests for:
+ *   1. Latest-position updates (in-place, cell change, removal)
+ *   2. Per-cell capacity and stalest-report eviction
+ *   3. k-nearest-vessel queries vs brute force (random fleet)
+ *   4. Radius queries vs brute force
+ *   5. ENU result offsets (signs, magnitudes, dateline wraparound)
+ *   6. Out-of-grid rejection
+ *   7. Full index keeps a moving vessel; far query points
+ *
+ * Compile with:
+ *   gcc -o t_bsp_query_test t_bsp_query_test.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       ../embedded/t_bsp.c ../embedded/t_bsp_query.c \
+ *       -I../embedded -lm -std=c99
+ *
+ * Author: ClaudeCode (spatial queries)
+ * Version: 1.0
+ */
+
+#include "../embedded/se3_edge.h"
+#include "../embedded/t_bsp.h"
+#include "../embedded/t_bsp_query.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+/* Large objects kept static (ESP32-style, avoids stack pressure) */
+static t_bsp_t g_bsp;
+static t_bsp_index_t g_idx;
+
+#define FLEET_SIZE  200
+static fixed_t fleet_lat[FLEET_SIZE];
+static fixed_t fleet_lon[FLEET_SIZE];
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 4242u;
+static int32_t lcg_range(int32_t amplitude) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (int32_t)((lcg_state >> 8) % (uint32_t)(2 * amplitude + 1)) - amplitude;
+}
+
+/* Reference geometry (double precision) */
+static const double REF_LAT = 37.80;
+static const double REF_LON = -122.40;
+
+static double ref_dist_m(fixed_t lat_a, fixed_t lon_a, fixed_t lat_b, fixed_t lon_b) {
+    double dn = (FIXED_TO_FLOAT(lat_a) - FIXED_TO_FLOAT(lat_b)) * 111320.0;
+    double de = (FIXED_TO_FLOAT(lon_a) - FIXED_TO_FLOAT(lon_b)) * 111320.0 *
+                cos(REF_LAT * 3.14159265358979 / 180.0);
+    return sqrt(dn * dn + de * de);
+}
+
+static int cmp_double(const void* a, const void* b) {
+    double da = *(const double*)a, db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static void build_fleet(void) {
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(REF_LAT), FLOAT_TO_FIXED(REF_LON));
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    /* ±0.25° ≈ ±28 km N/S, ±22 km E/W → 36 grid cells */
+    for (int i = 0; i < FLEET_SIZE; i++) {
+        fleet_lat[i] = g_bsp.ref_lat + lcg_range(FLOAT_TO_FIXED(0.25f));
+        fleet_lon[i] = g_bsp.ref_lon + lcg_range(FLOAT_TO_FIXED(0.25f));
+    }
+}
+
+/* ========================================================================
+ * TEST 1: Latest-Position Updates
+ * ======================================================================== */
+
+void test_updates(void) {
+    printf("\n[TEST 1] Latest-Position Updates\n");
+    t_bsp_neighbor_t res[4];
+
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(REF_LAT), FLOAT_TO_FIXED(REF_LON));
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    TEST_ASSERT(t_bsp_query_knn(&g_idx, g_bsp.ref_lat, g_bsp.ref_lon, 4, res) == 0,
+                "Empty index returns no neighbors");
+
+    /* Same vessel reported repeatedly inside one cell */
+    fixed_t lat = g_bsp.ref_lat + FLOAT_TO_FIXED(0.01f);
+    fixed_t lon = g_bsp.ref_lon + FLOAT_TO_FIXED(0.01f);
+    for (int t = 0; t < 5; t++) {
+        t_bsp_index_update(&g_idx, lat + t * 100, lon, 366000001, 1000 + t * 10);
+    }
+    TEST_ASSERT(t_bsp_index_vessel_count(&g_idx) == 1 && g_idx.cell_count == 1,
+                "Repeated reports update in place");
+
+    int n = t_bsp_query_knn(&g_idx, g_bsp.ref_lat, g_bsp.ref_lon, 4, res);
+    TEST_ASSERT(n == 1 && res[0].timestamp == 1040, "Query returns latest report");
+
+    /* Move the vessel 0.2° north (several cells) */
+    t_bsp_index_update(&g_idx, lat + FLOAT_TO_FIXED(0.2f), lon, 366000001, 1100);
+    TEST_ASSERT(t_bsp_index_vessel_count(&g_idx) == 1 && g_idx.cell_count == 1,
+                "Cell change leaves no stale entry");
+
+    TEST_ASSERT(t_bsp_index_remove(&g_idx, 366000001) && g_idx.cell_count == 0,
+                "Remove frees the cell");
+    TEST_ASSERT(!t_bsp_index_remove(&g_idx, 366000001), "Removing absent vessel fails");
+}
+
+/* ========================================================================
+ * TEST 2: Capacity and Eviction
+ * ======================================================================== */
+
+void test_eviction(void) {
+    printf("\n[TEST 2] Per-Cell Capacity and Eviction\n");
+    t_bsp_neighbor_t res[T_BSP_QUERY_MAX];
+    bool oldest_seen = false;
+
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(REF_LAT), FLOAT_TO_FIXED(REF_LON));
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    /* T_BSP_INDEX_SLOTS + 1 vessels inside one ~1 km patch */
+    for (int i = 0; i <= T_BSP_INDEX_SLOTS; i++) {
+        t_bsp_index_update(&g_idx, g_bsp.ref_lat + FLOAT_TO_FIXED(0.001f) * (i + 1),
+                           g_bsp.ref_lon + FLOAT_TO_FIXED(0.005f),
+                           367000000 + i, 2000 + i);
+    }
+    TEST_ASSERT(t_bsp_index_vessel_count(&g_idx) == T_BSP_INDEX_SLOTS,
+                "Full cell holds T_BSP_INDEX_SLOTS vessels");
+
+    int n = t_bsp_query_knn(&g_idx, g_bsp.ref_lat, g_bsp.ref_lon, T_BSP_QUERY_MAX, res);
+    for (int i = 0; i < n; i++) {
+        if (res[i].mmsi == 367000000) oldest_seen = true;
+    }
+    TEST_ASSERT(n == T_BSP_INDEX_SLOTS && !oldest_seen, "Stalest report was evicted");
+}
+
+/* ========================================================================
+ * TEST 3: k-Nearest Neighbors vs Brute Force
+ * ======================================================================== */
+
+void test_knn(void) {
+    printf("\n[TEST 3] k-Nearest Vessels vs Brute Force\n");
+    static double dist[FLEET_SIZE];
+    t_bsp_neighbor_t res[16];
+    int inserted = 0, sorted = 1, matched = 1;
+    double max_err = 0.0;
+
+    build_fleet();
+    for (int i = 0; i < FLEET_SIZE; i++) {
+        inserted += t_bsp_index_update(&g_idx, fleet_lat[i], fleet_lon[i],
+                                       400000000 + i, 5000 + i);
+    }
+    TEST_ASSERT(inserted == FLEET_SIZE, "Fleet of 200 vessels indexed");
+    printf("    Index cells in use: %d\n", g_idx.cell_count);
+
+    for (int q = 0; q < 20; q++) {
+        fixed_t qlat = g_bsp.ref_lat + lcg_range(FLOAT_TO_FIXED(0.3f));
+        fixed_t qlon = g_bsp.ref_lon + lcg_range(FLOAT_TO_FIXED(0.3f));
+        int k = 1 + q % 16;
+
+        for (int i = 0; i < FLEET_SIZE; i++) {
+            dist[i] = ref_dist_m(fleet_lat[i], fleet_lon[i], qlat, qlon);
+        }
+        int n = t_bsp_query_knn(&g_idx, qlat, qlon, k, res);
+        qsort(dist, FLEET_SIZE, sizeof(double), cmp_double);
+
+        if (n != k) matched = 0;
+        for (int i = 0; i < n; i++) {
+            int v = (int)(res[i].mmsi - 400000000);
+            double d = ref_dist_m(fleet_lat[v], fleet_lon[v], qlat, qlon);
+            double err = fabs(d - FIXED_TO_FLOAT(res[i].distance));
+            if (err > max_err) max_err = err;
+            if (i > 0 && res[i].distance < res[i - 1].distance) sorted = 0;
+            /* i-th result must be the i-th true distance (2 m tolerance) */
+            if (fabs(d - dist[i]) > 2.0) matched = 0;
+        }
+    }
+
+    printf("    Max distance error vs double reference: %.3f m\n", max_err);
+    TEST_ASSERT(matched, "k-NN matches brute force for 20 queries (k = 1..16)");
+    TEST_ASSERT(sorted, "Results ordered nearest first");
+    TEST_ASSERT(max_err < 2.0, "Distances within 2 m of double reference");
+}
+
+/* ========================================================================
+ * TEST 4: Radius Queries vs Brute Force
+ * ======================================================================== */
+
+void test_radius(void) {
+    printf("\n[TEST 4] Radius Queries vs Brute Force\n");
+    t_bsp_neighbor_t res[T_BSP_QUERY_MAX];
+    int counts_ok = 1, inside_ok = 1;
+
+    for (int q = 0; q < 20; q++) {
+        fixed_t qlat = g_bsp.ref_lat + lcg_range(FLOAT_TO_FIXED(0.2f));
+        fixed_t qlon = g_bsp.ref_lon + lcg_range(FLOAT_TO_FIXED(0.2f));
+        fixed_t radius = INT_TO_FIXED(1000 + (q % 4) * 1000);
+        double r = FIXED_TO_FLOAT(radius);
+        int expected = 0;
+
+        for (int i = 0; i < FLEET_SIZE; i++) {
+            double d = ref_dist_m(fleet_lat[i], fleet_lon[i], qlat, qlon);
+            /* Skip borderline vessels (fixed-point vs double) */
+            if (fabs(d - r) < 2.0) { expected = -1; break; }
+            if (d < r) expected++;
+        }
+        if (expected < 0) continue;
+
+        int n = t_bsp_query_radius(&g_idx, qlat, qlon, radius, res, T_BSP_QUERY_MAX);
+        if (n != expected) counts_ok = 0;
+        for (int i = 0; i < n; i++) {
+            if (res[i].distance > radius) inside_ok = 0;
+        }
+    }
+
+    TEST_ASSERT(counts_ok, "Radius counts match brute force (1-4 km radii)");
+    TEST_ASSERT(inside_ok, "All radius results within radius");
+
+    int n = t_bsp_query_radius(&g_idx, g_bsp.ref_lat, g_bsp.ref_lon,
+                               INT_TO_FIXED(30000), res, 5);
+    TEST_ASSERT(n == 5, "Radius query truncates to max_results");
+    TEST_ASSERT(t_bsp_query_radius(&g_idx, g_bsp.ref_lat, g_bsp.ref_lon,
+                                   -FRACUNIT, res, 5) == 0,
+                "Negative radius returns nothing");
+}
+
+/* ========================================================================
+ * TEST 5: ENU Offsets and Dateline
+ * ======================================================================== */
+
+void test_enu_offsets(void) {
+    printf("\n[TEST 5] ENU Result Offsets\n");
+    t_bsp_neighbor_t res[2];
+
+    t_bsp_init(&g_bsp, FLOAT_TO_FIXED(REF_LAT), FLOAT_TO_FIXED(REF_LON));
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    /* Vessel 0.01° N and 0.01° E of the query point */
+    fixed_t qlat = g_bsp.ref_lat - FLOAT_TO_FIXED(0.003f);
+    fixed_t qlon = g_bsp.ref_lon + FLOAT_TO_FIXED(0.004f);
+    fixed_t vlat = qlat + FLOAT_TO_FIXED(0.01f);
+    fixed_t vlon = qlon + FLOAT_TO_FIXED(0.01f);
+    t_bsp_index_update(&g_idx, vlat, vlon, 368000001, 42);
+
+    int n = t_bsp_query_knn(&g_idx, qlat, qlon, 1, res);
+    double exp_n = FIXED_TO_FLOAT(vlat - qlat) * 111320.0;
+    double exp_e = FIXED_TO_FLOAT(vlon - qlon) * 111320.0 * cos(REF_LAT * 3.14159265358979 / 180.0);
+    printf("    east = %.2f m (exp %.2f), north = %.2f m (exp %.2f)\n",
+           FIXED_TO_FLOAT(res[0].east), exp_e, FIXED_TO_FLOAT(res[0].north), exp_n);
+    TEST_ASSERT(n == 1 && fabs(FIXED_TO_FLOAT(res[0].north) - exp_n) < 1.0,
+                "North offset in meters");
+    TEST_ASSERT(fabs(FIXED_TO_FLOAT(res[0].east) - exp_e) < 1.0,
+                "East offset scaled by cos(latitude)");
+
+    /* Dateline: origin at 179.95°E, vessel at 179.95°W (0.1° apart) */
+    t_bsp_init(&g_bsp, 0, FLOAT_TO_FIXED(179.95f));
+    t_bsp_index_init(&g_idx, &g_bsp);
+    TEST_ASSERT(t_bsp_index_update(&g_idx, 0, -FLOAT_TO_FIXED(179.95f), 368000002, 43),
+                "Vessel across dateline indexed");
+    n = t_bsp_query_knn(&g_idx, 0, FLOAT_TO_FIXED(179.95f), 1, res);
+    printf("    Dateline distance: %.1f m\n", FIXED_TO_FLOAT(res[0].distance));
+    TEST_ASSERT(n == 1 && res[0].east > 0 && fabs(FIXED_TO_FLOAT(res[0].distance) - 11132.0) < 5.0,
+                "Dateline neighbor ~11.1 km east");
+}
+
+/* ========================================================================
+ * TEST 6: Grid Range
+ * ======================================================================== */
+
+void test_grid_range(void) {
+    printf("\n[TEST 6] Grid Range\n");
+
+    t_bsp_init(&g_bsp, 0, 0);
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    /* ±127 cells × 10 km ≈ ±11.4° */
+    TEST_ASSERT(t_bsp_index_update(&g_idx, FLOAT_TO_FIXED(11.0f), 0, 1, 1),
+                "Position inside grid accepted");
+    TEST_ASSERT(!t_bsp_index_update(&g_idx, FLOAT_TO_FIXED(12.0f), 0, 2, 1),
+                "Position beyond ±127 cells rejected");
+    TEST_ASSERT(!t_bsp_index_update(&g_idx, 0, -FLOAT_TO_FIXED(12.0f), 3, 1),
+                "Position beyond -128 cells rejected");
+}
+
+/* ========================================================================
+ * TEST 7: Full Index and Far Queries
+ * ======================================================================== */
+
+void test_full_and_far(void) {
+    printf("\n[TEST 7] Full Index and Far Queries\n");
+    t_bsp_neighbor_t res[4];
+
+    t_bsp_init(&g_bsp, 0, 0);
+    t_bsp_index_init(&g_idx, &g_bsp);
+
+    /* One vessel per cell along a row, until every cell is taken */
+    fixed_t step = FLOAT_TO_FIXED(0.1f);   /* ~11 km: one cell per report */
+    bool filled = true;
+    for (int i = 0; i < T_BSP_INDEX_CELLS; i++) {
+        fixed_t lon = (fixed_t)(i - T_BSP_INDEX_CELLS / 2) * step;
+        filled = filled && t_bsp_index_update(&g_idx, 0, lon, 367000000u + (uint32_t)i, 1);
+    }
+    /* Second vessel in cell 0, so moving it cannot free a cell */
+    filled = filled && t_bsp_index_update(&g_idx, 0, -(T_BSP_INDEX_CELLS / 2) * step + 100,
+                                          368000000u, 1);
+    TEST_ASSERT(filled && g_idx.cell_count == T_BSP_INDEX_CELLS, "Index filled to every cell");
+
+    TEST_ASSERT(!t_bsp_index_update(&g_idx, FLOAT_TO_FIXED(1.0f), 0, 368000000u, 2),
+                "Move into a new cell fails when no cell is free");
+    TEST_ASSERT(t_bsp_index_vessel_count(&g_idx) == T_BSP_INDEX_CELLS + 1,
+                "Failed move keeps the vessel's last position");
+
+    TEST_ASSERT(t_bsp_index_update(&g_idx, FLOAT_TO_FIXED(1.0f), 0, 367000001u, 2) &&
+                t_bsp_index_vessel_count(&g_idx) == T_BSP_INDEX_CELLS + 1 &&
+                g_idx.cell_count == T_BSP_INDEX_CELLS,
+                "Sole occupant moves by reusing the cell it leaves");
+
+    /* ~19,900 km east of the reference: Q8.8 squares would overflow */
+    int n = t_bsp_query_knn(&g_idx, 0, FLOAT_TO_FIXED(179.0f), 4, res);
+    TEST_ASSERT(n == 4 && res[0].distance == 0x7FFFFFFF,
+                "Far query point returns neighbors with saturated distance");
+    TEST_ASSERT(t_bsp_query_radius(&g_idx, 0, FLOAT_TO_FIXED(179.0f),
+                                   INT_TO_FIXED(30000), res, 4) == 0,
+                "Far query point finds nothing within 30 km");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("T-BSP SPATIAL QUERIES - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+    printf("Latest-position index: %d cells × %d vessels (%d bytes)\n",
+           T_BSP_INDEX_CELLS, T_BSP_INDEX_SLOTS, (int)sizeof(t_bsp_index_t));
+
+    se3_init_tables();
+
+    test_updates();
+    test_eviction();
+    test_knn();
+    test_radius();
+    test_enu_offsets();
+    test_grid_range();
+    test_full_and_far();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
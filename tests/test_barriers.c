@@ -7,6 +7,7 @@
  *   - Gradient magnitude decreases away from bounds
  *   - Both lower and upper bound handling
  *   - Q16.16 fixed-point arithmetic correctness
+ *   - Division by zero returns 0 and raises FIXED_STICKY_DIV_ZERO
  *
  * Author: negentropic-core team
  * Version: 0.4.0-alpha-genesis
@@ -217,6 +218,23 @@ void test_gradient_finite(void) {
     TEST_ASSERT(!isinf(grad_f) && !isnan(grad_f), "Gradient is finite");
 }
 
+/**
+ * Test 9: Division by zero returns 0 and raises the sticky bit.
+ */
+void test_div_zero(void) {
+    printf("\n[Test 9] Division by zero\n");
+
+    fixed_sticky_take();
+    fixed_t q = barrier_fixed_div(FRACUNIT, 0);
+    uint32_t sticky = fixed_sticky_take();
+
+    TEST_ASSERT(q == 0, "a / 0 returns 0");
+    TEST_ASSERT(sticky == FIXED_STICKY_DIV_ZERO, "a / 0 raises FIXED_STICKY_DIV_ZERO only");
+    TEST_ASSERT(barrier_fixed_div(-FRACUNIT, 0) == 0, "-a / 0 returns 0");
+    TEST_ASSERT(barrier_fixed_div(FRACUNIT, 2 * FRACUNIT) == FRACUNIT / 2, "Nonzero divisor unchanged");
+    fixed_sticky_take();
+}
+
 /* ========================================================================
  * MAIN
  * ======================================================================== */
@@ -235,6 +253,7 @@ int main(void) {
     test_barrier_deep_violation();
     test_fixed_point_conversion();
     test_gradient_finite();
+    test_div_zero();
 
     /* Summary */
     printf("\n======================================================================\n");
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""
+test_native_binding.py - Tests for the negentropic_core._native extension
+
+Tests for:
+  1. Simulation.scalar_fields is a read-only float32 view of simulation memory
+  2. step_n(dt, n) matches n calls to step(dt) (state hash)
+  3. Grid fields are strided views into the Cell array, writable in place,
+     and see every later step
+  4. Arrays keep their owner alive
+  5. Stepping releases the GIL
+  6. memory_report() charges the Cell grid to "state"
+  7. compute_batch_metrics(engine="native") matches the Python path
+     (λ, ε, resonance, metadata, error entries); 10k trajectories in seconds
+
+Usage (after cmake -DBUILD_PYTHON=ON, or pip install .):
+    PYTHONPATH=<build>/python python tests/test_native_binding.py
+
+Exits 77 (skipped) when the extension or NumPy is not available.
+
+Author: negentropic-core team
+Version: 0.1.0
+License: MIT OR GPL-3.0
+"""
+
+import gc
+import json
+import logging
+import sys
+import threading
+import time
+from pathlib import Path
+
+try:
+    import numpy as np
+    from negentropic_core import _native
+except ImportError as exc:
+    print(f"SKIP: {exc}")
+    sys.exit(77)
+
+CELL_FLOATS_MIN = 40  # Cell is > 40 floats; views must stride over it
+
+
+def data_address(array):
+    return array.__array_interface__["data"][0]
+
+
+def test_scalar_fields_view():
+    sim = _native.Simulation('{"num_entities": 8, "num_scalar_fields": 1024}')
+    fields = sim.scalar_fields
+    assert isinstance(fields, np.ndarray)
+    assert fields.dtype == np.float32 and fields.shape == (1024,)
+    assert not fields.flags.writeable
+    assert data_address(fields) == data_address(sim.scalar_fields), "same memory each time"
+    try:
+        fields[0] = 1.0
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("simulation fields must be read-only")
+
+
+def test_step_n_matches_step():
+    a = _native.Simulation('{"num_entities": 8, "num_scalar_fields": 256}')
+    b = _native.Simulation('{"num_entities": 8, "num_scalar_fields": 256}')
+    a.step_n(0.016, 10)
+    for _ in range(10):
+        b.step(0.016)
+    assert a.state_hash() == b.state_hash()
+    assert "timers" in json.loads(a.diagnostics())
+    metrics = a.metrics_text()
+    assert "negentropic_steps_total 10\n" in metrics and metrics.endswith("# EOF\n")
+    try:
+        a.step_n(0.016, -1)
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("negative step count must raise")
+
+
+def test_grid_views():
+    grid = _native.Grid(16, 8, 4)
+    theta = grid.theta
+    assert grid.shape == (8, 16, 4) and theta.shape == (8, 16, 4)
+    assert theta.dtype == np.float32 and theta.flags.writeable
+    cell = theta.strides[2]
+    assert cell >= CELL_FLOATS_MIN * 4 and theta.strides == (16 * 4 * cell, 4 * cell, cell)
+    assert np.allclose(grid.soil_temp_C, 15.0) and np.allclose(grid.FB_ratio, 0.5)
+
+    theta[2, 3, 1] = 0.33
+    assert grid.theta[2, 3, 1] == np.float32(0.33), "write lands in the Cell"
+    assert data_address(grid.psi) - data_address(theta) == 4, "psi follows theta in Cell"
+
+    before = theta.copy()
+    grid.step(60.0, rainfall=1.0e-5, n=5)
+    assert not np.array_equal(theta, before), "view taken before stepping sees the step"
+    assert np.isfinite(grid.h_surface[:, :, 0]).all()
+
+
+def test_lifetime():
+    sim = _native.Simulation('{"num_scalar_fields": 64}')
+    fields = sim.scalar_fields
+    grid = _native.Grid(4, 4, 2)
+    theta = grid.theta
+    del sim, grid
+    gc.collect()
+    assert fields.shape == (64,) and np.isfinite(theta).all(), "owners outlive their arrays"
+
+
+def test_gil_released():
+    grid = _native.Grid(256, 256, 4)
+    started = threading.Event()
+    elapsed = []
+
+    def worker():
+        started.set()
+        t0 = time.perf_counter()
+        grid.step(60.0, n=3)
+        elapsed.append(time.perf_counter() - t0)
+
+    thread = threading.Thread(target=worker)
+    thread.start()
+    started.wait()
+    ticks = []
+    while thread.is_alive():
+        ticks.append(time.perf_counter())
+    thread.join()
+
+    gaps = np.diff(ticks) if len(ticks) > 1 else np.array([elapsed[0]])
+    assert gaps.max() < 0.5 * elapsed[0], "main thread ran during the step"
+
+
+def test_memory_report():
+    grid = _native.Grid(32, 32, 8)
+    report = json.loads(_native.memory_report())
+    cell = grid.theta.strides[2]
+    assert report["subsystems"]["state"]["current_bytes"] >= 32 * 32 * 8 * cell
+    assert _native.version()
+
+
+def test_metrics_batch():
+    try:
+        import scipy  # noqa: F401  (the Python reference path)
+    except ImportError:
+        print("    (scipy not installed, parity not checked)")
+        return
+    sys.path.insert(0, str(Path(__file__).resolve().parents[1]))
+    from src.core import metrics_service
+
+    logging.disable(logging.CRITICAL)
+    rng = np.random.default_rng(5)
+    trajectories = []
+    for k in range(24):
+        T = int(rng.integers(1, 8))
+        rv = rng.normal(0, 0.4, (T, 3))
+        t = rng.normal(0, 0.05 if k % 4 else 0.4, (T, 3))  # every 4th out of bounds
+        if k % 3 == 0:
+            trajectories.append({"poses": [{"rotation": list(a), "translation": list(b)}
+                                           for a, b in zip(rv, t)]})
+        elif k % 3 == 1:
+            trajectories.append({"state_vectors": np.hstack([rv, t]).tolist()})
+        else:
+            trajectories.append({"positions": np.cumsum(t, 0).tolist(),
+                                 "orientations": np.cumsum(rv, 0).tolist()})
+    trajectories.append({"poses": [{"rotation": 2 * np.eye(3), "translation": [0, 0, 0]}]})
+    trajectories.append({"poses": []})
+
+    python = metrics_service.compute_batch_metrics(trajectories, engine="python")
+    native = metrics_service.compute_batch_metrics(trajectories, engine="native", seed=1)
+    for i, (a, b) in enumerate(zip(python, native)):
+        if "error" in a:
+            assert a == b, f"trajectory {i}: {a} != {b}"
+            continue
+        assert abs(a["optimal_lambda"] - b["optimal_lambda"]) <= 1e-9, f"λ of {i}"
+        assert abs(a["return_error_epsilon"] - b["return_error_epsilon"]) <= \
+            1e-12 * a["return_error_epsilon"], f"ε of {i}"
+        assert a["resonance_detected"] == b["resonance_detected"]
+        a["metadata"].pop("timestamp")
+        b["metadata"].pop("timestamp")
+        assert a["metadata"] == b["metadata"], f"metadata of {i}"
+    assert sum("error" in a for a in python) >= 6, "bounds, determinant and empty cases"
+
+    big = [{"state_vectors": np.hstack([rng.normal(0, 0.3, (10, 3)), rng.normal(0, 0.01, (10, 3))])}
+           for _ in range(10000)]
+    t0 = time.perf_counter()
+    results = metrics_service.compute_batch_metrics(big, engine="native")
+    elapsed = time.perf_counter() - t0
+    assert len(results) == 10000 and all("error" not in r for r in results)
+    assert elapsed < 30.0, f"10k trajectories took {elapsed:.1f} s"
+
+
+def main():
+    tests = [
+        test_scalar_fields_view,
+        test_step_n_matches_step,
+        test_grid_views,
+        test_lifetime,
+        test_gil_released,
+        test_memory_report,
+        test_metrics_batch,
+    ]
+    failed = 0
+    for test in tests:
+        try:
+            test()
+            print(f"  ✓ {test.__name__}")
+        except AssertionError as exc:
+            failed += 1
+            print(f"  ✗ {test.__name__}: {exc}")
+    print(f"\n  Passed: {len(tests) - failed}\n  Failed: {failed}")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
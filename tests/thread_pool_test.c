@@ -0,0 +1,490 @@
+/*
+ * thread_pool_test.c - Unit Tests for the Process-Wide Worker Pool
+ *
+ * Tests:
+ *   1. Every item of the range is visited exactly once, in static tiles
+ *   2. Slots stay below neg_pool_slots(); 1 thread runs on the caller;
+ *      each slot runs the same contiguous block of tiles on every call
+ *   3. Richards-Lite vertical pass is bit-identical for any thread count
+ *      and tile size; first touch covers the grid; separate grids step
+ *      concurrently
+ *   4. Concurrent jobs from several callers share one bounded pool
+ *   5. "threads" / "tile_size" / "pin_cpus" config keys
+ *   6. Shutdown and restart
+ *   7. Fixed-point sticky bits raised on workers reach the caller
+ *
+ * Compile with:
+ *   gcc -o thread_pool_test thread_pool_test.c ../src/core/thread_pool.c \
+ *       ../src/core/step_async.c ../src/core/state_shm.c \
+ *       ../src/core/openmetrics.c ../src/core/mem_stats.c \
+ *       ../src/core/phase_timers.c ../src/core/trace.c ../src/core/state.c \
+ *       ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c ../src/core/math/barrier_field.c \
+ *       ../src/api/negentropic.c ../src/solvers/hydrology_richards_lite.c \
+ *       ../src/core/event_log.c ../src/core/replay.c ../src/core/rollback.c \
+ *       ../embedded/sha256.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I.. -I../embedded -pthread -lm -lrt -std=c11
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "../src/core/include/thread_pool.h"
+#include "../src/core/state.h"
+#include "../src/api/negentropic.h"
+#include "../src/solvers/hydrology_richards_lite.h"
+#include "../include/fixed_saturate.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+/* ========================================================================
+ * TILE RECORDER
+ * ======================================================================== */
+
+#define MAX_ITEMS 10000
+
+typedef struct {
+    _Atomic int visits[MAX_ITEMS];
+    _Atomic int bad_tile;           /* Tile not on a tile_size boundary */
+    _Atomic int bad_slot;
+    _Atomic int off_caller;         /* Tiles run on another thread */
+    _Atomic int slot_of[MAX_ITEMS]; /* Slot that ran tile k */
+    size_t count;
+    size_t tile;
+    int slots;
+    pthread_t caller;
+} Recorder;
+
+static void record_tile(void* ctx, size_t begin, size_t end, int slot) {
+    Recorder* r = (Recorder*)ctx;
+    size_t expected_end = begin + r->tile < r->count ? begin + r->tile : r->count;
+    if (begin % r->tile != 0 || end != expected_end) atomic_fetch_add(&r->bad_tile, 1);
+    if (slot < 0 || slot >= r->slots) atomic_fetch_add(&r->bad_slot, 1);
+    if (!pthread_equal(pthread_self(), r->caller)) atomic_fetch_add(&r->off_caller, 1);
+    atomic_store(&r->slot_of[begin / r->tile], slot);
+    for (size_t i = begin; i < end; i++) atomic_fetch_add(&r->visits[i], 1);
+}
+
+/* Run one job and return 1 if every item in [0, count) was visited once */
+static int run_recorded(Recorder* r, const NegPoolConfig* cfg, size_t count, size_t default_tile) {
+    memset(r, 0, sizeof(*r));
+    r->count = count;
+    r->tile = (cfg && cfg->tile_size) ? cfg->tile_size : (default_tile ? default_tile : 1);
+    r->slots = neg_pool_slots(cfg);
+    r->caller = pthread_self();
+    neg_pool_run(cfg, count, default_tile, record_tile, r);
+
+    for (size_t i = 0; i < MAX_ITEMS; i++) {
+        int expected = i < count ? 1 : 0;
+        if (atomic_load(&r->visits[i]) != expected) return 0;
+    }
+    return atomic_load(&r->bad_tile) == 0 && atomic_load(&r->bad_slot) == 0;
+}
+
+/* ========================================================================
+ * TEST 1: COVERAGE
+ * ======================================================================== */
+
+static Recorder g_rec;
+
+static void test_coverage(void) {
+    printf("\n[TEST 1] Every item visited once, in static tiles\n");
+
+    static const uint32_t threads[] = { 1, 2, 3, 8 };
+    static const uint32_t tiles[] = { 0, 1, 7, 64, 5000 };
+    static const size_t counts[] = { 1, 63, 64, 65, 1000, MAX_ITEMS };
+    int ok = 1;
+
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        for (size_t s = 0; s < sizeof(tiles) / sizeof(tiles[0]); s++) {
+            for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+                NegPoolConfig cfg;
+                neg_pool_config_default(&cfg);
+                cfg.threads = threads[t];
+                cfg.tile_size = tiles[s];
+                if (!run_recorded(&g_rec, &cfg, counts[c], 16)) ok = 0;
+            }
+        }
+    }
+    TEST_ASSERT(ok, "4 thread counts x 5 tile sizes x 6 ranges covered exactly once");
+
+    TEST_ASSERT(run_recorded(&g_rec, NULL, 100, 0), "NULL config and zero default tile run serially");
+
+    memset(&g_rec, 0, sizeof(g_rec));
+    neg_pool_run(NULL, 0, 16, record_tile, &g_rec);
+    neg_pool_run(NULL, 100, 16, NULL, NULL);
+    TEST_ASSERT(atomic_load(&g_rec.visits[0]) == 0, "Empty range and NULL callback are no-ops");
+}
+
+/* ========================================================================
+ * TEST 2: SLOTS
+ * ======================================================================== */
+
+static void test_slots(void) {
+    printf("\n[TEST 2] Slots and the serial path\n");
+
+    NegPoolConfig cfg;
+    neg_pool_config_default(&cfg);
+    TEST_ASSERT(cfg.threads == 1 && cfg.tile_size == 0 && cfg.pin_cpus == 0,
+                "Default configuration is serial");
+    TEST_ASSERT(neg_pool_slots(&cfg) == 1 && neg_pool_slots(NULL) == 1, "Serial: one slot");
+
+    cfg.threads = 1000;
+    TEST_ASSERT(neg_pool_slots(&cfg) == NEG_POOL_MAX_THREADS, "Thread count capped");
+    cfg.threads = 0;
+    TEST_ASSERT(neg_pool_slots(&cfg) >= 1, "0 threads: one per online CPU");
+
+    neg_pool_shutdown();
+    cfg.threads = 1;
+    cfg.tile_size = 10;
+    run_recorded(&g_rec, &cfg, 1000, 0);
+    TEST_ASSERT(atomic_load(&g_rec.off_caller) == 0 && neg_pool_workers() == 0,
+                "1 thread runs on the caller without starting workers");
+
+    cfg.threads = 4;
+    TEST_ASSERT(run_recorded(&g_rec, &cfg, 1000, 0), "4 threads: slots below neg_pool_slots()");
+    TEST_ASSERT(neg_pool_workers() == 3, "Pool grew to threads - 1 workers");
+
+    /* 100 tiles over 4 slots: slot s owns tiles [25 s, 25 s + 25) every call */
+    int blocks_ok = 1;
+    for (int run = 0; run < 20; run++) {
+        run_recorded(&g_rec, &cfg, 1000, 0);
+        for (int k = 0; k < 100; k++) {
+            if (atomic_load(&g_rec.slot_of[k]) != k / 25) blocks_ok = 0;
+        }
+    }
+    TEST_ASSERT(blocks_ok, "Static schedule: tile k always runs in slot k * slots / tiles");
+
+    cfg.tile_size = 1000;
+    run_recorded(&g_rec, &cfg, 1000, 0);
+    TEST_ASSERT(atomic_load(&g_rec.off_caller) == 0, "A single tile stays on the caller");
+}
+
+/* ========================================================================
+ * TEST 3: RICHARDS-LITE DETERMINISM
+ * ======================================================================== */
+
+static void init_cell(Cell* cell, int i) {
+    memset(cell, 0, sizeof(*cell));
+    cell->theta = 0.08f + 0.003f * (float)(i % 97);
+    cell->psi = -10.0f;
+    cell->K_s = 5.0e-6f;
+    cell->alpha_vG = 1.5f;
+    cell->n_vG = 1.4f;
+    cell->theta_s = 0.45f;
+    cell->theta_r = 0.05f;
+    cell->porosity_eff = 0.45f;
+    cell->M_K_zz = 1.0f + 0.01f * (float)(i % 13);
+    cell->M_K_xx = 1.0f;
+    cell->kappa_evap = 1.0f;
+    cell->zeta_c = 0.005f;
+    cell->a_c = 0.5f;
+    cell->dz = 0.2f;
+    cell->dx = 10.0f;
+}
+
+typedef struct {
+    Cell* cells;
+    const RichardsLiteParams* params;
+} GridRun;
+
+/* Three ponded steps of one grid on its own thread */
+static void* step_grid(void* arg) {
+    GridRun* run = (GridRun*)arg;
+    enum { NX = 24, NY = 20, NZ = 8 };
+    for (int step = 0; step < 3; step++) {
+        richards_lite_step(run->cells, run->params, NX, NY, NZ, 600.0f, 1.0e-6f, NULL);
+    }
+    return NULL;
+}
+
+static void test_richards(void) {
+    printf("\n[TEST 3] Richards-Lite vertical pass is deterministic\n");
+
+    enum { NX = 24, NY = 20, NZ = 8, N = NX * NY * NZ };
+    Cell* ref = (Cell*)malloc(sizeof(Cell) * N);
+    Cell* cells = (Cell*)malloc(sizeof(Cell) * N);
+    for (int i = 0; i < N; i++) init_cell(&ref[i], i);
+
+    RichardsLiteParams params;
+    memset(&params, 0, sizeof(params));
+    params.K_r = 1.0e-4f;
+    params.E_bare_ref = 5.0e-7f;
+    params.dt_max = 3600.0f;
+    params.CFL_factor = 0.5f;
+    params.use_free_drainage = 1;
+    richards_lite_init();
+
+    memcpy(cells, ref, sizeof(Cell) * N);
+    for (int step = 0; step < 3; step++) {
+        richards_lite_step(ref, &params, NX, NY, NZ, 600.0f, 1.0e-6f, NULL);
+    }
+
+    static const uint32_t threads[] = { 1, 2, 4, 8 };
+    static const uint32_t tiles[] = { 0, 1, 7, 1000 };
+    int identical = 1;
+    for (size_t t = 0; t < 4; t++) {
+        for (size_t s = 0; s < 4; s++) {
+            NegPoolConfig cfg;
+            neg_pool_config_default(&cfg);
+            cfg.threads = threads[t];
+            cfg.tile_size = tiles[s];
+
+            Cell* run = (Cell*)malloc(sizeof(Cell) * N);
+            memcpy(run, cells, sizeof(Cell) * N);
+            for (int step = 0; step < 3; step++) {
+                richards_lite_step_tiled(run, &params, NX, NY, NZ, 600.0f, 1.0e-6f, NULL, &cfg);
+            }
+            if (memcmp(run, ref, sizeof(Cell) * N) != 0) identical = 0;
+            free(run);
+        }
+    }
+    TEST_ASSERT(identical, "1/2/4/8 threads x 4 tile sizes match the serial step bit for bit");
+
+    int moved = 0;
+    for (int i = 0; i < N; i++) {
+        if (ref[i].theta != cells[i].theta) moved = 1;
+    }
+    TEST_ASSERT(moved, "The step actually changed the state");
+
+    /* First touch uses the solver's tiling, so it must cover every column */
+    NegPoolConfig touch;
+    neg_pool_config_default(&touch);
+    touch.threads = 4;
+    memset(cells, 0xAB, sizeof(Cell) * N);
+    richards_lite_first_touch(cells, NX, NY, NZ, &touch);
+    int zeroed = 1;
+    for (size_t b = 0; b < sizeof(Cell) * N; b++) {
+        if (((const uint8_t*)cells)[b] != 0) zeroed = 0;
+    }
+    TEST_ASSERT(zeroed, "richards_lite_first_touch() zeroes the whole grid");
+
+    /* Ponded grids stepped from two threads at once (surface flow on) */
+    GridRun runs[2];
+    for (int i = 0; i < N; i++) {
+        init_cell(&cells[i], i);
+        cells[i].h_surface = 0.02f + 0.001f * (float)(i % 23);
+        cells[i].z = 0.01f * (float)(i % 7);
+    }
+    for (int r = 0; r < 2; r++) {
+        runs[r].cells = (Cell*)malloc(sizeof(Cell) * N);
+        memcpy(runs[r].cells, cells, sizeof(Cell) * N);
+        runs[r].params = &params;
+    }
+    for (int step = 0; step < 3; step++) {
+        richards_lite_step(cells, &params, NX, NY, NZ, 600.0f, 1.0e-6f, NULL);
+    }
+    pthread_t grid_threads[2];
+    for (int r = 0; r < 2; r++) pthread_create(&grid_threads[r], NULL, step_grid, &runs[r]);
+    for (int r = 0; r < 2; r++) pthread_join(grid_threads[r], NULL);
+    TEST_ASSERT(memcmp(runs[0].cells, cells, sizeof(Cell) * N) == 0 &&
+                memcmp(runs[1].cells, cells, sizeof(Cell) * N) == 0,
+                "Two grids stepped concurrently match the serial step");
+    free(runs[0].cells);
+    free(runs[1].cells);
+
+    free(cells);
+    free(ref);
+}
+
+/* ========================================================================
+ * TEST 4: CONCURRENT CALLERS
+ * ======================================================================== */
+
+#define CALLERS 4
+
+typedef struct {
+    NegPoolConfig cfg;
+    _Atomic long sum;
+    int rounds;
+    int ok;
+} Caller;
+
+static void sum_tile(void* ctx, size_t begin, size_t end, int slot) {
+    Caller* c = (Caller*)ctx;
+    (void)slot;
+    long s = 0;
+    for (size_t i = begin; i < end; i++) s += (long)i;
+    atomic_fetch_add(&c->sum, s);
+}
+
+static void* caller_main(void* arg) {
+    Caller* c = (Caller*)arg;
+    const size_t count = 5000;
+    const long expected = (long)(count * (count - 1) / 2);
+    c->ok = 1;
+    for (int r = 0; r < c->rounds; r++) {
+        atomic_store(&c->sum, 0);
+        neg_pool_run(&c->cfg, count, 16, sum_tile, c);
+        if (atomic_load(&c->sum) != expected) c->ok = 0;
+    }
+    return NULL;
+}
+
+static void test_concurrent(void) {
+    printf("\n[TEST 4] Concurrent callers share one pool\n");
+
+    neg_pool_shutdown();
+
+    Caller callers[CALLERS];
+    pthread_t threads[CALLERS];
+    for (int i = 0; i < CALLERS; i++) {
+        neg_pool_config_default(&callers[i].cfg);
+        callers[i].cfg.threads = (uint32_t)(2 + i);   /* 2..5 */
+        callers[i].rounds = 200;
+        pthread_create(&threads[i], NULL, caller_main, &callers[i]);
+    }
+    int ok = 1;
+    for (int i = 0; i < CALLERS; i++) {
+        pthread_join(threads[i], NULL);
+        ok &= callers[i].ok;
+    }
+    TEST_ASSERT(ok, "4 callers x 200 jobs: every sum correct");
+    TEST_ASSERT(neg_pool_workers() == 4,
+                "Pool bounded by the largest request (5 threads: 4 workers), not the sum");
+}
+
+/* ========================================================================
+ * TEST 5: CONFIG JSON
+ * ======================================================================== */
+
+static void test_config(void) {
+    printf("\n[TEST 5] Config keys\n");
+
+    void* sim = neg_create("{\"num_entities\": 4, \"num_scalar_fields\": 16}");
+    const NegPoolConfig* cfg = state_get_pool_config(sim);
+    TEST_ASSERT(cfg && cfg->threads == 1 && cfg->tile_size == 0 && cfg->pin_cpus == 0,
+                "No keys: serial defaults");
+    neg_destroy(sim);
+
+    sim = neg_create("{\"num_entities\": 4, \"num_scalar_fields\": 16, "
+                     "\"threads\": 6, \"tile_size\": 32, \"pin_cpus\": true}");
+    cfg = state_get_pool_config(sim);
+    TEST_ASSERT(cfg && cfg->threads == 6 && cfg->tile_size == 32 && cfg->pin_cpus == 1,
+                "threads / tile_size / pin_cpus parsed");
+    neg_destroy(sim);
+
+    sim = neg_create("{\"num_entities\": 4, \"threads\": 0, \"pin_cpus\": false}");
+    cfg = state_get_pool_config(sim);
+    TEST_ASSERT(cfg && cfg->threads == 0 && cfg->pin_cpus == 0, "threads 0 and pin_cpus false");
+    neg_destroy(sim);
+
+    TEST_ASSERT(state_get_pool_config(NULL) == NULL, "NULL simulation");
+}
+
+/* ========================================================================
+ * TEST 6: SHUTDOWN
+ * ======================================================================== */
+
+static void test_shutdown(void) {
+    printf("\n[TEST 6] Shutdown and restart\n");
+
+    NegPoolConfig cfg;
+    neg_pool_config_default(&cfg);
+    cfg.threads = 3;
+    cfg.pin_cpus = 1;
+    TEST_ASSERT(run_recorded(&g_rec, &cfg, 2000, 8), "Pinned workers cover the range");
+
+    neg_pool_shutdown();
+    TEST_ASSERT(neg_pool_workers() == 0, "Shutdown joins every worker");
+    neg_pool_shutdown();
+    TEST_ASSERT(neg_pool_workers() == 0, "Second shutdown is a no-op");
+
+    cfg.pin_cpus = 0;
+    TEST_ASSERT(run_recorded(&g_rec, &cfg, 2000, 8) && neg_pool_workers() == 2,
+                "Next job restarts the pool");
+    neg_pool_shutdown();
+}
+
+/* ========================================================================
+ * TEST 7: STICKY BITS
+ * ======================================================================== */
+
+static volatile int32_t g_sink;
+
+/* Slot 1 overflows, slot 2 divides by zero, slot 0 stays clean */
+static void saturate_tile(void* ctx, size_t begin, size_t end, int slot) {
+    (void)ctx;
+    (void)begin;
+    (void)end;
+    if (slot == 1) g_sink = fixed_add_sat(INT32_MAX, 1);
+    if (slot == 2) g_sink = fixed_div_sat(1, 0);
+}
+
+static void test_sticky(void) {
+    printf("\n[TEST 7] Sticky bits from workers\n");
+
+    NegPoolConfig cfg;
+    neg_pool_config_default(&cfg);
+    cfg.threads = 4;
+    cfg.tile_size = 10;
+
+    int ok = 1;
+    for (int run = 0; run < 20; run++) {
+        fixed_sticky_take();
+        neg_pool_run(&cfg, 1000, 0, saturate_tile, NULL);
+        if (fixed_sticky_take() != (FIXED_STICKY_OVERFLOW | FIXED_STICKY_DIV_ZERO)) ok = 0;
+    }
+    TEST_ASSERT(ok, "Overflow and divide-by-zero on slots 1 and 2 reach the caller");
+
+    /* Workers took their bits, so the next job starts clean */
+    neg_pool_run(&cfg, 1000, 0, record_tile, &g_rec);
+    TEST_ASSERT(fixed_sticky_take() == 0, "No bits carried into the next job");
+
+    neg_pool_shutdown();
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("PROCESS-WIDE WORKER POOL - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_coverage();
+    test_slots();
+    test_richards();
+    test_concurrent();
+    test_config();
+    test_shutdown();
+    test_sticky();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
@@ -0,0 +1,231 @@
+/*
+ * trace_test.c - Unit Tests for Chrome Trace-Event Recording
+ *
+ * Built with NEG_TRACE=1 and a 256-event ring so wrap-around is cheap.
+ *
+ * Tests for:
+ *   1. Complete and instant events appear in the dump with their names,
+ *      categories and args
+ *   2. One ring (track) per thread; concurrent writers lose nothing
+ *      below the ring capacity
+ *   3. Wrap-around keeps the newest NEG_TRACE_RING_EVENTS - 1 events
+ *      (the slot a writer may be filling is never dumped)
+ *   4. Buffer sizing, short buffers, neg_trace_clear()
+ *   5. state_step() / state_hash() emit their events
+ *
+ * Compile with:
+ *   gcc -DNEG_TRACE=1 -DNEG_TRACE_RING_EVENTS=256 -pthread \
+ *       -o trace_test trace_test.c ../src/core/trace.c \
+ *       ../src/core/phase_timers.c ../src/core/state.c ../src/core/mem_stats.c \
+ *       ../src/core/thread_pool.c ../src/core/neg_error.c ../src/core/rng.c \
+ *       ../src/core/math/fixed_math.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I../embedded -lm -std=c99
+ *
+ * Author: negentropic-core team
+ * Version: 0.1.0
+ * License: MIT OR GPL-3.0
+ */
+
+#include "../src/core/state.h"
+#include "../src/core/include/trace.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+#define WORKERS 3
+#define EVENTS_PER_WORKER 100
+
+/** Count non-overlapping occurrences of needle */
+static int count(const char* haystack, const char* needle) {
+    int n = 0;
+    size_t len = strlen(needle);
+    for (const char* p = strstr(haystack, needle); p; p = strstr(p + len, needle)) {
+        n++;
+    }
+    return n;
+}
+
+/** Dump into a freshly sized buffer (caller frees) */
+static char* dump(int* len) {
+    size_t size = neg_trace_json_size();
+    char* buffer = (char*)malloc(size);
+    *len = neg_trace_json(buffer, size);
+    return buffer;
+}
+
+/* ========================================================================
+ * TEST 1: EVENTS
+ * ======================================================================== */
+
+static void test_events(void) {
+    printf("\n[TEST 1] Complete and instant events\n");
+
+    NEG_TRACE_SCOPE_BEGIN(t0);
+    volatile double sink = 0.0;
+    for (int i = 0; i < 10000; i++) sink += i;
+    NEG_TRACE_SCOPE_END(t0, "hyd", "vertical_solve", 4096);
+    NEG_TRACE_INSTANT("lod", "escalate", 2);
+
+    int len;
+    char* json = dump(&len);
+    TEST_ASSERT(len > 0 && (size_t)len == strlen(json), "Dump written");
+    TEST_ASSERT(strncmp(json, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 39) == 0 &&
+                strcmp(json + len - 4, "\n]}\n") == 0, "Trace-event object framing");
+    TEST_ASSERT(strstr(json, "\"name\":\"vertical_solve\",\"cat\":\"hyd\",\"ph\":\"X\"") != NULL &&
+                strstr(json, "\"args\":{\"n\":4096}") != NULL, "Complete event with arg");
+    TEST_ASSERT(strstr(json, "\"name\":\"escalate\",\"cat\":\"lod\",\"ph\":\"i\",\"s\":\"t\"") != NULL,
+                "Instant event, thread scope");
+    TEST_ASSERT(count(json, "\"thread_name\"") == 1, "One track so far");
+    free(json);
+}
+
+/* ========================================================================
+ * TEST 2: THREADS
+ * ======================================================================== */
+
+static void* worker(void* arg) {
+    (void)arg;
+    for (int i = 0; i < EVENTS_PER_WORKER; i++) {
+        NEG_TRACE_SCOPE_BEGIN(t0);
+        NEG_TRACE_SCOPE_END(t0, "sim", "tile", i);
+    }
+    return NULL;
+}
+
+static void test_threads(void) {
+    printf("\n[TEST 2] One ring per thread\n");
+
+    neg_trace_clear();
+    pthread_t threads[WORKERS];
+    for (int i = 0; i < WORKERS; i++) pthread_create(&threads[i], NULL, worker, NULL);
+    for (int i = 0; i < WORKERS; i++) pthread_join(threads[i], NULL);
+
+    int len;
+    char* json = dump(&len);
+    TEST_ASSERT(count(json, "\"thread_name\"") == 1 + WORKERS, "Main + worker tracks");
+    TEST_ASSERT(count(json, "\"name\":\"tile\"") == WORKERS * EVENTS_PER_WORKER,
+                "No worker event lost");
+    TEST_ASSERT(count(json, "\"vertical_solve\"") == 0, "Cleared events not dumped");
+    free(json);
+}
+
+/* ========================================================================
+ * TEST 3: WRAP-AROUND
+ * ======================================================================== */
+
+static void test_wrap(void) {
+    printf("\n[TEST 3] Ring wrap-around\n");
+
+    neg_trace_clear();
+    for (int i = 0; i < NEG_TRACE_RING_EVENTS + 50; i++) {
+        NEG_TRACE_INSTANT("sim", "tick", i);
+    }
+
+    int len;
+    char* json = dump(&len);
+    char newest[64], oldest_kept[64], dropped[64];
+    snprintf(newest, sizeof(newest), "\"n\":%d}", NEG_TRACE_RING_EVENTS + 49);
+    snprintf(oldest_kept, sizeof(oldest_kept), "\"n\":%d}", 51);
+    snprintf(dropped, sizeof(dropped), "\"n\":%d}", 50);
+    TEST_ASSERT(count(json, "\"name\":\"tick\"") == NEG_TRACE_RING_EVENTS - 1,
+                "Wrapped ring dumps NEG_TRACE_RING_EVENTS - 1 events");
+    TEST_ASSERT(strstr(json, newest) && strstr(json, oldest_kept) && !strstr(json, dropped),
+                "Oldest events overwritten, newest kept");
+    free(json);
+}
+
+/* ========================================================================
+ * TEST 4: SIZING
+ * ======================================================================== */
+
+static void test_sizing(void) {
+    printf("\n[TEST 4] Buffer sizing and clear\n");
+
+    size_t size = neg_trace_json_size();
+    char* buffer = (char*)malloc(size);
+    int len = neg_trace_json(buffer, size);
+    TEST_ASSERT(len > 0 && (size_t)len < size, "neg_trace_json_size() is sufficient");
+    TEST_ASSERT(neg_trace_json(buffer, (size_t)len) == -1, "Short buffer rejected");
+
+    neg_trace_clear();
+    len = neg_trace_json(buffer, size);
+    TEST_ASSERT(len > 0 && count(buffer, "\"ph\":\"X\"") == 0 && count(buffer, "\"ph\":\"i\"") == 0,
+                "Clear drops all events, keeps tracks");
+    free(buffer);
+}
+
+/* ========================================================================
+ * TEST 5: INSTRUMENTED STEP
+ * ======================================================================== */
+
+static void test_state(void) {
+    printf("\n[TEST 5] Instrumented simulation step\n");
+
+    SimulationConfig cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.num_entities = 16;
+    cfg.num_scalar_fields = 256;
+    cfg.dt = 0.016f;
+    void* sim = state_create(&cfg);
+
+    neg_trace_clear();
+    state_step(sim, 0.0f);
+    state_step(sim, 0.0f);
+    (void)state_hash(sim);
+
+    int len;
+    char* json = dump(&len);
+    TEST_ASSERT(count(json, "\"name\":\"step\",\"cat\":\"sim\"") == 2, "Two step events");
+    TEST_ASSERT(count(json, "\"name\":\"hash\",\"cat\":\"io\"") == 1 &&
+                count(json, "snapshot_save") == 0, "Hash traced once, not as a snapshot");
+    free(json);
+    state_destroy(sim);
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("CHROME TRACE-EVENT RECORDING - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    test_events();
+    test_threads();
+    test_wrap();
+    test_sizing();
+    test_state();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
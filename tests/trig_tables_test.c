@@ -0,0 +1,222 @@
+/*
+ * trig_tables_test.c - Unit Tests for Quarter-Wave Trigonometric LUTs
+ *
+ * Tests for:
+ *   1. finesine_at() reconstructs every fine angle of the full period
+ *   2. Sin_from_LUT / Cos_from_LUT accuracy and quadrant symmetry
+ *   3. Interpolated lookups: accuracy equal or better than the former
+ *      full-table interpolation
+ *   4. SinCos_from_LUT_interp bit-identical to separate calls
+ *   5. Table footprint
+ *
+ * Compile with:
+ *   gcc -o trig_tables_test trig_tables_test.c \
+ *       ../embedded/se3_math.c ../embedded/trig_tables.c \
+ *       -I../embedded -lm -std=c99
+ *
+ * Author: ClaudeCode (quarter-wave LUT)
+ * Version: 1.0
+ */
+
+#include "../embedded/se3_edge.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+/* Test statistics */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Helper macros */
+#define TEST_ASSERT(cond, msg) do { \
+    if (cond) { \
+        tests_passed++; \
+        printf("  ✓ %s\n", msg); \
+    } else { \
+        tests_failed++; \
+        printf("  ✗ %s\n", msg); \
+    } \
+} while(0)
+
+static const double TWO_PI = 6.283185307179586;
+
+/* Deterministic LCG so failures are reproducible */
+static uint32_t lcg_state = 2718u;
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state;
+}
+
+static double angle_to_rad(uint32_t angle) {
+    return (double)angle * (TWO_PI / 4294967296.0);
+}
+
+/**
+ * Former full-table interpolation (finesine[i] .. finesine[i+1],
+ * truncating FixedMul), kept as the accuracy baseline.
+ */
+static fixed_t legacy_sin_interp(uint32_t angle) {
+    uint32_t index = angle >> (32 - ANGLE_BITS);
+    fixed_t frac = (fixed_t)((angle >> (32 - ANGLE_BITS - 16)) & 0xFFFF);
+    fixed_t lo = finesine_at(index);
+    fixed_t hi = finesine_at(index + 1);
+    return lo + FixedMul(frac, hi - lo);
+}
+
+/* ========================================================================
+ * TEST 1: Full-Period Reconstruction
+ * ======================================================================== */
+
+void test_reconstruction(void) {
+    printf("\n[TEST 1] Full-Period Reconstruction from Quarter Table\n");
+    int exact = 1, sym = 1;
+
+    for (uint32_t i = 0; i < NUM_FINE_ANGLES; i++) {
+        /* Same formula as tools/generate_trig_lut.py */
+        double ref = sin((double)i / NUM_FINE_ANGLES * TWO_PI) * FRACUNIT;
+        if (finesine_at(i) != (fixed_t)lround(ref)) {
+            exact = 0;
+        }
+        if (finesine_at(i + NUM_FINE_ANGLES / 2) != -finesine_at(i) ||
+            finesine_at(NUM_FINE_ANGLES / 2 - i) != finesine_at(i)) {
+            sym = 0;
+        }
+    }
+    TEST_ASSERT(exact, "All 8192 fine angles match round(sin) exactly");
+    TEST_ASSERT(sym, "sin(180°-x) = sin(x), sin(180°+x) = -sin(x)");
+    TEST_ASSERT(finesine_at(NUM_FINE_ANGLES / 4) == FRACUNIT &&
+                finesine_at(3 * NUM_FINE_ANGLES / 4) == -FRACUNIT &&
+                finesine_at(NUM_FINE_ANGLES) == 0,
+                "Exact values at 90°, 270°, 360°");
+    TEST_ASSERT(get_cosine_table_entry(0) == FRACUNIT &&
+                get_cosine_table_entry(NUM_FINE_ANGLES / 2) == -FRACUNIT,
+                "Cosine entries via +90° offset");
+}
+
+/* ========================================================================
+ * TEST 2: Direct Lookups
+ * ======================================================================== */
+
+void test_direct_lookup(void) {
+    printf("\n[TEST 2] Sin_from_LUT / Cos_from_LUT\n");
+    double max_err = 0.0;
+
+    for (int n = 0; n < 200000; n++) {
+        uint32_t angle = lcg_next();
+        /* Truncated index: compare against the angle it represents */
+        uint32_t snapped = angle & ~((1u << (32 - ANGLE_BITS)) - 1u);
+        double es = fabs(FIXED_TO_FLOAT(Sin_from_LUT(angle)) - sin(angle_to_rad(snapped)));
+        double ec = fabs(FIXED_TO_FLOAT(Cos_from_LUT(angle)) - cos(angle_to_rad(snapped)));
+        if (es > max_err) max_err = es;
+        if (ec > max_err) max_err = ec;
+    }
+    printf("    Max error at table angles: %.2e\n", max_err);
+    TEST_ASSERT(max_err <= 0.5 / FRACUNIT + 1e-9, "Within half an LSB of sin/cos");
+    TEST_ASSERT(get_max_pythagorean_error() < FLOAT_TO_FIXED(0.001f), "sin² + cos² ≈ 1");
+}
+
+/* ========================================================================
+ * TEST 3: Interpolated Accuracy
+ * ======================================================================== */
+
+void test_interp_accuracy(void) {
+    printf("\n[TEST 3] Interpolated Lookups vs libm\n");
+    double max_new = 0.0, max_old = 0.0, sum_new = 0.0, sum_old = 0.0;
+    int odd = 1;
+    const int samples = 1000000;
+
+    for (int n = 0; n < samples; n++) {
+        uint32_t angle = lcg_next();
+        double ref = sin(angle_to_rad(angle));
+        double e_new = fabs(FIXED_TO_FLOAT(Sin_from_LUT_interp(angle)) - ref);
+        double e_old = fabs(FIXED_TO_FLOAT(legacy_sin_interp(angle)) - ref);
+        double e_cos = fabs(FIXED_TO_FLOAT(Cos_from_LUT_interp(angle)) - cos(angle_to_rad(angle)));
+
+        if (e_new > max_new) max_new = e_new;
+        if (e_cos > max_new) max_new = e_cos;
+        if (e_old > max_old) max_old = e_old;
+        sum_new += e_new;
+        sum_old += e_old;
+
+        if (Sin_from_LUT_interp(0u - angle) != -Sin_from_LUT_interp(angle)) {
+            odd = 0;
+        }
+    }
+
+    printf("    Quarter-wave interp: max %.2e, mean %.2e\n", max_new, sum_new / samples);
+    printf("    Former full-table:   max %.2e, mean %.2e\n", max_old, sum_old / samples);
+    TEST_ASSERT(max_new <= max_old, "Max error equal or better than full-table interpolation");
+    TEST_ASSERT(sum_new <= sum_old, "Mean error equal or better than full-table interpolation");
+    TEST_ASSERT(max_new < 2.0 / FRACUNIT, "Max error below 2 LSB");
+    TEST_ASSERT(odd, "Exact odd symmetry: sin(-x) == -sin(x)");
+    TEST_ASSERT(Sin_from_LUT_interp(0x40000000) == FRACUNIT &&
+                Cos_from_LUT_interp(0) == FRACUNIT &&
+                Sin_from_LUT_interp(0x80000000) == 0,
+                "Exact at quadrant boundaries");
+}
+
+/* ========================================================================
+ * TEST 4: Combined SinCos
+ * ======================================================================== */
+
+void test_sincos(void) {
+    printf("\n[TEST 4] SinCos_from_LUT_interp\n");
+    int same = 1;
+    const uint32_t edges[] = { 0u, 1u, 0x3FFFFFFFu, 0x40000000u, 0x7FFFFFFFu,
+                               0x80000000u, 0xBFFFFFFFu, 0xC0000000u, 0xFFFFFFFFu };
+
+    for (int n = 0; n < 200000 + (int)(sizeof(edges) / sizeof(edges[0])); n++) {
+        uint32_t angle = (n < (int)(sizeof(edges) / sizeof(edges[0]))) ? edges[n] : lcg_next();
+        fixed_t s, c;
+        SinCos_from_LUT_interp(angle, &s, &c);
+        if (s != Sin_from_LUT_interp(angle) || c != Cos_from_LUT_interp(angle)) {
+            same = 0;
+        }
+    }
+    TEST_ASSERT(same, "Bit-identical to separate Sin/Cos interp calls");
+}
+
+/* ========================================================================
+ * TEST 5: Footprint
+ * ======================================================================== */
+
+void test_footprint(void) {
+    printf("\n[TEST 5] Table Footprint\n");
+    printf("    finesine_quarter: %d bytes (full period was %d bytes)\n",
+           (int)sizeof(finesine_quarter), (int)(NUM_FINE_ANGLES * sizeof(fixed_t)));
+    TEST_ASSERT(sizeof(finesine_quarter) == (QUARTER_FINE_ANGLES + 1) * sizeof(fixed_t),
+                "Quarter table is 2049 entries (~8 KB)");
+}
+
+/* ========================================================================
+ * MAIN
+ * ======================================================================== */
+
+int main(void) {
+    printf("======================================================================\n");
+    printf("QUARTER-WAVE TRIG TABLES - UNIT TEST SUITE\n");
+    printf("======================================================================\n");
+
+    se3_init_tables();
+
+    test_reconstruction();
+    test_direct_lookup();
+    test_interp_accuracy();
+    test_sincos();
+    test_footprint();
+
+    printf("\n======================================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("======================================================================\n");
+    printf("  Passed: %d\n", tests_passed);
+    printf("  Failed: %d\n", tests_failed);
+    printf("  Total:  %d\n", tests_passed + tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✓ ALL TESTS PASSED\n");
+    } else {
+        printf("\n✗ SOME TESTS FAILED - Review implementation\n");
+    }
+
+    return tests_failed;
+}
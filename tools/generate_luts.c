@@ -0,0 +1,239 @@
+/*
+ * generate_luts.c - Build-Time Lookup Table Generator
+ *
+ * Emits the solver and fixed-point LUTs as const arrays so that nothing
+ * is computed at startup and every target reads the same bits:
+ *
+ *   src/core/math/fixed_math_luts.h          reciprocal_lut, sqrt_lut
+ *   src/solvers/atmosphere_biotic_luts.h     g_e_s_lut (e_s(T))
+ *   src/solvers/hydrology_richards_lite_luts.h
+ *                                            g_vG_lut_default (θ(ψ), K(θ), C(ψ))
+ *
+ * Written in C rather than Python (cf. tools/generate_trig_lut.py) because
+ * the float tables must match the single-precision powf()/expf() formulas
+ * in the solver headers bit for bit; the generator calls those very
+ * functions. Floats are printed with 9 significant digits, which
+ * round-trips every IEEE-754 single exactly.
+ *
+ * Usage:
+ *   generate_luts <repo_root>            Rewrite the three headers
+ *   generate_luts --check <repo_root>    Exit 1 if any header is stale
+ *
+ * Build with strict IEEE semantics (no -ffast-math); CMake target
+ * `regen_luts` and ctest `LutTablesCheck` do this.
+ *
+ * Reference: id-Software/DOOM linuxdoom-1.10/tables.c (precomputed tables)
+ * Author: ClaudeCode (static const LUTs)
+ * Version: 1.0
+ */
+
+#include "../src/core/math/fixed_math.h"
+#include "../src/solvers/atmosphere_biotic_internal.h"
+#include "../src/solvers/hydrology_richards_lite_internal.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========================================================================
+ * OUTPUT BUFFER
+ * ======================================================================== */
+
+#define OUT_CAPACITY (128 * 1024)
+
+typedef struct {
+    char data[OUT_CAPACITY];
+    size_t len;
+} out_buf_t;
+
+static out_buf_t g_out;
+
+static void emit(const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(g_out.data + g_out.len, OUT_CAPACITY - g_out.len, fmt, ap);
+    va_end(ap);
+    if (n < 0 || (size_t)n >= OUT_CAPACITY - g_out.len) {
+        fprintf(stderr, "generate_luts: output buffer overflow\n");
+        exit(2);
+    }
+    g_out.len += (size_t)n;
+}
+
+static void emit_preamble(const char* guard, const char* includer) {
+    g_out.len = 0;
+    emit("/* Generated by tools/generate_luts.c - DO NOT EDIT MANUALLY */\n");
+    emit("/* This file contains the LUT data and should be included in %s */\n", includer);
+    emit("#ifndef %s\n#define %s\n\n", guard, guard);
+}
+
+static void emit_fixed_array(const char* decl, const fixed_t* v, int count) {
+    emit("%s = {\n", decl);
+    for (int i = 0; i < count; i++) {
+        emit("%s%8d%s", (i % 8 == 0) ? "    " : "",
+             (int)v[i], (i == count - 1) ? "" : ",");
+        if (i % 8 == 7 || i == count - 1) {
+            emit("  /* %3d-%3d */\n", i - (i % 8), i);
+        }
+    }
+    emit("};\n");
+}
+
+static void emit_float_array(const char* decl, const float* v, int count, const char* indent) {
+    emit("%s%s{\n", indent, decl);
+    for (int i = 0; i < count; i++) {
+        emit("%s%s%.8ef%s", (i % 4 == 0) ? indent : "", (i % 4 == 0) ? "    " : " ",
+             (double)v[i], (i == count - 1) ? "" : ",");
+        if (i % 4 == 3 || i == count - 1) {
+            emit("\n");
+        }
+    }
+    emit("%s}", indent);
+}
+
+/* ========================================================================
+ * TABLE GENERATORS
+ * ======================================================================== */
+
+/**
+ * Reciprocal and sqrt LUTs for fixed_math.c.
+ *
+ * Same formulas as the former fixed_math_init():
+ *   reciprocal_lut[i] = FLOAT_TO_FIXED((float)(1.0 / (1.0 + i)))
+ *   sqrt_lut[i]       = FLOAT_TO_FIXED((float)sqrt(2.0 * i))
+ */
+static void generate_fixed_math(void) {
+    fixed_t recip[RECIPROCAL_LUT_SIZE];
+    fixed_t root[SQRT_LUT_SIZE];
+
+    for (int i = 0; i < RECIPROCAL_LUT_SIZE; i++) {
+        double recip_val = 1.0 / (1.0 + (double)i);
+        recip[i] = FLOAT_TO_FIXED((float)recip_val);
+    }
+    for (int i = 0; i < SQRT_LUT_SIZE; i++) {
+        double sqrt_val = sqrt(2.0 * (double)i);
+        root[i] = FLOAT_TO_FIXED((float)sqrt_val);
+    }
+
+    emit_preamble("FIXED_MATH_LUTS_H", "fixed_math.c");
+    emit("/* Reciprocal LUT: 1/(1 + i), i = 0..%d (Q16.16) */\n", RECIPROCAL_LUT_SIZE - 1);
+    emit_fixed_array("const fixed_t reciprocal_lut[RECIPROCAL_LUT_SIZE]", recip, RECIPROCAL_LUT_SIZE);
+    emit("\n/* Square root LUT: sqrt(2i), i = 0..%d (Q16.16) */\n", SQRT_LUT_SIZE - 1);
+    emit_fixed_array("const fixed_t sqrt_lut[SQRT_LUT_SIZE]", root, SQRT_LUT_SIZE);
+    emit("\n#endif /* FIXED_MATH_LUTS_H */\n");
+}
+
+/** e_s(T) table for atmosphere_biotic.c */
+static void generate_biotic(void) {
+    float e_s[E_S_LUT_SIZE];
+
+    biotic_e_s_lut_build(e_s);
+
+    emit_preamble("ATMOSPHERE_BIOTIC_LUTS_H", "atmosphere_biotic.c");
+    emit("/* Saturation vapor pressure e_s(T) [Pa], T = %.0f K .. %.0f K */\n",
+         (double)T_MIN, (double)T_MAX);
+    emit_float_array("static const float g_e_s_lut[E_S_LUT_SIZE] = ", e_s, E_S_LUT_SIZE, "");
+    emit(";\n\n#endif /* ATMOSPHERE_BIOTIC_LUTS_H */\n");
+}
+
+/** Default-soil van Genuchten tables for hydrology_richards_lite.c */
+static void generate_richards(void) {
+    static VanGenuchtenLUT lut;
+
+    vG_lut_build(&lut, VG_DEFAULT_ALPHA, VG_DEFAULT_N,
+                 VG_DEFAULT_THETA_S, VG_DEFAULT_THETA_R, VG_DEFAULT_K_S);
+
+    emit_preamble("HYDROLOGY_RICHARDS_LITE_LUTS_H", "hydrology_richards_lite.c");
+    emit("/* Default soil (sandy loam): vG_lut_build(VG_DEFAULT_*) */\n");
+    emit("const VanGenuchtenLUT g_vG_lut_default = {\n");
+    emit("    .alpha = %.8ef,\n", (double)lut.alpha);
+    emit("    .n = %.8ef,\n", (double)lut.n);
+    emit("    .m = %.8ef,\n", (double)lut.m);
+    emit("    .theta_s = %.8ef,\n", (double)lut.theta_s);
+    emit("    .theta_r = %.8ef,\n", (double)lut.theta_r);
+    emit("    .K_s = %.8ef,\n\n", (double)lut.K_s);
+    emit("    /* θ(ψ) */\n");
+    emit_float_array(".theta_of_psi = ", lut.theta_of_psi, LUT_SIZE, "    ");
+    emit(",\n\n    /* K(θ) */\n");
+    emit_float_array(".K_of_theta = ", lut.K_of_theta, LUT_SIZE, "    ");
+    emit(",\n\n    /* dθ/dψ */\n");
+    emit_float_array(".C_of_psi = ", lut.C_of_psi, LUT_SIZE, "    ");
+    emit(",\n\n");
+    emit("    .psi_min = %.8ef,\n", (double)lut.psi_min);
+    emit("    .psi_max = %.8ef,\n", (double)lut.psi_max);
+    emit("    .theta_min = %.8ef,\n", (double)lut.theta_min);
+    emit("    .theta_max = %.8ef\n", (double)lut.theta_max);
+    emit("};\n\n#endif /* HYDROLOGY_RICHARDS_LITE_LUTS_H */\n");
+}
+
+/* ========================================================================
+ * WRITE / CHECK
+ * ======================================================================== */
+
+/**
+ * Write the buffer to root/path, or compare against it in check mode.
+ *
+ * @return 0 on success / up to date, 1 if stale or unwritable
+ */
+static int flush(const char* root, const char* path, int check) {
+    char full[1024];
+    snprintf(full, sizeof(full), "%s/%s", root, path);
+
+    if (check) {
+        static char existing[OUT_CAPACITY];
+        FILE* f = fopen(full, "rb");
+        size_t len = 0;
+        if (f) {
+            len = fread(existing, 1, sizeof(existing), f);
+            fclose(f);
+        }
+        if (!f || len != g_out.len || memcmp(existing, g_out.data, len) != 0) {
+            fprintf(stderr, "✗ %s is stale (run generate_luts %s)\n", path, root);
+            return 1;
+        }
+        printf("✓ %s up to date\n", path);
+        return 0;
+    }
+
+    FILE* f = fopen(full, "wb");
+    if (!f || fwrite(g_out.data, 1, g_out.len, f) != g_out.len) {
+        fprintf(stderr, "✗ cannot write %s\n", full);
+        if (f) fclose(f);
+        return 1;
+    }
+    fclose(f);
+    printf("✓ Generated %s\n", path);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int check = 0;
+    const char* root = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--check") == 0) {
+            check = 1;
+        } else {
+            root = argv[i];
+        }
+    }
+    if (!root) {
+        fprintf(stderr, "usage: %s [--check] <repo_root>\n", argv[0]);
+        return 2;
+    }
+
+    int stale = 0;
+
+    generate_fixed_math();
+    stale += flush(root, "src/core/math/fixed_math_luts.h", check);
+
+    generate_biotic();
+    stale += flush(root, "src/solvers/atmosphere_biotic_luts.h", check);
+
+    generate_richards();
+    stale += flush(root, "src/solvers/hydrology_richards_lite_luts.h", check);
+
+    return stale ? 1 : 0;
+}
@@ -1,7 +1,8 @@
 #!/usr/bin/env python3
 """
 Doom-Inspired Fixed-Point Trigonometric Lookup Table Generator
-Generates sine LUT with 8192 entries for ESP32-S3 (16.16 fixed-point format)
+Generates quarter-wave sine LUT (2048 + 1 entries covering 8192 fine angles)
+for ESP32-S3 (16.16 fixed-point format)
 
 Reference: id-Software/DOOM linuxdoom-1.10/tables.c
 Author: ClaudeCode (Doom→SE(3) λ-Estimation Service)
@@ -35,14 +36,21 @@ def float_to_fixed(f: float) -> int:
 
 def generate_trig_tables_header(output_path: str) -> None:
     """
-    Generate trig_tables.h with sine lookup table DATA (for .c file).
+    Generate trig_tables.h with the quarter-wave sine table DATA (for .c file).
 
-    The cosine table is accessed via pointer offset:
-        finecosine = &finesine[NUM_FINE_ANGLES / 4]
+    Only 0°..90° (inclusive) is stored; the other quadrants follow by
+    symmetry in finesine_at() (se3_edge.h):
+        sin(180° - x) = sin(x),  sin(180° + x) = -sin(x)
+
+    Each entry is rounded independently with the same formula as the
+    former 8192-entry table, and the rounded values are exactly
+    symmetric, so lookups are bit-identical to it.
 
     Args:
         output_path: Path to output header file (will be included in trig_tables.c)
     """
+    quarter = NUM_FINE_ANGLES // 4
+
     with open(output_path, 'w') as f:
         # Header comment
         f.write('/* Generated by tools/generate_trig_lut.py - DO NOT EDIT MANUALLY */\n')
@@ -51,12 +59,12 @@ def generate_trig_tables_header(output_path: str) -> None:
         f.write('#define TRIG_TABLES_DATA_H\n\n')
 
         # Sine table data (no static - will have external linkage when included in .c)
-        f.write(f'/* Sine lookup table: 8192 entries, ~0.044° resolution */\n')
-        f.write(f'const fixed_t finesine[NUM_FINE_ANGLES] = {{\n')
+        f.write(f'/* Quarter-wave sine table: {quarter} + 1 entries (0° - 90° inclusive), ~0.044° resolution */\n')
+        f.write(f'const fixed_t finesine_quarter[QUARTER_FINE_ANGLES + 1] = {{\n')
 
         # Generate sine values
-        for i in range(NUM_FINE_ANGLES):
-            # Angle in radians: i maps to [0, 2π)
+        for i in range(quarter + 1):
+            # Angle in radians: i maps to [0, π/2]
             angle_rad = (i / NUM_FINE_ANGLES) * 2.0 * math.pi
             sin_val = math.sin(angle_rad)
             fixed_sin = float_to_fixed(sin_val)
@@ -67,22 +75,18 @@ def generate_trig_tables_header(output_path: str) -> None:
 
             f.write(f'{fixed_sin:7d}')
 
-            if i < NUM_FINE_ANGLES - 1:
+            if i < quarter:
                 f.write(',')
 
             # Line break and comment every 8 values
             if i % 8 == 7:
                 angle_deg = (i / NUM_FINE_ANGLES) * 360.0
                 f.write(f'  /* {i-7:4d}-{i:4d}: {angle_deg-360.0/NUM_FINE_ANGLES*7:.2f}° - {angle_deg:.2f}° */\n')
-            elif i == NUM_FINE_ANGLES - 1:
-                f.write('\n')
+            elif i == quarter:
+                f.write(f'  /* {i:4d}: 90.00° */\n')
 
         f.write('};\n\n')
 
-        # Cosine pointer (Doom optimization: point into sine table at +90°)
-        f.write('/* Cosine via pointer offset (cos(x) = sin(x + 90°)) */\n')
-        f.write('const fixed_t* const finecosine = &finesine[NUM_FINE_ANGLES / 4];\n\n')
-
         f.write('#endif /* TRIG_TABLES_DATA_H */\n')
 
 
@@ -149,10 +153,10 @@ def main():
 
     # Print summary
     print(f'\n✓ Generated trigonometric lookup tables:')
-    print(f'  - {NUM_FINE_ANGLES} sine entries (~0.044° resolution)')
+    print(f'  - {NUM_FINE_ANGLES // 4 + 1} quarter-wave sine entries ({NUM_FINE_ANGLES} fine angles, ~0.044° resolution)')
     print(f'  - {FRACBITS}.{FRACBITS} fixed-point format (range: ±1.0)')
-    print(f'  - Cosine via pointer offset (+{NUM_FINE_ANGLES // 4} entries)')
-    print(f'  - Memory: {NUM_FINE_ANGLES * 4} bytes ({NUM_FINE_ANGLES * 4 / 1024:.1f} KB)')
+    print(f'  - Other quadrants and cosine via symmetry (finesine_at)')
+    print(f'  - Memory: {(NUM_FINE_ANGLES // 4 + 1) * 4} bytes ({(NUM_FINE_ANGLES // 4 + 1) * 4 / 1024:.1f} KB)')
     print(f'\n✓ Verification data: {verify_path}')
     print(f'\nNext steps:')
     print(f'  1. Verify accuracy: python tools/verify_trig_lut.py')